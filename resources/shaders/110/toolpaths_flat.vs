@@ -0,0 +1,16 @@
+#version 110
+
+uniform mat4 view_model_matrix;
+uniform mat4 projection_matrix;
+
+attribute vec3 v_position;
+
+// the flat normal is derived from the screen space derivatives of this in the fragment shader
+varying vec3 eye_position;
+
+void main()
+{
+    vec4 position = view_model_matrix * vec4(v_position, 1.0);
+    eye_position = position.xyz;
+    gl_Position = projection_matrix * position;
+}
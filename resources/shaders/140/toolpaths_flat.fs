@@ -0,0 +1,42 @@
+#version 140
+
+#define INTENSITY_CORRECTION 0.6
+
+// normalized values for (-0.6/1.31, 0.6/1.31, 1./1.31)
+const vec3 LIGHT_TOP_DIR = vec3(-0.4574957, 0.4574957, 0.7624929);
+#define LIGHT_TOP_DIFFUSE    (0.8 * INTENSITY_CORRECTION)
+#define LIGHT_TOP_SPECULAR   (0.125 * INTENSITY_CORRECTION)
+#define LIGHT_TOP_SHININESS  20.0
+
+// normalized values for (1./1.43, 0.2/1.43, 1./1.43)
+const vec3 LIGHT_FRONT_DIR = vec3(0.6985074, 0.1397015, 0.6985074);
+#define LIGHT_FRONT_DIFFUSE  (0.3 * INTENSITY_CORRECTION)
+
+#define INTENSITY_AMBIENT    0.3
+
+uniform vec4 uniform_color;
+uniform float emission_factor;
+
+in vec3 eye_position;
+
+void main()
+{
+    // The toolpath tubes are flat shaded per face, thus the geometric normal reconstructed from
+    // the screen space derivatives of the eye space position matches the per-face normals that
+    // the gouraud_light path computes per vertex, at half the vertex buffer size. It has to be
+    // derived in eye space, the light directions below are eye space constants.
+    vec3 normal = normalize(cross(dFdx(eye_position), dFdy(eye_position)));
+#ifdef FLIP_TRIANGLE_NORMALS
+    normal = -normal;
+#endif
+
+    // Same lighting model as gouraud_light, evaluated per fragment.
+    float NdotL = max(dot(normal, LIGHT_TOP_DIR), 0.0);
+    float intensity_tainted = INTENSITY_AMBIENT + NdotL * LIGHT_TOP_DIFFUSE;
+    float intensity_specular = LIGHT_TOP_SPECULAR * pow(max(dot(-normalize(eye_position), reflect(-LIGHT_TOP_DIR, normal)), 0.0), LIGHT_TOP_SHININESS);
+
+    NdotL = max(dot(normal, LIGHT_FRONT_DIR), 0.0);
+    intensity_tainted += NdotL * LIGHT_FRONT_DIFFUSE;
+
+    gl_FragColor = vec4(vec3(intensity_specular) + uniform_color.rgb * (intensity_tainted + emission_factor), uniform_color.a);
+}
@@ -312,6 +312,7 @@ static PrinterTechnology get_printer_technology(const DynamicConfig &config)
 #if defined(__linux__) || defined(__LINUX__)
 #define flush_and_exit(ret)     { boost::nowide::cout << __FUNCTION__ << " found error, return "<<ret<<", exit..." << std::endl;\
     g_cli_callback_mgr.stop();\
+    Slic3r::tracing::stop();\
     boost::nowide::cout.flush();\
     boost::nowide::cerr.flush();\
     for (Model &model : m_models) {\
@@ -320,6 +321,7 @@ static PrinterTechnology get_printer_technology(const DynamicConfig &config)
     return(ret);}
 #else
 #define flush_and_exit(ret)     { boost::nowide::cout << __FUNCTION__ << " found error, exit" << std::endl;\
+    Slic3r::tracing::stop();\
     boost::nowide::cout.flush();\
     boost::nowide::cerr.flush();\
     for (Model &model : m_models) {\
@@ -486,6 +488,13 @@ int CLI::run(int argc, char **argv)
         else {
             set_logging_level(2);
         }
+        if (m_config.opt_bool("deterministic"))
+            // Seed the remaining random generators with fixed constants, so release validation
+            // can byte-diff the output at any thread count.
+            set_deterministic_mode(true);
+        if (const std::string &trace_path = m_config.opt_string("trace_events"); ! trace_path.empty())
+            // Collect chrome://tracing events of this slice job, written out on exit.
+            tracing::start(trace_path);
     }
 
     BOOST_LOG_TRIVIAL(info) << "start_gui="<< start_gui << std::endl;
@@ -2074,6 +2083,11 @@ int CLI::run(int argc, char **argv)
                                         part_plate->set_tmp_gcode_path(outfile);
                                     }
                                     BOOST_LOG_TRIVIAL(info) << "process finished, will export gcode temporily to " << outfile << std::endl;
+                                    if (!export_slicedata)
+                                        // No milestone will be re-run on this plate and the slicing data cache
+                                        // will not be exported: free the per-layer geometry that the G-code
+                                        // export does not read, to lower the peak memory of large plates.
+                                        (dynamic_cast<Print*>(print))->release_intermediate_geometry();
                                     outfile = (dynamic_cast<Print*>(print))->export_gcode(outfile, gcode_result, nullptr);
                                     //outfile_final = (dynamic_cast<Print*>(print))->print_statistics().finalize_output_path(outfile);
                                     //m_fff_print->export_gcode(m_temp_output_path, m_gcode_result, [this](const ThumbnailsParams& params) { return this->render_thumbnails(params); });
@@ -2713,6 +2727,8 @@ int CLI::run(int argc, char **argv)
     for (Model &model : m_models) {
 	model.remove_backup_path_if_exist();
     }
+    // Write out the collected trace events of this job, if any.
+    tracing::stop();
     //BBS: flush logs
     BOOST_LOG_TRIVIAL(info) << __FUNCTION__ << ", Finished" << std::endl;
     boost::nowide::cout.flush();
@@ -2817,6 +2833,11 @@ void CLI::print_help(bool include_print_options, PrinterTechnology printer_techn
         << SLIC3R_APP_KEY <<"-"<< SoftFever_VERSION << ":"
         << std::endl
         << "Usage: orca-slicer [ OPTIONS ] [ file.3mf/file.stl ... ]" << std::endl
+#ifndef _WIN32
+        << "       orca-slicer --daemon <socket-path>" << std::endl
+        << "           Resident mode: accept newline terminated CLI job lines over the local" << std::endl
+        << "           socket and run them in-process, amortizing startup across jobs." << std::endl
+#endif
         << std::endl
         << "OPTIONS:" << std::endl;
     cli_misc_config_def.print_cli_help(boost::nowide::cout, false);
@@ -3000,8 +3021,131 @@ extern "C" {
     }
 }
 #else /* _MSC_VER */
+
+#include <cerrno>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+namespace {
+
+// Split a daemon job line into argv style tokens. Double quotes group words into one token,
+// a backslash escapes the next character.
+std::vector<std::string> tokenize_job_line(const std::string &line)
+{
+    std::vector<std::string> tokens;
+    std::string              current;
+    bool                     in_quotes = false;
+    bool                     has_token = false;
+    for (size_t i = 0; i < line.size(); ++ i) {
+        char c = line[i];
+        if (c == '\\' && i + 1 < line.size()) {
+            current += line[++ i];
+            has_token = true;
+        } else if (c == '"') {
+            in_quotes = ! in_quotes;
+            has_token = true;
+        } else if (! in_quotes && (c == ' ' || c == '\t')) {
+            if (has_token) {
+                tokens.emplace_back(std::move(current));
+                current.clear();
+                has_token = false;
+            }
+        } else {
+            current += c;
+            has_token = true;
+        }
+    }
+    if (has_token)
+        tokens.emplace_back(std::move(current));
+    return tokens;
+}
+
+// Resident daemon for print farms issuing many CLI slices: accepts newline terminated job
+// lines with the regular CLI arguments over a local stream socket and runs them in-process,
+// one at a time, replying "exit <code>\n" per job. Amortizes the per invocation startup cost
+// (dynamic linking, static initialization, TBB thread pool spin up, preset files entering the
+// page cache) across jobs. The job line "shutdown" stops the daemon.
+int run_cli_daemon(const std::string &socket_path)
+{
+    if (socket_path.empty()) {
+        boost::nowide::cerr << "Usage: " << SLIC3R_APP_KEY << " --daemon <socket-path>" << std::endl;
+        return 1;
+    }
+    sockaddr_un addr {};
+    if (socket_path.size() >= sizeof(addr.sun_path)) {
+        boost::nowide::cerr << "Daemon socket path too long: " << socket_path << std::endl;
+        return 1;
+    }
+    addr.sun_family = AF_UNIX;
+    memcpy(addr.sun_path, socket_path.c_str(), socket_path.size() + 1);
+    int listen_fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    if (listen_fd < 0) {
+        boost::nowide::cerr << "Cannot create daemon socket: " << strerror(errno) << std::endl;
+        return 1;
+    }
+    // A previous daemon instance may have left its socket file behind.
+    ::unlink(socket_path.c_str());
+    if (::bind(listen_fd, reinterpret_cast<const sockaddr*>(&addr), sizeof(addr)) != 0 ||
+        ::listen(listen_fd, 4) != 0) {
+        boost::nowide::cerr << "Cannot listen on daemon socket " << socket_path << ": " << strerror(errno) << std::endl;
+        ::close(listen_fd);
+        return 1;
+    }
+    // Spin up and name the TBB worker threads now, so the first job does not pay for it.
+    name_tbb_thread_pool_threads_set_locale();
+    BOOST_LOG_TRIVIAL(info) << "CLI daemon listening on " << socket_path;
+    bool shutdown = false;
+    while (! shutdown) {
+        int conn = ::accept(listen_fd, nullptr, nullptr);
+        if (conn < 0) {
+            if (errno == EINTR)
+                continue;
+            break;
+        }
+        std::string line;
+        char        buf[4096];
+        while (line.find('\n') == std::string::npos) {
+            ssize_t n = ::read(conn, buf, sizeof(buf));
+            if (n <= 0)
+                break;
+            line.append(buf, size_t(n));
+        }
+        if (size_t pos = line.find('\n'); pos != std::string::npos)
+            line.resize(pos);
+        if (! line.empty() && line.back() == '\r')
+            line.pop_back();
+        int code = 0;
+        if (line == "shutdown") {
+            shutdown = true;
+        } else {
+            std::vector<std::string> args = tokenize_job_line(line);
+            std::string              argv0 { SLIC3R_APP_KEY };
+            std::vector<char*>       argv_ptrs;
+            argv_ptrs.reserve(args.size() + 1);
+            argv_ptrs.emplace_back(argv0.data());
+            for (std::string &arg : args)
+                argv_ptrs.emplace_back(arg.data());
+            // A fresh CLI object keeps the per job configuration isolated while the process
+            // wide caches stay warm.
+            code = CLI().run(int(argv_ptrs.size()), argv_ptrs.data());
+        }
+        std::string reply = "exit " + std::to_string(code) + "\n";
+        if (::write(conn, reply.data(), reply.size()) < 0)
+            BOOST_LOG_TRIVIAL(warning) << "CLI daemon: cannot reply to the client: " << strerror(errno);
+        ::close(conn);
+    }
+    ::close(listen_fd);
+    ::unlink(socket_path.c_str());
+    return 0;
+}
+
+} // namespace
+
 int main(int argc, char **argv)
 {
+    if (argc >= 2 && strcmp(argv[1], "--daemon") == 0)
+        return run_cli_daemon(argc >= 3 ? argv[2] : std::string());
     return CLI().run(argc, argv);
 }
 #endif /* _MSC_VER */
@@ -34,6 +34,10 @@
 #define BOOST_POOL_NO_MT
 #include <boost/pool/object_pool.hpp>
 
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_reduce.h>
+#include <tbb/parallel_sort.h>
+
 #include "stl.h"
 
 struct HashEdge {
@@ -120,6 +124,42 @@ private:
 	}
 };
 
+// Connect edge_a with edge_b, update edge connection statistics.
+static void record_neighbors(stl_file *stl, const HashEdge &edge_a, const HashEdge &edge_b)
+{
+	// Facet a's neighbor is facet b
+	stl->neighbors_start[edge_a.facet_number].neighbor[edge_a.which_edge % 3] = edge_b.facet_number;	/* sets the .neighbor part */
+	stl->neighbors_start[edge_a.facet_number].which_vertex_not[edge_a.which_edge % 3] = (edge_b.which_edge + 2) % 3; /* sets the .which_vertex_not part */
+
+	// Facet b's neighbor is facet a
+	stl->neighbors_start[edge_b.facet_number].neighbor[edge_b.which_edge % 3] = edge_a.facet_number;	/* sets the .neighbor part */
+	stl->neighbors_start[edge_b.facet_number].which_vertex_not[edge_b.which_edge % 3] = (edge_a.which_edge + 2) % 3; /* sets the .which_vertex_not part */
+
+	if ((edge_a.which_edge < 3 && edge_b.which_edge < 3) || (edge_a.which_edge > 2 && edge_b.which_edge > 2)) {
+		// These facets are oriented in opposite directions, their normals are probably messed up.
+		stl->neighbors_start[edge_a.facet_number].which_vertex_not[edge_a.which_edge % 3] += 3;
+		stl->neighbors_start[edge_b.facet_number].which_vertex_not[edge_b.which_edge % 3] += 3;
+	}
+
+	// Count successful connects:
+	// Total connects:
+	stl->stats.connected_edges += 2;
+	// Count individual connects:
+	switch (stl->neighbors_start[edge_a.facet_number].num_neighbors()) {
+	case 1:	++ stl->stats.connected_facets_1_edge; break;
+	case 2: ++ stl->stats.connected_facets_2_edge; break;
+	case 3: ++ stl->stats.connected_facets_3_edge; break;
+	default: assert(false);
+	}
+	switch (stl->neighbors_start[edge_b.facet_number].num_neighbors()) {
+	case 1:	++ stl->stats.connected_facets_1_edge; break;
+	case 2: ++ stl->stats.connected_facets_2_edge; break;
+	case 3: ++ stl->stats.connected_facets_3_edge; break;
+	default: assert(false);
+	}
+}
+
+
 struct HashTableEdges {
 	HashTableEdges(size_t number_of_faces) {
 		this->M = (int)hash_size_from_nr_faces(number_of_faces);
@@ -239,41 +279,6 @@ private:
 	    return edge_a.facet_number != edge_b.facet_number && edge_a == edge_b;
 	}
 
-	// Connect edge_a with edge_b, update edge connection statistics.
-	static void record_neighbors(stl_file *stl, const HashEdge &edge_a, const HashEdge &edge_b)
-	{
-		// Facet a's neighbor is facet b
-		stl->neighbors_start[edge_a.facet_number].neighbor[edge_a.which_edge % 3] = edge_b.facet_number;	/* sets the .neighbor part */
-		stl->neighbors_start[edge_a.facet_number].which_vertex_not[edge_a.which_edge % 3] = (edge_b.which_edge + 2) % 3; /* sets the .which_vertex_not part */
-
-		// Facet b's neighbor is facet a
-		stl->neighbors_start[edge_b.facet_number].neighbor[edge_b.which_edge % 3] = edge_a.facet_number;	/* sets the .neighbor part */
-		stl->neighbors_start[edge_b.facet_number].which_vertex_not[edge_b.which_edge % 3] = (edge_a.which_edge + 2) % 3; /* sets the .which_vertex_not part */
-
-		if ((edge_a.which_edge < 3 && edge_b.which_edge < 3) || (edge_a.which_edge > 2 && edge_b.which_edge > 2)) {
-			// These facets are oriented in opposite directions, their normals are probably messed up.
-			stl->neighbors_start[edge_a.facet_number].which_vertex_not[edge_a.which_edge % 3] += 3;
-			stl->neighbors_start[edge_b.facet_number].which_vertex_not[edge_b.which_edge % 3] += 3;
-		}
-
-		// Count successful connects:
-		// Total connects:
-		stl->stats.connected_edges += 2;
-		// Count individual connects:
-		switch (stl->neighbors_start[edge_a.facet_number].num_neighbors()) {
-		case 1:	++ stl->stats.connected_facets_1_edge; break;
-		case 2: ++ stl->stats.connected_facets_2_edge; break;
-		case 3: ++ stl->stats.connected_facets_3_edge; break;
-		default: assert(false);
-		}
-		switch (stl->neighbors_start[edge_b.facet_number].num_neighbors()) {
-		case 1:	++ stl->stats.connected_facets_1_edge; break;
-		case 2: ++ stl->stats.connected_facets_2_edge; break;
-		case 3: ++ stl->stats.connected_facets_3_edge; break;
-		default: assert(false);
-		}
-	}
-
 	static void match_neighbors_nearby(stl_file *stl, const HashEdge &edge_a, const HashEdge &edge_b)
 	{
 		record_neighbors(stl, edge_a, edge_b);
@@ -454,21 +459,64 @@ void stl_check_facets_exact(stl_file *stl)
 		  	++ i;
   	}
 
-  	// Initialize hash table.
-  	HashTableEdges hash_table(stl->stats.number_of_facets);
 	for (auto &neighbor : stl->neighbors_start)
 		neighbor.reset();
 
-  	// Connect neighbor edges.
-	for (uint32_t i = 0; i < stl->stats.number_of_facets; ++ i) {
-		const stl_facet &facet = stl->facet_start[i];
-		for (int j = 0; j < 3; ++ j) {
-			HashEdge edge;
-			edge.facet_number = i;
-			edge.which_edge = j;
-			edge.load_exact(stl, &facet.vertex[j], &facet.vertex[(j + 1) % 3]);
-			hash_table.insert_edge_exact(stl, edge);
+	// Load the canonical keys of all edges in parallel, folding the shortest edge statistics
+	// over the workers. Matching is done by sorting instead of the former serial chained hash
+	// table: bitwise equal edges become adjacent in the sorted order.
+	const uint32_t number_of_facets = stl->stats.number_of_facets;
+	std::vector<HashEdge> edges(size_t(number_of_facets) * 3);
+	stl->stats.shortest_edge = tbb::parallel_reduce(
+		tbb::blocked_range<uint32_t>(0, number_of_facets),
+		stl->stats.shortest_edge,
+		[stl, &edges](const tbb::blocked_range<uint32_t> &range, float shortest_edge) -> float {
+			// load_exact() folds the shortest edge into the passed stats, collect it per task.
+			stl_file local;
+			local.stats.shortest_edge = shortest_edge;
+			for (uint32_t i = range.begin(); i < range.end(); ++ i) {
+				const stl_facet &facet = stl->facet_start[i];
+				for (int j = 0; j < 3; ++ j) {
+					HashEdge &edge = edges[size_t(i) * 3 + j];
+					edge.facet_number = i;
+					edge.which_edge = j;
+					edge.load_exact(&local, &facet.vertex[j], &facet.vertex[(j + 1) % 3]);
+				}
+			}
+			return local.stats.shortest_edge;
+		},
+		[](float l, float r) { return std::min(l, r); });
+
+	tbb::parallel_sort(edges.begin(), edges.end(),
+		[](const HashEdge &l, const HashEdge &r) { return memcmp(l.key, r.key, sizeof(l.key)) < 0; });
+
+	// Connect neighbor edges: pair up the edges inside each run of equal keys. A regular manifold
+	// edge produces a run of two, longer runs come from non-manifold geometry and are paired up
+	// greedily the same way the hash chains used to.
+	std::vector<size_t> pending;
+	for (size_t i = 0; i < edges.size();) {
+		size_t j = i + 1;
+		while (j < edges.size() && edges[j] == edges[i])
+			++ j;
+		if (j - i == 2) {
+			if (edges[i].facet_number != edges[i + 1].facet_number)
+				record_neighbors(stl, edges[i], edges[i + 1]);
+		} else if (j - i > 2) {
+			pending.clear();
+			for (size_t k = i; k < j; ++ k) {
+				bool matched = false;
+				for (auto it = pending.begin(); it != pending.end(); ++ it)
+					if (edges[*it].facet_number != edges[k].facet_number) {
+						record_neighbors(stl, edges[*it], edges[k]);
+						pending.erase(it);
+						matched = true;
+						break;
+					}
+				if (! matched)
+					pending.push_back(k);
+			}
 		}
+		i = j;
 	}
 
 #if 0
@@ -26,6 +26,9 @@
 #include <math.h>
 #include <assert.h>
 
+#include <algorithm>
+#include <vector>
+
 #include <boost/log/trivial.hpp>
 #include <boost/nowide/cstdio.hpp>
 #include <boost/predef/other/endian.h>
@@ -159,6 +162,39 @@ static bool stl_read(stl_file *stl, FILE *fp, int first_facet, bool first, Impor
 
 	uint32_t facets_num = stl->stats.number_of_facets;
 	uint32_t unit = facets_num / LOAD_STL_UNIT_NUM + 1;
+
+	if (stl->stats.type == binary) {
+		// Read the facets in large blocks instead of one fread() per 50 byte facet,
+		// the per call overhead of buffered stdio dominates the binary load otherwise.
+		static constexpr uint32_t facets_per_block = 65536;
+		std::vector<char> block(size_t(std::min(facets_per_block, facets_num)) * SIZEOF_STL_FACET);
+		for (uint32_t i = (uint32_t)first_facet; i < facets_num;) {
+			bool cb_cancel = false;
+			if (stlFn) {
+				stlFn(i, facets_num, cb_cancel);
+				if (cb_cancel)
+					return false;
+			}
+			uint32_t n = std::min(facets_per_block, facets_num - i);
+			if (fread(block.data(), SIZEOF_STL_FACET, n, fp) != n)
+				return false;
+			for (uint32_t j = 0; j < n; ++ j) {
+				stl_facet &facet = stl->facet_start[i + j];
+				// We assume little-endian architecture!
+				memcpy(&facet, block.data() + size_t(j) * SIZEOF_STL_FACET, SIZEOF_STL_FACET);
+#if BOOST_ENDIAN_BIG_BYTE
+				// Convert the loaded little endian data to big endian.
+				stl_internal_reverse_quads((char*)&facet, 48);
+#endif /* BOOST_ENDIAN_BIG_BYTE */
+				stl_facet_stats(stl, facet, first);
+			}
+			i += n;
+		}
+		stl->stats.size = stl->stats.max - stl->stats.min;
+		stl->stats.bounding_diameter = stl->stats.size.norm();
+		return true;
+	}
+
     for (uint32_t i = first_facet; i < facets_num; ++ i) {
 		if ((i % unit) == 0) {
 				bool cb_cancel = false;
@@ -171,15 +207,7 @@ static bool stl_read(stl_file *stl, FILE *fp, int first_facet, bool first, Impor
 
   	  	stl_facet facet;
 
-    	if (stl->stats.type == binary) {
-      		// Read a single facet from a binary .STL file. We assume little-endian architecture!
-      		if (fread(&facet, 1, SIZEOF_STL_FACET, fp) != SIZEOF_STL_FACET)
-      			return false;
-#if BOOST_ENDIAN_BIG_BYTE
-      		// Convert the loaded little endian data to big endian.
-      		stl_internal_reverse_quads((char*)&facet, 48);
-#endif /* BOOST_ENDIAN_BIG_BYTE */
-    	} else {
+    	{
 			// Read a single facet from an ASCII .STL file
 			// skip solid/endsolid
 			// (in this order, otherwise it won't work when they are paired in the middle of a file)
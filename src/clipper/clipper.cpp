@@ -39,6 +39,7 @@
 *******************************************************************************/
 
 #include "clipper.hpp"
+#include <atomic>
 #include <cmath>
 #include <vector>
 #include <algorithm>
@@ -1180,6 +1181,62 @@ bool Clipper::ExecuteInternal()
 }
 //------------------------------------------------------------------------------
 
+namespace {
+
+// Per-thread recycling pools of the Clipper output structures. The slicing milestones issue
+// millions of short lived Clipper operations from the worker threads, each of them allocating
+// its OutPt chunks and OutRec nodes just to release them a moment later. The blocks released
+// by DisposeAllOutRecs() are parked here and handed out again to the next operation running
+// on the same thread, bypassing the system allocator and its lock.
+struct OutputStructuresPool
+{
+  // Bounds keep a long lived worker thread from hoarding memory after a spike:
+  // 256 chunks of 32 OutPts and 1024 OutRecs are tens of kilobytes per thread.
+  static constexpr const size_t max_outpt_chunks = 256;
+  static constexpr const size_t max_outrecs      = 1024;
+  std::vector<OutPt*>  outpt_chunks;
+  std::vector<OutRec*> outrecs;
+  ~OutputStructuresPool() {
+    for (OutPt *chunk : outpt_chunks)
+      delete[] chunk;
+    for (OutRec *rec : outrecs)
+      delete rec;
+  }
+};
+
+OutputStructuresPool& output_structures_pool()
+{
+  static thread_local OutputStructuresPool pool;
+  return pool;
+}
+
+// Pool hit rates surfaced by pool_stats(). Aggregated over all threads, thus atomic,
+// while relaxed increments keep them off the hot path's critical dependencies.
+std::atomic<size_t> s_outpt_chunk_hits{0};
+std::atomic<size_t> s_outpt_chunk_misses{0};
+std::atomic<size_t> s_outrec_hits{0};
+std::atomic<size_t> s_outrec_misses{0};
+
+} // end of anonymous namespace
+
+PoolStats pool_stats()
+{
+  return PoolStats {
+    s_outpt_chunk_hits.load(std::memory_order_relaxed),
+    s_outpt_chunk_misses.load(std::memory_order_relaxed),
+    s_outrec_hits.load(std::memory_order_relaxed),
+    s_outrec_misses.load(std::memory_order_relaxed)
+  };
+}
+
+void reset_pool_stats()
+{
+  s_outpt_chunk_hits.store(0, std::memory_order_relaxed);
+  s_outpt_chunk_misses.store(0, std::memory_order_relaxed);
+  s_outrec_hits.store(0, std::memory_order_relaxed);
+  s_outrec_misses.store(0, std::memory_order_relaxed);
+}
+
 OutPt* Clipper::AllocateOutPt()
 {
   OutPt *pt;
@@ -1191,8 +1248,17 @@ OutPt* Clipper::AllocateOutPt()
     // Get a point from the last chunk.
     pt = m_OutPts.back() + (m_OutPtsChunkLast ++);
   } else {
-    // The last chunk is full. Allocate a new one.
-    m_OutPts.push_back(new OutPt[m_OutPtsChunkSize]);
+    // The last chunk is full. Take a chunk recycled from an earlier operation on this thread
+    // or allocate a new one.
+    auto &pool = output_structures_pool();
+    if (! pool.outpt_chunks.empty()) {
+      m_OutPts.push_back(pool.outpt_chunks.back());
+      pool.outpt_chunks.pop_back();
+      s_outpt_chunk_hits.fetch_add(1, std::memory_order_relaxed);
+    } else {
+      m_OutPts.push_back(new OutPt[m_OutPtsChunkSize]);
+      s_outpt_chunk_misses.fetch_add(1, std::memory_order_relaxed);
+    }
     m_OutPtsChunkLast = 1;
     pt = m_OutPts.back();
   }
@@ -1201,10 +1267,18 @@ OutPt* Clipper::AllocateOutPt()
 
 void Clipper::DisposeAllOutRecs()
 {
+  // Park the released blocks in the per-thread pool up to its bounds, see OutputStructuresPool.
+  auto &pool = output_structures_pool();
   for (OutPt *pts : m_OutPts)
-    delete[] pts;
+    if (pool.outpt_chunks.size() < OutputStructuresPool::max_outpt_chunks)
+      pool.outpt_chunks.push_back(pts);
+    else
+      delete[] pts;
   for (OutRec *rec : m_PolyOuts)
-    delete rec;
+    if (pool.outrecs.size() < OutputStructuresPool::max_outrecs)
+      pool.outrecs.push_back(rec);
+    else
+      delete rec;
   m_OutPts.clear();
   m_OutPtsFree = nullptr;
   m_OutPtsChunkLast = m_OutPtsChunkSize;
@@ -1988,7 +2062,17 @@ void Clipper::AppendPolygon(TEdge *e1, TEdge *e2) const
 
 OutRec* Clipper::CreateOutRec()
 {
-  OutRec* result = new OutRec;
+  OutRec* result;
+  auto &pool = output_structures_pool();
+  if (! pool.outrecs.empty()) {
+    // Recycle an OutRec released by an earlier operation on this thread.
+    result = pool.outrecs.back();
+    pool.outrecs.pop_back();
+    s_outrec_hits.fetch_add(1, std::memory_order_relaxed);
+  } else {
+    result = new OutRec;
+    s_outrec_misses.fetch_add(1, std::memory_order_relaxed);
+  }
   result->IsHole = false;
   result->IsOpen = false;
   result->FirstLeft = 0;
@@ -211,6 +211,18 @@ void OpenPathsFromPolyTree(PolyTree& polytree, Paths& paths);
 void ReversePath(Path& p);
 void ReversePaths(Paths& p);
 
+// Hit rates of the per-thread recycling pools of the Clipper output structures,
+// aggregated over all threads. A hit reuses a block released by an earlier operation
+// on the same thread, a miss goes to the system allocator.
+struct PoolStats {
+  size_t outpt_chunk_hits;
+  size_t outpt_chunk_misses;
+  size_t outrec_hits;
+  size_t outrec_misses;
+};
+PoolStats pool_stats();
+void reset_pool_stats();
+
 struct IntRect { cInt left; cInt top; cInt right; cInt bottom; };
 
 //enums that are used internally ...
@@ -8,6 +8,9 @@
 #include <iterator>
 #include <future>
 #include <atomic>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
 
 #ifndef NDEBUG
 #include <iostream>
@@ -454,6 +457,57 @@ private:
     int plate_id = 0;   // BBS
     Pile merged_pile_;
 
+    // Memoization of pairwise no-fit polygons. The NFP shape only depends on the
+    // two hulls modulo translation (correctNfpPosition re-anchors it afterwards),
+    // so the cache is keyed by translation invariant hashes of the transformed
+    // shapes and identical hulls (e.g. many copies of the same part on a plate)
+    // share a single entry. The cache is shared between copies of the placer.
+    using NfpKey = std::pair<size_t, size_t>;
+    struct NfpKeyHash {
+        size_t operator()(const NfpKey& k) const {
+            return k.first ^ (k.second * size_t(0x9e3779b97f4a7c15ULL));
+        }
+    };
+    struct NfpCache {
+        std::mutex mtx;
+        std::unordered_map<NfpKey, nfp::NfpResult<RawShape>, NfpKeyHash> map;
+    };
+    std::shared_ptr<NfpCache> nfpcache_ = std::make_shared<NfpCache>();
+
+    // FNV-1a over the contour vertices relative to the first one, so that the
+    // hash is invariant to the shape's translation but not to its rotation.
+    static size_t shape_hash(const RawShape& sh)
+    {
+        static const size_t fnv_prime = size_t(0x100000001b3ULL);
+        size_t h = size_t(0xcbf29ce484222325ULL);
+        auto combine = [&h](long long v) {
+            h = (h ^ size_t(v)) * fnv_prime;
+        };
+        auto it = sl::cbegin(sh), end = sl::cend(sh);
+        if (it == end) return h;
+        const auto ref = *it;
+        combine(static_cast<long long>(std::distance(it, end)));
+        for (; it != end; ++it) {
+            combine(static_cast<long long>(getX(*it) - getX(ref)));
+            combine(static_cast<long long>(getY(*it) - getY(ref)));
+        }
+        return h;
+    }
+
+    template<class GetNfp>
+    nfp::NfpResult<RawShape> memoized_nfp(const NfpKey& key, GetNfp&& getnfp)
+    {
+        {
+            std::lock_guard<std::mutex> lk(nfpcache_->mtx);
+            auto it = nfpcache_->map.find(key);
+            if (it != nfpcache_->map.end())
+                return it->second;
+        }
+        nfp::NfpResult<RawShape> res = getnfp();
+        std::lock_guard<std::mutex> lk(nfpcache_->mtx);
+        return nfpcache_->map.emplace(key, std::move(res)).first->second;
+    }
+
 public:
 
     inline explicit _NofitPolyPlacer(const BinType& bin):
@@ -598,12 +652,15 @@ private:
         }
         // /////////////////////////////////////////////////////////////////////
 
+        const size_t orb_hash = shape_hash(trsh.transformedShape());
         __parallel::enumerate(items_.begin(), items_.end(),
-                              [&nfps, &trsh](const Item& sh, size_t n)
+                              [this, &nfps, &trsh, orb_hash](const Item& sh, size_t n)
         {
             auto& fixedp = sh.transformedShape();
             auto& orbp = trsh.transformedShape();
-            auto subnfp_r = noFitPolygon<NfpLevel::CONVEX_ONLY>(fixedp, orbp);
+            auto subnfp_r = memoized_nfp({shape_hash(fixedp), orb_hash}, [&fixedp, &orbp]() {
+                return noFitPolygon<NfpLevel::CONVEX_ONLY>(fixedp, orbp);
+            });
             correctNfpPosition(subnfp_r, sh, trsh);
             nfps[n] = subnfp_r.first;
         });
@@ -619,8 +676,11 @@ private:
         Shapes nfps(stationarys.size());
         Item   slidingItem(sliding);
         slidingItem.transformedShape();
-        __parallel::enumerate(stationarys.begin(), stationarys.end(), [&nfps, sliding, &slidingItem](const RawShape &stationary, size_t n) {
-            auto subnfp_r = noFitPolygon<NfpLevel::CONVEX_ONLY>(stationary, sliding);
+        const size_t orb_hash = shape_hash(sliding);
+        __parallel::enumerate(stationarys.begin(), stationarys.end(), [this, &nfps, sliding, &slidingItem, orb_hash](const RawShape &stationary, size_t n) {
+            auto subnfp_r = memoized_nfp({shape_hash(stationary), orb_hash}, [&stationary, &sliding]() {
+                return noFitPolygon<NfpLevel::CONVEX_ONLY>(stationary, sliding);
+            });
             correctNfpPosition(subnfp_r, stationary, slidingItem);
             nfps[n] = subnfp_r.first;
         });
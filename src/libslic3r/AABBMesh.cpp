@@ -177,6 +177,33 @@ AABBMesh::query_ray_hit(const Vec3d &s, const Vec3d &dir) const
     return ret;
 }
 
+std::vector<AABBMesh::hit_result>
+AABBMesh::query_ray_hits_batch(const std::vector<Vec3d> &sources,
+                               const std::vector<Vec3d> &dirs) const
+{
+    assert(sources.size() == dirs.size());
+    std::vector<hit_result> out(sources.size(), hit_result(*this));
+
+    // Group rays by direction octant: coherent rays descend into mostly the same subtrees,
+    // thus processing them back to back keeps the upper levels of the flat node array in cache.
+    std::vector<size_t> order(sources.size());
+    std::iota(order.begin(), order.end(), size_t(0));
+    auto octant = [&dirs](size_t i) {
+        const Vec3d &d = dirs[i];
+        return int(d.x() < 0.) | (int(d.y() < 0.) << 1) | (int(d.z() < 0.) << 2);
+    };
+    std::stable_sort(order.begin(), order.end(),
+                     [&octant](size_t a, size_t b) { return octant(a) < octant(b); });
+
+    execution::for_each(ex_tbb, size_t(0), order.size(),
+        [this, &order, &sources, &dirs, &out](size_t k) {
+            const size_t i = order[k];
+            out[i] = this->query_ray_hit(sources[i], dirs[i]);
+        }, 64);
+
+    return out;
+}
+
 std::vector<AABBMesh::hit_result>
 AABBMesh::query_ray_hits(const Vec3d &s, const Vec3d &dir) const
 {
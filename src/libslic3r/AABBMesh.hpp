@@ -120,6 +120,13 @@ public:
     // Casts a ray on the mesh and returns all hits
     std::vector<hit_result> query_ray_hits(const Vec3d &s, const Vec3d &dir) const;
 
+    // Batched variant of query_ray_hit(): intersect all rays of the batch, first hit per ray.
+    // Rays are grouped by direction octant and traversed in parallel, so coherent rays
+    // (e.g. SLA support sampling firing millions of mostly downward rays) visit largely the
+    // same AABB nodes while they are hot in cache. Results are returned in input order.
+    std::vector<hit_result> query_ray_hits_batch(const std::vector<Vec3d> &sources,
+                                                 const std::vector<Vec3d> &dirs) const;
+
     double squared_distance(const Vec3d& p, int& i, Vec3d& c) const;
     inline double squared_distance(const Vec3d &p) const
     {
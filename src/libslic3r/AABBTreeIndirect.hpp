@@ -71,7 +71,7 @@ public:
 		}
     };
 
-	void clear() { m_nodes.clear(); }
+	void clear() { m_nodes.clear(); m_built_measure = 0.; }
 
 	// SourceNode shall implement
 	// size_t SourceNode::idx() const
@@ -98,9 +98,57 @@ public:
 			// Allocate enough memory for a full binary tree.
             m_nodes.assign(next_highest_power_of_2(input.size()) * 2 - 1, Node());
             build_recursive(input, 0, 0, input.size() - 1);
+            // Remember the bounding volume quality of the freshly built tree, see rebuild_suggested().
+            m_built_measure = this->bbox_measure();
 		}
 	}
 
+	// Refit the tree after some primitives moved: recompute the leaf bounding boxes with
+	// leaf_bbox_fn(size_t entity_idx) -> BoundingBox and propagate the unions bottom-up,
+	// keeping the original topology. A single O(n) sweep over the flat node array, much cheaper
+	// than a full rebuild at the cost of possibly degraded bounding volume quality.
+	// If dirty_leaf_mask is provided (indexed by the external entity index), only the flagged
+	// leaves are recomputed and unions are only propagated along the paths that actually changed.
+	template<typename LeafBoundingBoxFn>
+	void refit(LeafBoundingBoxFn leaf_bbox_fn, const std::vector<bool> *dirty_leaf_mask = nullptr)
+	{
+		if (m_nodes.empty())
+			return;
+		// The implicit power of two layout stores children behind their parent,
+		// thus a reverse sweep visits children before parents.
+		std::vector<bool> changed(dirty_leaf_mask == nullptr ? 0 : m_nodes.size(), false);
+		for (size_t i = m_nodes.size(); i -- > 0; ) {
+			Node &node = m_nodes[i];
+			if (! node.is_valid())
+				continue;
+			if (node.is_leaf()) {
+				if (dirty_leaf_mask == nullptr || (node.idx < dirty_leaf_mask->size() && (*dirty_leaf_mask)[node.idx])) {
+					node.bbox = leaf_bbox_fn(node.idx);
+					if (dirty_leaf_mask != nullptr)
+						changed[i] = true;
+				}
+			} else {
+				const size_t left  = left_child_idx(i);
+				const size_t right = right_child_idx(i);
+				if (dirty_leaf_mask != nullptr && ! changed[left] && ! changed[right])
+					continue;
+				BoundingBox bbox = m_nodes[left].bbox;
+				bbox.extend(m_nodes[right].bbox);
+				node.bbox = bbox;
+				if (dirty_leaf_mask != nullptr)
+					changed[i] = true;
+			}
+		}
+	}
+
+	// Deferred rebuild heuristic: refitting keeps the topology fixed, thus repeated edits inflate
+	// the inner bounding boxes and traversal quality degrades. Suggest a full rebuild once the
+	// accumulated bounding box measure exceeds the freshly built one by the given relative threshold.
+	bool rebuild_suggested(double degradation_threshold = 0.3) const
+	{
+		return m_built_measure > 0. && this->bbox_measure() > m_built_measure * (1. + degradation_threshold);
+	}
+
 	const std::vector<Node>& 	nodes() const { return m_nodes; }
 	const Node& 				node(size_t idx) const { return m_nodes[idx]; }
 	bool 						empty() const { return m_nodes.empty(); }
@@ -209,8 +257,21 @@ private:
 		}
 	}
 
+	// Sum of the inner node bounding box extents, a cheap proxy of the bounding volume quality
+	// for the deferred rebuild heuristic.
+	double bbox_measure() const
+	{
+		double measure = 0.;
+		for (const Node &node : m_nodes)
+			if (node.is_inner())
+				measure += double(node.bbox.diagonal().template cast<double>().norm());
+		return measure;
+	}
+
 	// The balanced tree storage.
 	std::vector<Node> m_nodes;
+	// Bounding volume measure right after the last full build, zero for an empty tree.
+	double 			  m_built_measure { 0. };
 };
 
 using Tree2f = Tree<2, float>;
@@ -716,6 +777,37 @@ inline Tree<3, typename VertexType::Scalar> build_aabb_tree_over_indexed_triangl
 	return out;
 }
 
+// Refit an AABB tree built by build_aabb_tree_over_indexed_triangle_set() after vertices moved.
+// Topology of the tree and of the triangle set must be unchanged. If dirty_faces is provided,
+// only the flagged faces are recomputed, see Tree::refit(). Call Tree::rebuild_suggested()
+// once in a while to detect when the refitted tree degraded enough to warrant a full rebuild.
+template<typename VertexType, typename IndexedFaceType>
+inline void refit_aabb_tree_over_indexed_triangle_set(
+	Tree<3, typename VertexType::Scalar>	&tree,
+	// Indexed triangle set - 3D vertices.
+	const std::vector<VertexType> 			&vertices,
+	// Indexed triangle set - triangular faces, references to vertices.
+	const std::vector<IndexedFaceType> 		&faces,
+	// Epsilon applied when building the tree, shall match the build_aabb_tree_over_indexed_triangle_set() call.
+	const typename VertexType::Scalar 		 eps = 0,
+	const std::vector<bool> 				*dirty_faces = nullptr)
+{
+	using TreeType 	  = Tree<3, typename VertexType::Scalar>;
+	using VectorType  = typename TreeType::VectorType;
+	using BoundingBox = typename TreeType::BoundingBox;
+
+	const VectorType veps(eps, eps, eps);
+	tree.refit([&vertices, &faces, &veps](size_t face_idx) {
+		const IndexedFaceType &face = faces[face_idx];
+		BoundingBox bbox(vertices[face(0)], vertices[face(0)]);
+		bbox.extend(vertices[face(1)]);
+		bbox.extend(vertices[face(2)]);
+		bbox.min() -= veps;
+		bbox.max() += veps;
+		return bbox;
+	}, dirty_faces);
+}
+
 // Find a first intersection of a ray with indexed triangle set.
 // Intersection test is calculated with the accuracy of VectorType::Scalar
 // even if the triangle mesh and the AABB Tree are built with floats.
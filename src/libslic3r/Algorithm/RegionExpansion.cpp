@@ -11,6 +11,9 @@
 
 #include <numeric>
 
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+
 namespace Slic3r {
 namespace Algorithm {
 
@@ -384,28 +387,55 @@ static Polygons propagate_wave_from_boundary(
     // Now offset the remaining 
     for (size_t ioffset = 0; ioffset < num_other_steps; ++ ioffset)
         polygons = wavefront_clip(wavefront_step(co, polygons, other_step), clipping);
-    return to_polygons(polygons);
+    // ClipperLib::Paths shares the point type with Slic3r::Points, thus the contours can be moved.
+    return to_polygons(std::move(polygons));
 }
 
 // Resulting regions are sorted by boundary id and source id.
 std::vector<RegionExpansion> propagate_waves(const WaveSeeds &seeds, const ExPolygons &boundary, const RegionExpansionParameters &params)
 {
+    // Split the seeds into (boundary, src) groups. Each group expands into its
+    // own boundary island independently of the other groups.
+    struct SeedGroup { size_t begin, end; };
+    std::vector<SeedGroup> groups;
+    for (size_t i = 0; i < seeds.size();) {
+        size_t j = i + 1;
+        for (; j < seeds.size() && seeds[j].boundary == seeds[i].boundary && seeds[j].src == seeds[i].src; ++ j);
+        groups.push_back({ i, j });
+        i = j;
+    }
+
+    // Propagate the wavefronts of the independent groups in parallel, while
+    // clipping them with their trimmed boundaries. The results are collected
+    // per group and concatenated in group order afterwards, thus the output
+    // keeps the deterministic ordering of the serial algorithm regardless of
+    // the task scheduling.
+    std::vector<Polygons> expanded(groups.size());
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, groups.size()),
+        [&seeds, &boundary, &params, &groups, &expanded](const tbb::blocked_range<size_t> &range) {
+        // The offsetter and the seed path buffer are reused by all groups
+        // processed by this task.
+        ClipperLib::ClipperOffset co;
+        co.ArcTolerance       = params.arc_tolerance;
+        co.ShortestEdgeLength = params.shortest_edge_length;
+        ClipperLib::Paths paths;
+        for (size_t group_idx = range.begin(); group_idx < range.end(); ++ group_idx) {
+            const SeedGroup &group = groups[group_idx];
+            paths.clear();
+            for (size_t i = group.begin; i < group.end; ++ i)
+                paths.emplace_back(seeds[i].path);
+            expanded[group_idx] = propagate_wave_from_boundary(co, paths, boundary[seeds[group.begin].boundary],
+                params.initial_step, params.other_step, params.num_other_steps, params.max_inflation);
+        }
+    });
+
     std::vector<RegionExpansion> out;
-    ClipperLib::Paths            paths;
-    ClipperLib::ClipperOffset co;
-    co.ArcTolerance       = params.arc_tolerance;
-    co.ShortestEdgeLength = params.shortest_edge_length;
-    for (auto it_seed = seeds.begin(); it_seed != seeds.end();) {
-        auto it = it_seed;
-        paths.clear();
-        for (; it != seeds.end() && it->boundary == it_seed->boundary && it->src == it_seed->src; ++ it)
-            paths.emplace_back(it->path);
-        // Propagate the wavefront while clipping it with the trimmed boundary.
-        // Collect the expanded polygons, merge them with the source polygons.
-        RegionExpansion re;
-        for (Polygon &polygon : propagate_wave_from_boundary(co, paths, boundary[it_seed->boundary], params.initial_step, params.other_step, params.num_other_steps, params.max_inflation))
-            out.push_back({ std::move(polygon), it_seed->src, it_seed->boundary });
-        it_seed = it;
+    out.reserve(std::accumulate(expanded.begin(), expanded.end(), size_t(0),
+        [](const size_t acc, const Polygons &polygons) { return acc + polygons.size(); }));
+    for (size_t group_idx = 0; group_idx < groups.size(); ++ group_idx) {
+        const WaveSeed &seed = seeds[groups[group_idx].begin];
+        for (Polygon &polygon : expanded[group_idx])
+            out.push_back({ std::move(polygon), seed.src, seed.boundary });
     }
 
     return out;
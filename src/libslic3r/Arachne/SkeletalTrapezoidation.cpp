@@ -441,12 +441,14 @@ SkeletalTrapezoidation::SkeletalTrapezoidation(const Polygons& polys, const Bead
                                                double transitioning_angle, coord_t discretization_step_size,
                                                coord_t transition_filter_dist, coord_t allowed_filter_deviation,
                                                coord_t beading_propagation_transition_dist
+    , std::function<void()> throw_on_cancel
     ): transitioning_angle(transitioning_angle),
     discretization_step_size(discretization_step_size),
     transition_filter_dist(transition_filter_dist),
     allowed_filter_deviation(allowed_filter_deviation),
     beading_propagation_transition_dist(beading_propagation_transition_dist),
-    beading_strategy(beading_strategy)
+    beading_strategy(beading_strategy),
+    throw_on_cancel(std::move(throw_on_cancel))
 {
     constructFromPolygons(polys);
 }
@@ -573,6 +575,35 @@ inline static void rotate_back_skeletal_trapezoidation_graph_after_fix(SkeletalT
     }
 }
 
+// Cache of the Voronoi diagram constructed from the most recently processed segment set on this thread.
+// Consecutive layers of prismatic models slice to bitwise identical outlines and TBB hands consecutive
+// layers to a worker in blocks, thus reusing the previous layer's diagram skips the Voronoi construction,
+// the single most expensive step of Arachne on such models. The boost::polygon sweepline diagram cannot
+// be updated in place, therefore the cached diagram is only reused when the segment end points match
+// exactly, verified by a hash first and a full comparison after. The cache is invalidated whenever the
+// degenerated diagram fix reconstructs the diagram from rotated input, as the cached diagram then no
+// longer corresponds to its key.
+struct CachedVoronoiDiagram
+{
+    // Segment end points (from, to) flattened in the segment order, forming the cache key.
+    Points                   segment_endpoints;
+    uint64_t                 segment_hash { 0 };
+    Geometry::VoronoiDiagram diagram;
+    bool                     valid { false };
+};
+
+// FNV-1a over the raw coordinates.
+static uint64_t hash_segment_endpoints(const Points &endpoints)
+{
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    for (const Point &pt : endpoints)
+        for (const coord_t coord : { pt.x(), pt.y() }) {
+            hash ^= uint64_t(coord);
+            hash *= 0x100000001b3ULL;
+        }
+    return hash;
+}
+
 void SkeletalTrapezoidation::constructFromPolygons(const Polygons& polys)
 {
 #ifdef ARACHNE_DEBUG
@@ -604,8 +635,23 @@ void SkeletalTrapezoidation::constructFromPolygons(const Polygons& polys)
     }
 #endif
 
-    Geometry::VoronoiDiagram voronoi_diagram;
-    construct_voronoi(segments.begin(), segments.end(), &voronoi_diagram);
+    static thread_local CachedVoronoiDiagram voronoi_cache;
+    Points segment_endpoints;
+    segment_endpoints.reserve(2 * segments.size());
+    for (const Segment &segment : segments) {
+        segment_endpoints.emplace_back(segment.from());
+        segment_endpoints.emplace_back(segment.to());
+    }
+    const uint64_t            segment_hash    = hash_segment_endpoints(segment_endpoints);
+    Geometry::VoronoiDiagram &voronoi_diagram = voronoi_cache.diagram;
+    if (! voronoi_cache.valid || voronoi_cache.segment_hash != segment_hash || voronoi_cache.segment_endpoints != segment_endpoints) {
+        voronoi_diagram.clear();
+        construct_voronoi(segments.begin(), segments.end(), &voronoi_diagram);
+        voronoi_cache.segment_endpoints = std::move(segment_endpoints);
+        voronoi_cache.segment_hash      = segment_hash;
+        voronoi_cache.valid             = true;
+    }
+    throwOnCancel();
 
 #ifdef ARACHNE_DEBUG_VORONOI
     {
@@ -633,6 +679,8 @@ void SkeletalTrapezoidation::constructFromPolygons(const Polygons& polys)
             BOOST_LOG_TRIVIAL(warning) << "Detected non-planar Voronoi diagram, input polygons will be rotated back and forth.";
 
         vertex_mapping = try_to_fix_degenerated_voronoi_diagram_by_rotation(voronoi_diagram, polys, polys_copy, segments, fix_angle);
+        // The diagram was reconstructed from rotated input, it no longer corresponds to the cache key.
+        voronoi_cache.valid = false;
 
         assert(!detect_missing_voronoi_vertex(voronoi_diagram, segments));
         assert(Geometry::VoronoiUtilsCgal::is_voronoi_diagram_planar_angle(voronoi_diagram));
@@ -646,7 +694,11 @@ void SkeletalTrapezoidation::constructFromPolygons(const Polygons& polys)
 
 process_voronoi_diagram:
     assert(this->graph.edges.empty() && this->graph.nodes.empty() && this->vd_edge_to_he_edge.empty() && this->vd_node_to_he_node.empty());
+    size_t cells_processed = 0;
     for (vd_t::cell_type cell : voronoi_diagram.cells()) {
+        // Check for cancellation at a bounded interval, complex layers may have millions of cells.
+        if ((++ cells_processed % 1024) == 0)
+            throwOnCancel();
         if (!cell.incident_edge())
             continue; // There is no spoon
 
@@ -709,6 +761,8 @@ process_voronoi_diagram:
         BOOST_LOG_TRIVIAL(warning) << "Detected degenerated Voronoi diagram, input polygons will be rotated back and forth.";
         degenerated_voronoi_diagram = true;
         vertex_mapping = try_to_fix_degenerated_voronoi_diagram_by_rotation(voronoi_diagram, polys, polys_copy, segments, fix_angle);
+        // The diagram was reconstructed from rotated input, it no longer corresponds to the cache key.
+        voronoi_cache.valid = false;
 
         assert(!detect_missing_voronoi_vertex(voronoi_diagram, segments));
         if (detect_missing_voronoi_vertex(voronoi_diagram, segments))
@@ -798,6 +852,7 @@ void SkeletalTrapezoidation::generateToolpaths(std::vector<VariableWidthLines> &
     export_graph_to_svg(debug_out_path("ST-updateIsCentral-final-%d.svg", iRun), this->graph, this->outline);
 #endif
 
+    throwOnCancel();
     filterCentral(central_filter_dist);
 
 #ifdef ARACHNE_DEBUG
@@ -807,30 +862,35 @@ void SkeletalTrapezoidation::generateToolpaths(std::vector<VariableWidthLines> &
     if (filter_outermost_central_edges)
         filterOuterCentral();
 
+    throwOnCancel();
     updateBeadCount();
 
 #ifdef ARACHNE_DEBUG
     export_graph_to_svg(debug_out_path("ST-updateBeadCount-final-%d.svg", iRun), this->graph, this->outline);
 #endif
 
+    throwOnCancel();
     filterNoncentralRegions();
 
 #ifdef ARACHNE_DEBUG
     export_graph_to_svg(debug_out_path("ST-filterNoncentralRegions-final-%d.svg", iRun), this->graph, this->outline);
 #endif
 
+    throwOnCancel();
     generateTransitioningRibs();
 
 #ifdef ARACHNE_DEBUG
     export_graph_to_svg(debug_out_path("ST-generateTransitioningRibs-final-%d.svg", iRun), this->graph, this->outline);
 #endif
 
+    throwOnCancel();
     generateExtraRibs();
 
 #ifdef ARACHNE_DEBUG
     export_graph_to_svg(debug_out_path("ST-generateExtraRibs-final-%d.svg", iRun), this->graph, this->outline);
 #endif
 
+    throwOnCancel();
     generateSegments();
 
 #ifdef ARACHNE_DEBUG
@@ -1756,6 +1816,9 @@ void SkeletalTrapezoidation::generateSegments()
     });
 
     ptr_vector_t<BeadingPropagation> node_beadings;
+    // One beading per graph node at most before propagation; reserving up front keeps the
+    // propagation passes below from reallocating the pointer array on dense layers.
+    node_beadings.reserve(graph.nodes.size());
     { // Store beading
         for (node_t& node : graph.nodes)
         {
@@ -1765,7 +1828,7 @@ void SkeletalTrapezoidation::generateSegments()
             }
             if (node.data.transition_ratio == 0)
             {
-                node_beadings.emplace_back(new BeadingPropagation(beading_strategy.compute(node.data.distance_to_boundary * 2, node.data.bead_count)));
+                node_beadings.emplace_back(std::make_shared<BeadingPropagation>(beading_strategy.compute(node.data.distance_to_boundary * 2, node.data.bead_count)));
                 node.data.setBeading(node_beadings.back());
                 assert(node_beadings.back()->beading.total_thickness == node.data.distance_to_boundary * 2);
                 if(node_beadings.back()->beading.total_thickness != node.data.distance_to_boundary * 2)
@@ -1778,7 +1841,7 @@ void SkeletalTrapezoidation::generateSegments()
                 Beading low_count_beading = beading_strategy.compute(node.data.distance_to_boundary * 2, node.data.bead_count);
                 Beading high_count_beading = beading_strategy.compute(node.data.distance_to_boundary * 2, node.data.bead_count + 1);
                 Beading merged = interpolate(low_count_beading, 1.0 - node.data.transition_ratio, high_count_beading);
-                node_beadings.emplace_back(new BeadingPropagation(merged));
+                node_beadings.emplace_back(std::make_shared<BeadingPropagation>(merged));
                 node.data.setBeading(node_beadings.back());
                 assert(merged.total_thickness == node.data.distance_to_boundary * 2);
                 if(merged.total_thickness != node.data.distance_to_boundary * 2)
@@ -1794,12 +1857,14 @@ void SkeletalTrapezoidation::generateSegments()
     export_graph_to_svg(debug_out_path("ST-generateSegments-before-propagation-%d.svg", iRun), this->graph, this->outline);
 #endif
 
+    throwOnCancel();
     propagateBeadingsUpward(upward_quad_mids, node_beadings);
 
 #ifdef ARACHNE_DEBUG
     export_graph_to_svg(debug_out_path("ST-generateSegments-upward-propagation-%d.svg", iRun), this->graph, this->outline);
 #endif
 
+    throwOnCancel();
     propagateBeadingsDownward(upward_quad_mids, node_beadings);
 
 #ifdef ARACHNE_DEBUG
@@ -1807,14 +1872,18 @@ void SkeletalTrapezoidation::generateSegments()
 #endif
 
     ptr_vector_t<LineJunctions> edge_junctions; // junctions ordered high R to low R
+    edge_junctions.reserve(graph.edges.size());
+    throwOnCancel();
     generateJunctions(node_beadings, edge_junctions);
 
 #ifdef ARACHNE_DEBUG
     export_graph_to_svg(debug_out_path("ST-generateSegments-junctions-%d.svg", iRun), this->graph, this->outline, edge_junctions);
 #endif
 
+    throwOnCancel();
     connectJunctions(edge_junctions);
 
+    throwOnCancel();
     generateLocalMaximaSingleBeads();
 
 #ifdef ARACHNE_DEBUG
@@ -1870,7 +1939,7 @@ void SkeletalTrapezoidation::propagateBeadingsUpward(std::vector<edge_t*>& upwar
         BeadingPropagation upper_beading = lower_beading;
         upper_beading.dist_to_bottom_source += length;
         upper_beading.is_upward_propagated_only = true;
-        node_beadings.emplace_back(new BeadingPropagation(upper_beading));
+        node_beadings.emplace_back(std::make_shared<BeadingPropagation>(upper_beading));
         upward_edge->to->data.setBeading(node_beadings.back());
         assert(upper_beading.beading.total_thickness <= upward_edge->to->data.distance_to_boundary * 2);
     }
@@ -1914,7 +1983,7 @@ void SkeletalTrapezoidation::propagateBeadingsDownward(edge_t* edge_to_peak, ptr
     { // Set new beading if there is no beading associated with the node yet
         BeadingPropagation propagated_beading = top_beading;
         propagated_beading.dist_from_top_source += length;
-        node_beadings.emplace_back(new BeadingPropagation(propagated_beading));
+        node_beadings.emplace_back(std::make_shared<BeadingPropagation>(propagated_beading));
         edge_to_peak->from->data.setBeading(node_beadings.back());
         assert(propagated_beading.beading.total_thickness >= edge_to_peak->from->data.distance_to_boundary * 2);
         if(propagated_beading.beading.total_thickness < edge_to_peak->from->data.distance_to_boundary * 2)
@@ -2124,7 +2193,7 @@ std::shared_ptr<SkeletalTrapezoidationJoint::BeadingPropagation> SkeletalTrapezo
             node->data.bead_count = beading_strategy.getOptimalBeadCount(dist * 2);
         }
         assert(node->data.bead_count != -1);
-        node_beadings.emplace_back(new BeadingPropagation(beading_strategy.compute(node->data.distance_to_boundary * 2, node->data.bead_count)));
+        node_beadings.emplace_back(std::make_shared<BeadingPropagation>(beading_strategy.compute(node->data.distance_to_boundary * 2, node->data.bead_count)));
         node->data.setBeading(node_beadings.back());
     }
     assert(node->data.hasBeading());
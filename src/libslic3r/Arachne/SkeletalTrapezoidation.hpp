@@ -6,6 +6,7 @@
 
 #include <boost/polygon/voronoi.hpp>
 
+#include <functional>
 #include <memory> // smart pointers
 #include <unordered_map>
 #include <utility> // pair
@@ -78,6 +79,16 @@ class SkeletalTrapezoidation
      */
     const BeadingStrategy& beading_strategy;
 
+    /*!
+     * Optional callback that throws (e.g. CanceledException) when the slicing
+     * job was canceled. Invoked between the phases of the algorithm and at
+     * bounded intervals inside the long loops, so that canceling does not have
+     * to wait for a whole layer worth of trapezoidation to finish.
+     */
+    std::function<void()> throw_on_cancel;
+
+    void throwOnCancel() const { if (throw_on_cancel) throw_on_cancel(); }
+
 public:
     using Segment = PolygonsSegmentIndex;
 
@@ -97,6 +108,8 @@ public:
      * \param beading_propagation_transition_dist When there are different
      * beadings propagated from below and from above, use this transitioning
      * distance.
+     * \param throw_on_cancel Optional callback that throws when the slicing job
+     * was canceled; checked periodically throughout the algorithm.
      */
     SkeletalTrapezoidation(const Polygons& polys,
                            const BeadingStrategy& beading_strategy,
@@ -104,7 +117,8 @@ public:
     , coord_t discretization_step_size
     , coord_t transition_filter_dist
     , coord_t allowed_filter_deviation
-    , coord_t beading_propagation_transition_dist);
+    , coord_t beading_propagation_transition_dist
+    , std::function<void()> throw_on_cancel = {});
 
     /*!
      * A skeletal graph through the polygons that we need to fill with beads.
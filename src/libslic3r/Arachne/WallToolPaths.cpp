@@ -2,6 +2,9 @@
 // CuraEngine is released under the terms of the AGPLv3 or higher.
 
 #include <algorithm> //For std::partition_copy and std::min_element.
+#include <deque>
+#include <mutex>
+#include <unordered_map>
 #include <unordered_set>
 
 #include "WallToolPaths.hpp"
@@ -18,6 +21,8 @@
 
 #include <boost/log/trivial.hpp>
 
+#include <tbb/parallel_for.h>
+
 //#define ARACHNE_STITCH_PATCH_DEBUG
 
 namespace Slic3r::Arachne
@@ -461,11 +466,115 @@ void removeColinearEdges(Polygons &thiss, const double max_deviation_angle = 0.0
     }
 }
 
+// Content-hash memoization of generated toolpaths. Vase-like and extruded parts produce long
+// runs of consecutive layers with byte-identical outlines, for which the full skeletal
+// trapezoidation would be recomputed per layer. Keyed by the outline points and the complete
+// bead configuration; the outline and configuration are stored alongside and compared on a hit,
+// so a hash collision degrades to a miss instead of wrong geometry. Bounded FIFO eviction.
+namespace {
+
+struct ToolPathsCacheKey
+{
+    Polygons           outline;
+    coord_t            bead_width_0;
+    coord_t            bead_width_x;
+    size_t             inset_count;
+    coord_t            wall_0_inset;
+    coordf_t           layer_height;
+    bool               print_thin_walls;
+    coord_t            min_feature_size;
+    coord_t            min_bead_width;
+    coord_t            wall_transition_filter_deviation;
+    WallToolPathsParams params;
+
+    bool matches(const ToolPathsCacheKey &rhs) const
+    {
+        if (bead_width_0 != rhs.bead_width_0 || bead_width_x != rhs.bead_width_x ||
+            inset_count != rhs.inset_count || wall_0_inset != rhs.wall_0_inset ||
+            layer_height != rhs.layer_height || print_thin_walls != rhs.print_thin_walls ||
+            min_feature_size != rhs.min_feature_size || min_bead_width != rhs.min_bead_width ||
+            wall_transition_filter_deviation != rhs.wall_transition_filter_deviation ||
+            params.min_bead_width != rhs.params.min_bead_width ||
+            params.min_feature_size != rhs.params.min_feature_size ||
+            params.wall_transition_length != rhs.params.wall_transition_length ||
+            params.wall_transition_angle != rhs.params.wall_transition_angle ||
+            params.wall_transition_filter_deviation != rhs.params.wall_transition_filter_deviation ||
+            params.wall_distribution_count != rhs.params.wall_distribution_count ||
+            outline.size() != rhs.outline.size())
+            return false;
+        for (size_t i = 0; i < outline.size(); ++ i)
+            if (outline[i].points != rhs.outline[i].points)
+                return false;
+        return true;
+    }
+
+    uint64_t hash() const
+    {
+        auto combine = [](uint64_t &seed, uint64_t v) { seed ^= v + 0x9e3779b97f4a7c15ull + (seed << 6) + (seed >> 2); };
+        uint64_t h = 0xcbf29ce484222325ull;
+        for (const Polygon &poly : outline) {
+            combine(h, poly.points.size());
+            for (const Point &pt : poly.points) {
+                combine(h, uint64_t(int64_t(pt.x())));
+                combine(h, uint64_t(int64_t(pt.y())));
+            }
+        }
+        combine(h, uint64_t(int64_t(bead_width_0)));
+        combine(h, uint64_t(int64_t(bead_width_x)));
+        combine(h, uint64_t(inset_count));
+        combine(h, uint64_t(int64_t(wall_0_inset)));
+        combine(h, std::hash<double>{}(layer_height));
+        combine(h, uint64_t(print_thin_walls));
+        combine(h, uint64_t(int64_t(min_feature_size)));
+        combine(h, uint64_t(int64_t(min_bead_width)));
+        combine(h, uint64_t(int64_t(wall_transition_filter_deviation)));
+        combine(h, std::hash<float>{}(params.min_bead_width));
+        combine(h, std::hash<float>{}(params.min_feature_size));
+        combine(h, std::hash<float>{}(params.wall_transition_length));
+        combine(h, std::hash<float>{}(params.wall_transition_angle));
+        combine(h, std::hash<float>{}(params.wall_transition_filter_deviation));
+        combine(h, uint64_t(params.wall_distribution_count));
+        return h;
+    }
+};
+
+struct ToolPathsCacheEntry
+{
+    ToolPathsCacheKey               key;
+    std::vector<VariableWidthLines> toolpaths;
+    Polygons                        inner_contour;
+};
+
+std::mutex                                        s_toolpaths_cache_mutex;
+std::unordered_map<uint64_t, ToolPathsCacheEntry> s_toolpaths_cache;
+std::deque<uint64_t>                              s_toolpaths_cache_fifo;
+constexpr size_t                                  ToolPathsCacheCapacity = 64;
+
+} // anonymous namespace
+
 const std::vector<VariableWidthLines> &WallToolPaths::generate()
 {
     if (this->inset_count < 1)
         return toolpaths;
 
+    ToolPathsCacheKey cache_key { outline, bead_width_0, bead_width_x, inset_count, wall_0_inset,
+                                  layer_height, print_thin_walls, min_feature_size, min_bead_width,
+                                  wall_transition_filter_deviation, m_params };
+    // The cancel callback is not part of the bead configuration and may reference the current
+    // print job, do not let the global cache retain it.
+    cache_key.params.throw_on_cancel = nullptr;
+    const uint64_t cache_hash = cache_key.hash();
+    {
+        std::lock_guard<std::mutex> lock(s_toolpaths_cache_mutex);
+        auto it = s_toolpaths_cache.find(cache_hash);
+        if (it != s_toolpaths_cache.end() && it->second.key.matches(cache_key)) {
+            toolpaths           = it->second.toolpaths;
+            inner_contour       = it->second.inner_contour;
+            toolpaths_generated = true;
+            return toolpaths;
+        }
+    }
+
     const coord_t smallest_segment = Slic3r::Arachne::meshfix_maximum_resolution;
     const coord_t allowed_distance = Slic3r::Arachne::meshfix_maximum_deviation;
     const coord_t epsilon_offset = (allowed_distance / 2) - 1;
@@ -522,17 +631,55 @@ const std::vector<VariableWidthLines> &WallToolPaths::generate()
         );
     const coord_t transition_filter_dist   = scaled<coord_t>(100.f);
     const coord_t allowed_filter_deviation = wall_transition_filter_deviation;
-    SkeletalTrapezoidation wall_maker
-    (
-        prepared_outline,
-        *beading_strat,
-        beading_strat->getTransitioningAngle(),
-        discretization_step_size,
-        transition_filter_dist,
-        allowed_filter_deviation,
-        wall_transition_length
-    );
-    wall_maker.generateToolpaths(toolpaths);
+    // The Voronoi construction and the graph transfer are single threaded per skeletal graph,
+    // but connected components of the outline (an outer contour with its holes) are fully
+    // independent, thus build their graphs concurrently and merge the toolpaths per inset.
+    if (ExPolygons islands = union_ex(prepared_outline); islands.size() > 1) {
+        std::vector<std::vector<VariableWidthLines>> island_toolpaths(islands.size());
+        tbb::parallel_for(tbb::blocked_range<size_t>(0, islands.size(), 1),
+            [this, &islands, &island_toolpaths, &beading_strat, discretization_step_size, transition_filter_dist, allowed_filter_deviation, wall_transition_length](const tbb::blocked_range<size_t> &range) {
+                for (size_t island_idx = range.begin(); island_idx < range.end(); ++ island_idx) {
+                    SkeletalTrapezoidation island_wall_maker
+                    (
+                        to_polygons(islands[island_idx]),
+                        *beading_strat,
+                        beading_strat->getTransitioningAngle(),
+                        discretization_step_size,
+                        transition_filter_dist,
+                        allowed_filter_deviation,
+                        wall_transition_length,
+                        m_params.throw_on_cancel
+                    );
+                    island_wall_maker.generateToolpaths(island_toolpaths[island_idx]);
+                }
+            });
+        // Merge in island order, so the output is deterministic and sorted from the outer
+        // 0th inset to the inner walls as the downstream code expects.
+        for (std::vector<VariableWidthLines> &island : island_toolpaths)
+            for (VariableWidthLines &lines : island) {
+                if (lines.empty())
+                    continue;
+                const size_t inset_idx = lines.front().inset_idx;
+                if (toolpaths.size() <= inset_idx)
+                    toolpaths.resize(inset_idx + 1);
+                append(toolpaths[inset_idx], std::move(lines));
+            }
+        // Islands with fewer walls leave gaps in the inset sequence, drop them right away.
+        removeEmptyToolPaths(toolpaths);
+    } else {
+        SkeletalTrapezoidation wall_maker
+        (
+            prepared_outline,
+            *beading_strat,
+            beading_strat->getTransitioningAngle(),
+            discretization_step_size,
+            transition_filter_dist,
+            allowed_filter_deviation,
+            wall_transition_length,
+            m_params.throw_on_cancel
+        );
+        wall_maker.generateToolpaths(toolpaths);
+    }
 
     stitchToolPaths(toolpaths, this->bead_width_x);
 
@@ -549,6 +696,19 @@ const std::vector<VariableWidthLines> &WallToolPaths::generate()
                               return l.front().inset_idx < r.front().inset_idx;
                           }) && "WallToolPaths should be sorted from the outer 0th to inner_walls");
     toolpaths_generated = true;
+
+    {
+        std::lock_guard<std::mutex> lock(s_toolpaths_cache_mutex);
+        if (s_toolpaths_cache.find(cache_hash) == s_toolpaths_cache.end()) {
+            while (s_toolpaths_cache_fifo.size() >= ToolPathsCacheCapacity) {
+                s_toolpaths_cache.erase(s_toolpaths_cache_fifo.front());
+                s_toolpaths_cache_fifo.pop_front();
+            }
+            s_toolpaths_cache_fifo.emplace_back(cache_hash);
+        }
+        s_toolpaths_cache[cache_hash] = ToolPathsCacheEntry { std::move(cache_key), toolpaths, inner_contour };
+    }
+
     return toolpaths;
 }
 
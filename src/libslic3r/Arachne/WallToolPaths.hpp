@@ -4,6 +4,7 @@
 #ifndef CURAENGINE_WALLTOOLPATHS_H
 #define CURAENGINE_WALLTOOLPATHS_H
 
+#include <functional>
 #include <memory>
 #include <unordered_set>
 
@@ -29,6 +30,10 @@ public:
     float   wall_transition_angle;
     float   wall_transition_filter_deviation;
     int     wall_distribution_count;
+    // Optional callback that throws when the slicing job was canceled. Checked at bounded
+    // intervals during wall generation, so canceling does not wait for whole layers to finish.
+    // Not part of the bead configuration, thus ignored by the toolpaths memoization cache key.
+    std::function<void()> throw_on_cancel;
 };
 
 WallToolPathsParams make_paths_params(const int layer_id, const PrintObjectConfig &print_object_config, const PrintConfig &print_config);
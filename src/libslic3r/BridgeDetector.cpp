@@ -1,8 +1,12 @@
 #include "BridgeDetector.hpp"
+#include "AABBTreeLines.hpp"
 #include "ClipperUtils.hpp"
 #include "Geometry.hpp"
 #include <algorithm>
 
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+
 namespace Slic3r {
 
 BridgeDetector::BridgeDetector(
@@ -95,63 +99,71 @@ bool BridgeDetector::detect_angle(double bridge_direction_override)
     /*  we'll now try several directions using a rudimentary visibility check:
         bridge in several directions and then sum the length of lines having both
         endpoints within anchors */
-        
-    bool have_coverage = false;
-    for (size_t i_angle = 0; i_angle < candidates.size(); ++ i_angle)
-    {
-        const double angle = candidates[i_angle].angle;
 
-        Lines lines;
-        {
-            // Get an oriented bounding box around _anchor_regions.
-            BoundingBox bbox = get_extents_rotated(this->_anchor_regions, - angle);
-            // Cover the region with line segments.
-            lines.reserve((bbox.max(1) - bbox.min(1) + this->spacing) / this->spacing);
-            double s = sin(angle);
-            double c = cos(angle);
-            //FIXME Vojtech: The lines shall be spaced half the line width from the edge, but then 
-            // some of the test cases fail. Need to adjust the test cases then?
-//            for (coord_t y = bbox.min(1) + this->spacing / 2; y <= bbox.max(1); y += this->spacing)
-            for (coord_t y = bbox.min(1); y <= bbox.max(1); y += this->spacing)
-                lines.push_back(Line(
-                    Point((coord_t)round(c * bbox.min(0) - s * y), (coord_t)round(c * y + s * bbox.min(0))),
-                    Point((coord_t)round(c * bbox.max(0) - s * y), (coord_t)round(c * y + s * bbox.max(0)))));
-        }
+    // Precompute a spatial index over the anchor region boundaries. Testing both endpoints of
+    // every candidate line through expolygons_contain() was a linear scan over all anchor
+    // vertices per point, repeated for up to ~180 candidate directions.
+    AABBTreeLines::LinesDistancer<Line> anchor_index(to_lines(this->_anchor_regions));
 
-        double total_length = 0;
-        double max_length = 0;
+    // The candidate directions are probed independently, each of them writes only its own
+    // BridgeDirection entry, thus they may be evaluated in parallel.
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, candidates.size()),
+        [this, &candidates, &clip_area, &anchor_index](const tbb::blocked_range<size_t> &range) {
+        for (size_t i_angle = range.begin(); i_angle < range.end(); ++ i_angle)
         {
-            Lines clipped_lines = intersection_ln(lines, clip_area);
-            size_t archored_line_num = 0;
-            for (size_t i = 0; i < clipped_lines.size(); ++i) {
-                const Line &line = clipped_lines[i];
-                if (expolygons_contain(this->_anchor_regions, line.a) && expolygons_contain(this->_anchor_regions, line.b)) {
-                    // This line could be anchored.
-                    double len = line.length();
-                    total_length += len;
-                    max_length = std::max(max_length, len);
-                    archored_line_num++;
-                }
+            const double angle = candidates[i_angle].angle;
+
+            Lines lines;
+            {
+                // Get an oriented bounding box around _anchor_regions.
+                BoundingBox bbox = get_extents_rotated(this->_anchor_regions, - angle);
+                // Cover the region with line segments.
+                lines.reserve((bbox.max(1) - bbox.min(1) + this->spacing) / this->spacing);
+                double s = sin(angle);
+                double c = cos(angle);
+                //FIXME Vojtech: The lines shall be spaced half the line width from the edge, but then
+                // some of the test cases fail. Need to adjust the test cases then?
+//                for (coord_t y = bbox.min(1) + this->spacing / 2; y <= bbox.max(1); y += this->spacing)
+                for (coord_t y = bbox.min(1); y <= bbox.max(1); y += this->spacing)
+                    lines.push_back(Line(
+                        Point((coord_t)round(c * bbox.min(0) - s * y), (coord_t)round(c * y + s * bbox.min(0))),
+                        Point((coord_t)round(c * bbox.max(0) - s * y), (coord_t)round(c * y + s * bbox.max(0)))));
             }
-            if (clipped_lines.size() > 0 && archored_line_num > 0) {
-                candidates[i_angle].archored_percent = (double)archored_line_num / (double)clipped_lines.size();
+
+            double total_length = 0;
+            double max_length = 0;
+            {
+                Lines clipped_lines = intersection_ln(lines, clip_area);
+                size_t archored_line_num = 0;
+                for (size_t i = 0; i < clipped_lines.size(); ++i) {
+                    const Line &line = clipped_lines[i];
+                    if (anchor_index.outside(line.a) <= 0 && anchor_index.outside(line.b) <= 0) {
+                        // This line could be anchored.
+                        double len = line.length();
+                        total_length += len;
+                        max_length = std::max(max_length, len);
+                        archored_line_num++;
+                    }
+                }
+                if (clipped_lines.size() > 0 && archored_line_num > 0) {
+                    candidates[i_angle].archored_percent = (double)archored_line_num / (double)clipped_lines.size();
+                }
             }
+            if (total_length == 0.)
+                continue;
+
+            // Sum length of bridged lines.
+            candidates[i_angle].coverage = total_length;
+            /*  The following produces more correct results in some cases and more broken in others.
+                TODO: investigate, as it looks more reliable than line clipping. */
+            // $directions_coverage{$angle} = sum(map $_->area, @{$self->coverage($angle)}) // 0;
+            // max length of bridged lines
+            candidates[i_angle].max_length = max_length;
         }
-        if (total_length == 0.)
-            continue;
-
-        have_coverage = true;
-        // Sum length of bridged lines.
-        candidates[i_angle].coverage = total_length;
-        /*  The following produces more correct results in some cases and more broken in others.
-            TODO: investigate, as it looks more reliable than line clipping. */
-        // $directions_coverage{$angle} = sum(map $_->area, @{$self->coverage($angle)}) // 0;
-        // max length of bridged lines
-        candidates[i_angle].max_length = max_length;
-    }
+    });
 
     // if no direction produced coverage, then there's no bridge direction
-    if (! have_coverage)
+    if (std::none_of(candidates.begin(), candidates.end(), [](const BridgeDirection &c) { return c.coverage > 0.; }))
         return false;
     
     // sort directions by coverage - most coverage first
@@ -231,7 +231,7 @@ static ExPolygons top_level_outer_brim_area(const Print                   &print
                 append(no_brim_area_object, diff_ex(offset(ex_poly.contour, no_brim_offset, ClipperLib::jtSquare), ex_poly_holes_reversed));
 
             if (brim_type != BrimType::btNoBrim)
-                append(no_brim_area_object, offset_ex(ExPolygon(ex_poly.contour), brim_object_gap, ClipperLib::jtSquare));
+                offset_ex(ExPolygon(ex_poly.contour), brim_object_gap, no_brim_area_object, ClipperLib::jtSquare);
 
             no_brim_area_object.emplace_back(ex_poly.contour);
         }
@@ -242,7 +242,7 @@ static ExPolygons top_level_outer_brim_area(const Print                   &print
                     append(brim_area_object, diff_ex(offset(support_contour, brim_width + brim_object_gap, ClipperLib::jtRound, scaled_resolution), offset(support_contour, brim_object_gap)));
 
                 if (brim_type != BrimType::btNoBrim)
-                    append(no_brim_area_object, offset_ex(ExPolygon(support_contour), brim_object_gap));
+                    offset_ex(ExPolygon(support_contour), brim_object_gap, no_brim_area_object);
 
                 no_brim_area_object.emplace_back(support_contour);
             }
@@ -314,13 +314,13 @@ static ExPolygons top_level_outer_brim_area(const Print& print, const ConstPrint
                             offset_ex(ex_poly.contour, brim_offset)));
                     }
                     if (brim_type == BrimType::btOuterOnly || brim_type == BrimType::btNoBrim)
-                        append(no_brim_area_object, offset_ex(ex_poly.holes, -no_brim_offset));
+                        offset_ex(ex_poly.holes, -no_brim_offset, no_brim_area_object);
 
                     if (brim_type == BrimType::btInnerOnly || brim_type == BrimType::btNoBrim)
                         append(no_brim_area_object, diff_ex(offset(ex_poly.contour, no_brim_offset), ex_poly.holes));
 
                     if (brim_type != BrimType::btNoBrim)
-                        append(no_brim_area_object, offset_ex(ExPolygon(ex_poly.contour), brim_offset));
+                        offset_ex(ExPolygon(ex_poly.contour), brim_offset, no_brim_area_object);
 
                     no_brim_area_object.emplace_back(ex_poly.contour);
                 }
@@ -413,7 +413,7 @@ static ExPolygons inner_brim_area(const Print                   &print,
 
             append(holes_object, ex_poly_holes_reversed);
         }
-        append(no_brim_area_object, offset_ex(bottom_layers_expolygons[print_object_idx], brim_object_gap, ClipperLib::jtSquare));
+        offset_ex(bottom_layers_expolygons[print_object_idx], brim_object_gap, no_brim_area_object, ClipperLib::jtSquare);
 
         for (const PrintInstance &instance : object->instances()) {
             append_and_translate(brim_area, brim_area_object, instance);
@@ -489,7 +489,7 @@ static ExPolygons inner_brim_area(const Print& print, const ConstPrintObjectPtrs
                     if (brim_type == BrimType::btInnerOnly || brim_type == BrimType::btNoBrim)
                         append(no_brim_area_object, diff_ex(offset(ex_poly.contour, no_brim_offset), ex_poly.holes));
                     if (brim_type == BrimType::btOuterOnly || brim_type == BrimType::btNoBrim)
-                        append(no_brim_area_object, offset_ex(ex_poly.holes, -no_brim_offset));
+                        offset_ex(ex_poly.holes, -no_brim_offset, no_brim_area_object);
                     append(holes_object, ex_poly.holes);
                 }
                 append(no_brim_area_object, offset_ex(object->layers().front()->lslices, brim_offset));
@@ -1,6 +1,7 @@
 #ifndef PERFORMCSGMESHBOOLEANS_HPP
 #define PERFORMCSGMESHBOOLEANS_HPP
 
+#include <algorithm>
 #include <stack>
 #include <vector>
 
@@ -162,6 +163,35 @@ void perform_csgmesh_booleans_cgal(MeshBoolean::cgal::CGALMeshPtr &cgalm,
     using MeshBoolean::cgal::CGALMeshPtr;
     using namespace detail_cgal;
 
+    std::vector<CGALMeshPtr> cgalmeshes = get_cgalptrs(ex_tbb, csgrange);
+
+    // A flat chain of unions has no ordering constraints, every part is an
+    // independent subtree of the CSG expression. Such ranges are reduced by
+    // merging pairs of meshes in parallel with a doubling stride until only
+    // the front mesh remains.
+    if (csgrange.size() > 1 &&
+        std::all_of(csgrange.begin(), csgrange.end(), [](const auto &csgpart) {
+            return get_stack_operation(csgpart) == CSGStackOp::Continue &&
+                   get_operation(csgpart) == CSGType::Union;
+        })) {
+        for (size_t stride = 1; stride < cgalmeshes.size(); stride *= 2) {
+            size_t npairs = (cgalmeshes.size() + 2 * stride - 1) / (2 * stride);
+            execution::for_each(ex_tbb, size_t(0), npairs,
+                                [&cgalmeshes, stride](size_t pair_idx) {
+                size_t dst = 2 * stride * pair_idx;
+                size_t src = dst + stride;
+                if (src < cgalmeshes.size())
+                    perform_csg(CSGType::Union, cgalmeshes[dst], cgalmeshes[src]);
+            });
+        }
+
+        cgalm = std::move(cgalmeshes.front());
+        if (!cgalm)
+            cgalm = MeshBoolean::cgal::triangle_mesh_to_cgal(indexed_triangle_set{});
+
+        return;
+    }
+
     struct Frame {
         CSGType op; CGALMeshPtr cgalptr;
         explicit Frame(CSGType csgop = CSGType::Union)
@@ -174,8 +204,6 @@ void perform_csgmesh_booleans_cgal(MeshBoolean::cgal::CGALMeshPtr &cgalm,
 
     opstack.push(Frame{});
 
-    std::vector<CGALMeshPtr> cgalmeshes = get_cgalptrs(ex_tbb, csgrange);
-
     size_t csgidx = 0;
     for (auto& csgpart : csgrange) {
 
@@ -212,6 +240,33 @@ void perform_csgmesh_booleans_mcut(MeshBoolean::mcut::McutMeshPtr& mcutm,
     using MeshBoolean::mcut::McutMeshPtr;
     using namespace detail_mcut;
 
+    std::vector<McutMeshPtr> McutMeshes = get_mcutptrs(ex_tbb, csgrange);
+
+    // See perform_csgmesh_booleans_cgal(): flat chains of unions are reduced
+    // by merging pairs of meshes in parallel instead of the sequential fold.
+    if (csgrange.size() > 1 &&
+        std::all_of(csgrange.begin(), csgrange.end(), [](const auto &csgpart) {
+            return get_stack_operation(csgpart) == CSGStackOp::Continue &&
+                   get_operation(csgpart) == CSGType::Union;
+        })) {
+        for (size_t stride = 1; stride < McutMeshes.size(); stride *= 2) {
+            size_t npairs = (McutMeshes.size() + 2 * stride - 1) / (2 * stride);
+            execution::for_each(ex_tbb, size_t(0), npairs,
+                                [&McutMeshes, stride](size_t pair_idx) {
+                size_t dst = 2 * stride * pair_idx;
+                size_t src = dst + stride;
+                if (src < McutMeshes.size())
+                    perform_csg(CSGType::Union, McutMeshes[dst], McutMeshes[src]);
+            });
+        }
+
+        mcutm = std::move(McutMeshes.front());
+        if (!mcutm)
+            mcutm = MeshBoolean::mcut::triangle_mesh_to_mcut(indexed_triangle_set{});
+
+        return;
+    }
+
     struct Frame {
         CSGType op; McutMeshPtr mcutptr;
         explicit Frame(CSGType csgop = CSGType::Union)
@@ -224,8 +279,6 @@ void perform_csgmesh_booleans_mcut(MeshBoolean::mcut::McutMeshPtr& mcutm,
 
     opstack.push(Frame{});
 
-    std::vector<McutMeshPtr> McutMeshes = get_mcutptrs(ex_tbb, csgrange);
-
     size_t csgidx = 0;
     for (auto& csgpart : csgrange) {
 
@@ -111,6 +111,42 @@ VoxelGridPtr voxelize_csgmesh(const Range<It>      &csgrange,
     return ret;
 }
 
+// Total number of facets referenced by the csg parts of the given range. Used
+// by callers of perform_csgmesh_booleans_voxel() to decide whether a range is
+// small enough for the voxel based fast path to pay off.
+template<class It>
+size_t csgmesh_facet_count(const Range<It> &csgrange)
+{
+    size_t ret = 0;
+    for (auto &csgpart : csgrange)
+        if (const indexed_triangle_set *its = get_mesh(csgpart))
+            ret += its->indices.size();
+
+    return ret;
+}
+
+// Fast path for small csg stacks: instead of the exact mesh booleans of
+// PerformCSGMeshBooleans.hpp, the parts are rasterized into voxel grids,
+// combined in grid space and the result is remeshed. The output is an
+// approximation, but below max_facets the rasterization is cheap and the grid
+// csg is immune to the mesh defects (self intersections, open volumes) that
+// make the exact booleans fail. Returns an empty mesh when the range exceeds
+// the threshold or the voxelization was canceled through params.statusfn().
+template<class It>
+indexed_triangle_set perform_csgmesh_booleans_voxel(
+    const Range<It>      &csgrange,
+    const VoxelizeParams &params     = {},
+    size_t                max_facets = 100000)
+{
+    indexed_triangle_set ret;
+
+    if (csgmesh_facet_count(csgrange) <= max_facets)
+        if (VoxelGridPtr grid = voxelize_csgmesh(csgrange, params))
+            ret = grid_to_mesh(*grid, 0., 0.);
+
+    return ret;
+}
+
 }} // namespace Slic3r::csg
 
 #endif // VOXELIZECSGMESH_HPP
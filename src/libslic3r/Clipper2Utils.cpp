@@ -23,7 +23,7 @@ Clipper2Lib::Paths64 Slic3rPoints_to_Paths64(const std::vector<T>& in)
 {
     Clipper2Lib::Paths64 out;
     out.reserve(in.size());
-    for (const T item: in) {
+    for (const T &item : in) {
         Clipper2Lib::Path64 path;
         path.reserve(item.size());
         for (const Slic3r::Point& point : item.points)
@@ -57,4 +57,43 @@ Slic3r::Polylines intersection_pl_2(const Slic3r::Polylines& subject, const Slic
 Slic3r::Polylines  diff_pl_2(const Slic3r::Polylines& subject, const Slic3r::Polygons& clip)
     { return _clipper2_pl_open(Clipper2Lib::ClipType::Difference, subject, clip); }
 
+static Slic3r::Polygons Paths64_to_polygons(const Clipper2Lib::Paths64& in)
+{
+    Slic3r::Polygons out;
+    out.reserve(in.size());
+    for (const Clipper2Lib::Path64& path64 : in) {
+        Slic3r::Points points;
+        points.reserve(path64.size());
+        for (const Clipper2Lib::Point64& point64 : path64)
+            points.emplace_back(point64.x, point64.y);
+        out.emplace_back(std::move(points));
+    }
+    return out;
+}
+
+static Polygons _clipper2_closed(Clipper2Lib::ClipType clipType, const Slic3r::Polygons& subject, const Slic3r::Polygons& clip)
+{
+    Clipper2Lib::Clipper64 c;
+    c.AddSubject(Slic3rPoints_to_Paths64(subject));
+    if (! clip.empty())
+        c.AddClip(Slic3rPoints_to_Paths64(clip));
+
+    Clipper2Lib::Paths64 solution;
+    c.Execute(clipType, Clipper2Lib::FillRule::NonZero, solution);
+    return Paths64_to_polygons(solution);
+}
+
+Slic3r::Polygons union_2(const Slic3r::Polygons& subject)
+    { return _clipper2_closed(Clipper2Lib::ClipType::Union, subject, Slic3r::Polygons()); }
+Slic3r::Polygons diff_2(const Slic3r::Polygons& subject, const Slic3r::Polygons& clip)
+    { return _clipper2_closed(Clipper2Lib::ClipType::Difference, subject, clip); }
+Slic3r::Polygons intersection_2(const Slic3r::Polygons& subject, const Slic3r::Polygons& clip)
+    { return _clipper2_closed(Clipper2Lib::ClipType::Intersection, subject, clip); }
+
+Slic3r::Polygons offset_2(const Slic3r::Polygons& polygons, double delta, Clipper2Lib::JoinType joinType, double miterLimit)
+{
+    return Paths64_to_polygons(Clipper2Lib::InflatePaths(Slic3rPoints_to_Paths64(polygons), delta,
+        joinType, Clipper2Lib::EndType::Polygon, miterLimit));
+}
+
 }
\ No newline at end of file
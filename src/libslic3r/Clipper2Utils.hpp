@@ -11,6 +11,16 @@ namespace Slic3r {
 Slic3r::Polylines  intersection_pl_2(const Slic3r::Polylines& subject, const Slic3r::Polygons& clip);
 Slic3r::Polylines  diff_pl_2(const Slic3r::Polylines& subject, const Slic3r::Polygons& clip);
 
+// Closed polygon booleans and offsetting routed through the Clipper2 engine.
+// Candidate replacements for the legacy clipper.cpp entry points of ClipperUtils,
+// see the SLIC3R_USE_CLIPPER2_BOOLEANS switch in ClipperUtils.cpp and the
+// conformance tests in tests/libslic3r/test_clipper2_utils.cpp.
+Slic3r::Polygons   union_2(const Slic3r::Polygons& subject);
+Slic3r::Polygons   diff_2(const Slic3r::Polygons& subject, const Slic3r::Polygons& clip);
+Slic3r::Polygons   intersection_2(const Slic3r::Polygons& subject, const Slic3r::Polygons& clip);
+Slic3r::Polygons   offset_2(const Slic3r::Polygons& polygons, double delta,
+                            Clipper2Lib::JoinType joinType = Clipper2Lib::JoinType::Miter, double miterLimit = 3.);
+
 }
 
 #endif
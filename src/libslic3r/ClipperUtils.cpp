@@ -10,6 +10,9 @@
 ///|/ PrusaSlicer is released under the terms of the AGPLv3 or higher
 ///|/
 #include "ClipperUtils.hpp"
+
+#include <atomic>
+
 #include "Geometry.hpp"
 #include "ShortestPath.hpp"
 
@@ -19,6 +22,17 @@
 #include "SVG.hpp"
 #endif /* CLIPPER_UTILS_DEBUG */
 
+// Experimental switch routing the plain Polygons booleans below through the Clipper2
+// engine (src/clipper2) instead of the legacy clipper.cpp. Disabled by default until
+// the conformance tests in tests/libslic3r/test_clipper2_utils.cpp are validated on a
+// wider range of production models. Calls requesting a safety offset keep the legacy
+// engine, as Clipper2 has no equivalent of the clip path inflation performed there.
+// #define SLIC3R_USE_CLIPPER2_BOOLEANS
+
+#ifdef SLIC3R_USE_CLIPPER2_BOOLEANS
+#include "Clipper2Utils.hpp"
+#endif /* SLIC3R_USE_CLIPPER2_BOOLEANS */
+
 // Profiling support using the Shiny intrusive profiler
 //#define CLIPPER_UTILS_PROFILE
 #if defined(SLIC3R_PROFILE) && defined(CLIPPER_UTILS_PROFILE)
@@ -175,7 +189,34 @@ void clip_clipper_polygon_with_subject_bbox(const Polygon &src, const BoundingBo
 }
 }
 
-static ExPolygons PolyTreeToExPolygons(ClipperLib::PolyTree &&polytree)
+// Debug accounting of the sink overloads (offset_ex / union_ex appending into caller storage),
+// see ClipperUtils::sink_stats().
+static std::atomic<size_t> s_sink_calls { 0 };
+static std::atomic<size_t> s_sink_expolygons { 0 };
+
+static void account_sink(size_t expolygons_appended)
+{
+    s_sink_calls.fetch_add(1, std::memory_order_relaxed);
+    s_sink_expolygons.fetch_add(expolygons_appended, std::memory_order_relaxed);
+}
+
+namespace ClipperUtils {
+
+SinkStats sink_stats()
+{
+    return { s_sink_calls.load(std::memory_order_relaxed), s_sink_expolygons.load(std::memory_order_relaxed) };
+}
+
+void reset_sink_stats()
+{
+    s_sink_calls.store(0, std::memory_order_relaxed);
+    s_sink_expolygons.store(0, std::memory_order_relaxed);
+}
+
+} // namespace ClipperUtils
+
+// Appends into out, reserving the exact count of ExPolygons produced on top of the existing content.
+static void PolyTreeToExPolygons(ClipperLib::PolyTree &&polytree, ExPolygons &out)
 {
     struct Inner {
         static void PolyTreeToExPolygonsRecursive(ClipperLib::PolyNode &&polynode, ExPolygons *expolygons)
@@ -203,13 +244,18 @@ static ExPolygons PolyTreeToExPolygons(ClipperLib::PolyTree &&polytree)
         }
     };
 
-    ExPolygons retval;
     size_t cnt = 0;
     for (int i = 0; i < polytree.ChildCount(); ++ i)
         cnt += Inner::PolyTreeCountExPolygons(*polytree.Childs[i]);
-    retval.reserve(cnt);
+    out.reserve(out.size() + cnt);
     for (int i = 0; i < polytree.ChildCount(); ++ i)
-        Inner::PolyTreeToExPolygonsRecursive(std::move(*polytree.Childs[i]), &retval);
+        Inner::PolyTreeToExPolygonsRecursive(std::move(*polytree.Childs[i]), &out);
+}
+
+static ExPolygons PolyTreeToExPolygons(ClipperLib::PolyTree &&polytree)
+{
+    ExPolygons retval;
+    PolyTreeToExPolygons(std::move(polytree), retval);
     return retval;
 }
 
@@ -418,6 +464,13 @@ Slic3r::Polygons offset(const Slic3r::Polygons &polygons, const float delta, Cli
 Slic3r::ExPolygons offset_ex(const Slic3r::Polygons &polygons, const float delta, ClipperLib::JoinType joinType, double miterLimit)
     { return PolyTreeToExPolygons(offset_paths<ClipperLib::PolyTree>(ClipperUtils::PolygonsProvider(polygons), delta, joinType, miterLimit)); }
 
+void offset_ex(const Slic3r::Polygons &polygons, const float delta, Slic3r::ExPolygons &out, ClipperLib::JoinType joinType, double miterLimit)
+{
+    size_t cnt = out.size();
+    PolyTreeToExPolygons(offset_paths<ClipperLib::PolyTree>(ClipperUtils::PolygonsProvider(polygons), delta, joinType, miterLimit), out);
+    account_sink(out.size() - cnt);
+}
+
 Slic3r::Polygons offset(const Slic3r::Polyline &polyline, const float delta, ClipperLib::JoinType joinType, double miterLimit)
     { assert(delta > 0); return to_polygons(clipper_union<ClipperLib::Paths>(raw_offset_polyline(ClipperUtils::SinglePathProvider(polyline.points), delta, joinType, miterLimit))); }
 Slic3r::Polygons offset(const Slic3r::Polylines &polylines, const float delta, ClipperLib::JoinType joinType, double miterLimit)
@@ -559,6 +612,21 @@ Slic3r::ExPolygons offset_ex(const Slic3r::ExPolygon &expolygon, const float del
     { return ClipperPaths_to_Slic3rExPolygons(expolygon_offset(expolygon, delta, joinType, miterLimit)); }
 Slic3r::ExPolygons offset_ex(const Slic3r::ExPolygons &expolygons, const float delta, ClipperLib::JoinType joinType, double miterLimit)
     { return PolyTreeToExPolygons(expolygons_offset_pt(expolygons, delta, joinType, miterLimit)); }
+
+void offset_ex(const Slic3r::ExPolygon &expolygon, const float delta, Slic3r::ExPolygons &out, ClipperLib::JoinType joinType, double miterLimit)
+{
+    size_t cnt = out.size();
+    // Matches the pftEvenOdd union the value returning overload performs through ClipperPaths_to_Slic3rExPolygons().
+    PolyTreeToExPolygons(clipper_union<ClipperLib::PolyTree>(expolygon_offset(expolygon, delta, joinType, miterLimit), ClipperLib::pftEvenOdd), out);
+    account_sink(out.size() - cnt);
+}
+
+void offset_ex(const Slic3r::ExPolygons &expolygons, const float delta, Slic3r::ExPolygons &out, ClipperLib::JoinType joinType, double miterLimit)
+{
+    size_t cnt = out.size();
+    PolyTreeToExPolygons(expolygons_offset_pt(expolygons, delta, joinType, miterLimit), out);
+    account_sink(out.size() - cnt);
+}
 Slic3r::ExPolygons offset_ex(const Slic3r::Surfaces &surfaces, const float delta, ClipperLib::JoinType joinType, double miterLimit)
     { return PolyTreeToExPolygons(expolygons_offset_pt(surfaces, delta, joinType, miterLimit)); }
 
@@ -660,10 +728,45 @@ static inline Polygons _clipper(ClipperLib::ClipType clipType, TSubj &&subject,
     return to_polygons(clipper_do<ClipperLib::Paths>(clipType, std::forward<TSubj>(subject), std::forward<TClip>(clip), ClipperLib::pftNonZero, do_safety_offset));
 }
 
+// Fused multi-operand booleans. ClipperLib implicitly unites all subject paths and all clip
+// paths of one execution (non-zero filling rule), thus several polygon sets may be combined
+// and subtracted / intersected in a single Execute() without materializing their unions first.
+template<class TResult, ClipperLib::ClipType clipType>
+static TResult clipper_do_multi(std::initializer_list<const Slic3r::Polygons*> subjects, std::initializer_list<const Slic3r::Polygons*> clips)
+{
+    ClipperLib::Clipper clipper;
+    for (const Slic3r::Polygons *subject : subjects)
+        clipper.AddPaths(ClipperUtils::PolygonsProvider(*subject), ClipperLib::ptSubject, true);
+    for (const Slic3r::Polygons *clip : clips)
+        clipper.AddPaths(ClipperUtils::PolygonsProvider(*clip), ClipperLib::ptClip, true);
+    TResult retval;
+    clipper.Execute(clipType, retval, ClipperLib::pftNonZero, ClipperLib::pftNonZero);
+    return retval;
+}
+
+Slic3r::Polygons diff(std::initializer_list<const Slic3r::Polygons*> subjects, std::initializer_list<const Slic3r::Polygons*> clips)
+    { return to_polygons(clipper_do_multi<ClipperLib::Paths, ClipperLib::ctDifference>(subjects, clips)); }
+Slic3r::Polygons intersection(std::initializer_list<const Slic3r::Polygons*> subjects, std::initializer_list<const Slic3r::Polygons*> clips)
+    { return to_polygons(clipper_do_multi<ClipperLib::Paths, ClipperLib::ctIntersection>(subjects, clips)); }
+Slic3r::Polygons union_(std::initializer_list<const Slic3r::Polygons*> subjects)
+    { return to_polygons(clipper_do_multi<ClipperLib::Paths, ClipperLib::ctUnion>(subjects, {})); }
+Slic3r::ExPolygons diff_ex(std::initializer_list<const Slic3r::Polygons*> subjects, std::initializer_list<const Slic3r::Polygons*> clips)
+    { return PolyTreeToExPolygons(clipper_do_multi<ClipperLib::PolyTree, ClipperLib::ctDifference>(subjects, clips)); }
+Slic3r::ExPolygons intersection_ex(std::initializer_list<const Slic3r::Polygons*> subjects, std::initializer_list<const Slic3r::Polygons*> clips)
+    { return PolyTreeToExPolygons(clipper_do_multi<ClipperLib::PolyTree, ClipperLib::ctIntersection>(subjects, clips)); }
+Slic3r::ExPolygons union_ex(std::initializer_list<const Slic3r::Polygons*> subjects)
+    { return PolyTreeToExPolygons(clipper_do_multi<ClipperLib::PolyTree, ClipperLib::ctUnion>(subjects, {})); }
+
 Slic3r::Polygons diff(const Slic3r::Polygon &subject, const Slic3r::Polygon &clip, ApplySafetyOffset do_safety_offset)
     { return _clipper(ClipperLib::ctDifference, ClipperUtils::SinglePathProvider(subject.points), ClipperUtils::SinglePathProvider(clip.points), do_safety_offset); }
 Slic3r::Polygons diff(const Slic3r::Polygons &subject, const Slic3r::Polygons &clip, ApplySafetyOffset do_safety_offset)
-    { return _clipper(ClipperLib::ctDifference, ClipperUtils::PolygonsProvider(subject), ClipperUtils::PolygonsProvider(clip), do_safety_offset); }
+{
+#ifdef SLIC3R_USE_CLIPPER2_BOOLEANS
+    if (do_safety_offset == ApplySafetyOffset::No)
+        return diff_2(subject, clip);
+#endif /* SLIC3R_USE_CLIPPER2_BOOLEANS */
+    return _clipper(ClipperLib::ctDifference, ClipperUtils::PolygonsProvider(subject), ClipperUtils::PolygonsProvider(clip), do_safety_offset);
+}
 Slic3r::Polygons diff_clipped(const Slic3r::Polygons &subject, const Slic3r::Polygons &clip, ApplySafetyOffset do_safety_offset) 
     { return diff(subject, ClipperUtils::clip_clipper_polygons_with_subject_bbox(clip, get_extents(subject).inflated(SCALED_EPSILON)), do_safety_offset); }
 Slic3r::Polygons diff(const Slic3r::Polygons &subject, const Slic3r::ExPolygons &clip, ApplySafetyOffset do_safety_offset)
@@ -681,7 +784,13 @@ Slic3r::Polygons intersection_clipped(const Slic3r::Polygons &subject, const Sli
 Slic3r::Polygons intersection(const Slic3r::Polygons &subject, const Slic3r::ExPolygon &clip, ApplySafetyOffset do_safety_offset)
     { return _clipper(ClipperLib::ctIntersection, ClipperUtils::PolygonsProvider(subject), ClipperUtils::ExPolygonProvider(clip), do_safety_offset); }
 Slic3r::Polygons intersection(const Slic3r::Polygons &subject, const Slic3r::Polygons &clip, ApplySafetyOffset do_safety_offset)
-    { return _clipper(ClipperLib::ctIntersection, ClipperUtils::PolygonsProvider(subject), ClipperUtils::PolygonsProvider(clip), do_safety_offset); }
+{
+#ifdef SLIC3R_USE_CLIPPER2_BOOLEANS
+    if (do_safety_offset == ApplySafetyOffset::No)
+        return intersection_2(subject, clip);
+#endif /* SLIC3R_USE_CLIPPER2_BOOLEANS */
+    return _clipper(ClipperLib::ctIntersection, ClipperUtils::PolygonsProvider(subject), ClipperUtils::PolygonsProvider(clip), do_safety_offset);
+}
 Slic3r::Polygons intersection(const Slic3r::ExPolygon &subject, const Slic3r::ExPolygon &clip, ApplySafetyOffset do_safety_offset)
     { return _clipper(ClipperLib::ctIntersection, ClipperUtils::ExPolygonProvider(subject), ClipperUtils::ExPolygonProvider(clip), do_safety_offset); }
 Slic3r::Polygons intersection(const Slic3r::ExPolygons &subject, const Slic3r::Polygons &clip, ApplySafetyOffset do_safety_offset)
@@ -701,7 +810,13 @@ Slic3r::Polygons intersection(const Slic3r::Polygons& subject, const Slic3r::Pol
 }
 
 Slic3r::Polygons union_(const Slic3r::Polygons &subject)
-    { return _clipper(ClipperLib::ctUnion, ClipperUtils::PolygonsProvider(subject), ClipperUtils::EmptyPathsProvider(), ApplySafetyOffset::No); }
+{
+#ifdef SLIC3R_USE_CLIPPER2_BOOLEANS
+    return union_2(subject);
+#else
+    return _clipper(ClipperLib::ctUnion, ClipperUtils::PolygonsProvider(subject), ClipperUtils::EmptyPathsProvider(), ApplySafetyOffset::No);
+#endif /* SLIC3R_USE_CLIPPER2_BOOLEANS */
+}
 Slic3r::Polygons union_(const Slic3r::ExPolygons &subject)
     { return _clipper(ClipperLib::ctUnion, ClipperUtils::ExPolygonsProvider(subject), ClipperUtils::EmptyPathsProvider(), ApplySafetyOffset::No); }
 Slic3r::Polygons union_(const Slic3r::Polygons &subject, const ClipperLib::PolyFillType fillType)
@@ -795,6 +910,20 @@ Slic3r::ExPolygons union_ex(const Slic3r::Polygons &subject, ClipperLib::PolyFil
     { return _clipper_ex(ClipperLib::ctUnion, ClipperUtils::PolygonsProvider(subject), ClipperUtils::EmptyPathsProvider(), ApplySafetyOffset::No, fill_type); }
 Slic3r::ExPolygons union_ex(const Slic3r::ExPolygons &subject)
     { return PolyTreeToExPolygons(clipper_do_polytree(ClipperLib::ctUnion, ClipperUtils::ExPolygonsProvider(subject), ClipperUtils::EmptyPathsProvider(), ClipperLib::pftNonZero)); }
+
+void union_ex(const Slic3r::Polygons &subject, Slic3r::ExPolygons &out, ClipperLib::PolyFillType fill_type)
+{
+    size_t cnt = out.size();
+    PolyTreeToExPolygons(clipper_do_polytree(ClipperLib::ctUnion, ClipperUtils::PolygonsProvider(subject), ClipperUtils::EmptyPathsProvider(), fill_type), out);
+    account_sink(out.size() - cnt);
+}
+
+void union_ex(const Slic3r::ExPolygons &subject, Slic3r::ExPolygons &out)
+{
+    size_t cnt = out.size();
+    PolyTreeToExPolygons(clipper_do_polytree(ClipperLib::ctUnion, ClipperUtils::ExPolygonsProvider(subject), ClipperUtils::EmptyPathsProvider(), ClipperLib::pftNonZero), out);
+    account_sink(out.size() - cnt);
+}
 Slic3r::ExPolygons union_ex(const Slic3r::Surfaces &subject)
     { return PolyTreeToExPolygons(clipper_do_polytree(ClipperLib::ctUnion, ClipperUtils::SurfacesProvider(subject), ClipperUtils::EmptyPathsProvider(), ClipperLib::pftNonZero)); }
 // BBS
@@ -41,6 +41,17 @@ enum class ApplySafetyOffset {
 };
 
 namespace ClipperUtils {
+    // Debug accounting of the sink overloads (offset_ex / union_ex appending into caller
+    // storage): how many calls went through them and how many ExPolygons were written
+    // straight into caller storage instead of through a returned temporary. Lets production
+    // jobs verify the savings, see the log line at the end of Print::process().
+    struct SinkStats {
+        size_t calls;
+        size_t expolygons;
+    };
+    SinkStats sink_stats();
+    void      reset_sink_stats();
+
     class PathsProviderIteratorBase {
     public:
         using value_type        = Points;
@@ -346,6 +357,12 @@ Slic3r::ExPolygons offset_ex(const Slic3r::Polygons &polygons, const float delta
 Slic3r::ExPolygons offset_ex(const Slic3r::ExPolygon &expolygon, const float delta, ClipperLib::JoinType joinType = DefaultJoinType, double miterLimit = DefaultMiterLimit);
 Slic3r::ExPolygons offset_ex(const Slic3r::ExPolygons &expolygons, const float delta, ClipperLib::JoinType joinType = DefaultJoinType, double miterLimit = DefaultMiterLimit);
 Slic3r::ExPolygons offset_ex(const Slic3r::Surfaces &surfaces, const float delta, ClipperLib::JoinType joinType = DefaultJoinType, double miterLimit = DefaultMiterLimit);
+// Sink overloads appending the result directly into caller provided (ideally pre-reserved)
+// storage, sparing the returned temporary and its element moves on append heavy call sites.
+// Accounted by ClipperUtils::sink_stats().
+void offset_ex(const Slic3r::Polygons &polygons, const float delta, Slic3r::ExPolygons &out, ClipperLib::JoinType joinType = DefaultJoinType, double miterLimit = DefaultMiterLimit);
+void offset_ex(const Slic3r::ExPolygon &expolygon, const float delta, Slic3r::ExPolygons &out, ClipperLib::JoinType joinType = DefaultJoinType, double miterLimit = DefaultMiterLimit);
+void offset_ex(const Slic3r::ExPolygons &expolygons, const float delta, Slic3r::ExPolygons &out, ClipperLib::JoinType joinType = DefaultJoinType, double miterLimit = DefaultMiterLimit);
 // BBS
 inline Slic3r::ExPolygons offset_ex(const Slic3r::Polygon &polygon, const float delta, ClipperLib::JoinType joinType = DefaultJoinType, double miterLimit = DefaultMiterLimit)
 {
@@ -424,6 +441,24 @@ inline Slic3r::ExPolygons opening_ex(const Slic3r::Surfaces &surfaces, const flo
 Slic3r::Lines _clipper_ln(ClipperLib::ClipType clipType, const Slic3r::Lines &subject, const Slic3r::Polygons &clip);
 
 // Safety offset is applied to the clipping polygons only.
+// Fused multi-operand booleans. ClipperLib implicitly unites all subject paths and all clip
+// paths of one execution (non-zero filling rule), thus several polygon sets may be combined
+// and subtracted / intersected in a single Clipper execution without materializing their
+// unions first.
+Slic3r::Polygons   diff(std::initializer_list<const Slic3r::Polygons*> subjects, std::initializer_list<const Slic3r::Polygons*> clips);
+Slic3r::Polygons   intersection(std::initializer_list<const Slic3r::Polygons*> subjects, std::initializer_list<const Slic3r::Polygons*> clips);
+Slic3r::Polygons   union_(std::initializer_list<const Slic3r::Polygons*> subjects);
+Slic3r::ExPolygons diff_ex(std::initializer_list<const Slic3r::Polygons*> subjects, std::initializer_list<const Slic3r::Polygons*> clips);
+Slic3r::ExPolygons intersection_ex(std::initializer_list<const Slic3r::Polygons*> subjects, std::initializer_list<const Slic3r::Polygons*> clips);
+Slic3r::ExPolygons union_ex(std::initializer_list<const Slic3r::Polygons*> subjects);
+inline Slic3r::Polygons diff(const Slic3r::Polygons &subject, std::initializer_list<const Slic3r::Polygons*> clips)
+    { return diff({ &subject }, clips); }
+inline Slic3r::Polygons intersection(const Slic3r::Polygons &subject, std::initializer_list<const Slic3r::Polygons*> clips)
+    { return intersection({ &subject }, clips); }
+inline Slic3r::ExPolygons diff_ex(const Slic3r::Polygons &subject, std::initializer_list<const Slic3r::Polygons*> clips)
+    { return diff_ex({ &subject }, clips); }
+inline Slic3r::ExPolygons intersection_ex(const Slic3r::Polygons &subject, std::initializer_list<const Slic3r::Polygons*> clips)
+    { return intersection_ex({ &subject }, clips); }
 Slic3r::Polygons   diff(const Slic3r::Polygon &subject, const Slic3r::Polygon &clip, ApplySafetyOffset do_safety_offset = ApplySafetyOffset::No);
 Slic3r::Polygons   diff(const Slic3r::Polygons &subject, const Slic3r::Polygons &clip, ApplySafetyOffset do_safety_offset = ApplySafetyOffset::No);
 Slic3r::Polygons   diff(const Slic3r::Polygons &subject, const Slic3r::ExPolygons &clip, ApplySafetyOffset do_safety_offset = ApplySafetyOffset::No);
@@ -540,6 +575,10 @@ Slic3r::Polygons union_(const Slic3r::Polygons &subject, const Slic3r::Polygons
 Slic3r::ExPolygons union_ex(const Slic3r::Polygons &subject, ClipperLib::PolyFillType fill_type = ClipperLib::pftNonZero);
 Slic3r::ExPolygons union_ex(const Slic3r::ExPolygons &subject);
 Slic3r::ExPolygons union_ex(const Slic3r::Surfaces &subject);
+// Sink overloads appending the result directly into caller provided (ideally pre-reserved)
+// storage, see the offset_ex() sink overloads above.
+void union_ex(const Slic3r::Polygons &subject, Slic3r::ExPolygons &out, ClipperLib::PolyFillType fill_type = ClipperLib::pftNonZero);
+void union_ex(const Slic3r::ExPolygons &subject, Slic3r::ExPolygons &out);
 
 Slic3r::ExPolygons union_ex(const Slic3r::ExPolygons& poly1, const Slic3r::ExPolygons& poly2, bool safety_offset_ = false);
 
@@ -23,6 +23,8 @@
 #include <boost/property_tree/ini_parser.hpp>
 #include <boost/format.hpp>
 #include <string.h>
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
 //BBS: add json support
 #include "nlohmann/json.hpp"
 
@@ -562,6 +564,56 @@ void ConfigBase::set_deserialize(std::initializer_list<SetDeserializeItem> items
 		this->set_deserialize(item.opt_key, item.opt_value, substitutions_ctxt, item.append);
 }
 
+void ConfigBase::set_deserialize(const std::vector<SetDeserializeItem> &items, ConfigSubstitutionContext &substitutions_ctxt)
+{
+    // Parse the values in parallel into standalone options. Only the plain path is taken here
+    // (known option, no shortcut expansion, no value substitution, no append); everything else
+    // is left to the serial pass below, which is also the only place writing into the config
+    // and the substitution context.
+    struct ParsedItem {
+        t_config_option_key           opt_key;
+        std::unique_ptr<ConfigOption> opt;
+    };
+    std::vector<ParsedItem> parsed(items.size());
+    if (const ConfigDef *def = this->def(); def != nullptr)
+        tbb::parallel_for(tbb::blocked_range<size_t>(0, items.size()), [this, &items, &parsed, &substitutions_ctxt, def](const tbb::blocked_range<size_t> &range) {
+            for (size_t i = range.begin(); i < range.end(); ++i) {
+                const SetDeserializeItem &item = items[i];
+                if (item.append)
+                    continue;
+                t_config_option_key opt_key = item.opt_key;
+                std::string         value   = item.opt_value;
+                this->handle_legacy(opt_key, value);
+                if (opt_key.empty())
+                    // Unrecognized key, to be reported by the serial pass.
+                    continue;
+                const ConfigOptionDef *optdef = def->get(opt_key);
+                if (optdef == nullptr || ! optdef->shortcut.empty() ||
+                    // Vectors of bools deserialize through deserialize_with_substitutions(), see set_deserialize_raw().
+                    (optdef->type == coBools && substitutions_ctxt.rule != ForwardCompatibilitySubstitutionRule::Disable))
+                    continue;
+                std::unique_ptr<ConfigOption> opt(optdef->create_default_option());
+                try {
+                    if (opt->deserialize(value, false)) {
+                        parsed[i].opt_key = std::move(opt_key);
+                        parsed[i].opt     = std::move(opt);
+                    }
+                    // On failure the serial pass repeats the deserialization and handles the
+                    // possible enum / bool substitution including its logging.
+                } catch (...) {
+                    // Let the serial pass throw deterministically.
+                }
+            }
+        });
+    // Commit the parsed options and process the remaining items in the original order, so that
+    // substitution logging, unknown key reporting and thrown exceptions match per-item calls.
+    for (size_t i = 0; i < items.size(); ++ i)
+        if (parsed[i].opt != nullptr)
+            this->option(parsed[i].opt_key, true)->set(parsed[i].opt.get());
+        else
+            this->set_deserialize(items[i].opt_key, items[i].opt_value, substitutions_ctxt, items[i].append);
+}
+
 bool ConfigBase::set_deserialize_raw(const t_config_option_key &opt_key_src, const std::string &value, ConfigSubstitutionContext& substitutions_ctxt, bool append)
 {
     t_config_option_key    opt_key = opt_key_src;
@@ -796,6 +848,8 @@ int ConfigBase::load_from_json(const std::string &file, ConfigSubstitutionContex
             BOOST_LOG_TRIVIAL(error) << __FUNCTION__ << ": no config defs!";
             return -1;
         }
+        // Config options are collected first and deserialized in one batch, which parses the values in parallel.
+        std::vector<SetDeserializeItem> deserialize_items;
         //parse the json elements
         for (auto it = j.begin(); it != j.end(); it++) {
             if (boost::iequals(it.key(),BBL_JSON_KEY_VERSION)) {
@@ -836,7 +890,7 @@ int ConfigBase::load_from_json(const std::string &file, ConfigSubstitutionContex
 
                 if (it.value().is_string()) {
                     //bool test1 = (it.key() == std::string("end_gcode"));
-                    this->set_deserialize(opt_key, it.value(), substitution_context);
+                    deserialize_items.emplace_back(opt_key, it.value().get<std::string>());
                     //some logic for special values
                     if (opt_key == "support_type") {
                         //std::string new_value = dynamic_cast<ConfigOptionString*>(this->option(opt_key))->value;
@@ -903,7 +957,7 @@ int ConfigBase::load_from_json(const std::string &file, ConfigSubstitutionContex
                         }
                     }
                     if (valid)
-                        this->set_deserialize(opt_key, value_str, substitution_context);
+                        deserialize_items.emplace_back(opt_key, value_str);
                 }
                 else {
                     //should not happen
@@ -911,6 +965,7 @@ int ConfigBase::load_from_json(const std::string &file, ConfigSubstitutionContex
                 }
             }
         }
+        this->set_deserialize(deserialize_items, substitution_context);
         if (!different_settings_append.empty()) {
             if (!new_support_style.empty()) {
                 ConfigOptionEnum<SupportMaterialStyle>* opt = this->option<ConfigOptionEnum<SupportMaterialStyle>>("support_style", true);
@@ -80,6 +80,22 @@ extern bool         unescape_strings_cstyle(const std::string &str, std::vector<
 
 extern std::string  escape_ampersand(const std::string& str);
 
+// Parse a double with the decimal point independent of the current C++ locale,
+// skipping leading whitespace the way the locale-aware stream extraction used to.
+// Returns false when no number was consumed.
+inline bool parse_double_decimal_point(const std::string &str, double &out)
+{
+    std::string_view sv(str);
+    if (size_t begin = sv.find_first_not_of(" \t"); begin != std::string_view::npos)
+        sv.remove_prefix(begin);
+    size_t pos = 0;
+    double value = string_to_double_decimal_point(sv, &pos);
+    if (pos == 0)
+        return false;
+    out = value;
+    return true;
+}
+
 namespace ConfigHelpers {
 	inline bool looks_like_enum_value(std::string value)
 	{
@@ -577,17 +593,13 @@ public:
 
     std::string serialize() const override
     {
-        std::ostringstream ss;
-        ss << this->value;
-        return ss.str();
+        return float_to_string_decimal_point(this->value);
     }
 
     bool deserialize(const std::string &str, bool append = false) override
     {
         UNUSED(append);
-        std::istringstream iss(str);
-        iss >> this->value;
-        return !iss.fail();
+        return parse_double_decimal_point(str, this->value);
     }
 
     ConfigOptionFloat& operator=(const ConfigOption *opt)
@@ -667,9 +679,8 @@ public:
         		else
         			throw ConfigurationError("Deserializing nil into a non-nullable object");
         	} else {
-	            std::istringstream iss(item_str);
-	            double value;
-	            iss >> value;
+	            double value = 0.;
+	            parse_double_decimal_point(item_str, value);
 	            this->values.push_back(value);
 	        }
         }
@@ -685,7 +696,7 @@ public:
 protected:
 	void serialize_single_value(std::ostringstream &ss, const double v) const {
         	if (std::isfinite(v))
-	            ss << v;
+	            ss << float_to_string_decimal_point(v);
 	        else if (std::isnan(v)) {
         		if (NULLABLE)
         			ss << "nil";
@@ -950,20 +961,14 @@ public:
 
     std::string serialize() const override
     {
-        std::ostringstream ss;
-        ss << this->value;
-        std::string s(ss.str());
-        s += "%";
-        return s;
+        return float_to_string_decimal_point(this->value) + "%";
     }
 
     bool deserialize(const std::string &str, bool append = false) override
     {
         UNUSED(append);
         // don't try to parse the trailing % since it's optional
-        std::istringstream iss(str);
-        iss >> this->value;
-        return !iss.fail();
+        return parse_double_decimal_point(str, this->value);
     }
 
 private:
@@ -1064,9 +1069,7 @@ public:
 
     std::string serialize() const override
     {
-        std::ostringstream ss;
-        ss << this->value;
-        std::string s(ss.str());
+        std::string s = float_to_string_decimal_point(this->value);
         if (this->percent) s += "%";
         return s;
     }
@@ -1075,9 +1078,7 @@ public:
     {
         UNUSED(append);
         this->percent = str.find_first_of("%") != std::string::npos;
-        std::istringstream iss(str);
-        iss >> this->value;
-        return !iss.fail();
+        return parse_double_decimal_point(str, this->value);
     }
 
 private:
@@ -1153,9 +1154,8 @@ public:
                     throw ConfigurationError("Deserializing nil into a non-nullable object");
             } else {
                 bool percent = item_str.find_first_of("%") != std::string::npos;
-                std::istringstream iss(item_str);
-                double value;
-                iss >> value;
+                double value = 0.;
+                parse_double_decimal_point(item_str, value);
                 this->values.push_back({ value, percent });
             }
         }
@@ -1171,7 +1171,7 @@ public:
 protected:
     void serialize_single_value(std::ostringstream &ss, const FloatOrPercent &v) const {
             if (std::isfinite(v.value)) {
-                ss << v.value;
+                ss << float_to_string_decimal_point(v.value);
                 if (v.percent)
                     ss << "%";
             } else if (std::isnan(v.value)) {
@@ -1230,11 +1230,7 @@ public:
 
     std::string serialize() const override
     {
-        std::ostringstream ss;
-        ss << this->value(0);
-        ss << ",";
-        ss << this->value(1);
-        return ss.str();
+        return float_to_string_decimal_point(this->value(0)) + "," + float_to_string_decimal_point(this->value(1));
     }
 
     bool deserialize(const std::string &str, bool append = false) override
@@ -1269,27 +1265,22 @@ public:
 
     std::string serialize() const override
     {
-        std::ostringstream ss;
+        std::string out;
         for (Pointfs::const_iterator it = this->values.begin(); it != this->values.end(); ++it) {
-            if (it - this->values.begin() != 0) ss << ",";
-            ss << (*it)(0);
-            ss << "x";
-            ss << (*it)(1);
+            if (it - this->values.begin() != 0) out += ",";
+            out += float_to_string_decimal_point((*it)(0));
+            out += "x";
+            out += float_to_string_decimal_point((*it)(1));
         }
-        return ss.str();
+        return out;
     }
 
     std::vector<std::string> vserialize() const override
     {
         std::vector<std::string> vv;
         for (Pointfs::const_iterator it = this->values.begin(); it != this->values.end(); ++it) {
-            std::ostringstream ss;
             //BBS: add json format
-            //ss << *it;
-            ss << (*it)(0);
-            ss << "x";
-            ss << (*it)(1);
-            vv.push_back(ss.str());
+            vv.push_back(float_to_string_decimal_point((*it)(0)) + "x" + float_to_string_decimal_point((*it)(1)));
         }
         return vv;
     }
@@ -1305,9 +1296,9 @@ public:
             std::istringstream iss(point_str);
             std::string coord_str;
             if (std::getline(iss, coord_str, 'x')) {
-                std::istringstream(coord_str) >> point(0);
+                parse_double_decimal_point(coord_str, point(0));
                 if (std::getline(iss, coord_str, 'x')) {
-                    std::istringstream(coord_str) >> point(1);
+                    parse_double_decimal_point(coord_str, point(1));
                 }
             }
             this->values.push_back(point);
@@ -1346,13 +1337,9 @@ public:
 
     std::string serialize() const override
     {
-        std::ostringstream ss;
-        ss << this->value(0);
-        ss << ",";
-        ss << this->value(1);
-        ss << ",";
-        ss << this->value(2);
-        return ss.str();
+        return float_to_string_decimal_point(this->value(0)) + "," +
+               float_to_string_decimal_point(this->value(1)) + "," +
+               float_to_string_decimal_point(this->value(2));
     }
 
     bool deserialize(const std::string &str, bool append = false) override
@@ -2139,6 +2126,12 @@ public:
     };
 	// May throw BadOptionTypeException() if the operation fails.
     void set_deserialize(std::initializer_list<SetDeserializeItem> items, ConfigSubstitutionContext& substitutions);
+    // Batch deserialization of many key / value pairs, used when applying a whole config file
+    // at once (for example the project config embedded in a 3MF). Values of independent keys
+    // are parsed in parallel into standalone options, which are then committed into this config
+    // and the substitution context serially, so the observable behavior (substitution logging,
+    // unknown key reporting, thrown exceptions) matches calling set_deserialize() per item.
+    void set_deserialize(const std::vector<SetDeserializeItem> &items, ConfigSubstitutionContext& substitutions);
     void set_deserialize_strict(std::initializer_list<SetDeserializeItem> items)
         { ConfigSubstitutionContext ctxt{ ForwardCompatibilitySubstitutionRule::Disable }; this->set_deserialize(items, ctxt); }
 
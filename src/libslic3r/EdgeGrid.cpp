@@ -1,8 +1,11 @@
 #include <algorithm>
 #include <vector>
 #include <float.h>
+#include <atomic>
 #include <unordered_map>
 
+#include <tbb/parallel_for.h>
+
 #include <png.h>
 
 #include "libslic3r.h"
@@ -160,175 +163,94 @@ void EdgeGrid::Grid::create_from_m_contours(coord_t resolution)
 	m_rows = (m_bbox.max(1) - m_bbox.min(1) + m_resolution - 1) / m_resolution;
 	m_cells.assign(m_rows * m_cols, Cell());
 
-	// 3) First round of contour rasterization, count the edges per grid cell.
-	for (size_t i = 0; i < m_contours.size(); ++ i) {
-		const Contour &contour = m_contours[i];
-		for (size_t j = 0; j < contour.num_segments(); ++ j) {
-			// End points of the line segment.
-			Slic3r::Point p1(contour.segment_start(j));
-			Slic3r::Point p2(contour.segment_end(j));
-			p1(0) -= m_bbox.min(0);
-			p1(1) -= m_bbox.min(1);
-			p2(0) -= m_bbox.min(0);
-			p2(1) -= m_bbox.min(1);
-		   	// Get the cells of the end points.
-		    coord_t ix    = p1(0) / m_resolution;
-		    coord_t iy    = p1(1) / m_resolution;
-		    coord_t ixb   = p2(0) / m_resolution;
-		    coord_t iyb   = p2(1) / m_resolution;
-			assert(ix >= 0 && size_t(ix) < m_cols);
-			assert(iy >= 0 && size_t(iy) < m_rows);
-			assert(ixb >= 0 && size_t(ixb) < m_cols);
-			assert(iyb >= 0 && size_t(iyb) < m_rows);
-			// Account for the end points.
-			++ m_cells[iy*m_cols+ix].end;
-			if (ix == ixb && iy == iyb)
-				// Both ends fall into the same cell.
-				continue;
-		    // Raster the centeral part of the line.
-			coord_t dx = std::abs(p2(0) - p1(0));
-			coord_t dy = std::abs(p2(1) - p1(1));
-			if (p1(0) < p2(0)) {
-				int64_t ex = int64_t((ix + 1)*m_resolution - p1(0)) * int64_t(dy);
-				if (p1(1) < p2(1)) {
-					// x positive, y positive
-					int64_t ey = int64_t((iy + 1)*m_resolution - p1(1)) * int64_t(dx);
-					do {
-						assert(ix <= ixb && iy <= iyb);
-						if (ex < ey) {
-							ey -= ex;
-							ex = int64_t(dy) * m_resolution;
-							ix += 1;
-						}
-						else if (ex == ey) {
-							ex = int64_t(dy) * m_resolution;
-							ey = int64_t(dx) * m_resolution;
-							ix += 1;
-							iy += 1;
-						}
-						else {
-							assert(ex > ey);
-							ex -= ey;
-							ey = int64_t(dx) * m_resolution;
-							iy += 1;
-						}
-						++m_cells[iy*m_cols + ix].end;
-					} while (ix != ixb || iy != iyb);
-				}
-				else {
-					// x positive, y non positive
-					int64_t ey = int64_t(p1(1) - iy*m_resolution) * int64_t(dx);
-					do {
-						assert(ix <= ixb && iy >= iyb);
-						if (ex <= ey) {
-							ey -= ex;
-							ex = int64_t(dy) * m_resolution;
-							ix += 1;
-						}
-						else {
-							ex -= ey;
-							ey = int64_t(dx) * m_resolution;
-							iy -= 1;
-						}
-						++m_cells[iy*m_cols + ix].end;
-					} while (ix != ixb || iy != iyb);
-				}
+	// 3) Flatten the contour segments, so both rasterization passes can be parallelized
+	// with an even load even when a single long contour dominates.
+	size_t num_segments = 0;
+	for (const Contour &contour : m_contours)
+		num_segments += contour.num_segments();
+	std::vector<std::pair<size_t, size_t>> segments;
+	segments.reserve(num_segments);
+	for (size_t i = 0; i < m_contours.size(); ++ i)
+		for (size_t j = 0; j < m_contours[i].num_segments(); ++ j)
+			segments.emplace_back(i, j);
+
+	// First round of contour rasterization, count the edges per grid cell in parallel.
+	// Both rounds share visit_cells_intersecting_line(), thus the cells counted here match
+	// the cells visited by the scatter round below exactly.
+	std::vector<std::atomic<size_t>> cell_counts(m_cells.size());
+	{
+		struct CountingVisitor {
+			std::vector<std::atomic<size_t>> &counts;
+			size_t 							  cols;
+			inline bool operator()(coord_t iy, coord_t ix) {
+				counts[iy * cols + ix].fetch_add(1, std::memory_order_relaxed);
+				return true;
 			}
-			else {
-				int64_t ex = int64_t(p1(0) - ix*m_resolution) * int64_t(dy);
-				if (p1(1) < p2(1)) {
-					// x non positive, y positive
-					int64_t ey = int64_t((iy + 1)*m_resolution - p1(1)) * int64_t(dx);
-					do {
-						assert(ix >= ixb && iy <= iyb);
-						if (ex < ey) {
-							ey -= ex;
-							ex = int64_t(dy) * m_resolution;
-							ix -= 1;
-						}
-						else {
-							assert(ex >= ey);
-							ex -= ey;
-							ey = int64_t(dx) * m_resolution;
-							iy += 1;
-						}
-						++m_cells[iy*m_cols + ix].end;
-					} while (ix != ixb || iy != iyb);
+		};
+		tbb::parallel_for(
+			tbb::blocked_range<size_t>(0, segments.size(), 256),
+			[this, &segments, &cell_counts](const tbb::blocked_range<size_t> &range) {
+				CountingVisitor visitor { cell_counts, m_cols };
+				for (size_t k = range.begin(); k < range.end(); ++ k) {
+					const Contour &contour = m_contours[segments[k].first];
+					this->visit_cells_intersecting_line(contour.segment_start(segments[k].second), contour.segment_end(segments[k].second), visitor);
 				}
-				else {
-					// x non positive, y non positive
-					int64_t ey = int64_t(p1(1) - iy*m_resolution) * int64_t(dx);
-					do {
-						assert(ix >= ixb && iy >= iyb);
-						if (ex < ey) {
-							ey -= ex;
-							ex = int64_t(dy) * m_resolution;
-							ix -= 1;
-						}
-						else if (ex == ey) {
-							// The lower edge of a grid cell belongs to the cell.
-							// Handle the case where the ray may cross the lower left corner of a cell in a general case,
-							// or a left or lower edge in a degenerate case (horizontal or vertical line).
-							if (dx > 0) {
-								ex = int64_t(dy) * m_resolution;
-								ix -= 1;
-							}
-							if (dy > 0) {
-								ey = int64_t(dx) * m_resolution;
-								iy -= 1;
-							}
-						}
-						else {
-							assert(ex > ey);
-							ex -= ey;
-							ey = int64_t(dx) * m_resolution;
-							iy -= 1;
-						}
-						++m_cells[iy*m_cols + ix].end;
-					} while (ix != ixb || iy != iyb);
-				}
-			}
-		}
+			});
 	}
 
 	// 4) Prefix sum the numbers of hits per cells to get an index into m_cell_data.
-	size_t cnt = m_cells.front().end;
-	for (size_t i = 1; i < m_cells.size(); ++ i) {
+	// The serial scan is negligible next to the rasterization rounds.
+	size_t cnt = 0;
+	for (size_t i = 0; i < m_cells.size(); ++ i) {
 		m_cells[i].begin = cnt;
-		cnt += m_cells[i].end;
+		cnt += cell_counts[i].load(std::memory_order_relaxed);
 		m_cells[i].end = cnt;
 	}
 
 	// 5) Allocate the cell data.
 	m_cell_data.assign(cnt, std::pair<size_t, size_t>(size_t(-1), size_t(-1)));
 
-	// 6) Finally fill in m_cell_data by rasterizing the lines once again.
-	for (size_t i = 0; i < m_cells.size(); ++i)
-		m_cells[i].end = m_cells[i].begin;
+	// 6) Finally fill in m_cell_data by rasterizing the lines once again, scattering in
+	// parallel through per-cell atomic write cursors. cell_counts is reused as the cursors,
+	// rebased to the cell begins.
+	for (size_t i = 0; i < m_cells.size(); ++ i)
+		cell_counts[i].store(m_cells[i].begin, std::memory_order_relaxed);
 
-	struct Visitor {
-		Visitor(std::vector<std::pair<size_t, size_t>> &cell_data, std::vector<Cell> &cells, size_t cols) :
-			cell_data(cell_data), cells(cells), cols(cols), i(0), j(0) {}
-
-		inline bool operator()(coord_t iy, coord_t ix) {
-			cell_data[cells[iy*cols + ix].end++] = std::pair<size_t, size_t>(i, j);
-			// Continue traversing the grid along the edge.
-			return true;
-		}
-
-		std::vector<std::pair<size_t, size_t>> &cell_data;
-		std::vector<Cell> 					   &cells;
-		size_t									cols;
-		size_t 									i;
-		size_t 									j;
-	} visitor(m_cell_data, m_cells, m_cols);
-
-	assert(visitor.i == 0);
-	for (; visitor.i < m_contours.size(); ++ visitor.i) {
-		const Contour &contour = m_contours[visitor.i];
-		for (visitor.j = 0; visitor.j < contour.num_segments(); ++ visitor.j)
-			this->visit_cells_intersecting_line(contour.segment_start(visitor.j), contour.segment_end(visitor.j), visitor);
+	{
+		struct ScatterVisitor {
+			std::vector<std::pair<size_t, size_t>> &cell_data;
+			std::vector<std::atomic<size_t>> 	   &cursors;
+			size_t 									cols;
+			size_t 									i;
+			size_t 									j;
+			inline bool operator()(coord_t iy, coord_t ix) {
+				cell_data[cursors[iy * cols + ix].fetch_add(1, std::memory_order_relaxed)] = std::pair<size_t, size_t>(i, j);
+				// Continue traversing the grid along the edge.
+				return true;
+			}
+		};
+		tbb::parallel_for(
+			tbb::blocked_range<size_t>(0, segments.size(), 256),
+			[this, &segments, &cell_counts](const tbb::blocked_range<size_t> &range) {
+				ScatterVisitor visitor { m_cell_data, cell_counts, m_cols, 0, 0 };
+				for (size_t k = range.begin(); k < range.end(); ++ k) {
+					const Contour &contour = m_contours[segments[k].first];
+					visitor.i = segments[k].first;
+					visitor.j = segments[k].second;
+					this->visit_cells_intersecting_line(contour.segment_start(visitor.j), contour.segment_end(visitor.j), visitor);
+				}
+			});
 	}
+
+	// The parallel scatter interleaves edges of different segments inside a cell. Sort each
+	// cell by (contour, segment) to restore the exact layout the serial rasterization produced,
+	// keeping the grid bitwise deterministic run to run.
+	tbb::parallel_for(
+		tbb::blocked_range<size_t>(0, m_cells.size(), 1024),
+		[this](const tbb::blocked_range<size_t> &range) {
+			for (size_t i = range.begin(); i < range.end(); ++ i)
+				std::sort(m_cell_data.begin() + m_cells[i].begin, m_cell_data.begin() + m_cells[i].end);
+		});
 }
 
 #if 0
@@ -6,9 +6,12 @@
 #include "Polyline.hpp"
 
 #include <assert.h>
+#include <new>
 #include <string_view>
 #include <numeric>
 
+#include <oneapi/tbb/scalable_allocator.h>
+
 namespace Slic3r {
 
 class ExPolygon;
@@ -105,6 +108,18 @@ inline bool is_bridge(ExtrusionRole role) {
 class ExtrusionEntity
 {
 public:
+    // Extrusion entities are allocated in the millions from the TBB worker threads and walked
+    // again by the G-code export. Route their storage to the TBB scalable allocator (inherited
+    // by all the concrete entity classes below and by ExtrusionEntityCollection): the per-thread
+    // memory pools remove the allocation lock contention, and entities created together by one
+    // milestone end up adjacent in memory, which the export walk benefits from.
+    void* operator new(size_t size) {
+        if (void *ptr = scalable_malloc(size))
+            return ptr;
+        throw std::bad_alloc();
+    }
+    void operator delete(void *ptr) noexcept { scalable_free(ptr); }
+
     virtual ExtrusionRole role() const = 0;
     virtual bool is_collection() const { return false; }
     virtual bool is_loop() const { return false; }
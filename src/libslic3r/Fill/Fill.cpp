@@ -9,7 +9,11 @@
 ///|/
 #include <assert.h>
 #include <stdio.h>
+#include <cstring>
+#include <deque>
 #include <memory>
+#include <mutex>
+#include <unordered_map>
 
 #include "../ClipperUtils.hpp"
 #include "../Geometry.hpp"
@@ -704,6 +708,148 @@ void export_group_fills_to_svg(const char *path, const std::vector<SurfaceFill>
 }
 #endif
 
+namespace {
+
+// Sparse infill regions of prismatic parts often repeat unchanged through long stacks of layers,
+// generating the very same extrusions over and over. The cache below memoizes the extrusions
+// produced for one fill island, keyed by everything that determines the filler output.
+// Only patterns whose result does not depend on the slicing height may be cached; the per-layer
+// direction alternation is folded into the key, so a hit reproduces the entities verbatim.
+struct FillExtrusionsCacheKey
+{
+    InfillPattern            pattern;
+    // Index into the filler's per-layer angle rotation. The stock rotation alternates with
+    // period 2 and honeycomb rotates with period 3, hence modulo 6 covers both.
+    uint32_t                 layer_angle_slot;
+    float                    angle;
+    float                    bridge_angle;
+    coordf_t                 spacing;
+    coord_t                  link_max_length;
+    coord_t                  loop_clipping;
+    float                    density;
+    float                    anchor_length;
+    float                    anchor_length_max;
+    double                   resolution;
+    bool                     dont_adjust;
+    bool                     can_reverse;
+    float                    flow_width;
+    float                    flow_height;
+    float                    flow_nozzle_diameter;
+    bool                     flow_bridge;
+    ExtrusionRole            extrusion_role;
+    bool                     using_internal_flow;
+    float                    no_extrusion_overlap;
+    // The only region config field the cacheable fillers read. The config itself must not be
+    // keyed by pointer: PrintRegions are shared across objects and mutated in place by apply().
+    double                   filter_out_gap_fill;
+    // Anchors the pattern phase of the rectilinear family fillers. Objects with identical
+    // islands but different bounding boxes must not share extrusions.
+    BoundingBox              bounding_box;
+    ExPolygon                island;
+    ExPolygons               no_overlap_expolygons;
+
+    bool matches(const FillExtrusionsCacheKey &rhs) const {
+        return pattern == rhs.pattern && layer_angle_slot == rhs.layer_angle_slot && angle == rhs.angle &&
+               bridge_angle == rhs.bridge_angle && spacing == rhs.spacing && link_max_length == rhs.link_max_length &&
+               loop_clipping == rhs.loop_clipping && density == rhs.density && anchor_length == rhs.anchor_length &&
+               anchor_length_max == rhs.anchor_length_max && resolution == rhs.resolution &&
+               dont_adjust == rhs.dont_adjust && can_reverse == rhs.can_reverse && flow_width == rhs.flow_width &&
+               flow_height == rhs.flow_height && flow_nozzle_diameter == rhs.flow_nozzle_diameter &&
+               flow_bridge == rhs.flow_bridge && extrusion_role == rhs.extrusion_role &&
+               using_internal_flow == rhs.using_internal_flow && no_extrusion_overlap == rhs.no_extrusion_overlap &&
+               filter_out_gap_fill == rhs.filter_out_gap_fill &&
+               bounding_box.min == rhs.bounding_box.min && bounding_box.max == rhs.bounding_box.max &&
+               island == rhs.island && no_overlap_expolygons == rhs.no_overlap_expolygons;
+    }
+
+    uint64_t hash() const {
+        uint64_t seed = 0xcbf29ce484222325ull;
+        auto combine = [&seed](uint64_t v) { seed ^= v + 0x9e3779b97f4a7c15ull + (seed << 6) + (seed >> 2); };
+        auto combine_double = [&combine](double v) { uint64_t u; std::memcpy(&u, &v, sizeof(u)); combine(u); };
+        auto combine_polygon = [&combine](const Polygon &poly) {
+            combine(uint64_t(poly.points.size()));
+            for (const Point &pt : poly.points) {
+                combine(uint64_t(pt.x()));
+                combine(uint64_t(pt.y()));
+            }
+        };
+        auto combine_expolygon = [&combine, &combine_polygon](const ExPolygon &expoly) {
+            combine_polygon(expoly.contour);
+            combine(uint64_t(expoly.holes.size()));
+            for (const Polygon &hole : expoly.holes)
+                combine_polygon(hole);
+        };
+        combine(uint64_t(pattern));
+        combine(uint64_t(layer_angle_slot));
+        combine_double(double(angle));
+        combine_double(double(bridge_angle));
+        combine_double(double(spacing));
+        combine(uint64_t(link_max_length));
+        combine(uint64_t(loop_clipping));
+        combine_double(double(density));
+        combine_double(double(anchor_length));
+        combine_double(double(anchor_length_max));
+        combine_double(resolution);
+        combine(uint64_t(dont_adjust));
+        combine(uint64_t(can_reverse));
+        combine_double(double(flow_width));
+        combine_double(double(flow_height));
+        combine_double(double(flow_nozzle_diameter));
+        combine(uint64_t(flow_bridge));
+        combine(uint64_t(extrusion_role));
+        combine(uint64_t(using_internal_flow));
+        combine_double(double(no_extrusion_overlap));
+        combine_double(filter_out_gap_fill);
+        combine(uint64_t(bounding_box.min.x()));
+        combine(uint64_t(bounding_box.min.y()));
+        combine(uint64_t(bounding_box.max.x()));
+        combine(uint64_t(bounding_box.max.y()));
+        combine_expolygon(island);
+        combine(uint64_t(no_overlap_expolygons.size()));
+        for (const ExPolygon &expoly : no_overlap_expolygons)
+            combine_expolygon(expoly);
+        return seed;
+    }
+};
+
+struct FillExtrusionsCacheEntry
+{
+    FillExtrusionsCacheKey    key;
+    // Owns the cached entities, they are cloned into the layer output on every hit.
+    ExtrusionEntityCollection extrusions;
+};
+
+std::mutex                                            s_fill_extrusions_cache_mutex;
+std::unordered_map<uint64_t, FillExtrusionsCacheEntry> s_fill_extrusions_cache;
+std::deque<uint64_t>                                  s_fill_extrusions_cache_fifo;
+constexpr size_t                                       FillExtrusionsCacheCapacity = 64;
+
+// Patterns whose extrusions depend solely on the 2D inputs captured by FillExtrusionsCacheKey.
+// Everything z dependent (gyroid, the cubic family, lightning, 3D honeycomb ...) regenerates
+// from scratch on every layer and must not be cached.
+bool fill_extrusions_cacheable(InfillPattern pattern)
+{
+    switch (pattern) {
+    case ipRectilinear:
+    case ipMonotonic:
+    case ipMonotonicLine:
+    case ipAlignedRectilinear:
+    case ipGrid:
+    case ipTriangles:
+    case ipStars:
+    case ipLine:
+    case ipHoneycomb:
+    case ipHilbertCurve:
+    case ipArchimedeanChords:
+    case ipOctagramSpiral:
+        return true;
+    default:
+        return false;
+    }
+}
+
+} // namespace
+
 // friend to Layer
 void Layer::make_fills(FillAdaptive::Octree* adaptive_fill_octree, FillAdaptive::Octree* support_fill_octree, FillLightning::Generator* lightning_generator)
 {
@@ -779,7 +925,12 @@ void Layer::make_fills(FillAdaptive::Octree* adaptive_fill_octree, FillAdaptive:
 		if (surface_fill.params.pattern == ipGrid)
 			params.can_reverse = false;
 		for (ExPolygon& expoly : surface_fill.expolygons) {
-            f->no_overlap_expolygons = intersection_ex(surface_fill.no_overlap_expolygons, ExPolygons() = {expoly}, ApplySafetyOffset::Yes);
+            // Skip the clipping when there is nothing to clip against and hand the island
+            // over without copying it into a temporary ExPolygons.
+            if (surface_fill.no_overlap_expolygons.empty())
+                f->no_overlap_expolygons.clear();
+            else
+                f->no_overlap_expolygons = intersection_ex(surface_fill.no_overlap_expolygons, expoly, ApplySafetyOffset::Yes);
 			// Spacing is modified by the filler to indicate adjustments. Reset it for each expolygon.
 			f->spacing = surface_fill.params.spacing;
 			surface_fill.surface.expolygon = std::move(expoly);
@@ -789,9 +940,66 @@ void Layer::make_fills(FillAdaptive::Octree* adaptive_fill_octree, FillAdaptive:
 				params.dont_adjust = true;
 			}
 			// BBS: make fill
-			f->fill_surface_extrusion(&surface_fill.surface,
-				params,
-				m_regions[surface_fill.region_id]->fills.entities);
+			ExtrusionEntitiesPtr &out = m_regions[surface_fill.region_id]->fills.entities;
+			if (fill_extrusions_cacheable(surface_fill.params.pattern)) {
+				// Identical islands repeat through stacks of layers, reuse their extrusions.
+				FillExtrusionsCacheKey key;
+				key.pattern               = surface_fill.params.pattern;
+				key.layer_angle_slot      = uint32_t((f->layer_id / surface_fill.surface.thickness_layers) % 6);
+				key.angle                 = f->angle;
+				key.bridge_angle          = float(surface_fill.surface.bridge_angle);
+				key.spacing               = f->spacing;
+				key.link_max_length       = f->link_max_length;
+				key.loop_clipping         = f->loop_clipping;
+				key.density               = params.density;
+				key.anchor_length         = params.anchor_length;
+				key.anchor_length_max     = params.anchor_length_max;
+				key.resolution            = params.resolution;
+				key.dont_adjust           = params.dont_adjust;
+				key.can_reverse           = params.can_reverse;
+				key.flow_width            = params.flow.width();
+				key.flow_height           = params.flow.height();
+				key.flow_nozzle_diameter  = params.flow.nozzle_diameter();
+				key.flow_bridge           = params.flow.bridge();
+				key.extrusion_role        = params.extrusion_role;
+				key.using_internal_flow   = params.using_internal_flow;
+				key.no_extrusion_overlap  = params.no_extrusion_overlap;
+				key.filter_out_gap_fill   = params.config->filter_out_gap_fill.value;
+				key.bounding_box          = bbox;
+				key.island                = surface_fill.surface.expolygon;
+				key.no_overlap_expolygons = f->no_overlap_expolygons;
+				uint64_t hash = key.hash();
+				bool     hit  = false;
+				{
+					std::lock_guard<std::mutex> lock(s_fill_extrusions_cache_mutex);
+					auto it = s_fill_extrusions_cache.find(hash);
+					// Full comparison, a hash collision degrades into a cache miss.
+					if (it != s_fill_extrusions_cache.end() && it->second.key.matches(key)) {
+						out.reserve(out.size() + it->second.extrusions.entities.size());
+						for (const ExtrusionEntity *entity : it->second.extrusions.entities)
+							out.emplace_back(entity->clone());
+						hit = true;
+					}
+				}
+				if (! hit) {
+					size_t first_entity = out.size();
+					f->fill_surface_extrusion(&surface_fill.surface, params, out);
+					ExtrusionEntityCollection cached;
+					cached.entities.reserve(out.size() - first_entity);
+					for (size_t i = first_entity; i < out.size(); ++ i)
+						cached.entities.emplace_back(out[i]->clone());
+					std::lock_guard<std::mutex> lock(s_fill_extrusions_cache_mutex);
+					if (auto it = s_fill_extrusions_cache.find(hash); it == s_fill_extrusions_cache.end()) {
+						if (s_fill_extrusions_cache_fifo.size() >= FillExtrusionsCacheCapacity) {
+							s_fill_extrusions_cache.erase(s_fill_extrusions_cache_fifo.front());
+							s_fill_extrusions_cache_fifo.pop_front();
+						}
+						s_fill_extrusions_cache_fifo.emplace_back(hash);
+						s_fill_extrusions_cache.emplace(hash, FillExtrusionsCacheEntry{ std::move(key), std::move(cached) });
+					}
+				}
+			} else
+				f->fill_surface_extrusion(&surface_fill.surface, params, out);
 		}
     }
 
@@ -806,6 +1014,11 @@ void Layer::make_fills(FillAdaptive::Octree* adaptive_fill_octree, FillAdaptive:
 	        collection.entities.push_back(thin_fill->clone());
 	    }
 
+	// Cache which infill classes each region's fills contain, so ToolOrdering does not
+	// have to walk the fill extrusions again.
+	for (LayerRegion *layerm : m_regions)
+	    layerm->classify_fills();
+
 #ifndef NDEBUG
 	for (LayerRegion *layerm : m_regions)
 	    for (size_t i = 0; i < layerm->fills.entities.size(); ++ i)
@@ -1124,6 +1337,10 @@ void Layer::make_ironing()
 		// Regions up to j were processed.
 		i = j;
 	}
+
+	// Ironing appends to LayerRegion::fills, refresh the cached fill classification.
+	for (LayerRegion *layerm : m_regions)
+	    layerm->classify_fills();
 }
 
 } // namespace Slic3r
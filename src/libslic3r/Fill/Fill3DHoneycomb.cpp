@@ -1,3 +1,8 @@
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <unordered_map>
+
 #include "../ClipperUtils.hpp"
 #include "../ShortestPath.hpp"
 #include "../Surface.hpp"
@@ -74,16 +79,8 @@ static inline Pointfs zip(const std::vector<coordf_t> &x, const std::vector<coor
 // horizontal slice of a truncated regular octahedron with edge length 1.
 // curveType specifies which lines to print, 1 for vertical lines
 // (columns), 2 for horizontal lines (rows), and 3 for both.
-static std::vector<Pointfs> makeNormalisedGrid(coordf_t z, size_t gridWidth, size_t gridHeight, size_t curveType)
+static std::vector<Pointfs> makeNormalisedGrid(coordf_t offset, size_t gridWidth, size_t gridHeight, size_t curveType)
 {
-    // offset required to create a regular octagram
-    coordf_t octagramGap = coordf_t(0.5);
-    
-    // sawtooth wave function for range f($z) = [-$octagramGap .. $octagramGap]
-    coordf_t a = std::sqrt(coordf_t(2.));  // period
-    coordf_t wave = fabs(fmod(z, a) - a/2.)/a*4. - 1.;
-    coordf_t offset = wave * octagramGap;
-    
     std::vector<Pointfs> points;
     if ((curveType & 1) != 0) {
         for (size_t x = 0; x <= gridWidth; ++x) {
@@ -114,6 +111,53 @@ static std::vector<Pointfs> makeNormalisedGrid(coordf_t z, size_t gridWidth, siz
     return points;
 }
 
+namespace {
+
+// The truncated octahedron slice depends on z only through the triangular wave offset computed
+// in makeGrid(), so the generated grid template repeats whenever the wave phase repeats: every
+// island of a layer shares it and layers a multiple of the vertical period apart (as well as
+// the mirrored phase within one period) reuse it too. The templates are cached untranslated,
+// each island translates and clips its own copy.
+struct GridTemplateCacheKey
+{
+    coordf_t offset;
+    coord_t  gridSize;
+    size_t   gridWidth;
+    size_t   gridHeight;
+    size_t   curveType;
+
+    bool matches(const GridTemplateCacheKey &rhs) const {
+        return offset == rhs.offset && gridSize == rhs.gridSize && gridWidth == rhs.gridWidth &&
+               gridHeight == rhs.gridHeight && curveType == rhs.curveType;
+    }
+
+    uint64_t hash() const {
+        uint64_t seed = 0xcbf29ce484222325ull;
+        auto combine = [&seed](uint64_t v) { seed ^= v + 0x9e3779b97f4a7c15ull + (seed << 6) + (seed >> 2); };
+        uint64_t offset_bits;
+        std::memcpy(&offset_bits, &offset, sizeof(offset_bits));
+        combine(offset_bits);
+        combine(uint64_t(gridSize));
+        combine(uint64_t(gridWidth));
+        combine(uint64_t(gridHeight));
+        combine(uint64_t(curveType));
+        return seed;
+    }
+};
+
+struct GridTemplateCacheEntry
+{
+    GridTemplateCacheKey key;
+    Polylines            polylines;
+};
+
+std::mutex                                          s_grid_template_cache_mutex;
+std::unordered_map<uint64_t, GridTemplateCacheEntry> s_grid_template_cache;
+std::deque<uint64_t>                                s_grid_template_cache_fifo;
+constexpr size_t                                     GridTemplateCacheCapacity = 64;
+
+} // namespace
+
 // Generate a set of curves (array of array of 2d points) that describe a
 // horizontal slice of a truncated regular octahedron with a specified
 // grid square size.
@@ -121,7 +165,26 @@ static Polylines makeGrid(coord_t z, coord_t gridSize, size_t gridWidth, size_t
 {
     coord_t  scaleFactor = gridSize;
     coordf_t normalisedZ = coordf_t(z) / coordf_t(scaleFactor);
-    std::vector<Pointfs> polylines = makeNormalisedGrid(normalisedZ, gridWidth, gridHeight, curveType);
+
+    // offset required to create a regular octagram
+    coordf_t octagramGap = coordf_t(0.5);
+
+    // sawtooth wave function for range f($z) = [-$octagramGap .. $octagramGap]
+    coordf_t a = std::sqrt(coordf_t(2.));  // period
+    coordf_t wave = fabs(fmod(normalisedZ, a) - a/2.)/a*4. - 1.;
+    coordf_t offset = wave * octagramGap;
+
+    GridTemplateCacheKey key { offset, gridSize, gridWidth, gridHeight, curveType };
+    uint64_t hash = key.hash();
+    {
+        std::lock_guard<std::mutex> lock(s_grid_template_cache_mutex);
+        auto it = s_grid_template_cache.find(hash);
+        // Full comparison, a hash collision degrades into a cache miss.
+        if (it != s_grid_template_cache.end() && it->second.key.matches(key))
+            return it->second.polylines;
+    }
+
+    std::vector<Pointfs> polylines = makeNormalisedGrid(offset, gridWidth, gridHeight, curveType);
     Polylines result;
     result.reserve(polylines.size());
     for (std::vector<Pointfs>::const_iterator it_polylines = polylines.begin(); it_polylines != polylines.end(); ++ it_polylines) {
@@ -130,6 +193,18 @@ static Polylines makeGrid(coord_t z, coord_t gridSize, size_t gridWidth, size_t
         for (Pointfs::const_iterator it = it_polylines->begin(); it != it_polylines->end(); ++ it)
             polyline.points.push_back(Point(coord_t((*it)(0) * scaleFactor), coord_t((*it)(1) * scaleFactor)));
     }
+
+    {
+        std::lock_guard<std::mutex> lock(s_grid_template_cache_mutex);
+        if (auto it = s_grid_template_cache.find(hash); it == s_grid_template_cache.end()) {
+            if (s_grid_template_cache_fifo.size() >= GridTemplateCacheCapacity) {
+                s_grid_template_cache.erase(s_grid_template_cache_fifo.front());
+                s_grid_template_cache_fifo.pop_front();
+            }
+            s_grid_template_cache_fifo.emplace_back(hash);
+            s_grid_template_cache.emplace(hash, GridTemplateCacheEntry{ key, result });
+        }
+    }
     return result;
 }
 
@@ -254,6 +254,25 @@ struct CubeProperties
     double line_xy_distance;// Defines maximal distance from a center of a cube on X and Y axis on which lines will be created
 };
 
+// Flattened pre-order copy of a single octree cell for one infill line direction.
+// Iterating the flat array in order visits the cells exactly as the recursive octree
+// traversal would, but with sequential memory access; a cell whose Z window does not
+// contain the queried layer is skipped together with its whole subtree through skip.
+struct FlatCell
+{
+    // Cube center in world coordinates.
+    Vec3d   center;
+    // Half height of the rotated cube; the subtree is skipped if the layer Z differs
+    // from center.z() by more than this.
+    double  z_window;
+    // Index just past this cell's subtree in the flat array.
+    int32_t skip;
+    // Address of this wall in the linearized tree, used to address FillContext::temp_lines.
+    int32_t address;
+    // Depth of this cell, an index into Octree::cubes_properties.
+    int32_t depth;
+};
+
 struct Octree
 {
     // Octree will allocate its Cubes from the pool. The pool only supports deletion of the complete pool,
@@ -262,11 +281,16 @@ struct Octree
     Cube*                       root_cube { nullptr };
     Vec3d                       origin;
     std::vector<CubeProperties> cubes_properties;
+    // Flattened pre-order cells, one array per infill line direction. Built once by
+    // flatten() after the octree is complete, then shared read-only by all layers.
+    std::array<std::vector<FlatCell>, 3> flat_cells;
 
     Octree(const Vec3d &origin, const std::vector<CubeProperties> &cubes_properties)
         : root_cube(pool.construct(origin)), origin(origin), cubes_properties(cubes_properties) {}
 
     void insert_triangle(const Vec3d &a, const Vec3d &b, const Vec3d &c, Cube *current_cube, const BoundingBoxf3 &current_bbox, int depth);
+    // Build flat_cells from the Cube tree. To be called after the octree was transformed to world coordinates.
+    void flatten();
 };
 
 void OctreeDeleter::operator()(Octree *p) {
@@ -413,17 +437,17 @@ Eigen::Quaterniond transform_to_octree()
 // Verify that the traversal order of the octree children matches the line direction,
 // therefore the infill line may get extended with O(1) time & space complexity.
 static bool verify_traversal_order(
-    FillContext  &context,
+    const std::array<int, 8>          &traversal_order,
+    const std::vector<CubeProperties> &cubes_properties,
     const Cube   *cube,
     int           depth,
-    const Vec2d  &line_from,
-    const Vec2d  &line_to)
+    const Vec2d  &line_dir2)
 {
     std::array<Vec3d, 8> c;
     Eigen::Quaterniond to_world = transform_to_world();
     for (int i = 0; i < 8; ++i) {
-        int j = context.traversal_order[i];
-        Vec3d cntr = to_world * (cube->center_octree + (child_centers[j] * (context.cubes_properties[depth].edge_length / 4.)));
+        int j = traversal_order[i];
+        Vec3d cntr = to_world * (cube->center_octree + (child_centers[j] * (cubes_properties[depth].edge_length / 4.)));
         assert(!cube->children[j] || cube->children[j]->center.isApprox(cntr));
         c[i] = cntr;
     }
@@ -437,7 +461,7 @@ static bool verify_traversal_order(
     assert(dirs[1].isApprox(dirs[2]));
     assert(dirs[5].isApprox(dirs[8]));
     assert(dirs[6].isApprox(dirs[7]));
-    Vec3d line_dir = Vec3d(line_to.x() - line_from.x(), line_to.y() - line_from.y(), 0.).normalized();
+    Vec3d line_dir = Vec3d(line_dir2.x(), line_dir2.y(), 0.).normalized();
     for (auto& dir : dirs) {
         double d = dir.normalized().dot(line_dir);
         assert(d > 0.7);
@@ -446,61 +470,49 @@ static bool verify_traversal_order(
 }
 #endif // NDEBUG
 
-static void generate_infill_lines_recursive(
-    FillContext     &context,
-    const Cube      *cube,
-    // Address of this wall in the octree,  used to address context.temp_lines.
-    int              address,
-    int              depth)
+// Sweep the flattened octree cells of a single direction for one layer. Equivalent to
+// the recursive octree traversal the flat array was built from, but with sequential
+// memory access; subtrees that cannot intersect the layer are skipped in O(1).
+static void generate_infill_lines(FillContext &context, const std::vector<FlatCell> &cells)
 {
-    assert(cube != nullptr);
-
     const std::vector<CubeProperties> &cubes_properties = context.cubes_properties;
-    const double z_diff     = context.z_position - cube->center.z();
-    const double z_diff_abs = std::abs(z_diff);
-
-    if (z_diff_abs > cubes_properties[depth].height / 2.)
-        return;
+    for (size_t cell_idx = 0; cell_idx < cells.size();) {
+        const FlatCell &cell       = cells[cell_idx];
+        const double    z_diff     = context.z_position - cell.center.z();
+        const double    z_diff_abs = std::abs(z_diff);
+
+        if (z_diff_abs > cell.z_window) {
+            // Skip the cell together with its whole subtree.
+            cell_idx = size_t(cell.skip);
+            continue;
+        }
 
-    if (z_diff_abs < cubes_properties[depth].line_z_distance) {
-        // Discretize a single wall splitting the cube into two.
-        const double zdist = cubes_properties[depth].line_z_distance;
-        Vec2d from(
-            0.5 * cubes_properties[depth].diagonal_length * (zdist - z_diff_abs) / zdist,
-            cubes_properties[depth].line_xy_distance - (zdist + z_diff) / sqrt(2.));
-        Vec2d to(-from.x(), from.y());
-        from = context.rotate(from);
-        to   = context.rotate(to);
-        // Relative to cube center
-        const Vec2d offset(cube->center.x(), cube->center.y());
-        from += offset;
-        to   += offset;
-        // Verify that the traversal order of the octree children matches the line direction,
-        // therefore the infill line may get extended with O(1) time & space complexity.
-        assert(verify_traversal_order(context, cube, depth, from, to));
-        // Either extend an existing line or start a new one.
-        Line &last_line = context.temp_lines[address];
-        Line  new_line(Point::new_scale(from), Point::new_scale(to));
-        if (last_line.a.x() == std::numeric_limits<coord_t>::max()) {
-            last_line.a = new_line.a;
-        } else if ((new_line.a - last_line.b).cwiseAbs().maxCoeff() > 1000) { // SCALED_EPSILON is 100 and it is not enough
-            context.output_lines.emplace_back(last_line);
-            last_line.a = new_line.a;
+        if (z_diff_abs < cubes_properties[cell.depth].line_z_distance) {
+            // Discretize a single wall splitting the cube into two.
+            const double zdist = cubes_properties[cell.depth].line_z_distance;
+            Vec2d from(
+                0.5 * cubes_properties[cell.depth].diagonal_length * (zdist - z_diff_abs) / zdist,
+                cubes_properties[cell.depth].line_xy_distance - (zdist + z_diff) / sqrt(2.));
+            Vec2d to(-from.x(), from.y());
+            from = context.rotate(from);
+            to   = context.rotate(to);
+            // Relative to cube center
+            const Vec2d offset(cell.center.x(), cell.center.y());
+            from += offset;
+            to   += offset;
+            // Either extend an existing line or start a new one.
+            Line &last_line = context.temp_lines[cell.address];
+            Line  new_line(Point::new_scale(from), Point::new_scale(to));
+            if (last_line.a.x() == std::numeric_limits<coord_t>::max()) {
+                last_line.a = new_line.a;
+            } else if ((new_line.a - last_line.b).cwiseAbs().maxCoeff() > 1000) { // SCALED_EPSILON is 100 and it is not enough
+                context.output_lines.emplace_back(last_line);
+                last_line.a = new_line.a;
+            }
+            last_line.b = new_line.b;
         }
-        last_line.b = new_line.b;
-    }
 
-    // left child index
-    address = address * 2 + 1;
-    -- depth;
-    size_t i = 0;
-    for (const int child_idx : context.traversal_order) {
-        const Cube *child = cube->children[child_idx];
-        if (child != nullptr)
-            generate_infill_lines_recursive(context, child, address, depth);
-        if (++ i == 4)
-            // right child index
-            ++ address;
+        ++ cell_idx;
     }
 }
 
@@ -1336,8 +1348,9 @@ void Filler::_fill_surface_single(
         };
         // Generate the infill lines along the octree cells, merge touching lines of the same direction.
         size_t num_lines = 0;
-        for (auto &context : contexts) {
-            generate_infill_lines_recursive(context, adapt_fill_octree->root_cube, 0, int(adapt_fill_octree->cubes_properties.size()) - 1);
+        for (int direction_idx = 0; direction_idx < 3; ++ direction_idx) {
+            FillContext &context = contexts[direction_idx];
+            generate_infill_lines(context, adapt_fill_octree->flat_cells[direction_idx]);
             num_lines += context.output_lines.size() + context.temp_lines.size();
         }
 
@@ -1509,6 +1522,9 @@ OctreePtr build_octree(
         }
     }
 
+    // Linearize the octree for the per-layer line extraction.
+    octree->flatten();
+
     return octree;
 }
 
@@ -1548,5 +1564,53 @@ void Octree::insert_triangle(const Vec3d &a, const Vec3d &b, const Vec3d &c, Cub
     }
 }
 
+static void flatten_recursive(
+    const Cube                        *cube,
+    int                                depth,
+    int                                address,
+    const std::array<int, 8>          &traversal_order,
+    const std::vector<CubeProperties> &cubes_properties,
+    [[maybe_unused]] const Vec2d      &line_dir,
+    std::vector<FlatCell>             &out)
+{
+    assert(cube != nullptr);
+
+    size_t self = out.size();
+    out.push_back({ cube->center, 0.5 * cubes_properties[depth].height, 0, int32_t(address), int32_t(depth) });
+
+    // Verify that the traversal order of the octree children matches the line direction,
+    // therefore the infill line may get extended with O(1) time & space complexity.
+    assert(std::none_of(cube->children.begin(), cube->children.end(), [](const Cube *child) { return child != nullptr; }) ||
+           verify_traversal_order(traversal_order, cubes_properties, cube, depth, line_dir));
+
+    // left child index
+    address = address * 2 + 1;
+    -- depth;
+    size_t i = 0;
+    for (const int child_idx : traversal_order) {
+        const Cube *child = cube->children[child_idx];
+        if (child != nullptr)
+            flatten_recursive(child, depth, address, traversal_order, cubes_properties, line_dir, out);
+        if (++ i == 4)
+            // right child index
+            ++ address;
+    }
+
+    out[self].skip = int32_t(out.size());
+}
+
+void Octree::flatten()
+{
+    for (int direction_idx = 0; direction_idx < 3; ++ direction_idx) {
+        // Direction of the infill lines this flat array will be swept for, see the
+        // discretization in generate_infill_lines(): (from, to) maps to rotate((x, y), (-x, y)).
+        const double a = FillContext::direction_angles[direction_idx];
+        const Vec2d  line_dir(- cos(a), - sin(a));
+        std::vector<FlatCell> &out = this->flat_cells[direction_idx];
+        out.clear();
+        flatten_recursive(this->root_cube, int(this->cubes_properties.size()) - 1, 0, child_traversal_order[direction_idx], this->cubes_properties, line_dir, out);
+    }
+}
+
 } // namespace FillAdaptive
 } // namespace Slic3r
@@ -7,6 +7,9 @@
 ///|/
 ///|/ PrusaSlicer is released under the terms of the AGPLv3 or higher
 ///|/
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+
 #include "../ClipperUtils.hpp"
 #include "../ExPolygon.hpp"
 #include "../Surface.hpp"
@@ -37,10 +40,24 @@ void FillConcentric::_fill_surface_single(
     }
 
     Polygons   loops = to_polygons(expolygon);
-    ExPolygons last { std::move(expolygon) };
-    while (! last.empty()) {
-        last = offset2_ex(last, -(distance + min_spacing/2), +min_spacing/2);
-        append(loops, to_polygons(last));
+    // Erosions compose, therefore the k-th ring of the former incremental shrink loop equals
+    // a single inset of the outer boundary by k * distance followed by the same morphological
+    // opening the loop applied at each step. Computing the rings directly from the boundary
+    // makes them independent of each other, so they are extracted in parallel.
+    // Half of the shorter bounding box extent bounds the inradius of the surface and thus the
+    // number of rings. Erosion is monotone: the rings past the first empty one are empty as well.
+    size_t     n_rings = size_t((std::min(bounding_box.size().x(), bounding_box.size().y()) / 2) / distance) + 1;
+    ExPolygons source { std::move(expolygon) };
+    std::vector<ExPolygons> rings(n_rings);
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, n_rings),
+        [&source, &rings, distance, min_spacing](const tbb::blocked_range<size_t> &range) {
+            for (size_t ring_idx = range.begin(); ring_idx < range.end(); ++ ring_idx)
+                rings[ring_idx] = offset2_ex(source, -float(double(ring_idx + 1) * distance + min_spacing / 2), +float(min_spacing / 2));
+        });
+    for (ExPolygons &ring : rings) {
+        if (ring.empty())
+            break;
+        append(loops, to_polygons(std::move(ring)));
     }
 
     // generate paths from the outermost to the innermost, to avoid
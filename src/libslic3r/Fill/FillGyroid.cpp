@@ -9,23 +9,64 @@
 
 namespace Slic3r {
 
-static inline double f(double x, double z_sin, double z_cos, bool vertical, bool flip)
+// Loop invariant parameters of the gyroid isocurve function f(), hoisted out of the
+// per-sample evaluation. The flip term only shifts the second trig argument by 0 or PI,
+// so it folds into the sign of res_coef (cos(t + PI) == -cos(t), sin(t + PI) == -sin(t))
+// and a single sin/cos pair of the same argument serves both terms of f().
+struct GyroidParams
 {
-    if (vertical) {
-        double phase_offset = (z_cos < 0 ? M_PI : 0) + M_PI;
-        double a   = sin(x + phase_offset);
-        double b   = - z_cos;
-        double res = z_sin * cos(x + phase_offset + (flip ? M_PI : 0.));
-        double r   = sqrt(sqr(a) + sqr(b));
-        return asin(a/r) + asin(res/r) + M_PI;
+    GyroidParams(double z_sin, double z_cos, bool vertical, bool flip) : vertical(vertical) {
+        if (vertical) {
+            phase_offset = (z_cos < 0 ? M_PI : 0) + M_PI;
+            b            = - z_cos;
+            res_coef     = flip ? - z_sin : z_sin;
+            y_offset     = M_PI;
+        } else {
+            phase_offset = z_sin < 0 ? M_PI : 0.;
+            b            = - z_sin;
+            res_coef     = flip ? z_cos : - z_cos;
+            y_offset     = 0.5 * M_PI;
+        }
     }
-    else {
-        double phase_offset = z_sin < 0 ? M_PI : 0.;
-        double a   = cos(x + phase_offset);
-        double b   = - z_sin;
-        double res = z_cos * sin(x + phase_offset + (flip ? 0 : M_PI));
-        double r   = sqrt(sqr(a) + sqr(b));
-        return (asin(a/r) + asin(res/r) + 0.5 * M_PI);
+    double phase_offset;
+    double b;
+    double res_coef;
+    double y_offset;
+    bool   vertical;
+};
+
+static inline double f(double x, const GyroidParams &gp)
+{
+    double t = x + gp.phase_offset;
+    double s = sin(t);
+    double c = cos(t);
+    double a   = gp.vertical ? s : c;
+    double res = gp.res_coef * (gp.vertical ? c : s);
+    double r   = sqrt(sqr(a) + sqr(gp.b));
+    return asin(a/r) + asin(res/r) + gp.y_offset;
+}
+
+// Evaluate f() over a contiguous batch of sample parameters. Keeping the samples in
+// flat arrays lets the compiler unroll and pipeline the loop body; the branch on
+// gp.vertical is hoisted so the inner loops are straight-line trig / sqrt / asin code.
+static void f_batch(const double *xs, double *ys, size_t n, const GyroidParams &gp)
+{
+    if (gp.vertical) {
+        for (size_t i = 0; i < n; ++ i) {
+            double t   = xs[i] + gp.phase_offset;
+            double a   = sin(t);
+            double res = gp.res_coef * cos(t);
+            double r   = sqrt(sqr(a) + sqr(gp.b));
+            ys[i] = asin(a/r) + asin(res/r) + gp.y_offset;
+        }
+    } else {
+        for (size_t i = 0; i < n; ++ i) {
+            double t   = xs[i] + gp.phase_offset;
+            double a   = cos(t);
+            double res = gp.res_coef * sin(t);
+            double r   = sqrt(sqr(a) + sqr(gp.b));
+            ys[i] = asin(a/r) + asin(res/r) + gp.y_offset;
+        }
     }
 }
 
@@ -45,7 +86,7 @@ static inline Polyline make_wave(
             points.emplace_back(points[points.size()-n].x() + period, points[points.size()-n].y());
         } while (points.back()(0) < width - EPSILON);
 
-        points.emplace_back(Vec2d(width, f(width, z_sin, z_cos, vertical, flip)));
+        points.emplace_back(Vec2d(width, f(width, GyroidParams(z_sin, z_cos, vertical, flip))));
     }
 
     // and construct the final polyline to return:
@@ -64,26 +105,36 @@ static inline Polyline make_wave(
 
 static std::vector<Vec2d> make_one_period(double width, double scaleFactor, double z_cos, double z_sin, bool vertical, bool flip, double tolerance)
 {
+    const GyroidParams gp(z_sin, z_cos, vertical, flip);
     std::vector<Vec2d> points;
     double dx = M_PI_2; // exact coordinates on main inflexion lobes
     double limit = std::min(2*M_PI, width);
     points.reserve(coord_t(ceil(limit / tolerance / 3)));
 
-    for (double x = 0.; x < limit - EPSILON; x += dx) {
-        points.emplace_back(Vec2d(x, f(x, z_sin, z_cos, vertical, flip)));
-    }
-    points.emplace_back(Vec2d(limit, f(limit, z_sin, z_cos, vertical, flip)));
+    // coarse pass: sample the main inflexion lobes in one batch
+    std::vector<double> xs, ys;
+    for (double x = 0.; x < limit - EPSILON; x += dx)
+        xs.emplace_back(x);
+    xs.emplace_back(limit);
+    ys.resize(xs.size());
+    f_batch(xs.data(), ys.data(), xs.size(), gp);
+    for (size_t i = 0; i < xs.size(); ++ i)
+        points.emplace_back(Vec2d(xs[i], ys[i]));
 
-    // piecewise increase in resolution up to requested tolerance
+    // piecewise increase in resolution up to requested tolerance,
+    // evaluating all midpoints of a refinement pass as one contiguous batch
     for(;;)
     {
         size_t size = points.size();
-        for (unsigned int i = 1;i < size; ++i) {
+        xs.clear();
+        for (size_t i = 1; i < size; ++ i)
+            xs.emplace_back(points[i-1](0) + (points[i](0) - points[i-1](0)) / 2);
+        ys.resize(xs.size());
+        f_batch(xs.data(), ys.data(), xs.size(), gp);
+        for (size_t i = 1; i < size; ++i) {
             auto& lp = points[i-1]; // left point
             auto& rp = points[i];   // right point
-            double x = lp(0) + (rp(0) - lp(0)) / 2;
-            double y = f(x, z_sin, z_cos, vertical, flip);
-            Vec2d ip = {x, y};
+            Vec2d ip = {xs[i-1], ys[i-1]};
             if (std::abs(cross2(Vec2d(ip - lp), Vec2d(ip - rp))) > sqr(tolerance)) {
                 points.emplace_back(std::move(ip));
             }
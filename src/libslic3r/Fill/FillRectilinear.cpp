@@ -3,8 +3,11 @@
 
 #include <algorithm>
 #include <cmath>
+#include <deque>
 #include <limits>
+#include <mutex>
 #include <random>
+#include <unordered_map>
 
 #include <boost/container/small_vector.hpp>
 #include <boost/log/trivial.hpp>
@@ -2736,6 +2739,99 @@ static void polylines_from_paths(const std::vector<MonotonicRegionLink> &path, c
     }
 }
 
+// Content-hash memoization of the vertical slicing of a rotated surface. The same contours
+// are sliced repeatedly with identical rotation and spacing: Layer::make_fills() and
+// Layer::generate_sparse_infill_polylines_for_anchoring() both fill the sparse surfaces of
+// a layer, and extruded parts produce runs of consecutive layers with byte-identical
+// surfaces. The key stores the sliced contours and is compared on a hit, so a hash
+// collision degrades to a miss instead of wrong geometry. Bounded FIFO eviction.
+namespace {
+
+struct SlicedSurfaceCacheKey
+{
+    Polygons contours;
+    size_t   n_vlines;
+    coord_t  x0;
+    coord_t  line_spacing;
+
+    bool matches(const SlicedSurfaceCacheKey &rhs) const
+    {
+        if (n_vlines != rhs.n_vlines || x0 != rhs.x0 || line_spacing != rhs.line_spacing ||
+            contours.size() != rhs.contours.size())
+            return false;
+        for (size_t i = 0; i < contours.size(); ++ i)
+            if (contours[i].points != rhs.contours[i].points)
+                return false;
+        return true;
+    }
+
+    uint64_t hash() const
+    {
+        auto combine = [](uint64_t &seed, uint64_t v) { seed ^= v + 0x9e3779b97f4a7c15ull + (seed << 6) + (seed >> 2); };
+        uint64_t h = 0xcbf29ce484222325ull;
+        for (const Polygon &poly : contours) {
+            combine(h, poly.points.size());
+            for (const Point &pt : poly.points) {
+                combine(h, uint64_t(int64_t(pt.x())));
+                combine(h, uint64_t(int64_t(pt.y())));
+            }
+        }
+        combine(h, uint64_t(n_vlines));
+        combine(h, uint64_t(int64_t(x0)));
+        combine(h, uint64_t(int64_t(line_spacing)));
+        return h;
+    }
+};
+
+struct SlicedSurfaceCacheEntry
+{
+    SlicedSurfaceCacheKey                  key;
+    std::vector<SegmentedIntersectionLine> segs;
+};
+
+std::mutex                                              s_sliced_surface_cache_mutex;
+std::unordered_map<uint64_t, SlicedSurfaceCacheEntry>   s_sliced_surface_cache;
+std::deque<uint64_t>                                    s_sliced_surface_cache_fifo;
+constexpr size_t                                        SlicedSurfaceCacheCapacity = 64;
+
+} // anonymous namespace
+
+// Cached front end to slice_region_by_vertical_lines(). The vertical lines are returned
+// by copy as the callers mutate them when connecting and consuming the segments.
+static std::vector<SegmentedIntersectionLine> slice_region_by_vertical_lines_cached(
+    const ExPolygonWithOffset &poly_with_offset, size_t n_vlines, coord_t x0, coord_t line_spacing)
+{
+    SlicedSurfaceCacheKey cache_key;
+    cache_key.contours.reserve(poly_with_offset.n_contours);
+    for (size_t i = 0; i < poly_with_offset.n_contours; ++ i)
+        cache_key.contours.emplace_back(poly_with_offset.contour(i));
+    cache_key.n_vlines     = n_vlines;
+    cache_key.x0           = x0;
+    cache_key.line_spacing = line_spacing;
+    const uint64_t cache_hash = cache_key.hash();
+    {
+        std::lock_guard<std::mutex> lock(s_sliced_surface_cache_mutex);
+        auto it = s_sliced_surface_cache.find(cache_hash);
+        if (it != s_sliced_surface_cache.end() && it->second.key.matches(cache_key))
+            return it->second.segs;
+    }
+
+    std::vector<SegmentedIntersectionLine> segs = slice_region_by_vertical_lines(poly_with_offset, n_vlines, x0, line_spacing);
+
+    {
+        std::lock_guard<std::mutex> lock(s_sliced_surface_cache_mutex);
+        if (s_sliced_surface_cache.find(cache_hash) == s_sliced_surface_cache.end()) {
+            while (s_sliced_surface_cache_fifo.size() >= SlicedSurfaceCacheCapacity) {
+                s_sliced_surface_cache.erase(s_sliced_surface_cache_fifo.front());
+                s_sliced_surface_cache_fifo.pop_front();
+            }
+            s_sliced_surface_cache_fifo.emplace_back(cache_hash);
+        }
+        s_sliced_surface_cache[cache_hash] = SlicedSurfaceCacheEntry { std::move(cache_key), segs };
+    }
+    return segs;
+}
+
 bool FillRectilinear::fill_surface_by_lines(const Surface *surface, const FillParams &params, float angleBase, float pattern_shift, Polylines &polylines_out)
 {
     // At the end, only the new polylines will be rotated back.
@@ -2803,7 +2899,7 @@ bool FillRectilinear::fill_surface_by_lines(const Surface *surface, const FillPa
     iRun ++;
 #endif /* SLIC3R_DEBUG */
 
-    std::vector<SegmentedIntersectionLine> segs = slice_region_by_vertical_lines(poly_with_offset, n_vlines, x0, line_spacing);
+    std::vector<SegmentedIntersectionLine> segs = slice_region_by_vertical_lines_cached(poly_with_offset, n_vlines, x0, line_spacing);
     // Connect by horizontal / vertical links, classify the links based on link_max_length as too long.
 	connect_segment_intersections_by_contours(poly_with_offset, segs, params, link_max_length);
 
@@ -2903,7 +2999,7 @@ void make_fill_lines(const ExPolygonWithOffset &poly_with_offset, Point refpt, d
     const size_t n_vlines = (bounding_box.max.x() - bounding_box.min.x() + line_spacing - 1) / line_spacing;
     const double cos_a    = cos(angle);
     const double sin_a    = sin(angle);
-    for (const SegmentedIntersectionLine &vline : slice_region_by_vertical_lines(poly_with_offset, n_vlines, bounding_box.min.x(), line_spacing))
+    for (const SegmentedIntersectionLine &vline : slice_region_by_vertical_lines_cached(poly_with_offset, n_vlines, bounding_box.min.x(), line_spacing))
         if (vline.pos >= x_min) {
             if (vline.pos > x_max)
                 break;
@@ -3242,7 +3338,7 @@ void FillMonotonicLineWGapFill::fill_surface_by_lines(const Surface* surface, co
 	if (params.full_infill())
 		x0 += (line_spacing + coord_t(SCALED_EPSILON)) / 2;
 
-    std::vector<SegmentedIntersectionLine> segs = slice_region_by_vertical_lines(poly_with_offset, n_vlines, x0, line_spacing);
+    std::vector<SegmentedIntersectionLine> segs = slice_region_by_vertical_lines_cached(poly_with_offset, n_vlines, x0, line_spacing);
     // Connect by horizontal / vertical links, classify the links based on link_max_length as too long.
 	connect_segment_intersections_by_contours(poly_with_offset, segs, params, link_max_length);
 
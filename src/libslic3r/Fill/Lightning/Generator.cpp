@@ -10,6 +10,9 @@
 
 #include "ExPolygon.hpp"
 
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+
 /* Possible future tasks/optimizations,etc.:
  * - Improve connecting heuristic to favor connecting to shorter trees
  * - Change which node of a tree is the root when that would be better in reconnectRoots.
@@ -206,9 +209,19 @@ void Generator::generateTrees(const PrintObject &print_object, const std::functi
         outlines_locator.set_bbox(below_outlines_bbox);
         outlines_locator.create(below_outlines, locator_cell_size);
 
+        // Each tree is pruned, straightened and realigned independently of the others while only
+        // reading the shared outlines and locator, so the trees are propagated in parallel.
+        // Per-tree buckets keep the order of the lower roots stable.
+        std::vector<NodeSPtr>             &upper_trees = current_lightning_layer.tree_roots;
+        std::vector<std::vector<NodeSPtr>> propagated_trees(upper_trees.size());
+        tbb::parallel_for(tbb::blocked_range<size_t>(0, upper_trees.size()),
+            [this, &upper_trees, &propagated_trees, &below_outlines, &outlines_locator](const tbb::blocked_range<size_t> &range) {
+                for (size_t tree_idx = range.begin(); tree_idx < range.end(); ++ tree_idx)
+                    upper_trees[tree_idx]->propagateToNextLayer(propagated_trees[tree_idx], below_outlines, outlines_locator, m_prune_length, m_straightening_max_distance, locator_cell_size / 2);
+            });
         std::vector<NodeSPtr>& lower_trees = m_lightning_layers[layer_id - 1].tree_roots;
-        for (auto& tree : current_lightning_layer.tree_roots)
-            tree->propagateToNextLayer(lower_trees, below_outlines, outlines_locator, m_prune_length, m_straightening_max_distance, locator_cell_size / 2);
+        for (std::vector<NodeSPtr> &trees : propagated_trees)
+            append(lower_trees, std::move(trees));
     }
 }
 
@@ -254,9 +267,17 @@ void Generator::generateTreesforSupport(std::vector<Polygons>& contours, const s
         outlines_locator.set_bbox(below_outlines_bbox);
         outlines_locator.create(below_outlines, locator_cell_size);
 
+        // Propagate the trees in parallel, see Generator::generateTrees() above.
+        std::vector<NodeSPtr>             &upper_trees = current_lightning_layer.tree_roots;
+        std::vector<std::vector<NodeSPtr>> propagated_trees(upper_trees.size());
+        tbb::parallel_for(tbb::blocked_range<size_t>(0, upper_trees.size()),
+            [this, &upper_trees, &propagated_trees, &below_outlines, &outlines_locator](const tbb::blocked_range<size_t> &range) {
+                for (size_t tree_idx = range.begin(); tree_idx < range.end(); ++ tree_idx)
+                    upper_trees[tree_idx]->propagateToNextLayer(propagated_trees[tree_idx], below_outlines, outlines_locator, m_prune_length, m_straightening_max_distance, locator_cell_size / 2);
+            });
         std::vector<NodeSPtr>& lower_trees = m_lightning_layers[layer_id - 1].tree_roots;
-        for (auto& tree : current_lightning_layer.tree_roots)
-            tree->propagateToNextLayer(lower_trees, below_outlines, outlines_locator, m_prune_length, m_straightening_max_distance, locator_cell_size / 2);
+        for (std::vector<NodeSPtr> &trees : propagated_trees)
+            append(lower_trees, std::move(trees));
     }
 }
 
@@ -9,6 +9,8 @@
 #include <optional>
 #include <vector>
 
+#include <oneapi/tbb/scalable_allocator.h>
+
 #include "../../EdgeGrid.hpp"
 #include "../../Polygon.hpp"
 #include "SVG.hpp"
@@ -42,13 +44,16 @@ class Node : public std::enable_shared_from_this<Node>
 {
 public:
     // Workaround for private/protected constructors and 'make_shared': https://stackoverflow.com/a/27832765
+    // Allocated through the thread local pools of the TBB scalable allocator: a tree easily
+    // consists of thousands of nodes and the global allocator becomes a bottleneck when
+    // trees are propagated to the next layer in parallel.
     template<typename ...Arg> NodeSPtr static create(Arg&&...arg)
     {
         struct EnableMakeShared : public Node
         {
             explicit EnableMakeShared(Arg&&...arg) : Node(std::forward<Arg>(arg)...) {}
         };
-        return std::make_shared<EnableMakeShared>(std::forward<Arg>(arg)...);
+        return std::allocate_shared<EnableMakeShared>(tbb::scalable_allocator<EnableMakeShared>(), std::forward<Arg>(arg)...);
     }
 
     /*!
@@ -1,5 +1,7 @@
 #include <cmath>
 #include <assert.h>
+#include <mutex>
+#include <unordered_map>
 #include "slic3r/Utils/ColorSpaceConvert.hpp"
 
 #include "FlushVolCalc.hpp"
@@ -44,9 +46,48 @@ FlushVolCalculator::FlushVolCalculator(int min, int max, float multiplier)
 {
 }
 
+//BBS: the flush volume of a color pair only depends on the two colors and the
+// min/max limits, and the GUI recomputes the whole NxN matrix on every filament
+// edit, so memoize the per-pair results process-wide. The cache is bounded and
+// simply cleared when full: an entry is a handful of bytes and the working set
+// (a few color palettes) is far below the cap, so real evictions never happen.
+struct FlushVolKey
+{
+    uint64_t colors;  // src argb in the high 32 bits, dst argb in the low ones
+    int      min_vol;
+    int      max_vol;
+    bool operator==(const FlushVolKey& other) const {
+        return colors == other.colors && min_vol == other.min_vol && max_vol == other.max_vol;
+    }
+};
+
+struct FlushVolKeyHash
+{
+    size_t operator()(const FlushVolKey& key) const {
+        return std::hash<uint64_t>()(key.colors) ^ (std::hash<int>()(key.min_vol) * 101) ^ (std::hash<int>()(key.max_vol) * 10221);
+    }
+};
+
+static std::mutex s_flush_vol_cache_mutex;
+static std::unordered_map<FlushVolKey, int, FlushVolKeyHash> s_flush_vol_cache;
+
 int FlushVolCalculator::calc_flush_vol(unsigned char src_a, unsigned char src_r, unsigned char src_g, unsigned char src_b,
     unsigned char dst_a, unsigned char dst_r, unsigned char dst_g, unsigned char dst_b)
 {
+    static constexpr size_t CACHE_CAPACITY = 4096;
+
+    FlushVolKey key;
+    key.colors = (uint64_t(src_a) << 56) | (uint64_t(src_r) << 48) | (uint64_t(src_g) << 40) | (uint64_t(src_b) << 32)
+               | (uint64_t(dst_a) << 24) | (uint64_t(dst_r) << 16) | (uint64_t(dst_g) << 8) | uint64_t(dst_b);
+    key.min_vol = m_min_flush_vol;
+    key.max_vol = m_max_flush_vol;
+    {
+        std::lock_guard<std::mutex> lock(s_flush_vol_cache_mutex);
+        auto it = s_flush_vol_cache.find(key);
+        if (it != s_flush_vol_cache.end())
+            return it->second;
+    }
+
     // BBS: Transparent materials are treated as white materials
     if (src_a == 0) {
         src_r = src_g = src_b = 255;
@@ -92,7 +133,15 @@ int FlushVolCalculator::calc_flush_vol(unsigned char src_a, unsigned char src_r,
 
     //float flush_multiplier = std::atof(m_flush_multiplier_ebox->GetValue().c_str());
     flush_volume += m_min_flush_vol;
-    return std::min((int)flush_volume, m_max_flush_vol);
+    int result = std::min((int)flush_volume, m_max_flush_vol);
+
+    {
+        std::lock_guard<std::mutex> lock(s_flush_vol_cache_mutex);
+        if (s_flush_vol_cache.size() >= CACHE_CAPACITY)
+            s_flush_vol_cache.clear();
+        s_flush_vol_cache.emplace(key, result);
+    }
+    return result;
 }
 
 }
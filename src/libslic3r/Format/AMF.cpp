@@ -1,3 +1,5 @@
+#include <algorithm>
+#include <cstdint>
 #include <limits>
 #include <string.h>
 #include <map>
@@ -884,11 +886,16 @@ void AMFParserContext::endDocument()
 
 // Load an AMF file into a provided model.
 //BBS: add inches check logic
-bool load_amf_file(const char *path, DynamicPrintConfig *config, ConfigSubstitutionContext *config_substitutions, Model *model, bool *use_inches)
+bool load_amf_file(const char *path, DynamicPrintConfig *config, ConfigSubstitutionContext *config_substitutions, Model *model, bool *use_inches, ImportstlProgressFn proFn)
 {
     if ((path == nullptr) || (model == nullptr))
         return false;
 
+    boost::system::error_code ec;
+    std::uint64_t file_size = boost::filesystem::file_size(path, ec);
+    if (ec)
+        file_size = 0;
+
     XML_Parser parser = XML_ParserCreate(nullptr); // encoding
     if (!parser) {
         BOOST_LOG_TRIVIAL(error) << "Couldn't allocate memory for parser";
@@ -908,6 +915,8 @@ bool load_amf_file(const char *path, DynamicPrintConfig *config, ConfigSubstitut
 
     char buff[8192];
     bool result = false;
+    std::uint64_t bytes_read  = 0;
+    std::uint64_t last_report = 0;
     for (;;) {
         int len = (int)fread(buff, 1, 8192, pFile);
         if (ferror(pFile)) {
@@ -919,6 +928,18 @@ bool load_amf_file(const char *path, DynamicPrintConfig *config, ConfigSubstitut
             BOOST_LOG_TRIVIAL(error) << "AMF parser: Parse error at line " << int(XML_GetCurrentLineNumber(parser)) << ": " << ctx.error_message();
             break;
         }
+        bytes_read += (std::uint64_t)len;
+        // Report progress and poll for cancellation roughly once per MiB of input,
+        // in KiB units so huge files do not overflow the int interface.
+        if (proFn && (done || bytes_read - last_report >= (1 << 20))) {
+            last_report = bytes_read;
+            bool cb_cancel = false;
+            proFn((int)(bytes_read >> 10), (int)(std::max(file_size, bytes_read) >> 10), cb_cancel);
+            if (cb_cancel) {
+                BOOST_LOG_TRIVIAL(info) << "AMF parser: Import canceled by the user";
+                break;
+            }
+        }
         if (done) {
             result = true;
             break;
@@ -946,7 +967,7 @@ bool load_amf_file(const char *path, DynamicPrintConfig *config, ConfigSubstitut
 }
 
 //BBS: add inches logic
-bool extract_model_from_archive(mz_zip_archive& archive, const mz_zip_archive_file_stat& stat, DynamicPrintConfig* config, ConfigSubstitutionContext* config_substitutions, Model* model, bool* use_inches)
+bool extract_model_from_archive(mz_zip_archive& archive, const mz_zip_archive_file_stat& stat, DynamicPrintConfig* config, ConfigSubstitutionContext* config_substitutions, Model* model, bool* use_inches, ImportstlProgressFn proFn)
 {
     if (stat.m_uncomp_size == 0)
     {
@@ -972,11 +993,13 @@ bool extract_model_from_archive(mz_zip_archive& archive, const mz_zip_archive_fi
         XML_Parser& parser;
         AMFParserContext& ctx;
         const mz_zip_archive_file_stat& stat;
+        ImportstlProgressFn proFn;
+        mz_uint64 last_report { 0 };
 
-        CallbackData(XML_Parser& parser, AMFParserContext& ctx, const mz_zip_archive_file_stat& stat) : parser(parser), ctx(ctx), stat(stat) {}
+        CallbackData(XML_Parser& parser, AMFParserContext& ctx, const mz_zip_archive_file_stat& stat, ImportstlProgressFn proFn) : parser(parser), ctx(ctx), stat(stat), proFn(proFn) {}
     };
 
-    CallbackData data(parser, ctx, stat);
+    CallbackData data(parser, ctx, stat, proFn);
 
     mz_bool res = 0;
 
@@ -984,12 +1007,23 @@ bool extract_model_from_archive(mz_zip_archive& archive, const mz_zip_archive_fi
     {
         res = mz_zip_reader_extract_file_to_callback(&archive, stat.m_filename, [](void* pOpaque, mz_uint64 file_ofs, const void* pBuf, size_t n)->size_t {
             CallbackData* data = (CallbackData*)pOpaque;
-            if (!XML_Parse(data->parser, (const char*)pBuf, (int)n, (file_ofs + n == data->stat.m_uncomp_size) ? 1 : 0) || data->ctx.error())
+            bool done = file_ofs + n == data->stat.m_uncomp_size;
+            if (!XML_Parse(data->parser, (const char*)pBuf, (int)n, done ? 1 : 0) || data->ctx.error())
             {
                 char error_buf[1024];
                 ::sprintf(error_buf, "Parsing file %s error at line %d: {%s}", data->stat.m_filename, (int) XML_GetCurrentLineNumber(data->parser), data->ctx.error_message());
                 throw Slic3r::FileIOError(error_buf);
             }
+            // Report progress and poll for cancellation roughly once per MiB of decompressed
+            // data, in KiB units so huge files do not overflow the int interface.
+            if (data->proFn && (done || file_ofs + n - data->last_report >= (1 << 20)))
+            {
+                data->last_report = file_ofs + n;
+                bool cb_cancel = false;
+                data->proFn((int)((file_ofs + n) >> 10), (int)(data->stat.m_uncomp_size >> 10), cb_cancel);
+                if (cb_cancel)
+                    throw Slic3r::FileIOError("Import canceled by the user");
+            }
 
             return n;
             }, &data, 0);
@@ -1022,7 +1056,7 @@ bool extract_model_from_archive(mz_zip_archive& archive, const mz_zip_archive_fi
 }
 
 // Load an AMF archive into a provided model.
-bool load_amf_archive(const char* path, DynamicPrintConfig* config, ConfigSubstitutionContext* config_substitutions, Model* model, bool* use_inches)
+bool load_amf_archive(const char* path, DynamicPrintConfig* config, ConfigSubstitutionContext* config_substitutions, Model* model, bool* use_inches, ImportstlProgressFn proFn)
 {
     if ((path == nullptr) || (model == nullptr))
         return false;
@@ -1048,7 +1082,7 @@ bool load_amf_archive(const char* path, DynamicPrintConfig* config, ConfigSubsti
             {
                 try
                 {
-                    if (!extract_model_from_archive(archive, stat, config, config_substitutions, model, use_inches))
+                    if (!extract_model_from_archive(archive, stat, config, config_substitutions, model, use_inches, proFn))
                     {
                         close_zip_reader(&archive);
                         BOOST_LOG_TRIVIAL(error) << "Archive does not contain a valid model";
@@ -1091,7 +1125,7 @@ bool load_amf_archive(const char* path, DynamicPrintConfig* config, ConfigSubsti
 // Load an AMF file into a provided model.
 // If config is not a null pointer, updates it if the amf file/archive contains config data
 //BBS: refine the amf logic
-bool load_amf(const char *path, DynamicPrintConfig *config, ConfigSubstitutionContext *config_substitutions, Model *model, bool* use_inches)
+bool load_amf(const char *path, DynamicPrintConfig *config, ConfigSubstitutionContext *config_substitutions, Model *model, bool* use_inches, ImportstlProgressFn proFn)
 {
     CNumericLocalesSetter locales_setter; // use "C" locales and point as a decimal separator
 
@@ -1105,7 +1139,7 @@ bool load_amf(const char *path, DynamicPrintConfig *config, ConfigSubstitutionCo
         file.read(zip_mask.data(), 2);
         file.close();
 
-        return (zip_mask == "PK") ? load_amf_archive(path, config, config_substitutions, model, use_inches) : load_amf_file(path, config, config_substitutions, model, use_inches);
+        return (zip_mask == "PK") ? load_amf_archive(path, config, config_substitutions, model, use_inches, proFn) : load_amf_file(path, config, config_substitutions, model, use_inches, proFn);
     }
     else
         return false;
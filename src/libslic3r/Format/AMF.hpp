@@ -1,13 +1,15 @@
 #ifndef slic3r_Format_AMF_hpp_
 #define slic3r_Format_AMF_hpp_
 
+#include <admesh/stl.h>
+
 namespace Slic3r {
 
 class Model;
 class DynamicPrintConfig;
 
 // Load the content of an amf file into the given model and configuration.
-extern bool load_amf(const char* path, DynamicPrintConfig* config, ConfigSubstitutionContext* config_substitutions, Model* model, bool* use_inches);
+extern bool load_amf(const char* path, DynamicPrintConfig* config, ConfigSubstitutionContext* config_substitutions, Model* model, bool* use_inches, ImportstlProgressFn proFn = nullptr);
 
 //BBS: remove amf export
 // Save the given model and the config data into an amf file.
@@ -25,6 +25,18 @@
 #include <boost/filesystem/path.hpp>
 #include <boost/algorithm/string.hpp>
 
+// We are using quite an old TBB 2017 U7. Before we update our build servers, let's use the old API, which is deprecated in up to date TBB.
+#if ! defined(TBB_VERSION_MAJOR)
+    #include <tbb/version.h>
+#endif
+#if TBB_VERSION_MAJOR >= 2021
+    #include <tbb/parallel_pipeline.h>
+    using slic3r_tbb_filtermode = tbb::filter_mode;
+#else
+    #include <tbb/pipeline.h>
+    using slic3r_tbb_filtermode = tbb::filter;
+#endif
+
 namespace marchsq {
 
 template<> struct _RasterTraits<Slic3r::png::ImageGreyscale> {
@@ -500,14 +512,67 @@ void SL1Archive::export_print(Zipper& zipper,
         zipper.add_entry("prusaslicer.ini");
         zipper << to_ini(slicerconf);
         
-        size_t i = 0;
-        for (const sla::EncodedRaster &rst : m_layers) {
-
-            std::string imgname = project + string_printf("%.5d", i++) + "." +
-                                  rst.extension();
-            
-            zipper.add_entry(imgname.c_str(), rst.data(), rst.size());
-        }
+        // Deflating the layer entries and computing their CRC-32 used to run
+        // serially inside the zip writer and dominated the export of large jobs.
+        // Deflate the entries on worker threads with a bounded number of buffers
+        // in flight and keep only the ordered write serial, so the export is
+        // paced by the zip write bandwidth.
+        struct Entry
+        {
+            std::string          name;
+            std::vector<uint8_t> data;
+            size_t               uncomp_size = 0;
+            unsigned int         crc = 0;
+        };
+
+        size_t idx = 0;
+        const auto input = tbb::make_filter<void, size_t>(
+            slic3r_tbb_filtermode::serial_in_order,
+            [this, &idx](tbb::flow_control &fc) -> size_t {
+                if (idx >= m_layers.size())
+                    fc.stop();
+                return idx++;
+            });
+
+        const auto deflate = tbb::make_filter<size_t, Entry>(
+            slic3r_tbb_filtermode::parallel,
+            [this, &project](size_t i) {
+                const sla::EncodedRaster &rst = m_layers[i];
+
+                Entry e;
+                e.name = project + string_printf("%.5d", i) + "." +
+                         rst.extension();
+                e.uncomp_size = rst.size();
+                e.crc = (unsigned int)
+                    mz_crc32(MZ_CRC32_INIT,
+                             static_cast<const unsigned char *>(rst.data()),
+                             rst.size());
+
+                size_t outlen = 0;
+                void *out = tdefl_compress_mem_to_heap(
+                    rst.data(), rst.size(), &outlen,
+                    tdefl_create_comp_flags_from_zip_params(
+                        MZ_BEST_SPEED, -MZ_DEFAULT_WINDOW_BITS,
+                        MZ_DEFAULT_STRATEGY));
+
+                if (out == nullptr)
+                    throw Slic3r::ExportError(
+                        "Failed to compress layer image for the SLA archive.");
+
+                auto outp = static_cast<const uint8_t *>(out);
+                e.data.assign(outp, outp + outlen);
+                MZ_FREE(out);
+
+                return e;
+            });
+
+        const auto write = tbb::make_filter<Entry, void>(
+            slic3r_tbb_filtermode::serial_in_order, [&zipper](Entry e) {
+                zipper.add_entry_deflated(e.name, e.data.data(), e.data.size(),
+                                          e.uncomp_size, e.crc);
+            });
+
+        tbb::parallel_pipeline(12, input & deflate & write);
     } catch(std::exception& e) {
         BOOST_LOG_TRIVIAL(error) << e.what();
         // Rethrow the exception
@@ -27,6 +27,12 @@
 #include "TopExp_Explorer.hxx"
 #include "TopExp_Explorer.hxx"
 #include "BRep_Tool.hxx"
+#include "Bnd_Box.hxx"
+#include "BRepBndLib.hxx"
+
+#include <algorithm>
+#include <cmath>
+#include <thread>
 
 const double STEP_TRANS_CHORD_ERROR = 0.003;
 const double STEP_TRANS_ANGLE_RES = 0.5;
@@ -160,6 +166,19 @@ int StepPreProcessor::preNum(const unsigned char byte) {
     return num;
 }
 
+// Chord error used to tessellate a solid. Anything that fits a typical build volume gets
+// STEP_TRANS_CHORD_ERROR; only solids whose bounding box diagonal exceeds ~300 mm are
+// coarsened proportionally to the diagonal so that huge assemblies do not explode into
+// tens of millions of triangles, capped to stay well below typical printing accuracy.
+static double solid_deflection(const TopoDS_Shape &solid)
+{
+    Bnd_Box bbox;
+    BRepBndLib::Add(solid, bbox, Standard_False);
+    if (bbox.IsVoid())
+        return STEP_TRANS_CHORD_ERROR;
+    return std::clamp(std::sqrt(bbox.SquareExtent()) * 1e-5, STEP_TRANS_CHORD_ERROR, 0.05);
+}
+
 struct NamedSolid {
     NamedSolid(const TopoDS_Shape& s,
                const std::string& n) : solid{s}, name{n} {}
@@ -261,11 +280,34 @@ bool load_step(const char *path, Model *model, bool& is_cancel, ImportStepProgre
         getNamedSolids(TopLoc_Location{}, "", id, shapeTool, topLevelShapes.Value(iLabel), namedSolids);
     }
 
-    std::vector<stl_file> stl;
-    stl.resize(namedSolids.size());
-    tbb::parallel_for(tbb::blocked_range<size_t>(0, namedSolids.size()), [&](const tbb::blocked_range<size_t> &range) {
+    ModelObject *new_object = model->add_object();
+    const char * last_slash = strrchr(path, DIR_SEPARATOR);
+    new_object->name.assign((last_slash == nullptr) ? path : last_slash + 1);
+    new_object->input_file = path;
+
+    // Tessellate the solids in parallel batches and move each finished batch into the model
+    // right away. The progress callback runs between batches on the calling thread (it drives
+    // a wx progress dialog, so it must not be called from the workers), which keeps the GUI
+    // updating and cancelable even on assemblies that take minutes to mesh instead of going
+    // silent for the whole tessellation.
+    std::vector<TriangleMesh> meshes(namedSolids.size());
+    const size_t batch_size = std::max<size_t>(1, 2 * std::thread::hardware_concurrency());
+    for (size_t batch_begin = 0; batch_begin < namedSolids.size(); batch_begin += batch_size) {
+        const size_t batch_end = std::min(batch_begin + batch_size, namedSolids.size());
+        if (stepFn) {
+            stepFn(LOAD_STEP_STAGE_GET_MESH, (int)batch_begin, (int)namedSolids.size(), cb_cancel);
+            is_cancel = cb_cancel;
+            if (cb_cancel) {
+                model->delete_object(new_object);
+                shapeTool.reset(nullptr);
+                application->Close(document);
+                return false;
+            }
+        }
+
+        tbb::parallel_for(tbb::blocked_range<size_t>(batch_begin, batch_end), [&](const tbb::blocked_range<size_t> &range) {
         for (size_t i = range.begin(); i < range.end(); i++) {
-            BRepMesh_IncrementalMesh mesh(namedSolids[i].solid, STEP_TRANS_CHORD_ERROR, false, STEP_TRANS_ANGLE_RES, true);
+            BRepMesh_IncrementalMesh mesh(namedSolids[i].solid, solid_deflection(namedSolids[i].solid), false, STEP_TRANS_ANGLE_RES, true);
             // BBS: calculate total number of the nodes and triangles
             int aNbNodes     = 0;
             int aNbTriangles = 0;
@@ -282,10 +324,11 @@ bool load_step(const char *path, Model *model, bool& is_cancel, ImportStepProgre
                 // BBS: No triangulation on the shape.
                 continue;
 
-            stl[i].stats.type                = inmemory;
-            stl[i].stats.number_of_facets    = (uint32_t) aNbTriangles;
-            stl[i].stats.original_num_facets = stl[i].stats.number_of_facets;
-            stl_allocate(&stl[i]);
+            stl_file stl;
+            stl.stats.type                = inmemory;
+            stl.stats.number_of_facets    = (uint32_t) aNbTriangles;
+            stl.stats.original_num_facets = stl.stats.number_of_facets;
+            stl_allocate(&stl);
 
             std::vector<Vec3f> points;
             points.reserve(aNbNodes);
@@ -328,45 +371,29 @@ bool load_step(const char *path, Model *model, bool& is_cancel, ImportStepProgre
                     stl_normal normal;
                     stl_calculate_normal(normal, &facet);
                     stl_normalize_vector(normal);
-                    facet.normal                                      = normal;
-                    stl[i].facet_start[aTriangleOffet + aTriIter - 1] = facet;
+                    facet.normal                                     = normal;
+                    stl.facet_start[aTriangleOffet + aTriIter - 1] = facet;
                 }
 
                 aNodeOffset += aTriangulation->NbNodes();
                 aTriangleOffet += aTriangulation->NbTriangles();
             }
-        }
-    });
 
-    ModelObject *new_object = model->add_object();
-    const char * last_slash = strrchr(path, DIR_SEPARATOR);
-    new_object->name.assign((last_slash == nullptr) ? path : last_slash + 1);
-    new_object->input_file = path;
-
-    auto stage_unit3 = stl.size() / LOAD_STEP_STAGE_UNIT_NUM + 1;
-    for (size_t i = 0; i < stl.size(); i++) {
-        if (stepFn) {
-            if ((i % stage_unit3) == 0) {
-                stepFn(LOAD_STEP_STAGE_GET_MESH, i, stl.size(), cb_cancel);
-                is_cancel = cb_cancel;
-            }
-            if (cb_cancel) {
-                model->delete_object(new_object);
-                shapeTool.reset(nullptr);
-                application->Close(document);
-                return false;
-            }
+            // BBS: the mesh conversion runs on the workers as well, it repairs and
+            // compactifies the mesh which is not cheap on large solids.
+            meshes[i].from_stl(stl);
         }
-
-        //BBS: maybe mesh is empty from step file. Don't add
-        if (stl[i].stats.number_of_facets > 0) {
-            TriangleMesh triangle_mesh;
-            triangle_mesh.from_stl(stl[i]);
-            ModelVolume* new_volume = new_object->add_volume(std::move(triangle_mesh));
-            new_volume->name = namedSolids[i].name;
-            new_volume->source.input_file = path;
-            new_volume->source.object_idx = (int)model->objects.size() - 1;
-            new_volume->source.volume_idx = (int)new_object->volumes.size() - 1;
+        });
+
+        for (size_t i = batch_begin; i < batch_end; ++ i) {
+            //BBS: maybe mesh is empty from step file. Don't add
+            if (! meshes[i].empty()) {
+                ModelVolume* new_volume = new_object->add_volume(std::move(meshes[i]));
+                new_volume->name = namedSolids[i].name;
+                new_volume->source.input_file = path;
+                new_volume->source.object_idx = (int)model->objects.size() - 1;
+                new_volume->source.volume_idx = (int)new_object->volumes.size() - 1;
+            }
         }
     }
 
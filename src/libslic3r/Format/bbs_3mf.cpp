@@ -169,6 +169,9 @@ const std::string PROJECT_EMBEDDED_SLICE_PRESETS_FILE = "Metadata/process_settin
 const std::string PROJECT_EMBEDDED_FILAMENT_PRESETS_FILE = "Metadata/filament_settings_";
 const std::string PROJECT_EMBEDDED_PRINTER_PRESETS_FILE = "Metadata/machine_settings_";
 const std::string CUT_INFORMATION_FILE = "Metadata/cut_information.xml";
+// BBS: per object content hashes of the sub model entries, used by incremental saves
+// to splice unchanged objects from the previous archive instead of re-serializing them
+const std::string MESH_HASHES_FILE = "Metadata/mesh_hashes.txt";
 
 const unsigned int AUXILIARY_STR_LEN = 12;
 const unsigned int METADATA_STR_LEN = 9;
@@ -266,6 +269,9 @@ static constexpr const char* CUSTOM_SEAM_ATTR = "paint_seam";
 static constexpr const char* MMU_SEGMENTATION_ATTR = "paint_color";
 // BBS
 static constexpr const char* FACE_PROPERTY_ATTR = "face_property";
+// BBS: auxiliary binary vertex buffer entry referenced from the vertices element,
+// see binary_vertices_entry_path()
+static constexpr const char* BINARY_VERTICES_ATTR = "binary_vertices";
 
 static constexpr const char* KEY_ATTR = "key";
 static constexpr const char* VALUE_ATTR = "value";
@@ -403,6 +409,46 @@ bool bbs_get_attribute_value_bool(const char** attributes, unsigned int attribut
     return (text != nullptr) ? (bool)::atoi(text) : true;
 }
 
+// BBS: path of the auxiliary zip entry storing the raw little endian float32 vertex buffer of one
+// object of a sub model file. The buffer is written in addition to the XML vertices, which are kept
+// for foreign consumers; import prefers the binary entry and skips the XML float parsing.
+static std::string binary_vertices_entry_path(const std::string &model_path, int volume_id)
+{
+    std::string path = model_path;
+    if (path.size() > 6 && path.compare(path.size() - 6, 6, ".model") == 0)
+        path.erase(path.size() - 6);
+    path += "_";
+    path += std::to_string(volume_id);
+    path += ".bin";
+    return path;
+}
+
+// BBS: loads the binary vertex buffer referenced by the binary_vertices attribute of a vertices
+// element. Returns false when the entry is missing or malformed, in which case the caller falls
+// back to parsing the XML vertices.
+static bool load_binary_vertices(mz_zip_archive *archive, const std::string &path, float unit_factor, std::vector<Slic3r::Vec3f> &vertices)
+{
+    if (archive == nullptr || path.empty())
+        return false;
+    std::string path2 = path.front() == '/' ? path.substr(1) : path;
+    int index = mz_zip_reader_locate_file(archive, path2.c_str(), nullptr, 0);
+    mz_zip_archive_file_stat stat;
+    if (index < 0 || !mz_zip_reader_file_stat(archive, index, &stat))
+        return false;
+    if (stat.m_uncomp_size == 0 || stat.m_uncomp_size % sizeof(Slic3r::Vec3f) != 0 ||
+        stat.m_uncomp_size > uint64_t(std::numeric_limits<size_t>::max()))
+        return false;
+    vertices.resize(size_t(stat.m_uncomp_size) / sizeof(Slic3r::Vec3f));
+    if (!mz_zip_reader_extract_to_mem(archive, index, vertices.data(), size_t(stat.m_uncomp_size), 0)) {
+        vertices.clear();
+        return false;
+    }
+    if (unit_factor != 1.0f)
+        for (Slic3r::Vec3f &v : vertices)
+            v *= unit_factor;
+    return true;
+}
+
 void add_vec3(std::stringstream &stream, const Slic3r::Vec3f &tr)
 {
     for (unsigned r = 0; r < 3; ++r) {
@@ -786,6 +832,10 @@ void PlateData::parse_filament_info(GCodeProcessorResult *result)
             int object_current_color_group{-1};
             std::map<int, std::string> object_group_id_to_color;
             bool is_bbl_3mf { false };
+            // Archive the object model stream comes from, used to load auxiliary binary vertex entries.
+            mz_zip_archive *object_archive { nullptr };
+            // Vertices of the current object were loaded from a binary entry, the XML vertices are skipped.
+            bool object_binary_vertices_loaded { false };
 
             ObjectImporter(_BBS_3MF_Importer *importer, std::string file_path, std::string obj_path)
             {
@@ -945,6 +995,10 @@ void PlateData::parse_filament_info(GCodeProcessorResult *result)
         Model* m_model;
         float m_unit_factor;
         CurrentObject* m_curr_object{nullptr};
+        // Archive the model stream currently parsed comes from, used to load auxiliary binary vertex entries.
+        mz_zip_archive* m_zip_archive{nullptr};
+        // Vertices of the current object were loaded from a binary entry, the XML vertices are skipped.
+        bool m_binary_vertices_loaded{false};
         IdToCurrentObjectMap m_current_objects;
         IndexToPathMap       m_index_paths;
         IdToModelObjectMap m_objects;
@@ -1610,11 +1664,10 @@ void PlateData::parse_filament_info(GCodeProcessorResult *result)
             }
 
             //merge these objects into one
+            //splice the map nodes instead of copying, the parsed vertex/triangle buffers can be large
             for (auto obj_importer : m_object_importers) {
-                for (const IdToCurrentObjectMap::value_type&  obj : obj_importer->object_list)
-                    m_current_objects.insert({ std::move(obj.first), std::move(obj.second)});
-                for (auto group_color : obj_importer->object_group_id_to_color)
-                    m_group_id_to_color.insert(std::move(group_color));
+                m_current_objects.merge(obj_importer->object_list);
+                m_group_id_to_color.merge(obj_importer->object_group_id_to_color);
 
                 delete obj_importer;
             }
@@ -2269,6 +2322,8 @@ void PlateData::parse_filament_info(GCodeProcessorResult *result)
             return false;
         }
 
+        m_zip_archive = &archive;
+
         _destroy_xml_parser();
 
         m_xml_parser = XML_ParserCreate(nullptr);
@@ -3360,8 +3415,14 @@ void PlateData::parse_filament_info(GCodeProcessorResult *result)
     bool _BBS_3MF_Importer::_handle_start_vertices(const char** attributes, unsigned int num_attributes)
     {
         // reset current vertices
-        if (m_curr_object)
+        m_binary_vertices_loaded = false;
+        if (m_curr_object) {
             m_curr_object->geometry.vertices.clear();
+            // BBS: prefer the binary vertex buffer referenced from the element, if stored
+            std::string binary_path = bbs_get_attribute_value_string(attributes, num_attributes, BINARY_VERTICES_ATTR);
+            if (!binary_path.empty())
+                m_binary_vertices_loaded = load_binary_vertices(m_zip_archive, binary_path, m_unit_factor, m_curr_object->geometry.vertices);
+        }
         return true;
     }
 
@@ -3375,7 +3436,7 @@ void PlateData::parse_filament_info(GCodeProcessorResult *result)
     {
         // appends the vertex coordinates
         // missing values are set equal to ZERO
-        if (m_curr_object)
+        if (m_curr_object && !m_binary_vertices_loaded)
             m_curr_object->geometry.vertices.emplace_back(
                 m_unit_factor * bbs_get_attribute_value_float(attributes, num_attributes, X_ATTR),
                 m_unit_factor * bbs_get_attribute_value_float(attributes, num_attributes, Y_ATTR),
@@ -4855,8 +4916,14 @@ void PlateData::parse_filament_info(GCodeProcessorResult *result)
     bool _BBS_3MF_Importer::ObjectImporter::_handle_object_start_vertices(const char** attributes, unsigned int num_attributes)
     {
         // reset current vertices
-        if (current_object)
+        object_binary_vertices_loaded = false;
+        if (current_object) {
             current_object->geometry.vertices.clear();
+            // BBS: prefer the binary vertex buffer referenced from the element, if stored
+            std::string binary_path = bbs_get_attribute_value_string(attributes, num_attributes, BINARY_VERTICES_ATTR);
+            if (!binary_path.empty())
+                object_binary_vertices_loaded = load_binary_vertices(object_archive, binary_path, object_unit_factor, current_object->geometry.vertices);
+        }
         return true;
     }
 
@@ -4870,7 +4937,7 @@ void PlateData::parse_filament_info(GCodeProcessorResult *result)
     {
         // appends the vertex coordinates
         // missing values are set equal to ZERO
-        if (current_object)
+        if (current_object && !object_binary_vertices_loaded)
             current_object->geometry.vertices.emplace_back(
                 object_unit_factor * bbs_get_attribute_value_float(attributes, num_attributes, X_ATTR),
                 object_unit_factor * bbs_get_attribute_value_float(attributes, num_attributes, Y_ATTR),
@@ -5102,6 +5169,8 @@ void PlateData::parse_filament_info(GCodeProcessorResult *result)
             return false;
         }
 
+        object_archive = &archive;
+
         object_xml_parser = XML_ParserCreate(nullptr);
         if (object_xml_parser == nullptr) {
             top_importer->add_error("Unable to create parser for "+object_path);
@@ -5221,10 +5290,16 @@ void PlateData::parse_filament_info(GCodeProcessorResult *result)
         bool m_skip_auxiliary { false };    // skip normal axuiliary files
         bool m_use_loaded_id { false };        // whether to use loaded id for identify_id
         bool m_share_mesh { false };        // whether to share mesh between objects
+        bool m_incremental { false };       // reuse unchanged sub model entries from the previous archive
         std::string m_thumbnail_middle = PRINTER_THUMBNAIL_MIDDLE_FILE;
         std::string m_thumbnail_small  = PRINTER_THUMBNAIL_SMALL_FILE;
         std::map<void const *, std::pair<ObjectData*, ModelVolume const *>> m_shared_meshes;
         std::map<ModelVolume const *, std::pair<std::string, int>> m_volume_paths;
+        // incremental save: the archive being overwritten and its per object content hashes
+        mutable mz_zip_archive m_prev_archive;
+        bool m_prev_archive_open { false };
+        std::map<std::string, uint64_t> m_prev_mesh_hashes;
+        mutable std::map<std::string, uint64_t> m_curr_mesh_hashes;
     public:
         //BBS: add plate data related logic
 
@@ -5285,6 +5360,11 @@ void PlateData::parse_filament_info(GCodeProcessorResult *result)
         bool _add_custom_gcode_per_print_z_file_to_archive(mz_zip_archive& archive, Model& model, const DynamicPrintConfig* config);
         bool _add_auxiliary_dir_to_archive(mz_zip_archive &archive, const std::string &aux_dir, PackingTemporaryData &data);
 
+        // incremental save
+        void _load_mesh_hashes_from_prev_archive();
+        uint64_t _object_content_hash(const ObjectData &object_data) const;
+        bool _splice_object_from_prev_archive(mz_zip_archive &archive, boost::mutex &mutex, const ObjectData &object_data) const;
+
         static int convert_instance_id_to_resource_id(const Model& model, int obj_id, int instance_id)
         {
             int resource_id = 1;
@@ -5316,6 +5396,7 @@ void PlateData::parse_filament_info(GCodeProcessorResult *result)
         m_from_backup_save = store_params.strategy & SaveStrategy::Backup;
 
         m_use_loaded_id = store_params.strategy & SaveStrategy::UseLoadedId;
+        m_incremental = store_params.strategy & SaveStrategy::Incremental;
 
         if (auto info = store_params.model->model_info) {
             if (auto iter = info->metadata_items.find("Thumbnail_Small"); iter != info->metadata_items.end())
@@ -5327,9 +5408,26 @@ void PlateData::parse_filament_info(GCodeProcessorResult *result)
         std::string filename = std::string(store_params.path);
         boost::filesystem::remove(filename + ".tmp", ec);
 
+        // Incremental save only pays off when every object lives in its own sub model entry
+        // which can be spliced verbatim from the archive being overwritten.
+        if (m_incremental && m_split_model && !m_skip_model && boost::filesystem::exists(filename, ec)) {
+            mz_zip_zero_struct(&m_prev_archive);
+            if (open_zip_reader(&m_prev_archive, filename)) {
+                m_prev_archive_open = true;
+                _load_mesh_hashes_from_prev_archive();
+            }
+        }
+
         bool result = _save_model_to_file(filename + ".tmp", *store_params.model, store_params.plate_data_list, store_params.project_presets, store_params.config,
             store_params.thumbnail_data, store_params.top_thumbnail_data, store_params.pick_thumbnail_data, store_params.proFn,
             store_params.calibration_thumbnail_data, store_params.id_bboxes, store_params.project, store_params.export_plate_idx);
+
+        // The previous archive has to be closed before renaming over it.
+        if (m_prev_archive_open) {
+            close_zip_reader(&m_prev_archive);
+            m_prev_archive_open = false;
+        }
+
         if (result) {
             boost::filesystem::rename(filename + ".tmp", filename, ec);
             if (ec) {
@@ -5866,6 +5964,7 @@ void PlateData::parse_filament_info(GCodeProcessorResult *result)
         stream << " <Default Extension=\"model\" ContentType=\"application/vnd.ms-package.3dmanufacturing-3dmodel+xml\"/>\n";
         stream << " <Default Extension=\"png\" ContentType=\"image/png\"/>\n";
         stream << " <Default Extension=\"gcode\" ContentType=\"text/x.gcode\"/>\n";
+        stream << " <Default Extension=\"bin\" ContentType=\"application/octet-stream\"/>\n";
         stream << "</Types>";
 
         std::string out = stream.str();
@@ -6329,6 +6428,30 @@ void PlateData::parse_filament_info(GCodeProcessorResult *result)
             }
         }
 
+        // BBS: store the vertex buffers of a sub model also as auxiliary binary entries, preferred
+        // on import over parsing the XML vertices, see binary_vertices_entry_path()
+        if (sub_model && !m_skip_model) {
+            const ObjectData &object_data = objects_data.begin()->second;
+            if (!object_data.sub_path.empty()) {
+                for (ModelVolume *volume : object_data.object->volumes) {
+                    if (volume == nullptr)
+                        continue;
+                    int volume_id = object_data.volumes_objectID.find(volume)->second;
+                    if (m_share_mesh && volume_id == 0)
+                        continue;
+                    const std::vector<Vec3f> &vertices = volume->mesh().its.vertices;
+                    std::string bin_path = binary_vertices_entry_path(object_data.sub_path, volume_id);
+                    if (bin_path.front() == '/')
+                        bin_path = bin_path.substr(1);
+                    if (!mz_zip_writer_add_mem(&archive, bin_path.c_str(), vertices.data(), vertices.size() * sizeof(Vec3f), MZ_DEFAULT_COMPRESSION)) {
+                        add_error("Unable to add binary vertex data to archive");
+                        BOOST_LOG_TRIVIAL(error) << __FUNCTION__ << ":" << __LINE__ << boost::format(", Unable to add binary vertex data to archive\n");
+                        return false;
+                    }
+                }
+            }
+        }
+
         if (m_skip_model || write_object) return true;
 
         // write model rels
@@ -6339,6 +6462,20 @@ void PlateData::parse_filament_info(GCodeProcessorResult *result)
             tbb::parallel_for(tbb::blocked_range<size_t>(0, objects_data.size(), 1), [this, &mutex, &model, objects = model.objects, &objects_data, &object_paths, main = &archive, project](const tbb::blocked_range<size_t>& range) {
                 for (size_t i = range.begin(); i < range.end(); ++i) {
                     auto iter = objects_data.find(objects[i]);
+                    if (m_incremental) {
+                        // Splice the object's entries from the previous archive when its content
+                        // hash matches, skipping the whole XML serialization and deflate.
+                        uint64_t hash = _object_content_hash(iter->second);
+                        bool unchanged;
+                        {
+                            boost::unique_lock l(mutex);
+                            m_curr_mesh_hashes[iter->second.sub_path] = hash;
+                            auto it_prev = m_prev_mesh_hashes.find(iter->second.sub_path);
+                            unchanged = it_prev != m_prev_mesh_hashes.end() && it_prev->second == hash;
+                        }
+                        if (unchanged && _splice_object_from_prev_archive(*main, mutex, iter->second))
+                            continue;
+                    }
                     ObjectToObjectDataMap objects_data2;
                     objects_data2.insert(*iter);
                     auto & object = *iter->second.object;
@@ -6360,8 +6497,114 @@ void PlateData::parse_filament_info(GCodeProcessorResult *result)
                     mz_zip_reader_end(&archive);
                 }
             });
+
+            if (m_incremental) {
+                // Store the content hash index so the next incremental save can tell
+                // which objects are dirty.
+                std::stringstream stream;
+                for (const auto &entry : m_curr_mesh_hashes)
+                    stream << entry.first << " " << entry.second << "\n";
+                std::string buf = stream.str();
+                if (!mz_zip_writer_add_mem(&archive, MESH_HASHES_FILE.c_str(), buf.data(), buf.size(), MZ_DEFAULT_COMPRESSION)) {
+                    add_error("Unable to add mesh hashes file to archive");
+                    return false;
+                }
+            }
+        }
+
+        return true;
+    }
+
+    void _BBS_3MF_Exporter::_load_mesh_hashes_from_prev_archive()
+    {
+        m_prev_mesh_hashes.clear();
+        size_t size = 0;
+        void  *data = mz_zip_reader_extract_file_to_heap(&m_prev_archive, MESH_HASHES_FILE.c_str(), &size, 0);
+        if (data == nullptr)
+            // Previous archive was not an incremental save, every object will be re-serialized.
+            return;
+        std::istringstream stream(std::string((const char *) data, size));
+        mz_free(data);
+        std::string path;
+        uint64_t    hash;
+        while (stream >> path >> hash)
+            m_prev_mesh_hashes[path] = hash;
+    }
+
+    // Content hash of everything that ends up in an object's sub model entries: the raw mesh
+    // buffers, the paint annotations and the volume ids including the share mesh references.
+    // Seeded with the format versions so entries are never reused across format changes.
+    uint64_t _BBS_3MF_Exporter::_object_content_hash(const ObjectData &object_data) const
+    {
+        uint64_t hash = 0xcbf29ce484222325ULL;
+        auto hash_append = [&hash](const void *data, size_t size) {
+            for (const unsigned char *byte = (const unsigned char *) data; size > 0; ++ byte, -- size) {
+                hash ^= *byte;
+                hash *= 0x100000001b3ULL;
+            }
+        };
+        auto hash_append_value = [&hash_append](auto value) { hash_append(&value, sizeof(value)); };
+        hash_append_value(VERSION_BBS_3MF);
+        hash_append(SLIC3R_VERSION, strlen(SLIC3R_VERSION));
+        for (const ModelVolume *volume : object_data.object->volumes) {
+            if (volume == nullptr)
+                continue;
+            int volume_id = object_data.volumes_objectID.find(volume)->second;
+            hash_append_value(volume_id);
+            if (m_share_mesh && volume_id == 0) {
+                // Shared mesh, the entry only references another object's geometry.
+                auto iter = m_volume_paths.find(volume);
+                if (iter == m_volume_paths.end())
+                    return 0;
+                hash_append(iter->second.first.data(), iter->second.first.size());
+                hash_append_value(iter->second.second);
+                continue;
+            }
+            const indexed_triangle_set &its = volume->mesh().its;
+            hash_append(its.vertices.data(), its.vertices.size() * sizeof(Vec3f));
+            hash_append(its.indices.data(), its.indices.size() * sizeof(its.indices.front()));
+            for (const FacetsAnnotation *annotation : { &volume->supported_facets, &volume->seam_facets, &volume->mmu_segmentation_facets }) {
+                const auto &data = annotation->get_data();
+                hash_append(data.first.data(), data.first.size() * sizeof(std::pair<int, int>));
+                for (bool bit : data.second)
+                    hash_append_value((char) bit);
+            }
         }
+        return hash;
+    }
 
+    // Copy the object's sub model entry and its binary vertex entries verbatim from the
+    // previous archive. Returns false (without touching the target) when any entry is
+    // missing, the caller then serializes the object as usual.
+    bool _BBS_3MF_Exporter::_splice_object_from_prev_archive(mz_zip_archive &archive, boost::mutex &mutex, const ObjectData &object_data) const
+    {
+        if (!m_prev_archive_open || object_data.sub_path.empty())
+            return false;
+        boost::unique_lock l(mutex);
+        std::vector<mz_uint32> file_indices;
+        int index = mz_zip_reader_locate_file(&m_prev_archive, object_data.sub_path.substr(1).c_str(), nullptr, 0);
+        if (index < 0)
+            return false;
+        file_indices.emplace_back((mz_uint32) index);
+        for (const ModelVolume *volume : object_data.object->volumes) {
+            if (volume == nullptr)
+                continue;
+            int volume_id = object_data.volumes_objectID.find(volume)->second;
+            if (m_share_mesh && volume_id == 0)
+                continue;
+            std::string bin_path = binary_vertices_entry_path(object_data.sub_path, volume_id);
+            if (bin_path.front() == '/')
+                bin_path = bin_path.substr(1);
+            index = mz_zip_reader_locate_file(&m_prev_archive, bin_path.c_str(), nullptr, 0);
+            if (index < 0)
+                return false;
+            file_indices.emplace_back((mz_uint32) index);
+        }
+        for (mz_uint32 file_index : file_indices)
+            if (!mz_zip_writer_add_from_zip_reader(&archive, &m_prev_archive, file_index)) {
+                BOOST_LOG_TRIVIAL(error) << __FUNCTION__ << ":" << __LINE__ << boost::format(", failed to splice %1% from previous archive\n") % object_data.sub_path;
+                return false;
+            }
         return true;
     }
 
@@ -6557,6 +6800,15 @@ void PlateData::parse_filament_info(GCodeProcessorResult *result)
             output_buffer += MESH_TAG;
             output_buffer += ">\n    <";
             output_buffer += VERTICES_TAG;
+            if (!object_data.sub_path.empty()) {
+                // BBS: the same buffer is stored as a binary entry next to this sub model file and
+                // preferred on import, the XML vertices below are kept for foreign consumers
+                output_buffer += " ";
+                output_buffer += BINARY_VERTICES_ATTR;
+                output_buffer += "=\"";
+                output_buffer += binary_vertices_entry_path(object_data.sub_path, volume_id);
+                output_buffer += "\"";
+            }
             output_buffer += ">\n";
 
             vertices_count += (int)its.vertices.size();
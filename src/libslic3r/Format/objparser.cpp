@@ -4,21 +4,38 @@
 #include <boost/log/trivial.hpp>
 #include <boost/nowide/cstdio.hpp>
 
-#include "objparser.hpp"
+#include <fast_float/fast_float.h>
 
-#include "libslic3r/LocalesUtils.hpp"
+#include "objparser.hpp"
 
 namespace ObjParser {
 
-static bool obj_parseline(const char *line, ObjData &data)
+// Fast, locale independent replacement of strtod() with the same endptr convention:
+// on success *endptr points past the parsed number, on failure it points at line.
+static double strtod_fast(const char *line, const char *end, char **endptr)
+{
+	double value = 0.;
+	auto   res   = fast_float::from_chars(line, end, value);
+	*endptr = const_cast<char*>(res.ec == std::errc() ? res.ptr : line);
+	return value;
+}
+
+// Find the first line terminator ('\r' or '\n') in [begin, end), nullptr if there is none.
+// memchr() is used for the scanning as the C runtime vectorizes it.
+static inline char* find_eol(char *begin, char *end)
+{
+	char *lf = (char*)memchr(begin, '\n', end - begin);
+	char *cr = (char*)memchr(begin, '\r', (lf == nullptr ? end : lf) - begin);
+	return cr != nullptr ? cr : lf;
+}
+
+static bool obj_parseline(const char *line, const char *end, ObjData &data)
 {
 #define EATWS() while (*line == ' ' || *line == '\t') ++ line
 
 	if (*line == 0)
 		return true;
 
-    assert(Slic3r::is_decimal_separator_point());
-
 	// Ignore whitespaces at the beginning of the line.
 	//FIXME is this a good idea?
 	EATWS();
@@ -42,14 +59,14 @@ static bool obj_parseline(const char *line, ObjData &data)
 				return false;
 			EATWS();
 			char *endptr = 0;
-			double u = strtod(line, &endptr);
+			double u = strtod_fast(line, end, &endptr);
 			if (endptr == 0 || (*endptr != ' ' && *endptr != '\t'))
 				return false;
 			line = endptr;
 			EATWS();
 			double v = 0;
 			if (*line != 0) {
-				v = strtod(line, &endptr);
+				v = strtod_fast(line, end, &endptr);
 				if (endptr == 0 || (*endptr != ' ' && *endptr != '\t' && *endptr != 0))
 					return false;
 				line = endptr;
@@ -57,7 +74,7 @@ static bool obj_parseline(const char *line, ObjData &data)
 			}
 			double w = 0;
 			if (*line != 0) {
-				w = strtod(line, &endptr);
+				w = strtod_fast(line, end, &endptr);
 				if (endptr == 0 || (*endptr != ' ' && *endptr != '\t' && *endptr != 0))
 					return false;
 				line = endptr;
@@ -79,17 +96,17 @@ static bool obj_parseline(const char *line, ObjData &data)
 				return false;
 			EATWS();
 			char *endptr = 0;
-			double x = strtod(line, &endptr);
+			double x = strtod_fast(line, end, &endptr);
 			if (endptr == 0 || (*endptr != ' ' && *endptr != '\t'))
 				return false;
 			line = endptr;
 			EATWS();
-			double y = strtod(line, &endptr);
+			double y = strtod_fast(line, end, &endptr);
 			if (endptr == 0 || (*endptr != ' ' && *endptr != '\t'))
 				return false;
 			line = endptr;
 			EATWS();
-			double z = strtod(line, &endptr);
+			double z = strtod_fast(line, end, &endptr);
 			if (endptr == 0 || (*endptr != ' ' && *endptr != '\t' && *endptr != 0))
 				return false;
 			line = endptr;
@@ -109,19 +126,19 @@ static bool obj_parseline(const char *line, ObjData &data)
 				return false;
 			EATWS();
 			char *endptr = 0;
-			double u = strtod(line, &endptr);
+			double u = strtod_fast(line, end, &endptr);
 			if (endptr == 0 || (*endptr != ' ' && *endptr != '\t' && *endptr != 0))
 				return false;
 			line = endptr;
 			EATWS();
-			double v = strtod(line, &endptr);
+			double v = strtod_fast(line, end, &endptr);
 			if (endptr == 0 || (*endptr != ' ' && *endptr != '\t' && *endptr != 0))
 				return false;
 			line = endptr;
 			EATWS();
 			double w = 0;
 			if (*line != 0) {
-				w = strtod(line, &endptr);
+				w = strtod_fast(line, end, &endptr);
 				if (endptr == 0 || (*endptr != ' ' && *endptr != '\t' && *endptr != 0))
 					return false;
 				line = endptr;
@@ -141,24 +158,24 @@ static bool obj_parseline(const char *line, ObjData &data)
 				return false;
 			EATWS();
 			char *endptr = 0;
-			double x = strtod(line, &endptr);
+			double x = strtod_fast(line, end, &endptr);
 			if (endptr == 0 || (*endptr != ' ' && *endptr != '\t'))
 				return false;
 			line = endptr;
 			EATWS();
-			double y = strtod(line, &endptr);
+			double y = strtod_fast(line, end, &endptr);
 			if (endptr == 0 || (*endptr != ' ' && *endptr != '\t'))
 				return false;
 			line = endptr;
 			EATWS();
-			double z = strtod(line, &endptr);
+			double z = strtod_fast(line, end, &endptr);
 			if (endptr == 0 || (*endptr != ' ' && *endptr != '\t' && *endptr != 0))
 				return false;
 			line = endptr;
 			EATWS();
 			double w = 1.0;
 			if (*line != 0) {
-				w = strtod(line, &endptr);
+				w = strtod_fast(line, end, &endptr);
 				if (endptr == 0 || (*endptr != ' ' && *endptr != '\t' && *endptr != 0))
 					return false;
 				line = endptr;
@@ -326,8 +343,6 @@ static bool obj_parseline(const char *line, ObjData &data)
 
 bool objparse(const char *path, ObjData &data)
 {
-    Slic3r::CNumericLocalesSetter locales_setter;
-
 	FILE *pFile = boost::nowide::fopen(path, "rt");
 	if (pFile == 0)
 		return false;
@@ -339,17 +354,16 @@ bool objparse(const char *path, ObjData &data)
 		while ((len = ::fread(buf + lenPrev, 1, 65536, pFile)) != 0) {
 			len += lenPrev;
 			size_t lastLine = 0;
-			for (size_t i = 0; i < len; ++ i)
-				if (buf[i] == '\r' || buf[i] == '\n') {
-					buf[i] = 0;
-					char *c = buf + lastLine;
-					while (*c == ' ' || *c == '\t')
-						++ c;
-					//FIXME check the return value and exit on error?
-					// Will it break parsing of some obj files?
-					obj_parseline(c, data);
-					lastLine = i + 1;
-				}
+			for (char *eol; (eol = find_eol(buf + lastLine, buf + len)) != nullptr;) {
+				*eol = 0;
+				char *c = buf + lastLine;
+				while (*c == ' ' || *c == '\t')
+					++ c;
+				//FIXME check the return value and exit on error?
+				// Will it break parsing of some obj files?
+				obj_parseline(c, eol, data);
+				lastLine = eol - buf + 1;
+			}
 			lenPrev = len - lastLine;
 			if (lenPrev > 65536) {
 		    	BOOST_LOG_TRIVIAL(error) << "ObjParser: Excessive line length";
@@ -371,8 +385,6 @@ bool objparse(const char *path, ObjData &data)
 
 bool objparse(std::istream &stream, ObjData &data)
 {
-    Slic3r::CNumericLocalesSetter locales_setter;
-    
     try {
         char buf[65536 * 2];
         size_t len = 0;
@@ -380,15 +392,14 @@ bool objparse(std::istream &stream, ObjData &data)
         while ((len = size_t(stream.read(buf + lenPrev, 65536).gcount())) != 0) {
             len += lenPrev;
             size_t lastLine = 0;
-            for (size_t i = 0; i < len; ++ i)
-                if (buf[i] == '\r' || buf[i] == '\n') {
-                    buf[i] = 0;
-                    char *c = buf + lastLine;
-                    while (*c == ' ' || *c == '\t')
-                        ++ c;
-                    obj_parseline(c, data);
-                    lastLine = i + 1;
-                }
+            for (char *eol; (eol = find_eol(buf + lastLine, buf + len)) != nullptr;) {
+                *eol = 0;
+                char *c = buf + lastLine;
+                while (*c == ' ' || *c == '\t')
+                    ++ c;
+                obj_parseline(c, eol, data);
+                lastLine = eol - buf + 1;
+            }
             lenPrev = len - lastLine;
             memmove(buf, buf + lastLine, lenPrev);
         }
@@ -5,10 +5,15 @@
 #include "svg.hpp"
 #include "nanosvg/nanosvg.h"
 
+#include <algorithm>
 #include <string>
+#include <thread>
 
 #include <boost/log/trivial.hpp>
 
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+
 #include "BRepBuilderAPI_MakeWire.hxx"
 #include "BRepBuilderAPI_MakeEdge.hxx"
 #include "BRepBuilderAPI_MakeFace.hxx"
@@ -300,97 +305,114 @@ bool get_svg_profile(const char *path, std::vector<Element_Info> &element_infos,
     return true;
 }
 
-bool load_svg(const char *path, Model *model, std::string &message)
+bool load_svg(const char *path, Model *model, std::string &message, ImportstlProgressFn proFn)
 {
     std::vector<Element_Info> namedSolids;
     if (!get_svg_profile(path, namedSolids, message))
         return false;
 
-    std::vector<stl_file> stl;
-    stl.resize(namedSolids.size());
-    // todo: zhimin, Can be accelerated in parallel with tbb 
-    for (size_t i = 0 ; i < namedSolids.size(); i++) {
-        BRepMesh_IncrementalMesh mesh(namedSolids[i].shape, STEP_TRANS_CHORD_ERROR, false, STEP_TRANS_ANGLE_RES, true);
-        // BBS: calculate total number of the nodes and triangles
-        int aNbNodes     = 0;
-        int aNbTriangles = 0;
-        for (TopExp_Explorer anExpSF(namedSolids[i].shape, TopAbs_FACE); anExpSF.More(); anExpSF.Next()) {
-            TopLoc_Location aLoc;
-            Handle(Poly_Triangulation) aTriangulation = BRep_Tool::Triangulation(TopoDS::Face(anExpSF.Current()), aLoc);
-            if (!aTriangulation.IsNull()) {
-                aNbNodes += aTriangulation->NbNodes();
-                aNbTriangles += aTriangulation->NbTriangles();
+    ModelObject *new_object = model->add_object();
+    // new_object->name ?
+    new_object->input_file = path;
+
+    // BBS: tessellate the extruded profiles in parallel, batch by batch. The progress
+    // callback is polled on the calling thread between batches, so the import stays
+    // responsive and cancelable while the workers chew on the shapes.
+    std::vector<TriangleMesh> meshes(namedSolids.size());
+    const size_t batch_size = std::max<size_t>(1, 2 * std::thread::hardware_concurrency());
+    for (size_t batch_begin = 0; batch_begin < namedSolids.size(); batch_begin += batch_size) {
+        if (proFn) {
+            bool cb_cancel = false;
+            proFn((int) batch_begin, (int) namedSolids.size(), cb_cancel);
+            if (cb_cancel) {
+                model->delete_object(new_object);
+                return false;
             }
         }
+        const size_t batch_end = std::min(batch_begin + batch_size, namedSolids.size());
+        tbb::parallel_for(tbb::blocked_range<size_t>(batch_begin, batch_end),
+            [&namedSolids, &meshes](const tbb::blocked_range<size_t> &range) {
+            for (size_t i = range.begin(); i < range.end(); ++i) {
+                BRepMesh_IncrementalMesh mesh(namedSolids[i].shape, STEP_TRANS_CHORD_ERROR, false, STEP_TRANS_ANGLE_RES, true);
+                // BBS: calculate total number of the nodes and triangles
+                int aNbNodes     = 0;
+                int aNbTriangles = 0;
+                for (TopExp_Explorer anExpSF(namedSolids[i].shape, TopAbs_FACE); anExpSF.More(); anExpSF.Next()) {
+                    TopLoc_Location aLoc;
+                    Handle(Poly_Triangulation) aTriangulation = BRep_Tool::Triangulation(TopoDS::Face(anExpSF.Current()), aLoc);
+                    if (!aTriangulation.IsNull()) {
+                        aNbNodes += aTriangulation->NbNodes();
+                        aNbTriangles += aTriangulation->NbTriangles();
+                    }
+                }
 
-        if (aNbTriangles == 0 || aNbNodes == 0)
-            // BBS: No triangulation on the shape.
-            continue;
+                if (aNbTriangles == 0 || aNbNodes == 0)
+                    // BBS: No triangulation on the shape.
+                    continue;
+
+                stl_file stl;
+                stl.stats.type                = inmemory;
+                stl.stats.number_of_facets    = (uint32_t) aNbTriangles;
+                stl.stats.original_num_facets = stl.stats.number_of_facets;
+                stl_allocate(&stl);
+
+                std::vector<Vec3f> points;
+                points.reserve(aNbNodes);
+                // BBS: count faces missing triangulation
+                Standard_Integer aNbFacesNoTri = 0;
+                // BBS: fill temporary triangulation
+                Standard_Integer aNodeOffset    = 0;
+                Standard_Integer aTriangleOffet = 0;
+                for (TopExp_Explorer anExpSF(namedSolids[i].shape, TopAbs_FACE); anExpSF.More(); anExpSF.Next()) {
+                    const TopoDS_Shape &aFace = anExpSF.Current();
+                    TopLoc_Location     aLoc;
+                    Handle(Poly_Triangulation) aTriangulation = BRep_Tool::Triangulation(TopoDS::Face(aFace), aLoc);
+                    if (aTriangulation.IsNull()) {
+                        ++aNbFacesNoTri;
+                        continue;
+                    }
+                    // BBS: copy nodes
+                    gp_Trsf aTrsf = aLoc.Transformation();
+                    for (Standard_Integer aNodeIter = 1; aNodeIter <= aTriangulation->NbNodes(); ++aNodeIter) {
+                        gp_Pnt aPnt = aTriangulation->Node(aNodeIter);
+                        aPnt.Transform(aTrsf);
+                        points.emplace_back(std::move(Vec3f(aPnt.X(), aPnt.Y(), aPnt.Z())));
+                    }
+                    // BBS: copy triangles
+                    const TopAbs_Orientation anOrientation = anExpSF.Current().Orientation();
+                    Standard_Integer         anId[3];
+                    for (Standard_Integer aTriIter = 1; aTriIter <= aTriangulation->NbTriangles(); ++aTriIter) {
+                        Poly_Triangle aTri = aTriangulation->Triangle(aTriIter);
+
+                        aTri.Get(anId[0], anId[1], anId[2]);
+                        if (anOrientation == TopAbs_REVERSED) std::swap(anId[1], anId[2]);
+                        // BBS: save triangles facets
+                        stl_facet facet;
+                        facet.vertex[0] = points[anId[0] + aNodeOffset - 1].cast<float>();
+                        facet.vertex[1] = points[anId[1] + aNodeOffset - 1].cast<float>();
+                        facet.vertex[2] = points[anId[2] + aNodeOffset - 1].cast<float>();
+                        facet.extra[0]  = 0;
+                        facet.extra[1]  = 0;
+                        stl_normal normal;
+                        stl_calculate_normal(normal, &facet);
+                        stl_normalize_vector(normal);
+                        facet.normal                                   = normal;
+                        stl.facet_start[aTriangleOffet + aTriIter - 1] = facet;
+                    }
+
+                    aNodeOffset += aTriangulation->NbNodes();
+                    aTriangleOffet += aTriangulation->NbTriangles();
+                }
 
-        stl[i].stats.type                = inmemory;
-        stl[i].stats.number_of_facets    = (uint32_t) aNbTriangles;
-        stl[i].stats.original_num_facets = stl[i].stats.number_of_facets;
-        stl_allocate(&stl[i]);
-
-        std::vector<Vec3f> points;
-        points.reserve(aNbNodes);
-        // BBS: count faces missing triangulation
-        Standard_Integer aNbFacesNoTri = 0;
-        // BBS: fill temporary triangulation
-        Standard_Integer aNodeOffset    = 0;
-        Standard_Integer aTriangleOffet = 0;
-        for (TopExp_Explorer anExpSF(namedSolids[i].shape, TopAbs_FACE); anExpSF.More(); anExpSF.Next()) {
-            const TopoDS_Shape &aFace = anExpSF.Current();
-            TopLoc_Location     aLoc;
-            Handle(Poly_Triangulation) aTriangulation = BRep_Tool::Triangulation(TopoDS::Face(aFace), aLoc);
-            if (aTriangulation.IsNull()) {
-                ++aNbFacesNoTri;
-                continue;
-            }
-            // BBS: copy nodes
-            gp_Trsf aTrsf = aLoc.Transformation();
-            for (Standard_Integer aNodeIter = 1; aNodeIter <= aTriangulation->NbNodes(); ++aNodeIter) {
-                gp_Pnt aPnt = aTriangulation->Node(aNodeIter);
-                aPnt.Transform(aTrsf);
-                points.emplace_back(std::move(Vec3f(aPnt.X(), aPnt.Y(), aPnt.Z())));
+                meshes[i].from_stl(stl);
             }
-            // BBS: copy triangles
-            const TopAbs_Orientation anOrientation = anExpSF.Current().Orientation();
-            Standard_Integer         anId[3];
-            for (Standard_Integer aTriIter = 1; aTriIter <= aTriangulation->NbTriangles(); ++aTriIter) {
-                Poly_Triangle aTri = aTriangulation->Triangle(aTriIter);
-
-                aTri.Get(anId[0], anId[1], anId[2]);
-                if (anOrientation == TopAbs_REVERSED) std::swap(anId[1], anId[2]);
-                // BBS: save triangles facets
-                stl_facet facet;
-                facet.vertex[0] = points[anId[0] + aNodeOffset - 1].cast<float>();
-                facet.vertex[1] = points[anId[1] + aNodeOffset - 1].cast<float>();
-                facet.vertex[2] = points[anId[2] + aNodeOffset - 1].cast<float>();
-                facet.extra[0]  = 0;
-                facet.extra[1]  = 0;
-                stl_normal normal;
-                stl_calculate_normal(normal, &facet);
-                stl_normalize_vector(normal);
-                facet.normal                                      = normal;
-                stl[i].facet_start[aTriangleOffet + aTriIter - 1] = facet;
-            }
-
-            aNodeOffset += aTriangulation->NbNodes();
-            aTriangleOffet += aTriangulation->NbTriangles();
-        }
+        });
     }
 
-    ModelObject *new_object = model->add_object();
-    // new_object->name ?
-    new_object->input_file = path;
-    auto stage_unit3 = stl.size() / LOAD_STEP_STAGE_UNIT_NUM + 1;
-    for (size_t i = 0; i < stl.size(); i++) {
-        // BBS: maybe mesh is empty from step file. Don't add
-        if (stl[i].stats.number_of_facets > 0) {
-            TriangleMesh triangle_mesh;
-            triangle_mesh.from_stl(stl[i]);
-            ModelVolume *new_volume       = new_object->add_volume(std::move(triangle_mesh));
+    for (size_t i = 0; i < meshes.size(); i++) {
+        // BBS: maybe mesh is empty from svg profile. Don't add
+        if (! meshes[i].empty()) {
+            ModelVolume *new_volume       = new_object->add_volume(std::move(meshes[i]));
             new_volume->name              = namedSolids[i].name;
             new_volume->source.input_file = path;
             new_volume->source.object_idx = (int) model->objects.size() - 1;
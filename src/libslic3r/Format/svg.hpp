@@ -1,7 +1,10 @@
 #pragma once
+
+#include <admesh/stl.h>
+
 namespace Slic3r {
 class Model;
 
-extern bool load_svg(const char *path, Model *model, std::string &message);
+extern bool load_svg(const char *path, Model *model, std::string &message, ImportstlProgressFn proFn = nullptr);
 
 }; // namespace Slic3r
@@ -344,7 +344,7 @@ static std::vector<Vec2d> get_path_of_change_filament(const Print& print)
                 }
 
                 // add tag for processor
-                gcode += ";" + GCodeProcessor::reserved_tag(GCodeProcessor::ETags::Wipe_Start) + "\n";
+                gcode += GCodeProcessor::reserved_tag_line(GCodeProcessor::ETags::Wipe_Start);
                 //BBS: don't need to enable cooling makers when this is the last wipe. Because no more cooling layer will clean this "_WIPE"
                 //Softfever: 
                 std::string cooling_mark = "";
@@ -366,7 +366,7 @@ static std::vector<Vec2d> get_path_of_change_filament(const Print& print)
                     );
                 }
                 // add tag for processor
-                gcode += ";" + GCodeProcessor::reserved_tag(GCodeProcessor::ETags::Wipe_End) + "\n";
+                gcode += GCodeProcessor::reserved_tag_line(GCodeProcessor::ETags::Wipe_End);
                 gcodegen.set_last_pos(wipe_path.points.back());
             }
 
@@ -1985,7 +1985,10 @@ void GCode::_do_export(Print& print, GCodeOutputStream &file, ThumbnailsGenerato
     // Prepare the helper object for replacing placeholders in custom G-code and output filename.
     m_placeholder_parser_integration.parser = print.placeholder_parser();
     m_placeholder_parser_integration.parser.update_timestamp();
-    m_placeholder_parser_integration.context.rng = std::mt19937(std::chrono::high_resolution_clock::now().time_since_epoch().count());
+    m_placeholder_parser_integration.context.rng = deterministic_mode() ?
+        // Fixed seed, so the {rand} placeholders repeat across runs and the G-code can be byte-diffed.
+        std::mt19937(27644437) :
+        std::mt19937(std::chrono::high_resolution_clock::now().time_since_epoch().count());
     // Enable passing global variables between PlaceholderParser invocations.
     m_placeholder_parser_integration.context.global_config = std::make_unique<DynamicConfig>();
     print.update_object_placeholders(m_placeholder_parser_integration.parser.config_writable(), ".gcode");
@@ -2658,7 +2661,10 @@ void GCode::process_layers(
             } else {
                 const std::pair<coordf_t, std::vector<LayerToPrint>>& layer = layers_to_print[layer_to_print_idx++];
                 const LayerTools& layer_tools = tool_ordering.tools_for_layer(layer.first);
-                print.set_status(80, Slic3r::format(_(L("Generating G-code: layer %1%")), std::to_string(layer_to_print_idx)));
+                // Ramp the G-code span from 80 to 99 by the layer index instead of sitting at 80
+                // until everything is done, the export is a large share of the total slicing time.
+                print.set_status(80 + int(19 * layer_to_print_idx / layers_to_print.size()),
+                                 Slic3r::format(_(L("Generating G-code: layer %1%")), std::to_string(layer_to_print_idx)));
                 if (m_wipe_tower && layer_tools.has_wipe_tower)
                     m_wipe_tower->next_layer();
                 //BBS
@@ -2686,8 +2692,14 @@ void GCode::process_layers(
                 return in.gcode;
             return cooling_buffer.process_layer(std::move(in.gcode), in.layer_id, in.cooling_buffer_flush);
         });
-    const auto output = tbb::make_filter<std::string, void>(slic3r_tbb_filtermode::serial_in_order,
-        [&output_stream](std::string s) { output_stream.write(s); }
+    // The file write and the G-code analyzer used to share one stage, serializing each other.
+    // As separate stages the analysis of one layer overlaps the file write of the next one;
+    // both stay serial and in order, so neither the file content nor the analyzer results change.
+    const auto output = tbb::make_filter<std::string, std::string>(slic3r_tbb_filtermode::serial_in_order,
+        [&output_stream](std::string s) -> std::string { output_stream.write_file_only(s); return s; }
+    );
+    const auto analyzer = tbb::make_filter<std::string, void>(slic3r_tbb_filtermode::serial_in_order,
+        [&output_stream](std::string s) { output_stream.process_gcode(s); }
     );
 
     const auto fan_mover = tbb::make_filter<std::string, std::string>(slic3r_tbb_filtermode::serial_in_order,
@@ -2712,13 +2724,13 @@ void GCode::process_layers(
 
     // The pipeline elements are joined using const references, thus no copying is performed.
     if (m_spiral_vase && m_pressure_equalizer)
-        tbb::parallel_pipeline(12, generator & spiral_mode & pressure_equalizer & cooling & fan_mover & output);
+        tbb::parallel_pipeline(12, generator & spiral_mode & pressure_equalizer & cooling & fan_mover & output & analyzer);
     else if (m_spiral_vase)
-    	tbb::parallel_pipeline(12, generator & spiral_mode & cooling & fan_mover & output);
+    	tbb::parallel_pipeline(12, generator & spiral_mode & cooling & fan_mover & output & analyzer);
     else if	(m_pressure_equalizer)
-        tbb::parallel_pipeline(12, generator & pressure_equalizer & cooling & fan_mover & output);
+        tbb::parallel_pipeline(12, generator & pressure_equalizer & cooling & fan_mover & output & analyzer);
     else
-    	tbb::parallel_pipeline(12, generator & cooling & fan_mover & output);
+    	tbb::parallel_pipeline(12, generator & cooling & fan_mover & output & analyzer);
 }
 
 // Process all layers of a single object instance (sequential mode) with a parallel pipeline:
@@ -2742,7 +2754,9 @@ void GCode::process_layers(
                 return {};
             } else {
                 LayerToPrint &layer = layers_to_print[layer_to_print_idx ++];
-                print.set_status(80, Slic3r::format(_(L("Generating G-code: layer %1%")), std::to_string(layer_to_print_idx)));
+                // Keep in sync with the by-layer pipeline above: ramp the G-code span from 80 to 99.
+                print.set_status(80 + int(19 * layer_to_print_idx / layers_to_print.size()),
+                                 Slic3r::format(_(L("Generating G-code: layer %1%")), std::to_string(layer_to_print_idx)));
                 //BBS
                 check_placeholder_parser_failed();
                 print.throw_if_canceled();
@@ -2758,8 +2772,14 @@ void GCode::process_layers(
         [&cooling_buffer = *this->m_cooling_buffer.get()](LayerResult in)->std::string {
             return cooling_buffer.process_layer(std::move(in.gcode), in.layer_id, in.cooling_buffer_flush);
         });
-    const auto output = tbb::make_filter<std::string, void>(slic3r_tbb_filtermode::serial_in_order,
-        [&output_stream](std::string s) { output_stream.write(s); }
+    // See the comment in the non-sequential overload above: splitting the file write and the
+    // G-code analyzer into separate serial stages lets them overlap on different layers
+    // without changing the file content or the analyzer results.
+    const auto output = tbb::make_filter<std::string, std::string>(slic3r_tbb_filtermode::serial_in_order,
+        [&output_stream](std::string s) -> std::string { output_stream.write_file_only(s); return s; }
+    );
+    const auto analyzer = tbb::make_filter<std::string, void>(slic3r_tbb_filtermode::serial_in_order,
+        [&output_stream](std::string s) { output_stream.process_gcode(s); }
     );
 
     const auto fan_mover = tbb::make_filter<std::string, std::string>(slic3r_tbb_filtermode::serial_in_order,
@@ -2782,9 +2802,9 @@ void GCode::process_layers(
 
     // The pipeline elements are joined using const references, thus no copying is performed.
     if (m_spiral_vase)
-        tbb::parallel_pipeline(12, generator & spiral_mode & cooling & fan_mover & output);
+        tbb::parallel_pipeline(12, generator & spiral_mode & cooling & fan_mover & output & analyzer);
     else
-        tbb::parallel_pipeline(12, generator & cooling & fan_mover & output);
+        tbb::parallel_pipeline(12, generator & cooling & fan_mover & output & analyzer);
 }
 
 std::string GCode::placeholder_parser_process(const std::string &name, const std::string &templ, unsigned int current_extruder_id, const DynamicConfig *config_override)
@@ -3162,7 +3182,7 @@ namespace ProcessLayer
                 if (gcode_type == CustomGCode::PausePrint) // Pause print
                 {
                     // add tag for processor
-                    gcode += ";" + GCodeProcessor::reserved_tag(GCodeProcessor::ETags::Pause_Print) + "\n";
+                    gcode += GCodeProcessor::reserved_tag_line(GCodeProcessor::ETags::Pause_Print);
                     //! FIXME_in_fw show message during print pause
                     //if (!pause_print_msg.empty())
                     //    gcode += "M117 " + pause_print_msg + "\n";
@@ -3170,7 +3190,7 @@ namespace ProcessLayer
                 }
                 else {
                     // add tag for processor
-                    gcode += ";" + GCodeProcessor::reserved_tag(GCodeProcessor::ETags::Custom_Code) + "\n";
+                    gcode += GCodeProcessor::reserved_tag_line(GCodeProcessor::ETags::Custom_Code);
                     if (gcode_type == CustomGCode::Template)    // Template Custom Gcode
                         gcode += gcodegen.placeholder_parser_process("template_custom_gcode", config.template_custom_gcode, current_extruder_id);
                     else                                        // custom Gcode
@@ -3365,8 +3385,14 @@ LayerResult GCode::process_layer(
     std::string gcode;
     assert(is_decimal_separator_point()); // for the sprintfs
 
+    // Reserve the layer buffer up front. Consecutive layers are usually of similar
+    // complexity, so the size of the previous layer with a small margin avoids regrowing
+    // a multi-megabyte buffer through repeated reallocations and copies.
+    if (m_last_layer_gcode_size > 0)
+        gcode.reserve(m_last_layer_gcode_size + m_last_layer_gcode_size / 8);
+
     // add tag for processor
-    gcode += ";" + GCodeProcessor::reserved_tag(GCodeProcessor::ETags::Layer_Change) + "\n";
+    gcode += GCodeProcessor::reserved_tag_line(GCodeProcessor::ETags::Layer_Change);
     // export layer z
     char buf[64];
     sprintf(buf, print.is_BBL_printer() ? "; Z_HEIGHT: %g\n" : ";Z:%g\n", print_z);
@@ -4043,6 +4069,7 @@ LayerResult GCode::process_layer(
         }
     }
 
+    m_last_layer_gcode_size = gcode.size();
     result.gcode = std::move(gcode);
     result.cooling_buffer_flush = object_layer || raft_layer || last_layer;
     return result;
@@ -4157,29 +4184,6 @@ std::string GCode::change_layer(coordf_t print_z)
 
 
 
-static std::unique_ptr<EdgeGrid::Grid> calculate_layer_edge_grid(const Layer& layer)
-{
-    auto out = make_unique<EdgeGrid::Grid>();
-
-    // Create the distance field for a layer below.
-    const coord_t distance_field_resolution = coord_t(scale_(1.) + 0.5);
-    out->create(layer.lslices, distance_field_resolution);
-    out->calculate_sdf();
-#if 0
-        {
-            static int iRun = 0;
-            BoundingBox bbox = (*lower_layer_edge_grid)->bbox();
-            bbox.min(0) -= scale_(5.f);
-            bbox.min(1) -= scale_(5.f);
-            bbox.max(0) += scale_(5.f);
-            bbox.max(1) += scale_(5.f);
-            EdgeGrid::save_png(*(*lower_layer_edge_grid), bbox, scale_(0.1f), debug_out_path("GCode_extrude_loop_edge_grid-%d.png", iRun++));
-        }
-#endif
-    return out;
-}
-
-
 std::string GCode::extrude_loop(ExtrusionLoop loop, std::string description, double speed)
 {
     // get a copy; don't modify the orientation of the original loop object otherwise
@@ -4452,6 +4456,18 @@ void GCode::GCodeOutputStream::write(const char *what)
     }
 }
 
+void GCode::GCodeOutputStream::write_file_only(const std::string &what)
+{
+    if (! what.empty())
+        fwrite(what.data(), 1, what.size(), this->f);
+}
+
+void GCode::GCodeOutputStream::process_gcode(const std::string &what)
+{
+    if (! what.empty())
+        m_processor.process_buffer(what);
+}
+
 void GCode::GCodeOutputStream::writeln(const std::string &what)
 {
     if (! what.empty())
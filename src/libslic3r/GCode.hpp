@@ -282,6 +282,14 @@ private:
         void write(const std::string& what) { this->write(what.c_str()); }
         void write(const char* what);
 
+        // Write a string into a file without feeding it to the G-code analyzer.
+        // Used by the layer pipeline in process_layers(), which runs the analyzer
+        // in its own stage, see process_gcode().
+        void write_file_only(const std::string& what);
+
+        // Feed a string to the G-code analyzer without writing it to the file.
+        void process_gcode(const std::string& what);
+
         // Write a string into a file.
         // Add a newline, if the string does not end with a newline already.
         // Used to export a custom G-code section processed by the PlaceholderParser.
@@ -508,6 +516,9 @@ private:
     float                               m_last_layer_z{ 0.0f };
     float                               m_max_layer_z{ 0.0f };
     float                               m_last_width{ 0.0f };
+    // Size of the G-code generated for the previous layer, used to reserve the buffer
+    // of the next layer in process_layer().
+    size_t                              m_last_layer_gcode_size{ 0 };
 #if ENABLE_GCODE_VIEWER_DATA_CHECKING
     double                              m_last_mm3_per_mm;
 #endif // ENABLE_GCODE_VIEWER_DATA_CHECKING
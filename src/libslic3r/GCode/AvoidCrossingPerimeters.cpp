@@ -567,7 +567,8 @@ static size_t avoid_perimeters_inner(const AvoidCrossingPerimeters::Boundary &bo
         std::sort(intersections.begin(), intersections.end(), [dir](const auto &l, const auto &r) { return (r.point - l.point).template cast<double>().dot(dir) > 0.; });
 
         // Search radius should always be at least equals to the value of offset used for computing boundaries.
-        const float search_radius = 2.f * get_perimeter_spacing(layer);
+        // It is precomputed in travel_to() when the boundary is initialized for the layer.
+        const float search_radius = boundary.search_radius;
         // When the offset is too big, then original travel doesn't have to cross created boundaries.
         // These cases are fixed by calling extend_for_closest_lines.
         intersections             = extend_for_closest_lines(intersections, boundary, start, end, search_radius);
@@ -1189,8 +1190,10 @@ Polyline AvoidCrossingPerimeters::travel_to(const GCode &gcodegen, const Point &
     bool is_support_layer = dynamic_cast<const SupportLayer *>(gcodegen.layer()) != nullptr;
     if (!use_external && (is_support_layer || (!m_lslices_offset.empty() && !any_expolygon_contains(m_lslices_offset, m_lslices_offset_bboxes, m_grid_lslices_offset, travel)))) {
         // Initialize m_internal only when it is necessary.
-        if (m_internal.boundaries.empty())
+        if (m_internal.boundaries.empty()) {
             init_boundary(&m_internal, to_polygons(get_boundary(*gcodegen.layer())));
+            m_internal.search_radius = 2.f * get_perimeter_spacing(*gcodegen.layer());
+        }
 
         // Trim the travel line by the bounding box.
         if (!m_internal.boundaries.empty() && Geometry::liang_barsky_line_clipping(startf, endf, m_internal.bbox)) {
@@ -1200,8 +1203,10 @@ Polyline AvoidCrossingPerimeters::travel_to(const GCode &gcodegen, const Point &
         }
     } else if(use_external) {
         // Initialize m_external only when exist any external travel for the current layer.
-        if (m_external.boundaries.empty())
+        if (m_external.boundaries.empty()) {
             init_boundary(&m_external, get_boundary_external(*gcodegen.layer()));
+            m_external.search_radius = 2.f * get_perimeter_spacing(*gcodegen.layer());
+        }
 
         // Trim the travel line by the bounding box.
         if (!m_external.boundaries.empty() && Geometry::liang_barsky_line_clipping(startf, endf, m_external.bbox)) {
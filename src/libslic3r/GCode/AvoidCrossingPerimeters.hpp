@@ -46,11 +46,16 @@ public:
         std::vector<std::vector<float>> boundaries_params;
         // Used for detection of intersection between line and any polygon from boundaries
         EdgeGrid::Grid                  grid;
+        // Search radius for intersections close to the travel endpoints, derived from the
+        // perimeter spacing of the layer. Cached here because it is the same for every
+        // travel on the layer and recomputing it walks all layer regions.
+        float                           search_radius { 0.f };
 
         void clear()
         {
             boundaries.clear();
             boundaries_params.clear();
+            search_radius = 0.f;
         }
     };
 
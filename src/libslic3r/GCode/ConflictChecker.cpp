@@ -123,16 +123,17 @@ float LinesBucketQueue::getCurrBottomZ()
     return layerBottomZ;
 }
 
-LineWithIDs LinesBucketQueue::getCurLines() const
+LineGroups LinesBucketQueue::getCurLineGroups() const
 {
-    LineWithIDs lines;
+    LineGroups groups;
     for (const LinesBucket &bucket : _buckets) {
         if (bucket.valid()) {
-            LineWithIDs tmpLines = bucket.curLines();
-            lines.insert(lines.end(), tmpLines.begin(), tmpLines.end());
+            LineGroup group = bucket.curLineGroup();
+            if (!group.lines.empty())
+                groups.push_back(std::move(group));
         }
     }
-    return lines;
+    return groups;
 }
 
 void getExtrusionPathsFromEntity(const ExtrusionEntityCollection *entity, ExtrusionPaths &paths)
@@ -193,21 +194,28 @@ ObjectExtrusions getAllLayersExtrusionPathsFromObject(PrintObject *obj)
     return oe;
 }
 
-ConflictComputeOpt ConflictChecker::find_inter_of_lines(const LineWithIDs &lines)
+ConflictComputeOpt ConflictChecker::find_inter_of_lines(const LineWithIDs &lines1, const LineWithIDs &lines2)
 {
     using namespace RasterizationImpl;
+    // Narrow phase for one pair of line groups: rasterize the first group into the grid,
+    // then probe it with the second group only. Lines within one group belong to the same
+    // object and need not be tested against each other.
     std::map<IndexPair, std::vector<int>> indexToLine;
 
-    for (int i = 0; i < lines.size(); ++i) {
-        const LineWithID &l1      = lines[i];
-        auto              indexes = line_rasterization(l1._line);
+    for (int i = 0; i < lines1.size(); ++i)
+        for (auto index : line_rasterization(lines1[i]._line))
+            indexToLine[index].push_back(i);
+
+    for (const LineWithID &l2 : lines2) {
+        auto indexes = line_rasterization(l2._line);
         for (auto index : indexes) {
-            const auto &possibleIntersectIdxs = indexToLine[index];
-            for (auto possibleIntersectIdx : possibleIntersectIdxs) {
-                const LineWithID &l2 = lines[possibleIntersectIdx];
+            auto it = indexToLine.find(index);
+            if (it == indexToLine.end())
+                continue;
+            for (auto possibleIntersectIdx : it->second) {
+                const LineWithID &l1 = lines1[possibleIntersectIdx];
                 if (auto interRes = line_intersect(l1, l2); interRes.has_value()) { return interRes; }
             }
-            indexToLine[index].push_back(i);
         }
     }
     return {};
@@ -237,24 +245,49 @@ ConflictResultOpt ConflictChecker::find_inter_of_lines_in_diff_objs(PrintObjectP
         conflictQueue.emplace_back_bucket(std::move(layers.support), obj, obj->instances().front().shift);
     }
 
-    std::vector<LineWithIDs> layersLines;
-    std::vector<float>       bottomZs;
+    // Broad phase over whole buckets: if no two buckets of different objects overlap in XY,
+    // no path conflict is possible at any height and slicing the buckets into height bands
+    // (which copies every extrusion line) can be skipped altogether.
+    {
+        const std::vector<LinesBucket> &buckets = conflictQueue._buckets;
+        bool may_conflict = false;
+        for (size_t i = 0; i + 1 < buckets.size() && !may_conflict; ++i)
+            for (size_t j = i + 1; j < buckets.size(); ++j)
+                if (buckets[i]._id != buckets[j]._id && buckets[i]._bbox.defined && buckets[j]._bbox.defined &&
+                    buckets[i]._bbox.overlap(buckets[j]._bbox)) {
+                    may_conflict = true;
+                    break;
+                }
+        if (!may_conflict)
+            return {};
+    }
+
+    std::vector<LineGroups> layersGroups;
+    std::vector<float>      bottomZs;
     while (conflictQueue.valid()) {
-        LineWithIDs lines = conflictQueue.getCurLines();
+        LineGroups groups = conflictQueue.getCurLineGroups();
         float curBottomZ = conflictQueue.getCurrBottomZ();
         bottomZs.push_back(curBottomZ);
-        layersLines.push_back(std::move(lines));
+        layersGroups.push_back(std::move(groups));
     }
 
-    bool                                                          find = false;
+    std::atomic<bool>                                               find{false};
     tbb::concurrent_vector<std::pair<ConflictComputeResult, float>> conflict;
-    tbb::parallel_for(tbb::blocked_range<size_t>(0, layersLines.size()), [&](tbb::blocked_range<size_t> range) {
-        for (size_t i = range.begin(); i < range.end(); i++) {
-            auto interRes = find_inter_of_lines(layersLines[i]);
-            if (interRes.has_value()) {
-                find = true;
-                conflict.emplace_back(interRes.value(), bottomZs[i]);
-                break;
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, layersGroups.size()), [&](tbb::blocked_range<size_t> range) {
+        for (size_t i = range.begin(); i < range.end() && !find.load(std::memory_order_relaxed); i++) {
+            const LineGroups &groups = layersGroups[i];
+            for (size_t j = 0; j + 1 < groups.size() && !find.load(std::memory_order_relaxed); ++j) {
+                for (size_t k = j + 1; k < groups.size(); ++k) {
+                    // Broad phase: the perimeter and support bucket of one object share its id and
+                    // cannot conflict, and neither can groups whose bounding boxes do not touch.
+                    if (groups[j].id == groups[k].id || !groups[j].bbox.overlap(groups[k].bbox))
+                        continue;
+                    if (auto interRes = find_inter_of_lines(groups[j].lines, groups[k].lines); interRes.has_value()) {
+                        find = true;
+                        conflict.emplace_back(interRes.value(), bottomZs[i]);
+                        break;
+                    }
+                }
             }
         }
     });
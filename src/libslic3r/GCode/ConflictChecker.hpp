@@ -23,6 +23,17 @@ struct LineWithID
 
 using LineWithIDs = std::vector<LineWithID>;
 
+// Lines of one bucket within one layer band, together with their 2D bounding box.
+// The boxes are the broad phase when the buckets are tested pairwise for conflicts.
+struct LineGroup
+{
+    LineWithIDs lines;
+    BoundingBox bbox;
+    const void *id { nullptr };
+};
+
+using LineGroups = std::vector<LineGroup>;
+
 struct ExtrusionLayer
 {
     ExtrusionPaths paths;
@@ -59,9 +70,20 @@ public:
     ExtrusionLayers _piles;
     const void*     _id;
     Point           _offset;
+    // Overall XY occupancy of all extrusions of this bucket, used to skip pairs of objects
+    // that cannot conflict at any height.
+    BoundingBox     _bbox;
 
 public:
-    LinesBucket(ExtrusionLayers &&paths, const void* id, Point offset) : _piles(paths), _id(id), _offset(offset) {}
+    LinesBucket(ExtrusionLayers &&paths, const void* id, Point offset) : _piles(paths), _id(id), _offset(offset)
+    {
+        for (const ExtrusionLayer &el : _piles)
+            for (const ExtrusionPath &path : el.paths)
+                if (path.is_force_no_extrusion() == false)
+                    _bbox.merge(get_extents(path.polyline.points));
+        if (_bbox.defined)
+            _bbox.translate(_offset.x(), _offset.y());
+    }
     LinesBucket(LinesBucket &&) = default;
 
     std::pair<int, int> curRange() const
@@ -79,21 +101,23 @@ public:
         _curBottomZ = _curPileIdx == _piles.size() ? _piles.back().bottom_z : _piles[_curPileIdx].bottom_z;
     }
     float curBottomZ() const { return _curBottomZ; }
-    LineWithIDs curLines() const
+    LineGroup curLineGroup() const
     {
         auto [b, e] = curRange();
-        LineWithIDs lines;
+        LineGroup group;
+        group.id = _id;
         for (int i = b; i < e; ++i) {
             for (const ExtrusionPath &path : _piles[i].paths) {
                 if (path.is_force_no_extrusion() == false) {
                     Polyline check_polyline = path.polyline;
                     check_polyline.translate(_offset);
+                    group.bbox.merge(get_extents(check_polyline.points));
                     Lines tmpLines = check_polyline.lines();
-                    for (const Line &line : tmpLines) { lines.emplace_back(line, _id, path.role()); }
+                    for (const Line &line : tmpLines) { group.lines.emplace_back(line, _id, path.role()); }
                 }
             }
         }
-        return lines;
+        return group;
     }
 
     friend bool operator>(const LinesBucket &left, const LinesBucket &right) { return left._curBottomZ > right._curBottomZ; }
@@ -116,7 +140,7 @@ public:
     void        emplace_back_bucket(ExtrusionLayers &&els, const void *objPtr, Point offset);
     bool        valid() const { return _pq.empty() == false; }
     float       getCurrBottomZ();
-    LineWithIDs getCurLines() const;
+    LineGroups  getCurLineGroups() const;
 };
 
 void getExtrusionPathsFromEntity(const ExtrusionEntityCollection *entity, ExtrusionPaths &paths);
@@ -143,7 +167,7 @@ using ConflictObjName = std::optional<std::pair<std::string, std::string>>;
 struct ConflictChecker
 {
     static ConflictResultOpt  find_inter_of_lines_in_diff_objs(PrintObjectPtrs objs, std::optional<const FakeWipeTower *> wtdptr);
-    static ConflictComputeOpt find_inter_of_lines(const LineWithIDs &lines);
+    static ConflictComputeOpt find_inter_of_lines(const LineWithIDs &lines1, const LineWithIDs &lines2);
     static ConflictComputeOpt line_intersect(const LineWithID &l1, const LineWithID &l2);
 };
 
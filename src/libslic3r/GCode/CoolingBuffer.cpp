@@ -5,6 +5,7 @@
 #include <boost/log/trivial.hpp>
 #include <iostream>
 #include <float.h>
+#include <string_view>
 #include <system_error>
 #include <unordered_map>
 
@@ -341,12 +342,13 @@ std::vector<PerExtruderAdjustments> CoolingBuffer::parse_layer_gcode(const std::
     // for a sequence of extrusion moves.
     size_t            active_speed_modifier = size_t(-1);
 
-    for (; *line_start != 0; line_start = line_end) 
+    for (; *line_start != 0; line_start = line_end)
     {
         while (*line_end != '\n' && *line_end != 0)
             ++ line_end;
-        // sline will not contain the trailing '\n'.
-        std::string sline(line_start, line_end);
+        // sline will not contain the trailing '\n'. It is a view into the layer buffer,
+        // not a copy: a heap allocation per G-code line would dominate the parse.
+        std::string_view sline(line_start, size_t(line_end - line_start));
         // CoolingLine will contain the trailing '\n'.
         if (*line_end == '\n')
             ++ line_end;
@@ -369,7 +371,8 @@ std::vector<PerExtruderAdjustments> CoolingBuffer::parse_layer_gcode(const std::
             for (;;) {
                 // Skip whitespaces.
                 for (; *c == ' ' || *c == '\t'; ++ c);
-                if (*c == 0 || *c == ';')
+                // sline is a view into the layer buffer, thus the line ends at '\n', not at 0.
+                if (*c == 0 || *c == '\n' || *c == ';')
                     break;
 
                 assert(is_decimal_separator_point()); // for atof
@@ -391,7 +394,7 @@ std::vector<PerExtruderAdjustments> CoolingBuffer::parse_layer_gcode(const std::
                     }
                 }
                 // Skip this word.
-                for (; *c != ' ' && *c != '\t' && *c != 0; ++ c);
+                for (; *c != ' ' && *c != '\t' && *c != '\n' && *c != 0; ++ c);
             }
             bool external_perimeter = boost::contains(sline, ";_EXTERNAL_PERIMETER");
             bool wipe               = boost::contains(sline, ";_WIPE");
@@ -495,9 +498,10 @@ std::vector<PerExtruderAdjustments> CoolingBuffer::parse_layer_gcode(const std::
             size_t pos_S = sline.find('S', 3);
             size_t pos_P = sline.find('P', 3);
             assert(is_decimal_separator_point()); // for atof
+            // atof() stops at the '\n' terminating the line inside the layer buffer.
             line.time = line.time_max = float(
-                (pos_S > 0) ? atof(sline.c_str() + pos_S + 1) :
-                (pos_P > 0) ? atof(sline.c_str() + pos_P + 1) * 0.001 : 0.);
+                (pos_S > 0) ? atof(sline.data() + pos_S + 1) :
+                (pos_P > 0) ? atof(sline.data() + pos_P + 1) * 0.001 : 0.);
         } else if (boost::starts_with(sline, ";_FORCE_RESUME_FAN_SPEED")) {
             line.type = CoolingLine::TYPE_FORCE_RESUME_FAN;
         }
@@ -260,7 +260,10 @@ void FanMover::_process_gcode_line(GCodeReader& reader, const GCodeReader::GCode
 {
     // processes 'normal' gcode lines
     bool need_flush = false;
-    std::string cmd(line.cmd());
+    // A view into the parsed buffer, which is a std::string, thus the characters past the
+    // command are a parameter separator, a newline or the terminating zero and the atoi()
+    // below stops at them.
+    const std::string_view cmd = line.cmd();
     double time = 0;
     int16_t fan_speed = -1;
     if (cmd.length() > 1) {
@@ -491,9 +494,11 @@ void FanMover::_process_gcode_line(GCodeReader& reader, const GCodeReader::GCode
             remove_from_buffer(m_buffer.begin());
         }
     }
+#ifndef NDEBUG
     double sum = 0;
     for (auto& data : m_buffer) sum += data.time;
     assert( std::abs(m_buffer_time_size - sum) < 0.01);
+#endif /* NDEBUG */
 }
 
 } // namespace Slic3r
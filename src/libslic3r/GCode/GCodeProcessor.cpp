@@ -16,6 +16,15 @@
 
 #include <fast_float/fast_float.h>
 
+#include <tbb/parallel_for.h>
+
+#include <cereal/archives/binary.hpp>
+#include <cereal/types/array.hpp>
+#include <cereal/types/map.hpp>
+#include <cereal/types/string.hpp>
+#include <cereal/types/utility.hpp>
+#include <cereal/types/vector.hpp>
+
 #include <float.h>
 #include <assert.h>
 #include <regex>
@@ -88,6 +97,22 @@ const std::vector<std::string> GCodeProcessor::Reserved_Tags_compatible = {
 const std::string GCodeProcessor::Flush_Start_Tag = " FLUSH_START";
 const std::string GCodeProcessor::Flush_End_Tag = " FLUSH_END";
 
+static std::vector<std::string> build_reserved_tag_lines(const std::vector<std::string>& tags)
+{
+    std::vector<std::string> lines;
+    lines.reserve(tags.size());
+    for (const std::string& tag : tags)
+        lines.emplace_back(";" + tag + "\n");
+    return lines;
+}
+
+const std::string& GCodeProcessor::reserved_tag_line(ETags tag)
+{
+    static const std::vector<std::string> tag_lines            = build_reserved_tag_lines(Reserved_Tags);
+    static const std::vector<std::string> tag_lines_compatible = build_reserved_tag_lines(Reserved_Tags_compatible);
+    return (s_IsBBLPrinter ? tag_lines : tag_lines_compatible)[static_cast<unsigned char>(tag)];
+}
+
 
 const float GCodeProcessor::Wipe_Width = 0.05f;
 const float GCodeProcessor::Wipe_Height = 0.05f;
@@ -239,6 +264,7 @@ void GCodeProcessor::TimeMachine::reset()
     std::fill(moves_time.begin(), moves_time.end(), 0.0f);
     std::fill(roles_time.begin(), roles_time.end(), 0.0f);
     layers_time = std::vector<float>();
+    layers_stats = std::vector<PrintEstimatedStatistics::Mode::LayerStats>();
     prepare_time = 0.0f;
 }
 
@@ -359,6 +385,16 @@ void GCodeProcessor::TimeMachine::calculate_time(size_t keep_last_n_blocks, floa
             }
         }
         layers_time[block.layer_id - 1] += block_time;
+        // per-layer breakdown for the legend, block.layer_id is always >= 1
+        if (block.layer_id > layers_stats.size())
+            layers_stats.resize(block.layer_id);
+        PrintEstimatedStatistics::Mode::LayerStats& layer_stats = layers_stats[block.layer_id - 1];
+        layer_stats.roles_times[static_cast<size_t>(block.role)] += block_time;
+        if (block.move_type == EMoveType::Extrude)
+            layer_stats.roles_distances[static_cast<size_t>(block.role)] += block.distance;
+        const float acceleration_limit = (block.move_type == EMoveType::Travel) ? max_travel_acceleration : max_acceleration;
+        if (acceleration_limit > 0.0f && block.acceleration >= acceleration_limit)
+            ++layer_stats.acceleration_saturated_blocks;
         //BBS
         if (block.flags.prepare_stage)
             prepare_time += block_time;
@@ -376,6 +412,22 @@ void GCodeProcessor::TimeMachine::calculate_time(size_t keep_last_n_blocks, floa
         blocks.clear();
 }
 
+void GCodeProcessor::TimeProcessor::calculate_time_of_pending_machines()
+{
+    std::array<TimeMachine*, static_cast<size_t>(PrintEstimatedStatistics::ETimeMode::Count)> pending;
+    size_t pending_count = 0;
+    for (TimeMachine& machine : machines) {
+        if (machine.enabled && machine.blocks.size() > Planner::refresh_threshold)
+            pending[pending_count++] = &machine;
+    }
+
+    if (pending_count == 1)
+        pending.front()->calculate_time(Planner::queue_size);
+    else if (pending_count > 1)
+        // the machines only touch their own state, integrate the due time modes concurrently
+        tbb::parallel_for(size_t(0), pending_count, [&pending](size_t i) { pending[i]->calculate_time(Planner::queue_size); });
+}
+
 void GCodeProcessor::TimeProcessor::reset()
 {
     extruder_unloaded = true;
@@ -809,6 +861,7 @@ void GCodeProcessorResult::reset() {
     lock();
 
     moves = std::vector<GCodeProcessorResult::MoveVertex>();
+    completed_moves_watermark.store(0);
     printable_area = Pointfs();
     //BBS: add bed exclude area
     bed_exclude_area = Pointfs();
@@ -836,6 +889,7 @@ void GCodeProcessorResult::reset() {
     lock();
 
     moves.clear();
+    completed_moves_watermark.store(0);
     lines_ends.clear();
     printable_area = Pointfs();
     //BBS: add bed exclude area
@@ -1400,6 +1454,102 @@ static inline const char* remove_eols(const char *begin, const char *end) {
 
 // Load a G-code into a stand-alone G-code viewer.
 // throws CanceledException through print->throw_if_canceled() (sent by the caller as callback).
+// Serialization of the processed result for the binary sidecar cache.
+namespace CustomGCode {
+    template<class Archive> void serialize(Archive& ar, Item& v) { ar(v.print_z, v.type, v.extruder, v.color, v.extra); }
+}
+template<class Archive> void serialize(Archive& ar, GCodeProcessorResult::SettingsIds& v) { ar(v.print, v.filament, v.printer); }
+template<class Archive> void serialize(Archive& ar, GCodeProcessorResult::SliceWarning& v) { ar(v.level, v.msg, v.error_code, v.params); }
+template<class Archive> void serialize(Archive& ar, GCodeProcessorResult::MoveVertex& v) {
+    ar(v.gcode_id, v.type, v.extrusion_role, v.extruder_id, v.cp_color_id, v.move_path_type, v.position, v.delta_extruder,
+       v.feedrate, v.width, v.height, v.mm3_per_mm, v.fan_speed, v.temperature, v.time, v.layer_duration, v.interpolation_points);
+}
+template<class Archive> void serialize(Archive& ar, PrintEstimatedStatistics::Mode::LayerStats& v) { ar(v.roles_times, v.roles_distances, v.acceleration_saturated_blocks); }
+template<class Archive> void serialize(Archive& ar, PrintEstimatedStatistics::Mode& v) {
+    ar(v.time, v.prepare_time, v.custom_gcode_times, v.moves_times, v.roles_times, v.layers_times, v.layers_stats);
+}
+template<class Archive> void serialize(Archive& ar, PrintEstimatedStatistics& v) {
+    ar(v.volumes_per_color_change, v.volumes_per_extruder, v.flush_per_filament, v.used_filaments_per_role, v.modes, v.total_filamentchanges);
+}
+
+// Version of the binary result cache stored next to processed G-code files.
+// Bump whenever GCodeProcessorResult or any nested serialized type changes its layout.
+static constexpr uint32_t Result_Cache_Version = 1;
+
+// FNV-1a over the whole G-code file, used to detect whether a sidecar cache is stale.
+static uint64_t gcode_content_hash(const std::string& filename)
+{
+    FilePtr in{ boost::nowide::fopen(filename.c_str(), "rb") };
+    if (in.f == nullptr)
+        return 0;
+
+    uint64_t hash = 0xcbf29ce484222325ull;
+    std::vector<char> buffer(65536);
+    size_t len;
+    while ((len = ::fread(buffer.data(), 1, buffer.size(), in.f)) > 0) {
+        for (size_t i = 0; i < len; ++i)
+            hash = (hash ^ uint64_t(static_cast<unsigned char>(buffer[i]))) * 0x100000001b3ull;
+    }
+    return hash;
+}
+
+static std::string result_cache_path(const std::string& filename) { return filename + ".result_cache"; }
+
+bool GCodeProcessor::load_result_cache(const std::string& filename, uint64_t content_hash)
+{
+    if (content_hash == 0)
+        return false;
+
+    boost::nowide::ifstream in(result_cache_path(filename), std::ios::binary);
+    if (!in.good())
+        return false;
+
+    try {
+        cereal::BinaryInputArchive archive(in);
+        uint32_t version = 0;
+        uint64_t hash = 0;
+        archive(version, hash);
+        if (version != Result_Cache_Version || hash != content_hash)
+            return false;
+
+        GCodeProcessorResult& r = m_result;
+        archive(r.moves, r.lines_ends, r.printable_area, r.bed_exclude_area, r.toolpath_outside, r.label_object_enabled,
+                r.timelapse_warning_code, r.support_traditional_timelapse, r.printable_height, r.settings_ids,
+                r.extruders_count, r.extruder_colors, r.filament_diameters, r.required_nozzle_HRC, r.filament_densities,
+                r.filament_vitrification_temperature, r.print_statistics, r.custom_gcode_per_print_z,
+                r.spiral_vase_layers, r.warnings, r.nozzle_hrc, r.nozzle_type, r.bed_type);
+        r.completed_moves_watermark.store(r.moves.size());
+    } catch (const std::exception& ex) {
+        BOOST_LOG_TRIVIAL(warning) << __FUNCTION__ << boost::format(": discarding unreadable result cache for %1%: %2%") % filename % ex.what();
+        m_result.reset();
+        return false;
+    }
+    return true;
+}
+
+void GCodeProcessor::save_result_cache(const std::string& filename, uint64_t content_hash) const
+{
+    if (content_hash == 0)
+        return;
+
+    try {
+        boost::nowide::ofstream out(result_cache_path(filename), std::ios::binary | std::ios::trunc);
+        if (!out.good())
+            return;
+
+        cereal::BinaryOutputArchive archive(out);
+        archive(Result_Cache_Version, content_hash);
+        const GCodeProcessorResult& r = m_result;
+        archive(r.moves, r.lines_ends, r.printable_area, r.bed_exclude_area, r.toolpath_outside, r.label_object_enabled,
+                r.timelapse_warning_code, r.support_traditional_timelapse, r.printable_height, r.settings_ids,
+                r.extruders_count, r.extruder_colors, r.filament_diameters, r.required_nozzle_HRC, r.filament_densities,
+                r.filament_vitrification_temperature, r.print_statistics, r.custom_gcode_per_print_z,
+                r.spiral_vase_layers, r.warnings, r.nozzle_hrc, r.nozzle_type, r.bed_type);
+    } catch (const std::exception& ex) {
+        BOOST_LOG_TRIVIAL(warning) << __FUNCTION__ << boost::format(": failed to write result cache for %1%: %2%") % filename % ex.what();
+    }
+}
+
 void GCodeProcessor::process_file(const std::string& filename, std::function<void()> cancel_callback)
 {
     CNumericLocalesSetter locales_setter;
@@ -1408,6 +1558,15 @@ void GCodeProcessor::process_file(const std::string& filename, std::function<voi
     m_start_time = std::chrono::high_resolution_clock::now();
 #endif // ENABLE_GCODE_VIEWER_STATISTICS
 
+    // reuse the sidecar cache from a previous run, if the file content has not changed
+    const uint64_t content_hash = gcode_content_hash(filename);
+    if (this->load_result_cache(filename, content_hash)) {
+        m_result.filename = filename;
+        m_result.id = ++s_result_id;
+        BOOST_LOG_TRIVIAL(info) << __FUNCTION__ << boost::format(": restored result of %1% from the sidecar cache") % filename;
+        return;
+    }
+
     // pre-processing
     // parse the gcode file to detect its producer
     {
@@ -1453,7 +1612,7 @@ void GCodeProcessor::process_file(const std::string& filename, std::function<voi
     // 1st move must be a dummy move
     m_result.moves.emplace_back(GCodeProcessorResult::MoveVertex());
     size_t parse_line_callback_cntr = 10000;
-    m_parser.parse_file(filename, [this, cancel_callback, &parse_line_callback_cntr](GCodeReader& reader, const GCodeReader::GCodeLine& line) {
+    m_parser.parse_file_parallel(filename, [this, cancel_callback, &parse_line_callback_cntr](GCodeReader& reader, const GCodeReader::GCodeLine& line) {
         if (-- parse_line_callback_cntr == 0) {
             // Don't call the cancel_callback() too often, do it every at every 10000'th line.
             parse_line_callback_cntr = 10000;
@@ -1465,6 +1624,9 @@ void GCodeProcessor::process_file(const std::string& filename, std::function<voi
 
     // Don't post-process the G-code to update time stamps.
     this->finalize(false);
+
+    // store the processed result next to the G-code file for the next time it is opened
+    this->save_result_cache(filename, content_hash);
 }
 
 void GCodeProcessor::initialize(const std::string& filename)
@@ -1492,6 +1654,11 @@ void GCodeProcessor::process_buffer(const std::string &buffer)
 
 void GCodeProcessor::finalize(bool post_process)
 {
+    // The fixups below modify moves already published through completed_moves_watermark,
+    // take the result mutex to keep a concurrently scanning reader consistent. RAII, so
+    // the mutex is released even when post_process() throws (e.g. when the disk is full).
+    std::unique_lock<std::mutex> result_lock(m_result.result_mutex);
+
     // update width/height of wipe moves
     for (GCodeProcessorResult::MoveVertex& move : m_result.moves) {
         if (move.type == EMoveType::Wipe) {
@@ -1500,14 +1667,14 @@ void GCodeProcessor::finalize(bool post_process)
         }
     }
 
-    // process the time blocks
-    for (size_t i = 0; i < static_cast<size_t>(PrintEstimatedStatistics::ETimeMode::Count); ++i) {
+    // process the time blocks, the remaining per-mode simulations are independent of each other
+    tbb::parallel_for(size_t(0), static_cast<size_t>(PrintEstimatedStatistics::ETimeMode::Count), [this](size_t i) {
         TimeMachine& machine = m_time_processor.machines[i];
         TimeMachine::CustomGCodeTime& gcode_time = machine.gcode_time;
         machine.calculate_time();
         if (gcode_time.needed && gcode_time.cache != 0.0f)
             gcode_time.times.push_back({ CustomGCode::ColorChange, gcode_time.cache });
-    }
+    });
 
     m_used_filaments.process_caches(this);
 
@@ -1542,6 +1709,10 @@ void GCodeProcessor::finalize(bool post_process)
 #endif // ENABLE_GCODE_VIEWER_STATISTICS
     //BBS: update slice warning
     update_slice_warnings();
+
+    result_lock.unlock();
+    // The result is complete now, publish the tail moves of the last layer as well.
+    m_result.completed_moves_watermark.store(m_result.moves.size(), std::memory_order_release);
 }
 
 float GCodeProcessor::get_time(PrintEstimatedStatistics::ETimeMode mode) const
@@ -2233,6 +2404,9 @@ void GCodeProcessor::process_tags(const std::string_view comment, bool producers
     // layer change tag
     if (comment == reserved_tag(ETags::Layer_Change)) {
         ++m_layer_id;
+        // All moves stored so far belong to fully generated layers, publish them
+        // for a preview running concurrently with the export.
+        m_result.completed_moves_watermark.store(m_result.moves.size(), std::memory_order_release);
         if (m_spiral_vase_active) {
             if (m_result.moves.empty() || m_result.spiral_vase_layers.empty())
                 // add a placeholder for layer height. the actual value will be set inside process_G1() method
@@ -3096,11 +3270,10 @@ void GCodeProcessor::process_G1(const GCodeReader::GCodeLine& line)
         prev = curr;
 
         blocks.push_back(block);
-
-        if (blocks.size() > TimeProcessor::Planner::refresh_threshold)
-            machine.calculate_time(TimeProcessor::Planner::queue_size);
     }
 
+    m_time_processor.calculate_time_of_pending_machines();
+
     if (m_seams_detector.is_active()) {
         // check for seam starting vertex
         if (type == EMoveType::Extrude && m_extrusion_role == erExternalPerimeter && !m_seams_detector.has_first_vertex()) {
@@ -3509,11 +3682,10 @@ void  GCodeProcessor::process_G2_G3(const GCodeReader::GCodeLine& line)
         prev = curr;
 
         blocks.push_back(block);
-
-        if (blocks.size() > TimeProcessor::Planner::refresh_threshold)
-            machine.calculate_time(TimeProcessor::Planner::queue_size);
     }
 
+    m_time_processor.calculate_time_of_pending_machines();
+
     //BBS: seam detector
     Vec3f plate_offset = {(float) m_x_offset, (float) m_y_offset, 0.0f};
 
@@ -4126,12 +4298,24 @@ void GCodeProcessor::store_move_vertex(EMoveType type, EMovePathType path_type)
                 m_extruder_offsets[m_extruder_id];
     }
 
+    // A preview running while the G-code is still being generated scans the prefix of moves
+    // published through completed_moves_watermark under the result mutex. Growing the vector
+    // relocates that prefix, so reallocate under the same lock; the per-move cost is a single
+    // capacity check, the lock is taken only on the (amortized rare) growths.
+    if (m_result.moves.size() == m_result.moves.capacity()) {
+        m_result.lock();
+        m_result.moves.reserve(std::max<size_t>(64, 2 * m_result.moves.capacity()));
+        m_result.unlock();
+    }
+
     m_result.moves.push_back({
         m_last_line_id,
         type,
         m_extrusion_role,
         m_extruder_id,
         m_cp_color.current,
+        //BBS: add arc move related data
+        path_type,
         //BBS: add plate's offset to the rendering vertices
         Vec3f(m_end_position[X] + m_x_offset, m_end_position[Y] + m_y_offset, m_processing_start_custom_gcode ? m_first_layer_height : m_end_position[Z]- m_z_offset) + m_extruder_offsets[m_extruder_id],
         static_cast<float>(m_end_position[E] - m_start_position[E]),
@@ -4143,10 +4327,8 @@ void GCodeProcessor::store_move_vertex(EMoveType type, EMovePathType path_type)
         m_extruder_temps[m_extruder_id],
         static_cast<float>(m_result.moves.size()),
         static_cast<float>(m_layer_id), //layer_duration: set later
-        //BBS: add arc move related data
-        path_type,
-        Vec3f(m_arc_center(0, 0) + m_x_offset, m_arc_center(1, 0) + m_y_offset, m_arc_center(2, 0)) + m_extruder_offsets[m_extruder_id],
-        m_interpolation_points,
+        // The interpolation points are consumed here, the member is rebuilt for the next arc.
+        std::move(m_interpolation_points),
     });
 
     // stores stop time placeholders for later use
@@ -4328,9 +4510,11 @@ void GCodeProcessor::process_filaments(CustomGCode::Type code)
 
 void GCodeProcessor::simulate_st_synchronize(float additional_time)
 {
-    for (size_t i = 0; i < static_cast<size_t>(PrintEstimatedStatistics::ETimeMode::Count); ++i) {
+    // full flush of the planner queues, the machines only touch their own state,
+    // so the enabled time modes are simulated concurrently
+    tbb::parallel_for(size_t(0), static_cast<size_t>(PrintEstimatedStatistics::ETimeMode::Count), [this, additional_time](size_t i) {
         m_time_processor.machines[i].simulate_st_synchronize(additional_time);
-    }
+    });
 }
 
 void GCodeProcessor::update_estimated_times_stats()
@@ -4343,6 +4527,7 @@ void GCodeProcessor::update_estimated_times_stats()
         data.moves_times = get_moves_time(mode);
         data.roles_times = get_roles_time(mode);
         data.layers_times = get_layers_time(mode);
+        data.layers_stats = m_time_processor.machines[static_cast<size_t>(mode)].layers_stats;
     };
 
     update_mode(PrintEstimatedStatistics::ETimeMode::Normal);
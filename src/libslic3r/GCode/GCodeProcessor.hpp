@@ -7,6 +7,7 @@
 #include "libslic3r/PrintConfig.hpp"
 #include "libslic3r/CustomGCode.hpp"
 
+#include <atomic>
 #include <cstdint>
 #include <array>
 #include <vector>
@@ -50,12 +51,28 @@ namespace Slic3r {
 
         struct Mode
         {
+            // Per-layer breakdown collected during the time simulation: time and extruded
+            // distance per extrusion role, and the number of planner blocks whose acceleration
+            // was clamped by the machine limit. Used by the legend to point at slow layers.
+            struct LayerStats
+            {
+                std::array<float, static_cast<size_t>(ExtrusionRole::erCount)> roles_times;
+                std::array<float, static_cast<size_t>(ExtrusionRole::erCount)> roles_distances;
+                unsigned int acceleration_saturated_blocks{ 0 };
+
+                LayerStats() {
+                    roles_times.fill(0.0f);
+                    roles_distances.fill(0.0f);
+                }
+            };
+
             float time;
             float prepare_time;
             std::vector<std::pair<CustomGCode::Type, std::pair<float, float>>> custom_gcode_times;
             std::vector<std::pair<EMoveType, float>> moves_times;
             std::vector<std::pair<ExtrusionRole, float>> roles_times;
             std::vector<float> layers_times;
+            std::vector<LayerStats> layers_stats;
 
             void reset() {
                 time = 0.0f;
@@ -68,6 +85,8 @@ namespace Slic3r {
                 roles_times.shrink_to_fit();
                 layers_times.clear();
                 layers_times.shrink_to_fit();
+                layers_stats.clear();
+                layers_stats.shrink_to_fit();
             }
         };
 
@@ -135,6 +154,9 @@ namespace Slic3r {
             ExtrusionRole extrusion_role{ erNone };
             unsigned char extruder_id{ 0 };
             unsigned char cp_color_id{ 0 };
+            //BBS: arc move type, packed with the byte-sized fields above to keep the
+            // vertex small - the viewer holds tens of millions of these.
+            EMovePathType move_path_type{ EMovePathType::Noop_move };
             Vec3f position{ Vec3f::Zero() }; // mm
             float delta_extruder{ 0.0f }; // mm
             float feedrate{ 0.0f }; // mm/s
@@ -146,11 +168,8 @@ namespace Slic3r {
             float time{ 0.0f }; // s
             float layer_duration{ 0.0f }; // s (layer id before finalize)
 
-
-            //BBS: arc move related data
-            EMovePathType move_path_type{ EMovePathType::Noop_move };
-            Vec3f arc_center_position{ Vec3f::Zero() };      // mm
-            std::vector<Vec3f> interpolation_points;     // interpolation points of arc for drawing
+            //BBS: interpolation points of arc for drawing
+            std::vector<Vec3f> interpolation_points;
 
             float volumetric_rate() const { return feedrate * mm3_per_mm; }
             //BBS: new function to support arc move
@@ -172,6 +191,12 @@ namespace Slic3r {
         std::string filename;
         unsigned int id;
         std::vector<MoveVertex> moves;
+        // Number of leading elements of moves belonging to layers whose G-code has been fully generated.
+        // Published by GCodeProcessor at every layer change while the upper layers are still being produced,
+        // so the preview may upload and display the lower layers of a print before the export finishes.
+        // Elements below the watermark are not modified again until finalize(), and the moves vector only
+        // reallocates while result_mutex is held, so a reader holding the lock may safely scan the prefix.
+        std::atomic<size_t> completed_moves_watermark{ 0 };
         // Positions of ends of lines of the final G-code this->filename after TimeProcessor::post_process() finalizes the G-code.
         std::vector<size_t> lines_ends;
         Pointfs printable_area;
@@ -211,6 +236,7 @@ namespace Slic3r {
             filename = other.filename;
             id = other.id;
             moves = other.moves;
+            completed_moves_watermark.store(other.completed_moves_watermark.load());
             lines_ends = other.lines_ends;
             printable_area = other.printable_area;
             bed_exclude_area = other.bed_exclude_area;
@@ -265,6 +291,10 @@ namespace Slic3r {
         };
 
         static const std::string& reserved_tag(ETags tag) { return s_IsBBLPrinter ? Reserved_Tags[static_cast<unsigned char>(tag)] : Reserved_Tags_compatible[static_cast<unsigned char>(tag)]; }
+        // Complete comment line (";" + reserved_tag(tag) + "\n"), precomputed once per tag.
+        // Use it for tags emitted without a parameter: appending the ready made line avoids
+        // assembling the same temporary strings over and over on the G-code export hot path.
+        static const std::string& reserved_tag_line(ETags tag);
         // checks the given gcode for reserved tags and returns true when finding the 1st (which is returned into found_tag) 
         static bool contains_reserved_tag(const std::string& gcode, std::string& found_tag);
         // checks the given gcode for reserved tags and returns true when finding any
@@ -427,6 +457,7 @@ namespace Slic3r {
             std::array<float, static_cast<size_t>(EMoveType::Count)> moves_time;
             std::array<float, static_cast<size_t>(ExtrusionRole::erCount)> roles_time;
             std::vector<float> layers_time;
+            std::vector<PrintEstimatedStatistics::Mode::LayerStats> layers_stats;
             //BBS: prepare stage time before print model, including start gcode time and mostly same with start gcode time
             float prepare_time;
 
@@ -464,6 +495,11 @@ namespace Slic3r {
 
             void reset();
 
+            // Flushes the planner queues of all enabled machines whose block queue crossed the
+            // refresh threshold. The kinematic simulations of the individual time modes are
+            // independent of each other, so when more than one is due they are integrated concurrently.
+            void calculate_time_of_pending_machines();
+
             // post process the file with the given filename to add remaining time lines M73
             // and updates moves' gcode ids accordingly
             void post_process(const std::string& filename, std::vector<GCodeProcessorResult::MoveVertex>& moves, std::vector<size_t>& lines_ends, size_t total_layer_num);
@@ -906,6 +942,12 @@ namespace Slic3r {
         void simulate_st_synchronize(float additional_time = 0.0f);
 
         void update_estimated_times_stats();
+
+        // Versioned binary sidecar cache of a fully processed result, stored next to the
+        // G-code file and keyed by a content hash of it, so that re-opening unchanged
+        // G-code restores the result instead of re-running the full processing pass.
+        bool load_result_cache(const std::string& filename, uint64_t content_hash);
+        void save_result_cache(const std::string& filename, uint64_t content_hash) const;
         //BBS:
         void update_slice_warnings();
    };
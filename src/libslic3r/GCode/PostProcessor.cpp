@@ -10,6 +10,7 @@
 #include <boost/filesystem.hpp>
 #include <boost/nowide/convert.hpp>
 #include <boost/nowide/cenv.hpp>
+#include <boost/nowide/cstdio.hpp>
 #include <boost/nowide/fstream.hpp>
 
 // BBS
@@ -194,6 +195,122 @@ namespace Slic3r {
 #define L(s) (s)
 #define _(s) Slic3r::I18N::translate(s)
 
+void run_streaming_filters(const std::string &path, const std::vector<GCodeStreamingFilter*> &filters)
+{
+    if (filters.empty())
+        return;
+
+    FilePtr in{ boost::nowide::fopen(path.c_str(), "rb") };
+    if (in.f == nullptr)
+        throw Slic3r::RuntimeError(Slic3r::format("In-process post-processing of %1% failed.\nCannot open the file for reading.", path));
+
+    // temporary file to contain the filtered gcode
+    std::string out_path = path + ".postprocess";
+    FilePtr out{ boost::nowide::fopen(out_path.c_str(), "wb") };
+    if (out.f == nullptr)
+        throw Slic3r::RuntimeError(Slic3r::format("In-process post-processing of %1% failed.\nCannot open the file for writing.", out_path));
+
+    // buffer lines and export only when greater than 64K to reduce writing calls
+    std::string export_line;
+    auto write_string = [&export_line, &out, &out_path]() {
+        fwrite((const void*)export_line.c_str(), 1, export_line.length(), out.f);
+        if (ferror(out.f)) {
+            out.close();
+            boost::nowide::remove(out_path.c_str());
+            throw Slic3r::RuntimeError(std::string("In-process post-processing failed.\nIs the disk full?\n"));
+        }
+        export_line.clear();
+    };
+
+    for (GCodeStreamingFilter *filter : filters)
+        filter->start();
+
+    {
+        // Read the input stream 64kB at a time, extract lines and run them through the filters.
+        std::vector<char> buffer(65536, 0);
+        // Line buffer.
+        std::string gcode_line;
+        // Set when a '\r' fell on the last byte of a chunk: the matching '\n' may be the
+        // first byte of the next chunk, thus the line is only emitted after that chunk
+        // was read and the possible '\n' consumed.
+        bool pending_cr = false;
+        for (;;) {
+            size_t cnt_read = ::fread(buffer.data(), 1, buffer.size(), in.f);
+            if (::ferror(in.f))
+                throw Slic3r::RuntimeError(std::string("In-process post-processing failed.\nError while reading from file.\n"));
+            bool eof       = cnt_read == 0;
+            auto it        = buffer.begin();
+            auto it_bufend = buffer.begin() + cnt_read;
+            auto emit_line = [&filters, &export_line, &write_string, &gcode_line]() {
+                for (GCodeStreamingFilter *filter : filters)
+                    filter->process_line(gcode_line);
+                export_line += gcode_line;
+                if (export_line.length() > 65535)
+                    write_string();
+                gcode_line.clear();
+            };
+            if (pending_cr) {
+                if (it != it_bufend && *it == '\n') {
+                    gcode_line += '\n';
+                    ++ it;
+                }
+                emit_line();
+                pending_cr = false;
+            }
+            while (it != it_bufend || (eof && ! gcode_line.empty())) {
+                // Find end of line.
+                bool eol    = false;
+                auto it_end = it;
+                for (; it_end != it_bufend && ! (eol = *it_end == '\r' || *it_end == '\n'); ++ it_end) ;
+                // End of line is indicated also if end of file was reached.
+                eol |= eof && it_end == it_bufend;
+                gcode_line.insert(gcode_line.end(), it, it_end);
+                if (eol) {
+                    // determine the end of line character and pass to output
+                    if (it_end != it_bufend) {
+                        gcode_line += *it_end;
+                        if (*it_end == '\r') {
+                            if (it_end + 1 == it_bufend) {
+                                // A CRLF pair may be split across chunks, defer the line
+                                // until the next chunk was read.
+                                pending_cr = true;
+                                break;
+                            }
+                            if (*(it_end + 1) == '\n')
+                                gcode_line += '\n';
+                        }
+                    }
+                    emit_line();
+                }
+                // Skip EOL.
+                it = it_end;
+                if (it != it_bufend && *it == '\r')
+                    ++ it;
+                if (it != it_bufend && *it == '\n')
+                    ++ it;
+            }
+            if (eof)
+                break;
+        }
+    }
+
+    std::string trailer;
+    for (GCodeStreamingFilter *filter : filters) {
+        trailer.clear();
+        filter->finish(trailer);
+        export_line += trailer;
+    }
+    if (! export_line.empty())
+        write_string();
+
+    out.close();
+    in.close();
+
+    if (rename_file(out_path, path))
+        throw Slic3r::RuntimeError(std::string("Failed to rename the output G-code file from ") + out_path + " to " + path + '\n' +
+            "Is " + out_path + " locked?" + '\n');
+}
+
 // BBS
 void gcode_add_line_number(const std::string& path, const DynamicPrintConfig& config)
 {
@@ -205,24 +322,24 @@ void gcode_add_line_number(const std::string& path, const DynamicPrintConfig& co
     if (!boost::filesystem::exists(gcode_file))
         return;
 
-    std::fstream fs;
-    std::string new_gcode;
-    fs.open(gcode_file.c_str(), std::fstream::in | std::fstream::out);
-
-    size_t line_number = 1;
-    std::string gcode_line;
-    while (std::getline(fs, gcode_line)) {
-        char num_str[128];
-        memset(num_str, 0, sizeof(num_str));
-        snprintf(num_str, sizeof(num_str), "%zd", line_number);
-        new_gcode += std::string("N") + num_str + " " + gcode_line + "\n";
-        line_number++;
-    }
+    // prefixes every line with its line number, streamed in a single pass
+    // instead of rewriting the whole file in memory
+    class LineNumberFilter : public GCodeStreamingFilter
+    {
+    public:
+        void process_line(std::string& gcode_line) override {
+            char num_str[128];
+            memset(num_str, 0, sizeof(num_str));
+            snprintf(num_str, sizeof(num_str), "%zd", m_line_number);
+            gcode_line.insert(0, std::string("N") + num_str + " ");
+            ++m_line_number;
+        }
+    private:
+        size_t m_line_number{ 1 };
+    };
 
-    fs.clear();
-    fs.seekp(0, std::ios_base::beg);
-    fs.write(new_gcode.c_str(), new_gcode.length());
-    fs.close();
+    LineNumberFilter filter;
+    run_streaming_filters(path, { &filter });
 }
 
 // Run post processing script / scripts if defined.
@@ -2,12 +2,37 @@
 #define slic3r_GCode_PostProcessor_hpp_
 
 #include <string>
+#include <vector>
 
 #include "../libslic3r.h"
 #include "../PrintConfig.hpp"
 
 namespace Slic3r {
 
+// In-process streaming post-processing filter.
+// Filters registered with run_streaming_filters() see the exported G-code line by line
+// while it is copied through a temporary file, so any number of in-process filters
+// costs a single file rewrite, while external scripts keep the temp file mode
+// of run_post_process_scripts().
+class GCodeStreamingFilter
+{
+public:
+    virtual ~GCodeStreamingFilter() = default;
+    // Called once before the first line is processed.
+    virtual void start() {}
+    // Called for every line of the exported G-code, including the trailing end-of-line.
+    // The filter may modify the line in place, it is written to the output as returned.
+    virtual void process_line(std::string &gcode_line) = 0;
+    // Called once after the last line was processed, trailer is appended to the output.
+    virtual void finish(std::string &/* trailer */) {}
+};
+
+// Stream the G-code file at path through the given filters in a single pass.
+// The file is read in chunks, each line is passed to all filters in their registration
+// order and the result is written to a temporary file, which then replaces the original.
+// Throws an exception on error.
+extern void run_streaming_filters(const std::string &path, const std::vector<GCodeStreamingFilter*> &filters);
+
 // Run post processing script / scripts if defined.
 // Returns true if a post-processing script was executed.
 // Returns false if no post-processing script was defined.
@@ -7,6 +7,7 @@
 #include <cstring>
 #include <cfloat>
 #include <algorithm>
+#include <string_view>
 
 #include "../libslic3r.h"
 #include "../PrintConfig.hpp"
@@ -100,9 +101,16 @@ void PressureEqualizer::process_layer(const std::string &gcode)
             // Slic3r always generates end of lines in a Unix style.
             for (; *gcode_end != 0 && *gcode_end != '\n'; ++gcode_end);
 
-            m_gcode_lines.emplace_back();
+            if (m_gcode_line_pool.empty())
+                m_gcode_lines.emplace_back();
+            else {
+                // Recycle a GCodeLine from an already exported layer together with its raw string buffer.
+                m_gcode_lines.emplace_back(std::move(m_gcode_line_pool.back()));
+                m_gcode_line_pool.pop_back();
+            }
             if (!this->process_line(gcode_begin, gcode_end, m_gcode_lines.back())) {
                 // The line has to be forgotten. It contains comment marks, which shall be filtered out of the target g-code.
+                m_gcode_line_pool.emplace_back(std::move(m_gcode_lines.back()));
                 m_gcode_lines.pop_back();
             }
             gcode_begin = gcode_end;
@@ -119,7 +127,7 @@ void PressureEqualizer::process_layer(const std::string &gcode)
     while (idx_end_current_extrusion < m_gcode_lines.size()) {
         // find beginning of next extrusion segment from current pos
         const long idx_begin_current_extrusion   = find_if(m_gcode_lines.begin() + idx_end_current_extrusion, m_gcode_lines.end(),
-                                                          [](GCodeLine line) { return line.extruding(); }) - m_gcode_lines.begin();
+                                                          [](const GCodeLine &line) { return line.extruding(); }) - m_gcode_lines.begin();
         // (extrusion begin idx = extrusion end idx) here because we start with extrusion length of zero
         idx_end_current_extrusion = idx_begin_current_extrusion;
 
@@ -127,7 +135,7 @@ void PressureEqualizer::process_layer(const std::string &gcode)
         while (idx_end_current_extrusion < m_gcode_lines.size()) {
             // find end of the current extrusion segment
             const auto just_after_end_extrusion = find_if(m_gcode_lines.begin() + idx_end_current_extrusion, m_gcode_lines.end(),
-                                                          [](GCodeLine line) { return !line.extruding(); });
+                                                          [](const GCodeLine &line) { return !line.extruding(); });
             idx_end_current_extrusion = std::max<long>(0,(just_after_end_extrusion - m_gcode_lines.begin()) - 1);
             const long idx_begin_segment_continuation = advance_segment_beyond_small_gap(idx_end_current_extrusion);
             if (idx_begin_segment_continuation > idx_end_current_extrusion) {
@@ -155,7 +163,7 @@ void PressureEqualizer::process_layer(const std::string &gcode)
 long PressureEqualizer::advance_segment_beyond_small_gap(const long idx_orig)
 {
     // this should only be run on the last extruding line before a gap
-    assert(m_gcode_lines[idx_cur_pos].extruding());
+    assert(m_gcode_lines[idx_orig].extruding());
     double distance_traveled = 0.0;
     // start at beginning of gap, advance till extrusion found or gap too big
     for (auto idx_cur_pos = idx_orig + 1; idx_cur_pos < m_gcode_lines.size(); idx_cur_pos++) {
@@ -194,8 +202,10 @@ LayerResult PressureEqualizer::process_layer(LayerResult &&input)
 
     output_buffer_length      = 0;
     output_buffer_prev_length = 0;
-    for (size_t line_idx = 0; line_idx < next_layer_first_idx; ++line_idx)
+    for (size_t line_idx = 0; line_idx < next_layer_first_idx; ++line_idx) {
         output_gcode_line(line_idx);
+        m_gcode_line_pool.emplace_back(std::move(m_gcode_lines[line_idx]));
+    }
     m_gcode_lines.erase(m_gcode_lines.begin(), m_gcode_lines.begin() + int(next_layer_first_idx));
 
     if (output_buffer_length > 0)
@@ -288,9 +298,9 @@ bool PressureEqualizer::process_line(const char *line, const char *line_end, GCo
     buf.max_volumetric_extrusion_rate_slope_negative = 0.f;
 	buf.extrusion_role = m_current_extrusion_role;
 
-    std::string str_line(line, line_end);
-    const bool found_extrude_set_speed_tag = boost::contains(str_line, EXTRUDE_SET_SPEED_TAG);
-    const bool found_extrude_end_tag = boost::contains(str_line, EXTRUDE_END_TAG);
+    std::string_view str_line(line, len);
+    const bool found_extrude_set_speed_tag = str_line.find(EXTRUDE_SET_SPEED_TAG) != std::string_view::npos;
+    const bool found_extrude_end_tag = str_line.find(EXTRUDE_END_TAG) != std::string_view::npos;
     assert(!found_extrude_set_speed_tag || !found_extrude_end_tag);
 
     if (found_extrude_set_speed_tag)
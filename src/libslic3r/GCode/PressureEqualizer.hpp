@@ -207,6 +207,11 @@ public:
     std::queue<LayerResult*> m_layer_results;
 
     std::vector<GCodeLine> m_gcode_lines;
+
+private:
+    // Exported GCodeLines are recycled through this pool, so their raw string buffers
+    // are allocated once and reused, instead of being reallocated for every parsed line.
+    std::vector<GCodeLine> m_gcode_line_pool;
 };
 
 } // namespace Slic3r
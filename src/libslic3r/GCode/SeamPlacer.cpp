@@ -644,8 +644,11 @@ void compute_global_occlusion(GlobalModelInfo &result, const PrintObject *po,
 
   BOOST_LOG_TRIVIAL(debug)
       << "SeamPlacer: decimate: start";
-  its_short_edge_collpase(triangle_set, SeamPlacer::fast_decimation_triangle_count_target);
-  its_short_edge_collpase(negative_volumes_set, SeamPlacer::fast_decimation_triangle_count_target);
+  // Triangle budget of the decimated raycasting proxy. Configurable, so that densely
+  // sculpted surfaces may keep more of their detail for the visibility estimate.
+  const size_t decimation_target = size_t(po->config().seam_visibility_triangle_budget.value);
+  its_short_edge_collpase(triangle_set, decimation_target);
+  its_short_edge_collpase(negative_volumes_set, decimation_target);
 
   size_t negative_volumes_start_index = triangle_set.indices.size();
   its_merge(triangle_set, negative_volumes_set);
@@ -27,10 +27,11 @@ std::string SpiralVase::process_layer(const std::string &gcode)
     float z = 0.f;
     
     {
-        //FIXME Performance warning: This copies the GCodeConfig of the reader.
-        GCodeReader r = m_reader;  // clone
+        // Look ahead on the reader itself and rewind its positions afterwards.
+        // Cloning the reader instead would copy its GCodeConfig for every layer.
+        GCodeReader::PositionSnapshot rewind = m_reader.save_position();
         bool set_z = false;
-        r.parse_buffer(gcode, [&total_layer_length, &layer_height, &z, &set_z]
+        m_reader.parse_buffer(gcode, [&total_layer_length, &layer_height, &z, &set_z]
             (GCodeReader &reader, const GCodeReader::GCodeLine &line) {
             if (line.cmd_is("G1")) {
                 if (line.extruding(reader)) {
@@ -44,12 +45,15 @@ std::string SpiralVase::process_layer(const std::string &gcode)
                 }
             }
         });
+        m_reader.restore_position(rewind);
     }
-    
+
     // Remove layer height from initial Z.
     z -= layer_height;
     
     std::string new_gcode;
+    // Nearly every line is kept and the extruding moves grow by an interpolated Z word.
+    new_gcode.reserve(gcode.size() + gcode.size() / 4);
     //FIXME Tapering of the transition layer only works reliably with relative extruder distances.
     // For absolute extruder distances it will be switched off.
     // Tapering the absolute extruder distances requires to process every extrusion value after the first transition
@@ -40,7 +40,10 @@ struct CompressedBIQU : CompressedImageBuffer
 std::unique_ptr<CompressedImageBuffer> compress_thumbnail_png(const ThumbnailData &data)
 {
     auto out = std::make_unique<CompressedPNG>();
-    out->data = tdefl_write_image_to_png_file_in_memory_ex((const void*)data.pixels.data(), data.width, data.height, 4, &out->size, MZ_DEFAULT_LEVEL, 1);
+    // These are preview grade images, use the fastest deflate level. miniz writes raw
+    // (filter 0) scanlines either way, so the level is the only compression knob and
+    // MZ_BEST_SPEED costs only a slightly larger embedded thumbnail.
+    out->data = tdefl_write_image_to_png_file_in_memory_ex((const void*)data.pixels.data(), data.width, data.height, 4, &out->size, MZ_BEST_SPEED, 1);
     return out;
 }
 
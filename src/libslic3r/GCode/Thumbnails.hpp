@@ -7,6 +7,7 @@
 
 #include "../Point.hpp"
 #include "../PrintConfig.hpp"
+#include "../Execution/ExecutionTBB.hpp"
 #include "ThumbnailData.hpp"
 
 #include <vector>
@@ -41,11 +42,23 @@ inline void export_thumbnails_to_file(ThumbnailsGeneratorCallback &thumbnail_cb,
     if (thumbnail_cb != nullptr) {
         static constexpr const size_t max_row_length = 78;
         ThumbnailsList                thumbnails     = thumbnail_cb(ThumbnailsParams{sizes, true, true, true, true, plate_id});
-        short                         i              = 0;
-        for (const ThumbnailData &data : thumbnails) {
+        // Compress the requested resolutions concurrently, the writing below streams them
+        // out in order.
+        std::vector<std::unique_ptr<CompressedImageBuffer>> compressed_thumbnails(thumbnails.size());
+        execution::for_each(
+            ex_tbb, size_t(0), thumbnails.size(),
+            [&thumbnails, &compressed_thumbnails, format](size_t idx) {
+                if (thumbnails[idx].is_valid())
+                    compressed_thumbnails[idx] = compress_thumbnail(thumbnails[idx], format);
+            },
+            execution::max_concurrency(ex_tbb));
+        throw_if_canceled();
+        short i = 0;
+        for (size_t idx = 0; idx < thumbnails.size(); ++ idx) {
+            const ThumbnailData &data = thumbnails[idx];
             if (data.is_valid()) {
                 output("; THUMBNAIL_BLOCK_START\n");
-                auto compressed = compress_thumbnail(data, format);
+                auto &compressed = compressed_thumbnails[idx];
                 if (compressed->data && compressed->size) {
                     if (format == GCodeThumbnailsFormat::BTT_TFT) {
                         // write BTT_TFT header
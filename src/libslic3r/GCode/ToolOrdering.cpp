@@ -419,19 +419,16 @@ void ToolOrdering::collect_extruders(const PrintObject &object, const std::vecto
                 layer_tools.has_object = true;
             }
 
-            bool has_infill       = false;
-            bool has_solid_infill = false;
+            // The infill classes present in layerm->fills are cached by LayerRegion::classify_fills()
+            // when the fills are generated, so the fill extrusions only need to be walked here
+            // when wipe tower overrides have to be marked on them.
+            bool has_infill       = layerm->fills_have_sparse_infill;
+            bool has_solid_infill = layerm->fills_have_solid_infill;
             bool something_nonoverriddable = false;
-            for (const ExtrusionEntity *ee : layerm->fills.entities) {
-                // fill represents infill extrusions of a single island.
-                const auto *fill = dynamic_cast<const ExtrusionEntityCollection*>(ee);
-                ExtrusionRole role = fill->entities.empty() ? erNone : fill->entities.front()->role();
-                if (is_solid_infill(role))
-                    has_solid_infill = true;
-                else if (role != erNone)
-                    has_infill = true;
-
-                if (m_print_config_ptr) {
+            if (m_print_config_ptr) {
+                for (const ExtrusionEntity *ee : layerm->fills.entities) {
+                    // fill represents infill extrusions of a single island.
+                    const auto *fill = dynamic_cast<const ExtrusionEntityCollection*>(ee);
                     if (! layer_tools.wiping_extrusions().is_overriddable_and_mark(*fill, *m_print_config_ptr, object, region))
                         something_nonoverriddable = true;
                 }
@@ -1495,8 +1495,9 @@ void WipeTower2::plan_tower()
 	}
 }
 
-void WipeTower2::save_on_last_wipe()
+bool WipeTower2::save_on_last_wipe()
 {
+    bool depths_changed = false;
     for (m_layer_info=m_plan.begin();m_layer_info<m_plan.end();++m_layer_info) {
         set_layer(m_layer_info->z, m_layer_info->height, 0, m_layer_info->z == m_plan.front().z, m_layer_info->z == m_plan.back().z);
         if (m_layer_info->tool_changes.size()==0)   // we have no way to save anything on an empty layer
@@ -1518,10 +1519,14 @@ void WipeTower2::save_on_last_wipe()
                 length_to_wipe = std::max(length_to_wipe,0.f);
                 float depth_to_wipe = m_perimeter_width * (std::floor(length_to_wipe/width) + ( length_to_wipe > 0.f ? 1.f : 0.f ) ) * m_extra_spacing;
 
-                toolchange.required_depth = toolchange.ramming_depth + depth_to_wipe;
+                float required_depth = toolchange.ramming_depth + depth_to_wipe;
+                if (std::abs(required_depth - toolchange.required_depth) > WT_EPSILON)
+                    depths_changed = true;
+                toolchange.required_depth = required_depth;
             }
         }
     }
+    return depths_changed;
 }
 
 
@@ -1564,7 +1569,11 @@ void WipeTower2::generate(std::vector<std::vector<WipeTower::ToolChangeResult>>
 
 	plan_tower();
     for (int i=0;i<5;++i) {
-        save_on_last_wipe();
+        // Each save_on_last_wipe() pass regenerates the tool change and finish_layer
+        // extrusions of the whole tower just to refine the required depths. Once the
+        // depths stop changing, repeating the pass would recompute the very same tower.
+        if (! save_on_last_wipe())
+            break;
         plan_tower();
     }
 
@@ -255,8 +255,9 @@ private:
 	// Goes through m_plan and recalculates depths and width of the WT to make it exactly square - experimental
 	void make_wipe_tower_square();
 
-    // Goes through m_plan, calculates border and finish_layer extrusions and subtracts them from last wipe
-    void save_on_last_wipe();
+    // Goes through m_plan, calculates border and finish_layer extrusions and subtracts them from last wipe.
+    // Returns true if any required depth changed, i.e. the tower needs to be planned again.
+    bool save_on_last_wipe();
 
 
     // to store information about tool changes for a given layer
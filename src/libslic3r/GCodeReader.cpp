@@ -1,8 +1,11 @@
 #include "GCodeReader.hpp"
 #include <boost/algorithm/string/classification.hpp>
 #include <boost/algorithm/string/split.hpp>
+#include <boost/iostreams/device/mapped_file.hpp>
 #include <boost/nowide/fstream.hpp>
 #include <boost/nowide/cstdio.hpp>
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
 #include <fstream>
 #include <iostream>
 #include <iomanip>
@@ -25,12 +28,14 @@ void GCodeReader::apply_config(const DynamicPrintConfig &config)
     m_config.apply(config, true);
 }
 
-const char* GCodeReader::parse_line_internal(const char *ptr, const char *end, GCodeLine &gline, std::pair<const char*, const char*> &command)
+// Tokenize a single line into gline without touching the modal state of the reader.
+// Called concurrently from parse_file_parallel(), thus it has to stay const.
+const char* GCodeReader::tokenize_line(const char *ptr, const char *end, GCodeLine &gline, std::pair<const char*, const char*> &command) const
 {
     PROFILE_FUNC();
 
     assert(is_decimal_separator_point());
-    
+
     // command and args
     const char *c = ptr;
     {
@@ -82,9 +87,6 @@ const char* GCodeReader::parse_line_internal(const char *ptr, const char *end, G
         }
     }
     
-    if (gline.has(E) && m_config.use_relative_e_distances)
-        m_position[E] = 0;
-
     // Skip the rest of the line.
     for (; ! is_end_of_line(*c); ++ c);
 
@@ -100,6 +102,16 @@ const char* GCodeReader::parse_line_internal(const char *ptr, const char *end, G
 	if (*c == '\n')
 		++ c;
 
+    return c;
+}
+
+const char* GCodeReader::parse_line_internal(const char *ptr, const char *end, GCodeLine &gline, std::pair<const char*, const char*> &command)
+{
+    const char *c = this->tokenize_line(ptr, end, gline, command);
+
+    if (gline.has(E) && m_config.use_relative_e_distances)
+        m_position[E] = 0;
+
     if (m_verbose)
         std::cout << gline.m_raw << std::endl;
 
@@ -124,9 +136,45 @@ void GCodeReader::update_coordinates(GCodeLine &gline, std::pair<const char*, co
 template<typename ParseLineCallback, typename LineEndCallback>
 bool GCodeReader::parse_file_raw_internal(const std::string &filename, ParseLineCallback parse_line_callback, LineEndCallback line_end_callback)
 {
+    // Try to memory map the file first: the lines are then handed to the callback as
+    // zero-copy slices of the mapping instead of being accumulated into a line buffer.
+    boost::iostreams::mapped_file_source map;
+    try { map.open(boost::filesystem::path(filename)); } catch (const std::exception &) {}
+    if (map.is_open()) {
+        const char *data = map.data();
+        const char *end  = data + map.size();
+        // Buffer for an unterminated last line, which has to be copied to get the
+        // terminating zero the tokenizer relies on.
+        std::string last_line;
+        m_parsing = true;
+        for (const char *it = data; it != end;) {
+            // Find end of line.
+            const char *it_end = it;
+            while (it_end != end && *it_end != '\r' && *it_end != '\n')
+                ++ it_end;
+            if (it_end == end) {
+                last_line.assign(it, it_end);
+                parse_line_callback(last_line.c_str(), last_line.c_str() + last_line.size());
+            } else
+                parse_line_callback(it, it_end);
+            if (! m_parsing)
+                // The callback wishes to exit.
+                return true;
+            // Skip EOL.
+            it = it_end;
+            if (it != end && *it == '\r')
+                ++ it;
+            if (it != end && *it == '\n') {
+                line_end_callback(size_t(it - data) + 1);
+                ++ it;
+            }
+        }
+        return true;
+    }
+
+    // The file cannot be mapped (e.g. it is empty), read it 64kB at a time instead.
     FilePtr in{ boost::nowide::fopen(filename.c_str(), "rb") };
 
-    // Read the input stream 64kB at a time, extract lines and process them.
     std::vector<char> buffer(65536 * 10, 0);
     // Line buffer.
     std::string gcode_line;
@@ -214,6 +262,88 @@ bool GCodeReader::parse_file(const std::string &file, callback_t callback, std::
     return ret;
 }
 
+bool GCodeReader::parse_file_parallel(const std::string &filename, callback_t callback, std::vector<size_t> &lines_ends)
+{
+    lines_ends.clear();
+    // Zero-copy input: the lines are tokenized straight out of the memory mapping.
+    boost::iostreams::mapped_file_source map;
+    try { map.open(boost::filesystem::path(filename)); } catch (const std::exception &) {}
+    if (! map.is_open())
+        // Empty and unmappable files take the serial path.
+        return this->parse_file(filename, callback, lines_ends);
+
+    const char  *data = map.data();
+    const size_t size = map.size();
+
+    // Phase 1: split the mapping at line boundaries. The line end positions double as the
+    // index for the G-code viewer overlay: line i spans [lines_ends[i-1], lines_ends[i]).
+    for (const char *p = data, *pend = data + size; p != pend;) {
+        const char *nl = static_cast<const char *>(memchr(p, '\n', pend - p));
+        if (nl == nullptr)
+            break;
+        lines_ends.emplace_back(size_t(nl - data) + 1);
+        p = nl + 1;
+    }
+    const size_t tail_begin = lines_ends.empty() ? 0 : lines_ends.back();
+
+    // Tokenize one line of the mapping, skipping the optional leading line number.
+    auto tokenize = [this](const char *b, const char *e, GCodeLine &gline, std::pair<const char*, const char*> &command) {
+        gline.reset();
+        b = skip_whitespaces(b);
+        if (std::toupper(*b) == 'N')
+            b = skip_word(b);
+        b = skip_whitespaces(b);
+        this->tokenize_line(b, e, gline, command);
+    };
+    // Replay one tokenized line, applying the modal state updates in file order.
+    auto replay = [this, &callback](GCodeLine &gline, std::pair<const char*, const char*> &command) {
+        if (gline.has(E) && m_config.use_relative_e_distances)
+            m_position[E] = 0;
+        if (m_verbose)
+            std::cout << gline.m_raw << std::endl;
+        callback(*this, gline);
+        update_coordinates(gline, command);
+    };
+
+    // Phase 2: tokenize the lines in parallel windows, then replay each window serially,
+    // so the callback sees the lines in file order with the modal state stitched across
+    // window seams. The window bounds the memory held by the tokenized records.
+    constexpr size_t                                 window_size = 65536;
+    std::vector<GCodeLine>                           glines;
+    std::vector<std::pair<const char*, const char*>> commands;
+    m_parsing = true;
+    for (size_t window_begin = 0; window_begin < lines_ends.size(); window_begin += window_size) {
+        const size_t window_end = std::min(window_begin + window_size, lines_ends.size());
+        glines.resize(window_end - window_begin);
+        commands.resize(window_end - window_begin);
+        tbb::parallel_for(tbb::blocked_range<size_t>(window_begin, window_end, 4096),
+            [&, this](const tbb::blocked_range<size_t> &range) {
+                for (size_t i = range.begin(); i < range.end(); ++ i)
+                    // The line ends before its trailing '\n', which also acts as the terminator
+                    // character the tokenizer stops at.
+                    tokenize(data + (i == 0 ? 0 : lines_ends[i - 1]), data + lines_ends[i] - 1,
+                             glines[i - window_begin], commands[i - window_begin]);
+            });
+        for (size_t i = 0; i < window_end - window_begin; ++ i) {
+            replay(glines[i], commands[i]);
+            if (! m_parsing)
+                // The callback wishes to exit.
+                return true;
+        }
+    }
+
+    if (tail_begin < size) {
+        // Last line of the file is not terminated by a newline; it has to be copied to get
+        // the terminating zero the tokenizer relies on.
+        std::string last_line(data + tail_begin, data + size);
+        GCodeLine                           gline;
+        std::pair<const char*, const char*> command;
+        tokenize(last_line.c_str(), last_line.c_str() + last_line.size(), gline, command);
+        replay(gline, command);
+    }
+    return true;
+}
+
 bool GCodeReader::parse_file_raw(const std::string &filename, raw_line_callback_t line_callback)
 {
     return this->parse_file_raw_internal(filename,
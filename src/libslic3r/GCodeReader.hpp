@@ -90,6 +90,14 @@ public:
     
     GCodeReader() : m_verbose(false) { this->reset(); }
     void reset() { memset(m_position, 0, sizeof(m_position)); }
+    // Snapshot / restore of the axis positions. Parsing only updates the positions,
+    // thus a caller may run a look-ahead parse on the reader and rewind it afterwards
+    // without copying the whole reader (and its GCodeConfig).
+    struct PositionSnapshot { float position[NUM_AXES]; };
+    PositionSnapshot save_position() const
+        { PositionSnapshot out; memcpy(out.position, m_position, sizeof(m_position)); return out; }
+    void restore_position(const PositionSnapshot &snapshot)
+        { memcpy(m_position, snapshot.position, sizeof(m_position)); }
     void apply_config(const GCodeConfig &config);
     void apply_config(const DynamicPrintConfig &config);
 
@@ -128,6 +136,10 @@ public:
     // Collect positions of line ends in the binary G-code to be used by the G-code viewer when memory mapping and displaying section of G-code
     // as an overlay in the 3D scene.
     bool parse_file(const std::string &file, callback_t callback, std::vector<size_t> &lines_ends);
+    // Same as parse_file() above, but the lines of the file are tokenized in parallel in blocks
+    // cut at line boundaries, while the callback still sees the lines serially in file order
+    // with the modal state stitched across block seams. Used by the G-code viewer on big files.
+    bool parse_file_parallel(const std::string &file, callback_t callback, std::vector<size_t> &lines_ends);
     // Just read the G-code file line by line, calls callback (const char *begin, const char *end). Returns false if reading the file failed.
     bool parse_file_raw(const std::string &file, raw_line_callback_t callback);
 
@@ -156,6 +168,7 @@ private:
     template<typename ParseLineCallback, typename LineEndCallback>
     bool        parse_file_internal(const std::string &filename, ParseLineCallback parse_line_callback, LineEndCallback line_end_callback);
 
+    const char* tokenize_line(const char *ptr, const char *end, GCodeLine &gline, std::pair<const char*, const char*> &command) const;
     const char* parse_line_internal(const char *ptr, const char *end, GCodeLine &gline, std::pair<const char*, const char*> &command);
     void        update_coordinates(GCodeLine &gline, std::pair<const char*, const char*> &command);
 
@@ -1,5 +1,6 @@
 #include "Layer.hpp"
 #include "ClipperUtils.hpp"
+#include "EdgeGrid.hpp"
 #include "Print.hpp"
 #include "Fill/Fill.hpp"
 #include "ShortestPath.hpp"
@@ -28,6 +29,24 @@ bool Layer::empty() const
     return true;
 }
 
+const EdgeGrid::Grid& Layer::lslices_edge_grid() const
+{
+    std::call_once(m_lslices_edge_grid_once, [this]() {
+        m_lslices_edge_grid = std::make_unique<EdgeGrid::Grid>();
+        // One cell per mm, the same resolution the G-code generator used for
+        // its per-layer distance fields before the cache existed.
+        const coord_t distance_field_resolution = coord_t(scale_(1.) + 0.5);
+        m_lslices_edge_grid->create(this->lslices, distance_field_resolution);
+        m_lslices_edge_grid->calculate_sdf();
+    });
+    return *m_lslices_edge_grid;
+}
+
+bool Layer::signed_distance_to_lslices(const Point &pt, coord_t search_radius, coordf_t &distance_out) const
+{
+    return this->lslices_edge_grid().signed_distance(pt, search_radius, distance_out);
+}
+
 LayerRegion* Layer::add_region(const PrintRegion *print_region)
 {
     m_regions.emplace_back(new LayerRegion(this, print_region));
@@ -136,6 +155,16 @@ ExPolygons Layer::merged(float offset_scaled) const
     return out;
 }
 
+void Layer::release_intermediate_geometry()
+{
+    for (LayerRegion *layerm : m_regions)
+        layerm->release_intermediate_geometry();
+    // Overhang / sharp tail detection results were consumed by the support generator.
+    ExPolygons().swap(this->sharp_tails);
+    ExPolygons().swap(this->cantilevers);
+    this->sharp_tails_height.clear();
+}
+
 // Here the perimeters are created cummulatively for all layer regions sharing the same parameters influencing the perimeters.
 // The perimeter paths and the thin fills (ExtrusionEntityCollection) are assigned to the first compatible layer region.
 // The resulting fill surface is split back among the originating regions.
@@ -6,8 +6,16 @@
 #include "SurfaceCollection.hpp"
 #include "ExtrusionEntityCollection.hpp"
 #include "BoundingBox.hpp"
+
+#include <memory>
+#include <mutex>
+
 namespace Slic3r {
 
+namespace EdgeGrid {
+    class Grid;
+}
+
 class ExPolygon;
 using ExPolygons = std::vector<ExPolygon>;
 class Layer;
@@ -69,6 +77,12 @@ public:
     // ordered collection of extrusion paths to fill surfaces
     // (this collection contains only ExtrusionEntityCollection objects)
     ExtrusionEntityCollection   fills;
+    // Which infill classes this->fills contains. Cached by classify_fills() once the fills
+    // are complete, so that ToolOrdering, which is rebuilt several times per slice (tool
+    // ordering, wipe tower planning, G-code export), does not have to walk every fill
+    // extrusion of every layer again to discover the extruders used.
+    bool                        fills_have_sparse_infill { false };
+    bool                        fills_have_solid_infill { false };
 
     Flow    flow(FlowRole role) const;
     Flow    flow(FlowRole role, double layer_height) const;
@@ -92,8 +106,16 @@ public:
     void    export_region_slices_to_svg_debug(const char *name) const;
     void    export_region_fill_surfaces_to_svg_debug(const char *name) const;
 
+    // Free geometry that was only consumed while slicing: thin fills (already copied into
+    // this->fills), fill expolygons and the unsupported bridge edges. Keeps this->slices,
+    // this->raw_slices and this->fill_surfaces, which the G-code export still reads.
+    // Only to be called when no milestone will be re-run on this region anymore.
+    void    release_intermediate_geometry();
+
     // Is there any valid extrusion assigned to this LayerRegion?
     bool    has_extrusions() const { return ! this->perimeters.entities.empty() || ! this->fills.entities.empty(); }
+    // Update fills_have_sparse_infill / fills_have_solid_infill from this->fills.
+    void    classify_fills();
     //BBS
     void    simplify_infill_extrusion_entity() { simplify_entity_collection(&fills); }
     void    simplify_wall_extrusion_entity() { simplify_entity_collection(&perimeters); }
@@ -170,6 +192,16 @@ public:
     void                    restore_untyped_slices_no_extra_perimeters();
     // Slices merged into islands, to be used by the elephant foot compensation to trim the individual surfaces with the shrunk merged slices.
     ExPolygons              merged(float offset) const;
+    // Signed distance field (EdgeGrid with calculated SDF) of this layer's lslices.
+    // Built lazily on the first query and cached, so that all consumers needing
+    // distances to the layer outline share a single rasterization per layer.
+    // Thread safe. Valid only after lslices are final (after slicing); it is the
+    // caller's responsibility not to query it while lslices are still mutated.
+    const EdgeGrid::Grid&   lslices_edge_grid() const;
+    // Signed distance of a point (in scaled coordinates) to the lslices outline queried on
+    // lslices_edge_grid(), negative inside the slices. Returns false when the
+    // point lies outside of the grid bounding box extended by search_radius.
+    bool                    signed_distance_to_lslices(const Point &pt, coord_t search_radius, coordf_t &distance_out) const;
     template <class T> bool any_internal_region_slice_contains(const T &item) const {
         for (const LayerRegion *layerm : m_regions) if (layerm->slices.any_internal_contains(item)) return true;
         return false;
@@ -186,6 +218,9 @@ public:
                                                                            FillAdaptive::Octree *support_fill_octree,
                                                                            FillLightning::Generator* lightning_generator) const;
     void 					make_ironing();
+    // Free intermediate geometry of all regions of this layer plus the overhang / sharp tail
+    // detection data of the support generator. See LayerRegion::release_intermediate_geometry().
+    void                    release_intermediate_geometry();
 
     void                    export_region_slices_to_svg(const char *path) const;
     void                    export_region_fill_surfaces_to_svg(const char *path) const;
@@ -258,6 +293,9 @@ private:
     size_t              m_id;
     PrintObject        *m_object;
     LayerRegionPtrs     m_regions;
+    // Cache of the lslices distance field, see lslices_edge_grid().
+    mutable std::unique_ptr<EdgeGrid::Grid> m_lslices_edge_grid;
+    mutable std::once_flag                  m_lslices_edge_grid_once;
 };
 
 enum SupportInnerType {
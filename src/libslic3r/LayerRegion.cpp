@@ -55,6 +55,15 @@ Flow LayerRegion::bridging_flow(FlowRole role, bool thick_bridge, bool internal_
 
 }
 
+void LayerRegion::release_intermediate_geometry()
+{
+    // The thin fills were copied into this->fills by Layer::make_fills() already.
+    this->thin_fills.clear();
+    ExPolygons().swap(this->fill_expolygons);
+    ExPolygons().swap(this->fill_no_overlap_expolygons);
+    Polylines().swap(this->unsupported_bridge_edges);
+}
+
 // Fill in layerm->fill_surfaces by trimming the layerm->slices by the cummulative layerm->fill_surfaces.
 void LayerRegion::slices_to_fill_surfaces_clipped()
 {
@@ -114,6 +123,8 @@ void LayerRegion::make_perimeters(const SurfaceCollection &slices, SurfaceCollec
         g.upper_slices = &this->layer()->upper_layer->lslices;
     
     g.layer_id              = (int)this->layer()->id();
+    // Let the Arachne wall generator abort promptly when the print is canceled.
+    g.throw_on_cancel       = [print = this->layer()->object()->print()]() { if (print->canceled()) throw CanceledException(); };
     g.ext_perimeter_flow    = this->flow(frExternalPerimeter);
     g.overhang_flow         = this->bridging_flow(frPerimeter, object_config.thick_bridges);
     g.solid_infill_flow     = this->flow(frSolidInfill);
@@ -783,6 +794,21 @@ void LayerRegion::process_external_surfaces(const Layer *lower_layer, const Poly
 }
 #endif
 
+void LayerRegion::classify_fills()
+{
+    this->fills_have_sparse_infill = false;
+    this->fills_have_solid_infill  = false;
+    for (const ExtrusionEntity *ee : this->fills.entities) {
+        // fill represents infill extrusions of a single island.
+        const auto *fill = dynamic_cast<const ExtrusionEntityCollection*>(ee);
+        ExtrusionRole role = (fill == nullptr || fill->entities.empty()) ? erNone : fill->entities.front()->role();
+        if (is_solid_infill(role))
+            this->fills_have_solid_infill = true;
+        else if (role != erNone)
+            this->fills_have_sparse_infill = true;
+    }
+}
+
 void LayerRegion::prepare_fill_surfaces()
 {
 #ifdef SLIC3R_DEBUG_SLICE_PROCESSING
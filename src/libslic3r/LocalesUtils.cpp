@@ -1,8 +1,6 @@
 #include "LocalesUtils.hpp"
 
-#ifdef _WIN32
-    #include <charconv>
-#endif
+#include <charconv>
 #include <stdexcept>
 
 #include <fast_float/fast_float.h>
@@ -62,9 +60,10 @@ double string_to_double_decimal_point(const std::string_view str, size_t* pos /*
 
 std::string float_to_string_decimal_point(double value, int precision/* = -1*/)
 {
-    // Our Windows build server fully supports C++17 std::to_chars. Let's use it.
-    // Other platforms are behind, fall back to slow stringstreams for now.
-#ifdef _WIN32
+    // Take the C++17 std::to_chars path wherever the standard library provides the floating
+    // point overloads (MSVC, GCC 11+, recent libc++): it is locale independent and does not
+    // touch the global locale lock the stringstream fallback serializes on.
+#if defined(_WIN32) || (defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L)
     constexpr size_t SIZE = 20;
     char out[SIZE] = "";
     std::to_chars_result res;
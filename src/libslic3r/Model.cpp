@@ -210,12 +210,12 @@ Model Model::read_from_file(const std::string& input_file, DynamicPrintConfig* c
     else if (boost::algorithm::iends_with(input_file, ".obj"))
         result = load_obj(input_file.c_str(), &model, message);
     else if (boost::algorithm::iends_with(input_file, ".svg"))
-        result = load_svg(input_file.c_str(), &model, message);
+        result = load_svg(input_file.c_str(), &model, message, stlFn);
     //BBS: remove the old .amf.xml files
     //else if (boost::algorithm::iends_with(input_file, ".amf") || boost::algorithm::iends_with(input_file, ".amf.xml"))
     else if (boost::algorithm::iends_with(input_file, ".amf"))
         //BBS: is_xxx is used for is_inches when load amf
-        result = load_amf(input_file.c_str(), config, config_substitutions, &model, is_xxx);
+        result = load_amf(input_file.c_str(), config, config_substitutions, &model, is_xxx, stlFn);
     else if (boost::algorithm::iends_with(input_file, ".3mf"))
         //BBS: add part plate related logic
         // BBS: backup & restore
@@ -1417,12 +1417,38 @@ BoundingBoxf3 ModelObject::instance_bounding_box(size_t instance_idx, bool dont_
 }
 
 BoundingBoxf3 ModelObject::instance_bounding_box(const ModelInstance &instance, bool dont_translate) const {
-    BoundingBoxf3 bbox;
-    const auto& inst_mat = instance.get_transformation().get_matrix(dont_translate);
-    for (auto vol : this->volumes) {
+    //BBS: the instance matrix is Translate(offset) * matrix(true), so the snug box of the
+    // fully transformed volumes equals the box computed without the instance translation,
+    // shifted by the instance offset. The untranslated box rescans all mesh vertices, so
+    // cache it on the instance keyed by everything it depends on; pure moves (the common
+    // case while dragging) then never touch vertex data.
+    const Transform3d& inst_mat = instance.get_transformation().get_matrix(true);
+    std::vector<std::pair<const TriangleMesh*, Transform3d>> volumes_key;
+    volumes_key.reserve(this->volumes.size());
+    for (const ModelVolume* vol : this->volumes)
         if (vol->is_model_part())
-            bbox.merge(vol->mesh().transformed_bounding_box(inst_mat * vol->get_matrix()));
-    }
+            volumes_key.emplace_back(&vol->mesh(), vol->get_matrix());
+
+    bool valid = instance.m_untranslated_bbox_valid
+        && instance.m_untranslated_bbox_trafo.matrix() == inst_mat.matrix()
+        && instance.m_untranslated_bbox_volumes.size() == volumes_key.size();
+    for (size_t i = 0; valid && i < volumes_key.size(); ++i)
+        valid = instance.m_untranslated_bbox_volumes[i].first == volumes_key[i].first
+             && instance.m_untranslated_bbox_volumes[i].second.matrix() == volumes_key[i].second.matrix();
+
+    if (!valid) {
+        BoundingBoxf3 bbox;
+        for (const auto& [mesh, matrix] : volumes_key)
+            bbox.merge(mesh->transformed_bounding_box(inst_mat * matrix));
+        instance.m_untranslated_bbox         = bbox;
+        instance.m_untranslated_bbox_trafo   = inst_mat;
+        instance.m_untranslated_bbox_volumes = std::move(volumes_key);
+        instance.m_untranslated_bbox_valid   = true;
+    }
+
+    BoundingBoxf3 bbox = instance.m_untranslated_bbox;
+    if (!dont_translate && bbox.defined)
+        bbox.translate(instance.get_offset());
     return bbox;
 }
 
@@ -1494,6 +1520,30 @@ Polygon ModelObject::convex_hull_2d(const Transform3d& trafo_instance) const
 #endif
 }
 
+const Polygon& ModelObject::arrange_hull_2d(const Transform3d &trafo_instance) const
+{
+    // The nesting engine cost grows with the vertex count of every pairwise no-fit polygon,
+    // so the hull is decimated before it enters the arrangement. The tolerance is well below
+    // the clearances arrange adds around the items (brim width, extruder clearance), while
+    // the exact full resolution hulls are still used for the final placement validation
+    // (e.g. Print::sequential_print_horizontal_clearance_valid()).
+    static const double SIMPLIFY_TOLERANCE_MM = 0.1;
+
+    if (!m_arrange_hull_2d_valid || m_arrange_hull_2d_trafo.matrix() != trafo_instance.matrix()) {
+        Polygon p = this->convex_hull_2d(trafo_instance);
+        if (!p.points.empty()) {
+            // Douglas-Peucker keeps a subset of the hull vertices, so the result stays convex.
+            Polygons pp = p.simplify(scaled<double>(SIMPLIFY_TOLERANCE_MM));
+            if (!pp.empty())
+                p = pp.front();
+        }
+        m_arrange_hull_2d = std::move(p);
+        m_arrange_hull_2d_trafo = trafo_instance;
+        m_arrange_hull_2d_valid = true;
+    }
+    return m_arrange_hull_2d;
+}
+
 void ModelObject::center_around_origin(bool include_modifiers)
 {
     // calculate the displacements needed to
@@ -2383,17 +2433,32 @@ void ModelVolume::update_extruder_count(size_t extruder_count)
     }
 }
 
+// Copy on write before an in place mutation: the mesh payloads are shared immutable objects
+// (with clones of the volume and with the undo / redo snapshots holding them by shared_ptr),
+// thus a mutation of a payload with other owners would silently rewrite history. Detach a
+// private copy when shared and hand out a writable reference.
+static TriangleMesh& detach_for_modification(std::shared_ptr<const TriangleMesh> &mesh)
+{
+    if (mesh.use_count() > 1)
+        mesh = std::make_shared<const TriangleMesh>(*mesh);
+    return const_cast<TriangleMesh&>(*mesh);
+}
+
 void ModelVolume::center_geometry_after_creation(bool update_source_offset)
 {
     Vec3d shift = this->mesh().bounding_box().center();
     if (!shift.isApprox(Vec3d::Zero()))
     {
+        //BBS: the mesh is mutated in place below; wait out a background hull computation
+        // still reading it, so the published hull matches the shifted vertices.
+        ensure_convex_hull();
         if (m_mesh) {
-            const_cast<TriangleMesh*>(m_mesh.get())->translate(-(float)shift(0), -(float)shift(1), -(float)shift(2));
-            const_cast<TriangleMesh*>(m_mesh.get())->set_init_shift(shift);
+            TriangleMesh &mesh = detach_for_modification(m_mesh);
+            mesh.translate(-(float)shift(0), -(float)shift(1), -(float)shift(2));
+            mesh.set_init_shift(shift);
         }
         if (m_convex_hull)
-			const_cast<TriangleMesh*>(m_convex_hull.get())->translate(-(float)shift(0), -(float)shift(1), -(float)shift(2));
+            detach_for_modification(m_convex_hull).translate(-(float)shift(0), -(float)shift(1), -(float)shift(2));
         translate(shift);
     }
 
@@ -2401,15 +2466,40 @@ void ModelVolume::center_geometry_after_creation(bool update_source_offset)
         source.mesh_offset = shift;
 }
 
+//BBS: guards m_convex_hull / m_convex_hull_pending of all volumes. A shared mutex (instead
+// of a per-volume one) keeps ModelVolume copyable; the critical sections are a flag check
+// in the common case, so contention is not a concern.
+static std::mutex s_convex_hull_pending_mutex;
+
 void ModelVolume::calculate_convex_hull()
 {
-    m_convex_hull = std::make_shared<TriangleMesh>(this->mesh().convex_hull_3d());
-    assert(m_convex_hull.get());
+    //BBS: qhull on a large mesh is expensive and used to run synchronously inside the mesh
+    // import and geometry fixup paths, which stalls the first interaction with a freshly
+    // imported object. Kick the computation to a worker instead; every consumer goes through
+    // ensure_convex_hull(), which blocks only if it arrives before the result lands and
+    // always yields the exact hull.
+    std::shared_ptr<const TriangleMesh> mesh = m_mesh;
+    std::lock_guard<std::mutex> lock(s_convex_hull_pending_mutex);
+    m_convex_hull.reset();
+    m_convex_hull_pending = std::async(std::launch::async, [mesh]() -> std::shared_ptr<const TriangleMesh> {
+        return std::make_shared<const TriangleMesh>(mesh->convex_hull_3d());
+    }).share();
+}
+
+void ModelVolume::ensure_convex_hull() const
+{
+    std::lock_guard<std::mutex> lock(s_convex_hull_pending_mutex);
+    if (m_convex_hull_pending.valid()) {
+        m_convex_hull = m_convex_hull_pending.get();
+        m_convex_hull_pending = {};
+        assert(m_convex_hull.get());
+    }
 }
 
 //BBS: convex_hull_2d using convex_hull_3d
 void  ModelVolume::calculate_convex_hull_2d(const Geometry::Transformation &transformation) const
 {
+    ensure_convex_hull();
     const indexed_triangle_set &its = m_convex_hull->its;
 	if (its.vertices.empty())
         return;
@@ -2500,6 +2590,7 @@ int ModelVolume::get_repaired_errors_count() const
 
 const TriangleMesh& ModelVolume::get_convex_hull() const
 {
+    ensure_convex_hull();
     return *m_convex_hull.get();
 }
 
@@ -2663,15 +2754,17 @@ void ModelVolume::mirror(Axis axis)
     set_mirror(mirror);
 }
 
-// This method could only be called before the meshes of this ModelVolumes are not shared!
 void ModelVolume::scale_geometry_after_creation(const Vec3f& versor)
 {
-	const_cast<TriangleMesh*>(m_mesh.get())->scale(versor);
+    //BBS: see center_geometry_after_creation(), the mesh is mutated in place
+    // (detaching a private copy first when the payload is shared)
+    ensure_convex_hull();
+    detach_for_modification(m_mesh).scale(versor);
     if (m_convex_hull->empty())
         //BBS: recompute the convex hull if it is null for previous too small
         this->calculate_convex_hull();
     else
-        const_cast<TriangleMesh*>(m_convex_hull.get())->scale(versor);
+        detach_for_modification(m_convex_hull).scale(versor);
 }
 
 void ModelVolume::transform_this_mesh(const Transform3d &mesh_trafo, bool fix_left_handed)
@@ -3013,20 +3106,13 @@ double ModelInstance::get_auto_brim_width() const
 
 void ModelInstance::get_arrange_polygon(void *ap, const Slic3r::DynamicPrintConfig &config_global) const
 {
-//    static const double SIMPLIFY_TOLERANCE_MM = 0.1;
-
     Vec3d rotation = get_rotation();
     rotation.z()   = 0.;
     Transform3d trafo_instance =
         Geometry::assemble_transform(get_offset().z() * Vec3d::UnitZ(), rotation, get_scaling_factor(), get_mirror());
 
-    Polygon p = get_object()->convex_hull_2d(trafo_instance);
-
-//    if (!p.points.empty()) {
-//        Polygons pp{p};
-//        pp = p.simplify(scaled<double>(SIMPLIFY_TOLERANCE_MM));
-//        if (!pp.empty()) p = pp.front();
-//    }
+    // decimated and cached on the object, instances sharing the transform reuse the result
+    Polygon p = get_object()->arrange_hull_2d(trafo_instance);
 
     arrangement::ArrangePolygon& ret = *(arrangement::ArrangePolygon*)ap;
     ret.poly.contour = std::move(p);
@@ -41,6 +41,8 @@
 #include <vector>
 #include <algorithm>
 #include <functional>
+#include <future>
+#include <mutex>
 
 namespace cereal {
 	class BinaryInputArchive;
@@ -435,7 +437,7 @@ public:
     // This bounding box is approximate and not snug.
     // This bounding box is being cached.
     const BoundingBoxf3& bounding_box() const;
-    void invalidate_bounding_box() { m_bounding_box_valid = false; m_raw_bounding_box_valid = false; m_raw_mesh_bounding_box_valid = false; }
+    void invalidate_bounding_box() { m_bounding_box_valid = false; m_raw_bounding_box_valid = false; m_raw_mesh_bounding_box_valid = false; m_arrange_hull_2d_valid = false; }
 
     // A mesh containing all transformed instances of this object.
     TriangleMesh mesh() const;
@@ -463,6 +465,9 @@ public:
     // This method is cheap in that it does not make any unnecessary copy of the volume meshes.
     // This method is used by the auto arrange function.
     Polygon       convex_hull_2d(const Transform3d &trafo_instance) const;
+    // Same as convex_hull_2d(), but decimated for the arrangement engine and cached.
+    // The cache is keyed by the instance transform and is invalidated together with the bounding boxes.
+    const Polygon& arrange_hull_2d(const Transform3d &trafo_instance) const;
 
     void center_around_origin(bool include_modifiers = true);
     void ensure_on_bed(bool allow_negative_z = false);
@@ -624,6 +629,10 @@ private:
     mutable bool          m_raw_bounding_box_valid;
     mutable BoundingBoxf3 m_raw_mesh_bounding_box;
     mutable bool          m_raw_mesh_bounding_box_valid;
+    // 2D convex hull used by the auto arrange function, decimated and cached (see arrange_hull_2d()).
+    mutable Polygon       m_arrange_hull_2d;
+    mutable Transform3d   m_arrange_hull_2d_trafo{ Transform3d::Identity() };
+    mutable bool          m_arrange_hull_2d_valid{ false };
 
     // Called by Print::apply() to set the model pointer after making a copy.
     friend class Print;
@@ -941,7 +950,7 @@ public:
 
     void                calculate_convex_hull();
     const TriangleMesh& get_convex_hull() const;
-    const std::shared_ptr<const TriangleMesh>& get_convex_hull_shared_ptr() const { return m_convex_hull; }
+    const std::shared_ptr<const TriangleMesh>& get_convex_hull_shared_ptr() const { ensure_convex_hull(); return m_convex_hull; }
     //BBS: add convex_hell_2d related logic
     const Polygon& get_convex_hull_2d(const Transform3d &trafo_instance) const;
     void invalidate_convex_hull_2d()
@@ -1027,7 +1036,11 @@ private:
     ModelVolumeType                 	m_type;
     t_model_material_id             	m_material_id;
     // The convex hull of this model's mesh.
-    std::shared_ptr<const TriangleMesh> m_convex_hull;
+    // Mutable because ensure_convex_hull() publishes a background-computed hull on first (const) access.
+    mutable std::shared_ptr<const TriangleMesh> m_convex_hull;
+    //BBS: calculate_convex_hull() kicks the qhull computation to a worker thread and parks
+    // the result here; ensure_convex_hull() publishes it into m_convex_hull on first use.
+    mutable std::shared_future<std::shared_ptr<const TriangleMesh>> m_convex_hull_pending;
     //BBS: add convex hull 2d related logic
     mutable Polygon                     m_convex_hull_2d; //BBS, used for convex_hell_2d acceleration
     mutable Transform3d                 m_cached_trans_matrix; //BBS, used for convex_hell_2d acceleration
@@ -1039,6 +1052,10 @@ private:
     //BBS: add convex_hell_2d related logic
     void  calculate_convex_hull_2d(const Geometry::Transformation &transformation) const;
 
+    //BBS: wait for a pending background hull computation and publish it into m_convex_hull.
+    // Must be called before m_convex_hull is read or mutated.
+    void  ensure_convex_hull() const;
+
     // flag to optimize the checking if the volume is splittable
     //     -1   ->   is unknown value (before first cheking)
     //      0   ->   is not splittable
@@ -1088,6 +1105,7 @@ private:
     ModelVolume(ModelObject *object, const ModelVolume &other) :
         ObjectBase(other),
         name(other.name), source(other.source), m_mesh(other.m_mesh), m_convex_hull(other.m_convex_hull),
+        m_convex_hull_pending(other.m_convex_hull_pending),
         config(other.config), m_type(other.m_type), object(object), m_transformation(other.m_transformation),
         supported_facets(other.supported_facets), seam_facets(other.seam_facets), mmu_segmentation_facets(other.mmu_segmentation_facets),
         m_text_info(other.m_text_info)
@@ -1169,6 +1187,9 @@ private:
         mesh_changed |= t != mmu_segmentation_facets.timestamp();
         cereal::load_by_value(ar, config);
 		assert(m_mesh);
+		// BBS: drop any hull computation still in flight for the previous mesh,
+		// it must not overwrite the hull loaded below.
+		m_convex_hull_pending = {};
 		if (has_convex_hull) {
 			cereal::load_optional(ar, m_convex_hull);
 			if (! m_convex_hull && ! m_mesh->empty())
@@ -1180,6 +1201,7 @@ private:
             Slic3r::save_object_mesh(*object);
 	}
 	template<class Archive> void save(Archive &ar) const {
+		ensure_convex_hull();
 		bool has_convex_hull = m_convex_hull.get() != nullptr;
         ar(name, source, m_mesh, m_type, m_material_id, m_transformation, m_is_splittable, has_convex_hull, m_text_info, cut_info);
         cereal::save_by_value(ar, supported_facets);
@@ -1345,6 +1367,15 @@ private:
     ModelObject* object;
     Polygon convex_hull; // BBS
 
+    //BBS: cache of the snug bounding box of this instance without the instance translation
+    // applied (see ModelObject::instance_bounding_box()). Validated by comparing the cached
+    // key (untranslated instance matrix plus the mesh and matrix of each printable volume),
+    // so pure moves reuse it without any explicit invalidation hook.
+    mutable BoundingBoxf3 m_untranslated_bbox;
+    mutable Transform3d   m_untranslated_bbox_trafo{ Transform3d::Identity() };
+    mutable std::vector<std::pair<const TriangleMesh*, Transform3d>> m_untranslated_bbox_volumes;
+    mutable bool          m_untranslated_bbox_valid{ false };
+
     // Constructor, which assigns a new unique ID.
     explicit ModelInstance(ModelObject* object) : print_volume_state(ModelInstancePVS_Inside), printable(true), object(object), m_assemble_initialized(false) { assert(this->id().valid()); }
     // Constructor, which assigns a new unique ID.
@@ -1866,26 +1866,34 @@ std::vector<std::vector<ExPolygons>> multi_material_segmentation_by_painting(con
     }); // end of parallel_for
     BOOST_LOG_TRIVIAL(debug) << "MMU segmentation - slices preparation in parallel - end";
 
+    BOOST_LOG_TRIVIAL(debug) << "MMU segmentation - edge grids in parallel - begin";
     std::vector<BoundingBox> layer_bboxes(num_layers);
-    for (size_t layer_idx = 0; layer_idx < num_layers; ++layer_idx) {
-        throw_on_cancel_callback();
-        layer_bboxes[layer_idx] = get_extents(layers[layer_idx]->regions());
-        layer_bboxes[layer_idx].merge(get_extents(input_expolygons[layer_idx]));
-    }
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, num_layers), [&layers, &input_expolygons, &layer_bboxes, &throw_on_cancel_callback](const tbb::blocked_range<size_t> &range) {
+        for (size_t layer_idx = range.begin(); layer_idx < range.end(); ++layer_idx) {
+            throw_on_cancel_callback();
+            layer_bboxes[layer_idx] = get_extents(layers[layer_idx]->regions());
+            layer_bboxes[layer_idx].merge(get_extents(input_expolygons[layer_idx]));
+        }
+    }); // end of parallel_for
 
-    for (size_t layer_idx = 0; layer_idx < num_layers; ++layer_idx) {
-        throw_on_cancel_callback();
-        BoundingBox bbox = layer_bboxes[layer_idx];
-        // Projected triangles could, in rare cases (as in GH issue #7299), belongs to polygons printed in the previous or the next layer.
-        // Let's merge the bounding box of the current layer with bounding boxes of the previous and the next layer to ensure that
-        // every projected triangle will be inside the resulting bounding box.
-        if (layer_idx > 1) bbox.merge(layer_bboxes[layer_idx - 1]);
-        if (layer_idx < num_layers - 1) bbox.merge(layer_bboxes[layer_idx + 1]);
-        // Projected triangles may slightly exceed the input polygons.
-        bbox.offset(20 * SCALED_EPSILON);
-        edge_grids[layer_idx].set_bbox(bbox);
-        edge_grids[layer_idx].create(input_expolygons[layer_idx], coord_t(scale_(10.)));
-    }
+    // Filling an EdgeGrid only reads the bounding boxes of the neighboring layers, which are all
+    // computed by the pass above, so the grids can be populated layer by layer in parallel as well.
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, num_layers), [&layer_bboxes, &edge_grids, &input_expolygons, &num_layers, &throw_on_cancel_callback](const tbb::blocked_range<size_t> &range) {
+        for (size_t layer_idx = range.begin(); layer_idx < range.end(); ++layer_idx) {
+            throw_on_cancel_callback();
+            BoundingBox bbox = layer_bboxes[layer_idx];
+            // Projected triangles could, in rare cases (as in GH issue #7299), belongs to polygons printed in the previous or the next layer.
+            // Let's merge the bounding box of the current layer with bounding boxes of the previous and the next layer to ensure that
+            // every projected triangle will be inside the resulting bounding box.
+            if (layer_idx > 1) bbox.merge(layer_bboxes[layer_idx - 1]);
+            if (layer_idx < num_layers - 1) bbox.merge(layer_bboxes[layer_idx + 1]);
+            // Projected triangles may slightly exceed the input polygons.
+            bbox.offset(20 * SCALED_EPSILON);
+            edge_grids[layer_idx].set_bbox(bbox);
+            edge_grids[layer_idx].create(input_expolygons[layer_idx], coord_t(scale_(10.)));
+        }
+    }); // end of parallel_for
+    BOOST_LOG_TRIVIAL(debug) << "MMU segmentation - edge grids in parallel - end";
 
     BOOST_LOG_TRIVIAL(debug) << "MMU segmentation - projection of painted triangles - begin";
     for (const ModelVolume *mv : print_object.model_object()->volumes) {
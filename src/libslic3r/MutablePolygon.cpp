@@ -384,4 +384,41 @@ void smooth_outward(MutablePolygon &polygon, coord_t clip_dist_scaled)
         polygon.clear();
 }
 
+void douglas_peucker_in_place(MutablePolygon &polygon, const double tolerance)
+{
+    if (polygon.size() <= 3)
+        return;
+    const double tolerance_sq = tolerance * tolerance;
+    // Spans of the closed ring still to be processed, bounded by points already decided to be kept.
+    // The initial degenerate span anchors the ring at its first point, the same way
+    // MultiPoint::_douglas_peucker() is applied to a closed contour in ExPolygon::simplify_p().
+    std::vector<std::pair<MutablePolygon::iterator, MutablePolygon::iterator>> spans;
+    spans.emplace_back(polygon.begin(), polygon.begin());
+    while (! spans.empty()) {
+        MutablePolygon::iterator b = spans.back().first;
+        MutablePolygon::iterator e = spans.back().second;
+        spans.pop_back();
+        if (b.next() == e)
+            // No interior points.
+            continue;
+        // Find the interior point of the span farthest from the line segment (b, e).
+        double                   max_dist_sq = 0.;
+        MutablePolygon::iterator farthest    = b;
+        for (MutablePolygon::iterator it = b.next(); it != e; ++ it)
+            if (double dist_sq = Line::distance_to_squared(*it, *b, *e); dist_sq > max_dist_sq) {
+                max_dist_sq = dist_sq;
+                farthest    = it;
+            }
+        if (max_dist_sq <= tolerance_sq) {
+            // All interior points of the span are within tolerance, unlink them.
+            // iterator::remove() advances to the following element.
+            for (MutablePolygon::iterator it = b.next(); it != e; )
+                it.remove();
+        } else {
+            spans.emplace_back(farthest, e);
+            spans.emplace_back(b, farthest);
+        }
+    }
+}
+
 } // namespace Slic3r
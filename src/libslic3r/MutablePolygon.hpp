@@ -327,6 +327,30 @@ inline ExPolygons remove_duplicates(ExPolygons expolygons, coord_t scaled_eps, d
     return expolygons;
 }
 
+// Simplify the polygon in place with the Douglas-Peucker algorithm, unlinking the dropped points.
+// Matches the semantics of MultiPoint::_douglas_peucker() applied to a closed contour: the first
+// point anchors the ring and is always kept. May reduce the polygon below three points.
+void douglas_peucker_in_place(MutablePolygon &polygon, double tolerance);
+
+// Append a Douglas-Peucker simplification of expolygon to out, reusing buffer between calls to
+// avoid heap churn. Unlike ExPolygon::simplify_p() this does not run Clipper over the result to
+// resolve rare self-intersections introduced by the simplification, thus the output shall only be
+// fed into a boolean operation (union_ex / offset_ex) which resolves them anyway.
+inline void douglas_peucker_in_place_append(const ExPolygon &expolygon, double tolerance, MutablePolygon &buffer, Polygons &out)
+{
+    out.reserve(out.size() + expolygon.holes.size() + 1);
+    buffer.assign(expolygon.contour, expolygon.contour.size());
+    douglas_peucker_in_place(buffer, tolerance);
+    if (buffer.valid())
+        out.emplace_back(buffer.polygon());
+    for (const Polygon &hole : expolygon.holes) {
+        buffer.assign(hole, hole.size());
+        douglas_peucker_in_place(buffer, tolerance);
+        if (buffer.valid())
+            out.emplace_back(buffer.polygon());
+    }
+}
+
 void smooth_outward(MutablePolygon &polygon, coord_t clip_dist_scaled);
 
 inline Polygon smooth_outward(Polygon polygon, coord_t clip_dist_scaled)
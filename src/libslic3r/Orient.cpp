@@ -63,10 +63,6 @@ public:
     Eigen::MatrixXf normals, normals_quantize, normals_hull, normals_hull_quantize;
     Eigen::VectorXf areas, areas_hull;
     Eigen::VectorXf is_apperance; // whether a facet is outer apperance
-    Eigen::MatrixXf z_projected;
-    Eigen::VectorXf z_max, z_max_hull;  // max of projected z
-    Eigen::VectorXf z_median;  // median of projected z
-    Eigen::VectorXf z_mean;  // mean of projected z
     std::vector<Vec3f> face_normals;
     std::vector<Vec3f> face_normals_hull;
     OrientParams params;
@@ -109,6 +105,15 @@ public:
         return Vec3f(floor(n1(0) * 1000) / 1000, floor(n1(1) * 1000) / 1000, floor(n1(2) * 1000) / 1000);
     }
 
+    // Per-orientation projection scratch data. Each worker thread owns one instance,
+    // so the candidate orientations can be evaluated in parallel.
+    struct Projection {
+        Eigen::MatrixXf z_projected;
+        Eigen::VectorXf z_max, z_max_hull;  // max of projected z
+        Eigen::VectorXf z_median;  // median of projected z
+        Eigen::VectorXf z_mean;  // mean of projected z
+    };
+
     Vec3d process()
     {
         orientations = { { 0,0,-1 } }; // original orientation
@@ -130,19 +135,30 @@ public:
         std::unordered_map<Vec3f, CostItems, VecHash> results;
         BOOST_LOG_TRIVIAL(info) << CostItems::field_names();
         std::cout << CostItems::field_names() << std::endl;
-        for (int i = 0; i < orientations.size();i++) {
-            auto orientation = -orientations[i];
+        // Evaluate the candidate orientations in parallel. Each evaluation only reads the
+        // per-face arrays built once in preprocess() and writes its own Projection scratch,
+        // so the candidates are independent of each other.
+        std::vector<std::pair<Vec3f, CostItems>> evaluated(orientations.size());
+        tbb::parallel_for(tbb::blocked_range<size_t>(0, orientations.size()),
+            [this, &evaluated](const tbb::blocked_range<size_t>& range) {
+                Projection proj;
+                for (size_t i = range.begin(); i != range.end(); ++i) {
+                    Vec3f orientation = -orientations[i];
 
-            project_vertices(orientation);
+                    project_vertices(orientation, proj);
 
-            auto cost_items = get_features(orientation, params.min_volume);
+                    auto cost_items = get_features(orientation, proj, params.min_volume);
 
-            float unprintability = target_function(cost_items, params.min_volume);
+                    target_function(cost_items, params.min_volume);
 
+                    evaluated[i] = { orientation, cost_items };
+                }
+            });
+        for (const auto& [orientation, cost_items] : evaluated) {
             results[orientation] = cost_items;
 
-            BOOST_LOG_TRIVIAL(info) << std::fixed << std::setprecision(4) << "orientation:" << orientation.transpose() << ", cost:" << std::fixed << std::setprecision(4) << cost_items.field_values();
-            std::cout << std::fixed << std::setprecision(4) << "orientation:" << orientation.transpose() << ", cost:" << std::fixed << std::setprecision(4) << cost_items.field_values() << std::endl;
+            BOOST_LOG_TRIVIAL(info) << std::fixed << std::setprecision(4) << "orientation:" << orientation.transpose() << ", cost:" << std::fixed << std::setprecision(4) << results[orientation].field_values();
+            std::cout << std::fixed << std::setprecision(4) << "orientation:" << orientation.transpose() << ", cost:" << std::fixed << std::setprecision(4) << results[orientation].field_values() << std::endl;
         }
         if (progressind)
             progressind(60);
@@ -315,35 +331,35 @@ public:
         }
     }
 
-    void project_vertices(Vec3f orientation)
+    void project_vertices(Vec3f orientation, Projection& proj)
     {
         int face_count = mesh->facets_count();
         auto its = mesh->its;
-        z_projected.resize(face_count, 3);
-        z_max.resize(face_count, 1);
-        z_median.resize(face_count, 1);
-        z_mean.resize(face_count, 1);
+        proj.z_projected.resize(face_count, 3);
+        proj.z_max.resize(face_count, 1);
+        proj.z_median.resize(face_count, 1);
+        proj.z_mean.resize(face_count, 1);
         for (size_t i = 0; i < face_count; i++)
         {
             float z0 = its.get_vertex(i,0).dot(orientation);
             float z1 = its.get_vertex(i,1).dot(orientation);
             float z2 = its.get_vertex(i,2).dot(orientation);
-            z_projected(i, 0) = z0;
-            z_projected(i, 1) = z1;
-            z_projected(i, 2) = z2;
-            z_max(i) = MAX3(z0,z1,z2);
-            z_median(i) = MEDIAN3(z0,z1,z2);
-            z_mean(i) = (z0 + z1 + z2) / 3;
+            proj.z_projected(i, 0) = z0;
+            proj.z_projected(i, 1) = z1;
+            proj.z_projected(i, 2) = z2;
+            proj.z_max(i) = MAX3(z0,z1,z2);
+            proj.z_median(i) = MEDIAN3(z0,z1,z2);
+            proj.z_mean(i) = (z0 + z1 + z2) / 3;
         }
 
-        z_max_hull.resize(mesh_convex_hull.facets_count(), 1);
+        proj.z_max_hull.resize(mesh_convex_hull.facets_count(), 1);
         its = mesh_convex_hull.its;
-        for (size_t i = 0; i < z_max_hull.rows(); i++)
+        for (size_t i = 0; i < proj.z_max_hull.rows(); i++)
         {
             float z0 = its.get_vertex(i,0).dot(orientation);
             float z1 = its.get_vertex(i,1).dot(orientation);
             float z2 = its.get_vertex(i,2).dot(orientation);
-            z_max_hull(i) = MAX3(z0, z1, z2);
+            proj.z_max_hull(i) = MAX3(z0, z1, z2);
         }
     }
 
@@ -371,7 +387,7 @@ public:
     }
 
     // previously calc_overhang
-    CostItems get_features(Vec3f orientation, bool min_volume = true)
+    CostItems get_features(Vec3f orientation, const Projection& proj, bool min_volume = true)
     {
         CostItems costs;
         costs.area_total = mesh->bounding_box().area();
@@ -379,11 +395,11 @@ public:
         // volume
         costs.volume = mesh->stats().volume > 0 ? mesh->stats().volume : its_volume(mesh->its);
 
-        float total_min_z = z_projected.minCoeff();
+        float total_min_z = proj.z_projected.minCoeff();
         // filter bottom area
-        auto bottom_condition = z_max.array() < total_min_z + this->params.FIRST_LAY_H - EPSILON;
-        auto bottom_condition_hull = z_max_hull.array() < total_min_z + this->params.FIRST_LAY_H - EPSILON;
-        auto bottom_condition_2nd = z_max.array() < total_min_z + this->params.FIRST_LAY_H/2.f - EPSILON;
+        auto bottom_condition = proj.z_max.array() < total_min_z + this->params.FIRST_LAY_H - EPSILON;
+        auto bottom_condition_hull = proj.z_max_hull.array() < total_min_z + this->params.FIRST_LAY_H - EPSILON;
+        auto bottom_condition_2nd = proj.z_max.array() < total_min_z + this->params.FIRST_LAY_H/2.f - EPSILON;
         //The first layer is sliced on half of the first layer height. 
         //The bottom area is measured by accumulating first layer area with the facets area below first layer height.
         //By combining these two factors, we can avoid the wrong orientation of large planar faces while not influence the
@@ -402,7 +418,7 @@ public:
         inner = inner.cwiseMin(0).cwiseAbs();
         if (min_volume)
         {
-            Eigen::MatrixXf heights = z_mean.array() - total_min_z;
+            Eigen::MatrixXf heights = proj.z_mean.array() - total_min_z;
             costs.overhang = (heights.array()* overhang_areas.array()*inner.array()).sum();
         }
         else {
@@ -422,7 +438,7 @@ public:
             for (size_t i = 0; i < face_count; i++)
             {
                 if (bottom_condition(i)) {
-                    Eigen::VectorXi index = argsort(z_projected.row(i));
+                    Eigen::VectorXi index = argsort(proj.z_projected.row(i));
                     stl_vertex line = its.get_vertex(i, index(0)) - its.get_vertex(i, index(1));
                     contour += line.norm();
                     contour_amout++;
@@ -437,7 +453,7 @@ public:
 
         // low angle faces
         auto normal_projection_abs = normal_projection.cwiseAbs();
-        Eigen::MatrixXf laf_areas = ((normal_projection_abs.array() < params.LAF_MAX) * (normal_projection_abs.array() > params.LAF_MIN) * (z_max.array() > total_min_z + params.FIRST_LAY_H)).select(areas, 0);
+        Eigen::MatrixXf laf_areas = ((normal_projection_abs.array() < params.LAF_MAX) * (normal_projection_abs.array() > params.LAF_MIN) * (proj.z_max.array() > total_min_z + params.FIRST_LAY_H)).select(areas, 0);
         costs.area_laf = laf_areas.sum();
 
         // height to bottom_hull_area ratio
@@ -11,9 +11,11 @@
 #include "ClipperUtils.hpp"
 #include "ExtrusionEntity.hpp"
 #include "ExtrusionEntityCollection.hpp"
+#include "PolylineJoin.hpp"
 #include "ShortestPath.hpp"
 #include "VariableWidth.hpp"
 #include "CurveAnalyzer.hpp"
+#include "MutablePolygon.hpp"
 #include "Clipper2Utils.hpp"
 #include "Arachne/WallToolPaths.hpp"
 #include "Geometry/ConvexHull.hpp"
@@ -21,6 +23,9 @@
 #include <cmath>
 #include <cassert>
 
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+
 static const int overhang_sampling_number = 6;
 static const double narrow_loop_length_threshold = 10;
 //BBS: when the width of expolygon is smaller than
@@ -55,29 +60,119 @@ public:
     bool is_internal_contour() const;
 };
 
+// Cheap local PRNG (xorshift64*). The fuzzy skin displacement used to call rand() per point;
+// rand() takes a process wide lock in glibc, which serialized the TBB perimeter workers
+// whenever fuzzy skin was enabled on all walls.
+struct FuzzyRand
+{
+    FuzzyRand() : m_state((uint64_t(rand()) << 32) ^ uint64_t(rand()) ^ 0x9e3779b97f4a7c15ull) {
+        if (m_state == 0)
+            m_state = 0x9e3779b97f4a7c15ull;
+    }
+    // Uniform in <0, 1).
+    double next() {
+        m_state ^= m_state >> 12;
+        m_state ^= m_state << 25;
+        m_state ^= m_state >> 27;
+        return double((m_state * 0x2545f4914f6cdd1dull) >> 11) * (1. / 9007199254740992.);
+    }
+private:
+    uint64_t m_state;
+};
+
+// Batched core of the fuzzy skin displacement shared by fuzzy_polygon() and fuzzy_extrusion_line().
+// The contour is first flattened into contiguous per-segment arrays, then a cheap scalar pass only
+// decides where the resampled points go (segment index and distance along the segment), and the
+// final coordinates are produced in a tight branch-free loop over the flat arrays which the
+// compiler can vectorize. There is no dedicated intrinsics layer in libslic3r, so the kernel
+// relies on auto-vectorization of the contiguous float loops.
+struct FuzzySampler
+{
+    void reserve(size_t num_segments) {
+        m_seg_start.reserve(num_segments);
+        m_seg_dir_x.reserve(num_segments);
+        m_seg_dir_y.reserve(num_segments);
+        m_seg_len.reserve(num_segments);
+    }
+
+    // Append a contour segment. A zero length segment produces a single marker sample, which
+    // emits a verbatim copy of the segment end point (used to connect Arachne endpoints).
+    void add_segment(const Point &a, const Point &b) {
+        Vec2d  v = (b - a).cast<double>();
+        double l = v.norm();
+        double inv_l = l > 0. ? 1. / l : 0.;
+        m_seg_start.emplace_back(a.cast<double>());
+        m_seg_dir_x.emplace_back(float(v.x() * inv_l));
+        m_seg_dir_y.emplace_back(float(v.y() * inv_l));
+        m_seg_len.emplace_back(float(l));
+    }
+
+    // Decide the resampling positions and draw the noise offsets. This pass is inherently serial
+    // (each random draw depends on the previous one), but it touches no geometry.
+    void sample(double min_dist_between_points, double range_random_point_dist, double fuzzy_skin_thickness, FuzzyRand &rng) {
+        // the distance to be traversed on the line before making the first new point
+        double dist_left_over = rng.next() * (min_dist_between_points / 2);
+        for (size_t i = 0; i < m_seg_len.size(); ++ i) {
+            const double l = double(m_seg_len[i]);
+            if (l == 0.) {
+                m_sample_seg.emplace_back(int32_t(i));
+                m_sample_pos.emplace_back(-1.f);
+                continue;
+            }
+            double d = dist_left_over;
+            for (; d < l; d += min_dist_between_points + rng.next() * range_random_point_dist) {
+                m_sample_seg.emplace_back(int32_t(i));
+                m_sample_pos.emplace_back(float(d));
+            }
+            dist_left_over = d - l;
+        }
+        m_sample_noise.resize(m_sample_seg.size());
+        for (float &r : m_sample_noise)
+            r = float(rng.next() * (fuzzy_skin_thickness * 2.) - fuzzy_skin_thickness);
+    }
+
+    size_t  size() const { return m_sample_seg.size(); }
+    int32_t segment(size_t i) const { return m_sample_seg[i]; }
+    bool    is_marker(size_t i) const { return m_sample_pos[i] < 0.f; }
+
+    // Displaced point of the i-th sample. perp((x, y)) = (-y, x), matching perp() in Point.hpp.
+    Point point(size_t i) const {
+        const int32_t s = m_sample_seg[i];
+        const double  d = double(m_sample_pos[i]);
+        const double  r = double(m_sample_noise[i]);
+        return Point(coord_t(m_seg_start[s].x() + double(m_seg_dir_x[s]) * d - double(m_seg_dir_y[s]) * r),
+                     coord_t(m_seg_start[s].y() + double(m_seg_dir_y[s]) * d + double(m_seg_dir_x[s]) * r));
+    }
+
+private:
+    std::vector<Vec2d>   m_seg_start;
+    std::vector<float>   m_seg_dir_x;
+    std::vector<float>   m_seg_dir_y;
+    std::vector<float>   m_seg_len;
+    std::vector<int32_t> m_sample_seg;
+    std::vector<float>   m_sample_pos;
+    std::vector<float>   m_sample_noise;
+};
+
 // Thanks Cura developers for this function.
 static void fuzzy_polygon(Polygon &poly, double fuzzy_skin_thickness, double fuzzy_skin_point_distance)
 {
     const double min_dist_between_points = fuzzy_skin_point_distance * 3. / 4.; // hardcoded: the point distance may vary between 3/4 and 5/4 the supplied value
     const double range_random_point_dist = fuzzy_skin_point_distance / 2.;
-    double dist_left_over = double(rand()) * (min_dist_between_points / 2) / double(RAND_MAX); // the distance to be traversed on the line before making the first new point
-    Point* p0 = &poly.points.back();
-    Points out;
-    out.reserve(poly.points.size());
-    for (Point &p1 : poly.points)
-    { // 'a' is the (next) new point between p0 and p1
-        Vec2d  p0p1      = (p1 - *p0).cast<double>();
-        double p0p1_size = p0p1.norm();
-        double p0pa_dist = dist_left_over;
-        for (; p0pa_dist < p0p1_size;
-            p0pa_dist += min_dist_between_points + double(rand()) * range_random_point_dist / double(RAND_MAX))
-        {
-            double r = double(rand()) * (fuzzy_skin_thickness * 2.) / double(RAND_MAX) - fuzzy_skin_thickness;
-            out.emplace_back(*p0 + (p0p1 * (p0pa_dist / p0p1_size) + perp(p0p1).cast<double>().normalized() * r).cast<coord_t>());
-        }
-        dist_left_over = p0pa_dist - p0p1_size;
+    FuzzyRand    rng;
+    FuzzySampler sampler;
+    sampler.reserve(poly.points.size());
+    const Point *p0 = &poly.points.back();
+    for (const Point &p1 : poly.points) {
+        sampler.add_segment(*p0, p1);
         p0 = &p1;
     }
+    sampler.sample(min_dist_between_points, range_random_point_dist, fuzzy_skin_thickness, rng);
+    Points out;
+    out.reserve(sampler.size());
+    for (size_t i = 0; i < sampler.size(); ++ i)
+        if (! sampler.is_marker(i))
+            out.emplace_back(sampler.point(i));
     while (out.size() < 3) {
         size_t point_idx = poly.size() - 2;
         out.emplace_back(poly[point_idx]);
@@ -94,28 +189,26 @@ static void fuzzy_extrusion_line(Arachne::ExtrusionLine& ext_lines, double fuzzy
 {
     const double min_dist_between_points = fuzzy_skin_point_dist * 3. / 4.; // hardcoded: the point distance may vary between 3/4 and 5/4 the supplied value
     const double range_random_point_dist = fuzzy_skin_point_dist / 2.;
-    double dist_left_over = double(rand()) * (min_dist_between_points / 2) / double(RAND_MAX); // the distance to be traversed on the line before making the first new point
-
-    auto* p0 = &ext_lines.front();
-    std::vector<Arachne::ExtrusionJunction> out;
-    out.reserve(ext_lines.size());
-    for (auto& p1 : ext_lines) {
-        if (p0->p == p1.p) { // Connect endpoints.
-            out.emplace_back(p1.p, p1.w, p1.perimeter_index);
-            continue;
-        }
-
-        // 'a' is the (next) new point between p0 and p1
-        Vec2d  p0p1 = (p1.p - p0->p).cast<double>();
-        double p0p1_size = p0p1.norm();
-        double p0pa_dist = dist_left_over;
-        for (; p0pa_dist < p0p1_size; p0pa_dist += min_dist_between_points + double(rand()) * range_random_point_dist / double(RAND_MAX)) {
-            double r = double(rand()) * (fuzzy_skin_thickness * 2.) / double(RAND_MAX) - fuzzy_skin_thickness;
-            out.emplace_back(p0->p + (p0p1 * (p0pa_dist / p0p1_size) + perp(p0p1).cast<double>().normalized() * r).cast<coord_t>(), p1.w, p1.perimeter_index);
-        }
-        dist_left_over = p0pa_dist - p0p1_size;
+    FuzzyRand    rng;
+    FuzzySampler sampler;
+    sampler.reserve(ext_lines.size());
+    const Arachne::ExtrusionJunction *p0 = &ext_lines.front();
+    for (const auto &p1 : ext_lines) {
+        // Coinciding junctions produce a marker sample, connecting Arachne endpoints verbatim.
+        sampler.add_segment(p0->p, p1.p);
         p0 = &p1;
     }
+    sampler.sample(min_dist_between_points, range_random_point_dist, fuzzy_skin_thickness, rng);
+    std::vector<Arachne::ExtrusionJunction> out;
+    out.reserve(sampler.size());
+    for (size_t i = 0; i < sampler.size(); ++ i) {
+        // Width and perimeter index are inherited from the end junction of the sample's segment.
+        const Arachne::ExtrusionJunction &j = ext_lines[sampler.segment(i)];
+        if (sampler.is_marker(i))
+            out.emplace_back(j.p, j.w, j.perimeter_index);
+        else
+            out.emplace_back(sampler.point(i), j.w, j.perimeter_index);
+    }
 
     while (out.size() < 3) {
         size_t point_idx = ext_lines.size() - 2;
@@ -982,51 +1075,8 @@ Polylines reconnect_polylines(const Polylines &polylines, double limit_distance)
 {
     if (polylines.empty())
         return polylines;
-
-    std::unordered_map<size_t, Polyline> connected;
-    connected.reserve(polylines.size());
-    for (size_t i = 0; i < polylines.size(); i++) {
-        if (!polylines[i].empty()) {
-            connected.emplace(i, polylines[i]);
-        }
-    }
-
-    for (size_t a = 0; a < polylines.size(); a++) {
-        if (connected.find(a) == connected.end()) {
-            continue;
-        }
-        Polyline &base = connected.at(a);
-        for (size_t b = a + 1; b < polylines.size(); b++) {
-            if (connected.find(b) == connected.end()) {
-                continue;
-            }
-            Polyline &next = connected.at(b);
-            if ((base.last_point() - next.first_point()).cast<double>().squaredNorm() < limit_distance * limit_distance) {
-                base.append(std::move(next));
-                connected.erase(b);
-            } else if ((base.last_point() - next.last_point()).cast<double>().squaredNorm() < limit_distance * limit_distance) {
-                base.points.insert(base.points.end(), next.points.rbegin(), next.points.rend());
-                connected.erase(b);
-            } else if ((base.first_point() - next.last_point()).cast<double>().squaredNorm() < limit_distance * limit_distance) {
-                next.append(std::move(base));
-                base = std::move(next);
-                base.reverse();
-                connected.erase(b);
-            } else if ((base.first_point() - next.first_point()).cast<double>().squaredNorm() < limit_distance * limit_distance) {
-                base.reverse();
-                base.append(std::move(next));
-                base.reverse();
-                connected.erase(b);
-            }
-        }
-    }
-
-    Polylines result;
-    for (auto &ext : connected) {
-        result.push_back(std::move(ext.second));
-    }
-
-    return result;
+    // The end point grid hash avoids testing every pair of polylines against each other.
+    return join_polylines(Polylines(polylines), limit_distance);
 }
 
 ExtrusionPaths sort_extra_perimeters(const ExtrusionPaths& extra_perims, int index_of_first_unanchored, double extrusion_spacing)
@@ -1495,6 +1545,9 @@ void PerimeterGenerator::process_classic()
 
     // BBS: don't simplify too much which influence arc fitting when export gcode if arc_fitting is enabled
     double surface_simplify_resolution = (print_config->enable_arc_fitting && this->config->fuzzy_skin == FuzzySkinType::None) ? 0.2 * m_scaled_resolution : m_scaled_resolution;
+    // Reused between the islands to avoid reallocating the simplification buffers per island.
+    MutablePolygon simplify_buf;
+    Polygons       simplified;
     for (const Surface &surface : this->slices->surfaces) {
         // detect how many perimeters must be generated for this island
         int        loop_number = this->config->wall_loops + surface.extra_perimeters - 1;  // 0-indexed loops
@@ -1504,7 +1557,9 @@ void PerimeterGenerator::process_classic()
         if (loop_number > 0 && config->only_one_wall_top && this->upper_slices == nullptr)
             loop_number = 0;
 
-        ExPolygons last        = union_ex(surface.expolygon.simplify_p(surface_simplify_resolution));
+        simplified.clear();
+        douglas_peucker_in_place_append(surface.expolygon, surface_simplify_resolution, simplify_buf, simplified);
+        ExPolygons last        = union_ex(simplified);
         ExPolygons gaps;
         ExPolygons top_fills;
         ExPolygons fill_clip;
@@ -1821,10 +1876,10 @@ void PerimeterGenerator::process_classic()
             inset -= infill_peri_overlap;
         }
         // simplify infill contours according to resolution
-        Polygons pp;
+        simplified.clear();
         for (ExPolygon &ex : last)
-            ex.simplify_p(m_scaled_resolution, &pp);
-        ExPolygons not_filled_exp = union_ex(pp);
+            douglas_peucker_in_place_append(ex, m_scaled_resolution, simplify_buf, simplified);
+        ExPolygons not_filled_exp = union_ex(simplified);
         // collapse too narrow infill areas
         coord_t min_perimeter_infill_spacing = coord_t(solid_infill_spacing * (1. - INSET_OVERLAP_TOLERANCE));
 
@@ -1893,8 +1948,51 @@ void PerimeterGenerator::process_arachne()
 
     // BBS: don't simplify too much which influence arc fitting when export gcode if arc_fitting is enabled
     double surface_simplify_resolution = (print_config->enable_arc_fitting && this->config->fuzzy_skin == FuzzySkinType::None) ? 0.2 * m_scaled_resolution : m_scaled_resolution;
+    // Generate the wall toolpaths of all islands of this layer concurrently up front.
+    // The assembly loop below has to stay serial (it appends to loops / gap fill / fill
+    // surfaces in island order), but the expensive part - the Arachne wall generation per
+    // island - is independent. Running it here populates the WallToolPaths memoization
+    // cache, which the loop below then hits, so output ordering stays exactly the same.
+    // Islands taking the only_one_wall_top path are skipped, their input depends on
+    // stateful top-surface splitting.
+    if (this->slices->surfaces.size() > 1) {
+        Arachne::WallToolPathsParams warm_params = Arachne::make_paths_params(this->layer_id, *object_config, *print_config);
+        warm_params.throw_on_cancel = this->throw_on_cancel;
+        tbb::parallel_for(tbb::blocked_range<size_t>(0, this->slices->surfaces.size(), 1),
+            [this, perimeter_spacing, ext_perimeter_width, ext_perimeter_spacing, surface_simplify_resolution, &warm_params](const tbb::blocked_range<size_t> &range) {
+                MutablePolygon simplify_buf;
+                Polygons       simplified;
+                for (size_t surface_idx = range.begin(); surface_idx < range.end(); ++ surface_idx) {
+                    const Surface &surface = this->slices->surfaces[surface_idx];
+                    coord_t bead_width_0 = ext_perimeter_spacing;
+                    if (config->precise_outer_wall)
+                        bead_width_0 = ext_perimeter_width + this->perimeter_flow.scaled_width() - perimeter_spacing;
+                    int loop_number = this->config->wall_loops + surface.extra_perimeters - 1;
+                    if (this->layer_id == 0 && this->config->only_one_wall_first_layer)
+                        loop_number = 0;
+                    if (loop_number > 0 && config->only_one_wall_top && this->upper_slices == nullptr)
+                        loop_number = 0;
+                    if (loop_number > 0 && config->only_one_wall_top && ! surface.is_bridge() && this->upper_slices != nullptr)
+                        // Keep in sync with the assembly loop below: this island's outline is
+                        // modified by split_top_surfaces() before wall generation.
+                        continue;
+                    simplified.clear();
+                    douglas_peucker_in_place_append(surface.expolygon, surface_simplify_resolution, simplify_buf, simplified);
+                    ExPolygons last = offset_ex(simplified,
+                                  config->precise_outer_wall ? -float(ext_perimeter_width / 2. - bead_width_0 / 2.)
+                                                             : -float(ext_perimeter_width / 2. - ext_perimeter_spacing / 2.));
+                    Polygons last_p = to_polygons(last);
+                    Arachne::WallToolPaths(last_p, bead_width_0, perimeter_spacing, coord_t(loop_number + 1),
+                                           coord_t(0), layer_height, warm_params).generate();
+                }
+            });
+    }
+
     // we need to process each island separately because we might have different
     // extra perimeters for each one
+    // Reused between the islands to avoid reallocating the simplification buffers per island.
+    MutablePolygon simplify_buf;
+    Polygons       simplified;
     for (const Surface& surface : this->slices->surfaces) {
         coord_t bead_width_0 = ext_perimeter_spacing;
         if (config->precise_outer_wall)
@@ -1906,11 +2004,14 @@ void PerimeterGenerator::process_arachne()
         // BBS: set the topmost layer to be one wall
         if (loop_number > 0 && config->only_one_wall_top && this->upper_slices == nullptr)
             loop_number = 0;
-        ExPolygons last = offset_ex(surface.expolygon.simplify_p(surface_simplify_resolution),
+        simplified.clear();
+        douglas_peucker_in_place_append(surface.expolygon, surface_simplify_resolution, simplify_buf, simplified);
+        ExPolygons last = offset_ex(simplified,
                       config->precise_outer_wall ? -float(ext_perimeter_width / 2. - bead_width_0 / 2.)
                                                  : -float(ext_perimeter_width / 2. - ext_perimeter_spacing / 2.));
-        
+
         Arachne::WallToolPathsParams input_params = Arachne::make_paths_params(this->layer_id, *object_config, *print_config);
+        input_params.throw_on_cancel = this->throw_on_cancel;
         coord_t wall_0_inset = 0;
         //if (config->precise_outer_wall)
         //    wall_0_inset = 0.5 * (ext_perimeter_width + this->perimeter_flow.scaled_width() - ext_perimeter_spacing -
@@ -2261,10 +2362,10 @@ void PerimeterGenerator::process_arachne()
 
         inset = coord_t(scale_(this->config->infill_wall_overlap.get_abs_value(unscale<double>(inset))));
         // simplify infill contours according to resolution
-        Polygons pp;
+        simplified.clear();
         for (ExPolygon& ex : infill_contour)
-            ex.simplify_p(m_scaled_resolution, &pp);
-        ExPolygons not_filled_exp = union_ex(pp);
+            douglas_peucker_in_place_append(ex, m_scaled_resolution, simplify_buf, simplified);
+        ExPolygons not_filled_exp = union_ex(simplified);
         // collapse too narrow infill areas
         const auto    min_perimeter_infill_spacing = coord_t(solid_infill_spacing * (1. - INSET_OVERLAP_TOLERANCE));
 
@@ -2,6 +2,7 @@
 #define slic3r_PerimeterGenerator_hpp_
 
 #include "libslic3r.h"
+#include <functional>
 #include <vector>
 #include "Flow.hpp"
 #include "Polygon.hpp"
@@ -25,6 +26,9 @@ public:
     const PrintRegionConfig     *config;
     const PrintObjectConfig     *object_config;
     const PrintConfig           *print_config;
+    // Optional, throws when the print job was canceled. Forwarded into the Arachne wall
+    // generator so that canceling does not wait for whole layers of wall generation to finish.
+    std::function<void()>        throw_on_cancel;
     // Outputs:
     ExtrusionEntityCollection   *loops;
     ExtrusionEntityCollection   *gap_fill;
@@ -1,6 +1,7 @@
 #include "PlaceholderParser.hpp"
 #include "Exception.hpp"
 #include "Flow.hpp"
+#include "LocalesUtils.hpp"
 #include <cstring>
 #include <ctime>
 #include <iomanip>
@@ -306,19 +307,10 @@ namespace client
             switch (this->type()) {
 			case TYPE_BOOL:   out = this->b() ? "true" : "false"; break;
             case TYPE_INT:    out = std::to_string(this->i()); break;
-            case TYPE_DOUBLE: 
-#if 0
-                // The default converter produces trailing zeros after the decimal point.
-				out = std::to_string(data.d);
-#else
-                // ostringstream default converter produces no trailing zeros after the decimal point.
-                // It seems to be doing what the old boost::to_string() did.
-				{
-					std::ostringstream ss;
-					ss << this->d();
-					out = ss.str();
-				}
-#endif
+            case TYPE_DOUBLE:
+                // Producing no trailing zeros after the decimal point, same as the ostringstream
+                // default converter did, but locale independent and without the stream setup cost.
+                out = float_to_string_decimal_point(this->d());
 				break;
             case TYPE_STRING: out = this->s(); break;
             default:          break;
@@ -1701,8 +1693,46 @@ static std::string process_macro(const std::string &templ, client::MyContext &co
     return output;
 }
 
+// Validate an UTF-8 string with the same (lax) rules as utf8_char_skipper_parser,
+// so that the fast path below accepts exactly the plain text the grammar would accept.
+static bool is_valid_utf8_text(const std::string &text)
+{
+    for (auto it = text.begin(); it != text.end();) {
+        unsigned char c = static_cast<unsigned char>(*it ++);
+        // UTF-8 sequence must not start with a continuation character.
+        if ((c & 0xC0) == 0x80)
+            return false;
+        // If the most significant bit with a zero in it is in position
+        // 8-N then there are N bytes in this UTF-8 sequence.
+        unsigned char mask   = 0x80u;
+        unsigned int  result = 0;
+        while (c & mask) {
+            ++ result;
+            mask >>= 1;
+        }
+        unsigned int cnt = (result == 0) ? 1 : ((result > 4) ? 4 : result);
+        for (-- cnt; cnt > 0; -- cnt) {
+            if (it == text.end())
+                return false;
+            c = static_cast<unsigned char>(*it ++);
+            // We must have a continuation byte.
+            if (cnt > 1 && (c & 0xC0) != 0x80)
+                return false;
+        }
+    }
+    return true;
+}
+
 std::string PlaceholderParser::process(const std::string &templ, unsigned int current_extruder_id, const DynamicConfig *config_override, DynamicConfig *config_outputs, ContextData *context_data) const
 {
+    // Fast path: a template without '{' and '[' contains no macros nor legacy variable
+    // expansions, thus it is emitted verbatim and the spirit parser can be skipped.
+    // Custom layer change G-code is processed once per layer, so this saves a full parse
+    // per layer for the common plain-text templates. Templates failing the character
+    // validation take the slow path so that the parser reports its usual error.
+    if (templ.find_first_of("{[") == std::string::npos && is_valid_utf8_text(templ))
+        return templ;
+
     client::MyContext context;
     context.external_config 	= this->external_config();
     context.config              = &this->config();
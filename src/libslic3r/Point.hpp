@@ -511,6 +511,11 @@ template<class Tout = coord_t, class Tin, class = FloatingOnly<Tin>>
 inline constexpr ScaledCoordOnly<Tout> scaled(const Tin &v) noexcept
 {
     //return static_cast<Tout>(std::round(v / SCALING_FACTOR));
+    // Guard the conversion boundary in debug builds: with the 32bit coord_t the representable
+    // range at SCALING_FACTOR resolution is about +-2147mm, an overflowing input would wrap
+    // around silently.
+    assert(double(v) / SCALING_FACTOR >= double(std::numeric_limits<Tout>::lowest()) &&
+           double(v) / SCALING_FACTOR <= double(std::numeric_limits<Tout>::max()));
     return Tout(v / Tin(SCALING_FACTOR));
 }
 
@@ -523,6 +528,13 @@ template<class Tout = coord_t,
 inline Eigen::Matrix<ArithmeticOnly<Tout>, N, EigenArgs...>
 scaled(const Eigen::Matrix<Tin, N, EigenArgs...> &v)
 {
+#ifndef NDEBUG
+    if constexpr (std::is_integral<Tout>::value)
+        // See the range guard in the scalar integer overload above.
+        for (int i = 0; i < N; ++ i)
+            assert(double(v[i]) / SCALING_FACTOR >= double(std::numeric_limits<Tout>::lowest()) &&
+                   double(v[i]) / SCALING_FACTOR <= double(std::numeric_limits<Tout>::max()));
+#endif // NDEBUG
     return (v / SCALING_FACTOR).template cast<Tout>();
 }
 
@@ -0,0 +1,103 @@
+#include "PolylineJoin.hpp"
+
+#include <cmath>
+#include <unordered_map>
+#include <vector>
+
+namespace Slic3r {
+
+namespace {
+
+// Uniform grid hash over polyline end points. Entries are never removed, the indices of
+// consumed polylines are filtered out lazily when a cell is visited.
+struct EndPointGrid
+{
+    explicit EndPointGrid(coord_t cell_size) : m_cell_size(std::max(cell_size, coord_t(1))) {}
+
+    void insert(const Point &pt, size_t poly_idx) {
+        m_cells[key(cell_coord(pt.x()), cell_coord(pt.y()))].emplace_back(poly_idx);
+    }
+
+    // Visit the indices of all polylines with an end point possibly within cell_size of pt.
+    template<typename Visitor>
+    void visit_nearby(const Point &pt, Visitor &&visitor) const {
+        const coord_t cx = cell_coord(pt.x());
+        const coord_t cy = cell_coord(pt.y());
+        for (coord_t ix = cx - 1; ix <= cx + 1; ++ ix)
+            for (coord_t iy = cy - 1; iy <= cy + 1; ++ iy)
+                if (auto it = m_cells.find(key(ix, iy)); it != m_cells.end())
+                    for (size_t poly_idx : it->second)
+                        visitor(poly_idx);
+    }
+
+private:
+    // Floor division, the grid has to stay uniform across the origin.
+    coord_t         cell_coord(coord_t v) const { return (v >= 0 ? v : v - (m_cell_size - 1)) / m_cell_size; }
+    static uint64_t key(coord_t ix, coord_t iy) { return (uint64_t(uint32_t(ix)) << 32) | uint64_t(uint32_t(iy)); }
+
+    coord_t                                           m_cell_size;
+    std::unordered_map<uint64_t, std::vector<size_t>> m_cells;
+};
+
+} // namespace
+
+Polylines join_polylines(Polylines &&polylines, double join_distance)
+{
+    Polylines out;
+    out.reserve(polylines.size());
+
+    EndPointGrid grid(coord_t(std::ceil(join_distance)));
+    for (size_t i = 0; i < polylines.size(); ++ i)
+        if (! polylines[i].empty()) {
+            grid.insert(polylines[i].first_point(), i);
+            grid.insert(polylines[i].last_point(), i);
+        }
+
+    const double limit2 = join_distance * join_distance;
+    auto close = [limit2](const Point &a, const Point &b) { return (a - b).cast<double>().squaredNorm() < limit2; };
+
+    std::vector<bool> consumed(polylines.size(), false);
+    for (size_t seed = 0; seed < polylines.size(); ++ seed) {
+        if (consumed[seed] || polylines[seed].empty())
+            continue;
+        consumed[seed] = true;
+        Polyline chain = std::move(polylines[seed]);
+        for (;;) {
+            // Of all pieces joinable to either end of the chain, take the one with the lowest
+            // index to mirror the order a pairwise scan would have merged in.
+            size_t next_idx = size_t(-1);
+            auto   visitor  = [&polylines, &consumed, &chain, &close, &next_idx](size_t poly_idx) {
+                if (! consumed[poly_idx] && poly_idx < next_idx) {
+                    const Polyline &next = polylines[poly_idx];
+                    if (close(chain.last_point(),  next.first_point()) || close(chain.last_point(),  next.last_point()) ||
+                        close(chain.first_point(), next.last_point())  || close(chain.first_point(), next.first_point()))
+                        next_idx = poly_idx;
+                }
+            };
+            grid.visit_nearby(chain.last_point(), visitor);
+            grid.visit_nearby(chain.first_point(), visitor);
+            if (next_idx == size_t(-1))
+                break;
+            consumed[next_idx] = true;
+            Polyline &next = polylines[next_idx];
+            if (close(chain.last_point(), next.first_point()))
+                chain.append(std::move(next));
+            else if (close(chain.last_point(), next.last_point())) {
+                next.reverse();
+                chain.append(std::move(next));
+            } else if (close(chain.first_point(), next.last_point())) {
+                next.append(std::move(chain));
+                chain = std::move(next);
+                chain.reverse();
+            } else {
+                next.reverse();
+                next.append(std::move(chain));
+                chain = std::move(next);
+            }
+        }
+        out.emplace_back(std::move(chain));
+    }
+    return out;
+}
+
+} // namespace Slic3r
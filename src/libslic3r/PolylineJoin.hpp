@@ -0,0 +1,16 @@
+#ifndef slic3r_PolylineJoin_hpp_
+#define slic3r_PolylineJoin_hpp_
+
+#include "Polyline.hpp"
+
+namespace Slic3r {
+
+// Join polylines whose end points lie closer than join_distance into longer chains,
+// reversing the pieces as needed. The end points are indexed by a uniform grid hash,
+// therefore the pairing cost stays roughly linear in the number of polylines instead
+// of testing every pair. Empty input polylines are dropped.
+Polylines join_polylines(Polylines &&polylines, double join_distance);
+
+} // namespace Slic3r
+
+#endif // slic3r_PolylineJoin_hpp_
@@ -51,6 +51,10 @@
 #include <boost/locale.hpp>
 #include <boost/log/trivial.hpp>
 
+#include <cereal/archives/binary.hpp>
+#include <cereal/types/map.hpp>
+#include <cereal/types/string.hpp>
+
 #include "libslic3r.h"
 #include "Utils.hpp"
 #include "Time.hpp"
@@ -546,7 +550,7 @@ std::string Preset::label(bool no_alias) const
         + ((no_alias || this->alias.empty()) ? this->name : this->alias);
 }
 
-bool is_compatible_with_print(const PresetWithVendorProfile &preset, const PresetWithVendorProfile &active_print, const PresetWithVendorProfile &active_printer)
+bool is_compatible_with_print(const PresetWithVendorProfile &preset, const PresetWithVendorProfile &active_print, const PresetWithVendorProfile &active_printer, CompatibleConditionCache *condition_cache)
 {
 	if (preset.vendor != nullptr && preset.vendor != active_printer.vendor)
 		// The current profile has a vendor assigned and it is different from the active print's vendor.
@@ -555,13 +559,20 @@ bool is_compatible_with_print(const PresetWithVendorProfile &preset, const Prese
     auto *compatible_prints     = dynamic_cast<const ConfigOptionStrings*>(preset.preset.config.option("compatible_prints"));
     bool  has_compatible_prints = compatible_prints != nullptr && ! compatible_prints->values.empty();
     if (! has_compatible_prints && ! condition.empty()) {
+        if (condition_cache != nullptr)
+            if (auto it = condition_cache->find(condition); it != condition_cache->end())
+                return it->second;
+        bool result;
         try {
-            return PlaceholderParser::evaluate_boolean_expression(condition, active_print.preset.config);
+            result = PlaceholderParser::evaluate_boolean_expression(condition, active_print.preset.config);
         } catch (const std::runtime_error &err) {
             //FIXME in case of an error, return "compatible with everything".
             printf("Preset::is_compatible_with_print - parsing error of compatible_prints_condition %s:\n%s\n", active_print.preset.name.c_str(), err.what());
-            return true;
+            result = true;
         }
+        if (condition_cache != nullptr)
+            condition_cache->emplace(condition, result);
+        return result;
     }
     return preset.preset.is_default || active_print.preset.name.empty() || ! has_compatible_prints ||
         std::find(compatible_prints->values.begin(), compatible_prints->values.end(), active_print.preset.name) !=
@@ -583,7 +594,7 @@ bool is_compatible_with_parent_printer(const PresetWithVendorProfile& preset, co
                compatible_printers->values.end();
 }
 
-bool is_compatible_with_printer(const PresetWithVendorProfile &preset, const PresetWithVendorProfile &active_printer, const DynamicPrintConfig *extra_config)
+bool is_compatible_with_printer(const PresetWithVendorProfile &preset, const PresetWithVendorProfile &active_printer, const DynamicPrintConfig *extra_config, CompatibleConditionCache *condition_cache)
 {
 	if (preset.vendor != nullptr && preset.vendor != active_printer.vendor)
 		// The current profile has a vendor assigned and it is different from the active print's vendor.
@@ -592,13 +603,20 @@ bool is_compatible_with_printer(const PresetWithVendorProfile &preset, const Pre
     auto *compatible_printers     = dynamic_cast<const ConfigOptionStrings*>(preset.preset.config.option("compatible_printers"));
     bool  has_compatible_printers = compatible_printers != nullptr && ! compatible_printers->values.empty();
     if (! has_compatible_printers && ! condition.empty()) {
+        if (condition_cache != nullptr)
+            if (auto it = condition_cache->find(condition); it != condition_cache->end())
+                return it->second;
+        bool result;
         try {
-            return PlaceholderParser::evaluate_boolean_expression(condition, active_printer.preset.config, extra_config);
+            result = PlaceholderParser::evaluate_boolean_expression(condition, active_printer.preset.config, extra_config);
         } catch (const std::runtime_error &err) {
             //FIXME in case of an error, return "compatible with everything".
             printf("Preset::is_compatible_with_printer - parsing error of compatible_printers_condition %s:\n%s\n", active_printer.preset.name.c_str(), err.what());
-            return true;
+            result = true;
         }
+        if (condition_cache != nullptr)
+            condition_cache->emplace(condition, result);
+        return result;
     }
     return preset.preset.is_default || active_printer.preset.name.empty() || !has_compatible_printers ||
         std::find(compatible_printers->values.begin(), compatible_printers->values.end(), active_printer.preset.name) !=
@@ -727,7 +745,7 @@ static std::vector<std::string> s_Preset_print_options {
     "layer_height", "initial_layer_print_height", "wall_loops", "slice_closing_radius", "spiral_mode", "slicing_mode",
     "top_shell_layers", "top_shell_thickness", "bottom_shell_layers", "bottom_shell_thickness",
     "extra_perimeters_on_overhangs", "ensure_vertical_shell_thickness", "reduce_crossing_wall", "detect_thin_wall", "detect_overhang_wall", "overhang_reverse", "overhang_reverse_threshold","overhang_reverse_internal_only",
-    "seam_position", "staggered_inner_seams", "wall_infill_order", "sparse_infill_density", "sparse_infill_pattern", "top_surface_pattern", "bottom_surface_pattern",
+    "seam_position", "seam_visibility_triangle_budget", "staggered_inner_seams", "wall_infill_order", "sparse_infill_density", "sparse_infill_pattern", "top_surface_pattern", "bottom_surface_pattern",
     "infill_direction",
     "minimum_sparse_infill_area", "reduce_infill_retraction","internal_solid_infill_pattern",
     "ironing_type", "ironing_pattern", "ironing_flow", "ironing_speed", "ironing_spacing", "ironing_angle",
@@ -1010,6 +1028,76 @@ void PresetCollection::add_default_preset(const std::vector<std::string> &keys,
 
 // Load all presets found in dir_path.
 // Throws an exception on error.
+namespace {
+
+// Binary cache of the parsed preset files of one directory, cutting the json parsing out
+// of application startup. Configs are stored in the cereal format also used by the
+// undo/redo stack, which interns option keys as ConfigOptionDef serialization key
+// ordinals. Entries are validated against mtime and file size of their source json and
+// the whole cache is dropped on an application version or format change.
+constexpr std::uint32_t PRESET_CACHE_FORMAT_VERSION = 1;
+
+struct PresetCacheEntry
+{
+    std::int64_t  mtime { 0 };
+    std::uint64_t file_size { 0 };
+    DynamicPrintConfig config;
+    std::map<std::string, std::string> key_values;
+
+    template<class Archive> void serialize(Archive &ar) { ar(mtime, file_size, config, key_values); }
+};
+
+typedef std::map<std::string, PresetCacheEntry> PresetCacheMap;
+
+std::string preset_cache_path(const boost::filesystem::path &dir) { return (dir / ".presets.cache").string(); }
+
+PresetCacheMap load_preset_cache(const boost::filesystem::path &dir)
+{
+    PresetCacheMap cache;
+    boost::nowide::ifstream ifs(preset_cache_path(dir), std::ios::binary);
+    if (! ifs.good())
+        return cache;
+    try {
+        cereal::BinaryInputArchive archive(ifs);
+        std::uint32_t format_version = 0;
+        std::string   app_version;
+        archive(format_version, app_version);
+        if (format_version == PRESET_CACHE_FORMAT_VERSION && app_version == SLIC3R_VERSION)
+            archive(cache);
+    } catch (const std::exception &err) {
+        BOOST_LOG_TRIVIAL(warning) << boost::format("Failed loading preset cache %1%: %2%") % preset_cache_path(dir) % err.what();
+        cache.clear();
+    }
+    return cache;
+}
+
+void store_preset_cache(const boost::filesystem::path &dir, const PresetCacheMap &cache)
+{
+    try {
+        boost::nowide::ofstream ofs(preset_cache_path(dir), std::ios::binary | std::ios::trunc);
+        cereal::BinaryOutputArchive archive(ofs);
+        archive(PRESET_CACHE_FORMAT_VERSION, std::string(SLIC3R_VERSION));
+        archive(cache);
+    } catch (const std::exception &err) {
+        // The cache is an optimization only, the presets were loaded fine.
+        BOOST_LOG_TRIVIAL(warning) << boost::format("Failed storing preset cache %1%: %2%") % preset_cache_path(dir) % err.what();
+    }
+}
+
+// Only configs whose keys all carry a serialization key ordinal can be written into the
+// binary cache.
+bool preset_cache_storable(const DynamicPrintConfig &config)
+{
+    for (auto it = config.cbegin(); it != config.cend(); ++ it) {
+        const ConfigOptionDef *optdef = print_config_def.get(it->first);
+        if (optdef == nullptr || optdef->serialization_key_ordinal == 0)
+            return false;
+    }
+    return true;
+}
+
+} // namespace
+
 void PresetCollection::load_presets(
     const std::string &dir_path, const std::string &subdir,
     PresetsConfigSubstitutions& substitutions, ForwardCompatibilitySubstitutionRule substitution_rule)
@@ -1031,6 +1119,9 @@ void PresetCollection::load_presets(
     // Store the loaded presets into a new vector, otherwise the binary search for already existing presets would be broken.
     // (see the "Preset already present, not loading" message).
     std::deque<Preset> presets_loaded;
+    PresetCacheMap cache = load_preset_cache(dir);
+    PresetCacheMap new_cache;
+    size_t         cache_hits = 0;
     //BBS: change to json format
     for (auto &dir_entry : boost::filesystem::directory_iterator(dir))
     {
@@ -1060,7 +1151,23 @@ void PresetCollection::load_presets(
                     //ConfigSubstitutions config_substitutions = config.load_from_ini(preset.file, substitution_rule);
                     std::map<std::string, std::string> key_values;
                     std::string reason;
-                    ConfigSubstitutions config_substitutions = config.load_from_json(preset.file, substitution_rule, key_values, reason);
+                    ConfigSubstitutions config_substitutions;
+                    std::int64_t  file_mtime = (std::int64_t) boost::filesystem::last_write_time(dir_entry.path());
+                    std::uint64_t file_size  = (std::uint64_t) boost::filesystem::file_size(dir_entry.path());
+                    auto cache_it = cache.find(name);
+                    if (cache_it != cache.end() && cache_it->second.mtime == file_mtime && cache_it->second.file_size == file_size) {
+                        // The source file did not change since it was cached, skip the json parsing.
+                        config     = cache_it->second.config;
+                        key_values = cache_it->second.key_values;
+                        new_cache.insert({ name, std::move(cache_it->second) });
+                        ++ cache_hits;
+                    } else {
+                        config_substitutions = config.load_from_json(preset.file, substitution_rule, key_values, reason);
+                        // Only entries parsed cleanly and representable with interned keys go into
+                        // the cache, anything else is parsed from the source on every startup.
+                        if (reason.empty() && config_substitutions.empty() && preset_cache_storable(config))
+                            new_cache.insert({ name, PresetCacheEntry{ file_mtime, file_size, config, key_values } });
+                    }
                     if (! config_substitutions.empty())
                         substitutions.push_back({ preset.name, m_type, PresetConfigSubstitutions::Source::UserFile, preset.file, std::move(config_substitutions) });
                     if (!reason.empty()) {
@@ -1153,6 +1260,9 @@ void PresetCollection::load_presets(
             }
         }
     }
+    // Rewrite the cache only when something changed: a file was added, modified or removed.
+    if (cache_hits != cache.size() || new_cache.size() != cache.size())
+        store_preset_cache(dir, new_cache);
     if (presets_loaded.size() > 0)
         m_presets.insert(m_presets.end(), std::make_move_iterator(presets_loaded.begin()), std::make_move_iterator(presets_loaded.end()));
     std::sort(m_presets.begin() + m_num_default_presets, m_presets.end());
@@ -2284,6 +2394,11 @@ size_t PresetCollection::update_compatible_internal(const PresetWithVendorProfil
     if (opt)
         config.set_key_value("num_extruders", new ConfigOptionInt((int)static_cast<const ConfigOptionFloats*>(opt)->values.size()));
     bool some_compatible = false;
+    // The active printer and the extra config are fixed for the whole pass, so condition
+    // expressions shared by multiple presets only need to be evaluated once. Separate caches
+    // are used as the printer and print conditions are evaluated against different configs.
+    CompatibleConditionCache printer_condition_cache;
+    CompatibleConditionCache print_condition_cache;
     for (size_t idx_preset = m_num_default_presets; idx_preset < m_presets.size(); ++ idx_preset) {
         bool    selected        = idx_preset == m_idx_selected;
         Preset &preset_selected = m_presets[idx_preset];
@@ -2291,10 +2406,10 @@ size_t PresetCollection::update_compatible_internal(const PresetWithVendorProfil
 
         const PresetWithVendorProfile this_preset_with_vendor_profile = this->get_preset_with_vendor_profile(preset_edited);
         bool    was_compatible  = preset_edited.is_compatible;
-        preset_edited.is_compatible = is_compatible_with_printer(this_preset_with_vendor_profile, active_printer, &config);
+        preset_edited.is_compatible = is_compatible_with_printer(this_preset_with_vendor_profile, active_printer, &config, &printer_condition_cache);
         some_compatible |= preset_edited.is_compatible;
 	    if (active_print != nullptr)
-	        preset_edited.is_compatible &= is_compatible_with_print(this_preset_with_vendor_profile, *active_print, active_printer);
+	        preset_edited.is_compatible &= is_compatible_with_print(this_preset_with_vendor_profile, *active_print, active_printer, &print_condition_cache);
         if (! preset_edited.is_compatible && selected &&
         	(unselect_if_incompatible == PresetSelectCompatibleType::Always || (unselect_if_incompatible == PresetSelectCompatibleType::OnlyIfWasCompatible && was_compatible)))
             m_idx_selected = size_t(-1);
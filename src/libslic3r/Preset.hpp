@@ -337,8 +337,15 @@ protected:
     friend class        PresetBundle;
 };
 
-bool is_compatible_with_print  (const PresetWithVendorProfile &preset, const PresetWithVendorProfile &active_print, const PresetWithVendorProfile &active_printer);
-bool is_compatible_with_printer(const PresetWithVendorProfile &preset, const PresetWithVendorProfile &active_printer, const DynamicPrintConfig *extra_config);
+// Cache of compatibility condition expressions evaluated against one fixed active preset.
+// Vendor bundles reuse the same handful of condition strings across hundreds of presets,
+// so one PlaceholderParser evaluation per distinct string covers a whole update_compatible()
+// pass. The cached results are only valid for the active preset (and extra config) they were
+// evaluated against, therefore the cache is kept local to a single pass and never stored.
+using CompatibleConditionCache = std::map<std::string, bool>;
+
+bool is_compatible_with_print  (const PresetWithVendorProfile &preset, const PresetWithVendorProfile &active_print, const PresetWithVendorProfile &active_printer, CompatibleConditionCache *condition_cache = nullptr);
+bool is_compatible_with_printer(const PresetWithVendorProfile &preset, const PresetWithVendorProfile &active_printer, const DynamicPrintConfig *extra_config, CompatibleConditionCache *condition_cache = nullptr);
 bool is_compatible_with_printer(const PresetWithVendorProfile &preset, const PresetWithVendorProfile &active_printer);
 
 enum class PresetSelectCompatibleType {
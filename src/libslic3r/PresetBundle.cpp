@@ -1616,10 +1616,11 @@ void PresetBundle::set_calibrate_printer(std::string name)
     const ConfigOption *opt = active_printer.preset.config.option("nozzle_diameter");
     if (opt) config.set_key_value("num_extruders", new ConfigOptionInt((int) static_cast<const ConfigOptionFloats *>(opt)->values.size()));
     calibrate_filaments.clear();
+    CompatibleConditionCache condition_cache;
     for (size_t i = filaments.num_default_presets(); i < filaments.size(); ++i) {
         const Preset &                preset                          = filaments.m_presets[i];
         const PresetWithVendorProfile this_preset_with_vendor_profile = filaments.get_preset_with_vendor_profile(preset);
-        bool                          is_compatible                   = is_compatible_with_printer(this_preset_with_vendor_profile, active_printer, &config);
+        bool                          is_compatible                   = is_compatible_with_printer(this_preset_with_vendor_profile, active_printer, &config, &condition_cache);
         if (is_compatible) calibrate_filaments.insert(&preset);
     }
 }
@@ -45,6 +45,8 @@
 #include <algorithm>
 #include <limits>
 #include <unordered_set>
+
+#include <tbb/task_group.h>
 #include <boost/filesystem/path.hpp>
 #include <boost/format.hpp>
 #include <boost/log/trivial.hpp>
@@ -87,6 +89,36 @@ void Print::clear()
 
 // Called by Print::apply().
 // This method only accepts PrintConfig option keys.
+const char* print_step_name(PrintStep step)
+{
+    switch (step) {
+    case psWipeTower:     return "wipe_tower";
+    case psSkirtBrim:     return "skirt_brim";
+    case psGCodeExport:   return "gcode_export";
+    case psConflictCheck: return "conflict_check";
+    default:              return "unknown";
+    }
+}
+
+const char* print_object_step_name(PrintObjectStep step)
+{
+    switch (step) {
+    case posSlice:                    return "slice";
+    case posPerimeters:               return "perimeters";
+    case posEstimateCurledExtrusions: return "estimate_curled_extrusions";
+    case posPrepareInfill:            return "prepare_infill";
+    case posInfill:                   return "infill";
+    case posIroning:                  return "ironing";
+    case posSupportMaterial:          return "support_material";
+    case posSimplifyPath:             return "simplify_path";
+    case posSimplifySupportPath:      return "simplify_support_path";
+    case posDetectOverhangsForLift:   return "detect_overhangs_for_lift";
+    case posSimplifyWall:             return "simplify_wall";
+    case posSimplifyInfill:           return "simplify_infill";
+    default:                          return "unknown";
+    }
+}
+
 bool Print::invalidate_state_by_config_options(const ConfigOptionResolver & /* new_config */, const std::vector<t_config_option_key> &opt_keys)
 {
     if (opt_keys.empty())
@@ -140,7 +172,7 @@ bool Print::invalidate_state_by_config_options(const ConfigOptionResolver & /* n
         "bridge_acceleration",
         "travel_acceleration",
         "sparse_infill_acceleration",
-        "internal_solid_infill_acceleration"
+        "internal_solid_infill_acceleration",
         // BBS
         "cool_plate_temp_initial_layer",
         "eng_plate_temp_initial_layer",
@@ -213,7 +245,14 @@ bool Print::invalidate_state_by_config_options(const ConfigOptionResolver & /* n
     std::vector<PrintObjectStep> osteps;
     bool invalidated = false;
 
+    //BBS: report which changed option invalidated which step, so that overly coarse
+    // entries in the tables below (or options falling into the invalidate-all fallback)
+    // can be spotted from the logs.
+    std::string report;
+
     for (const t_config_option_key &opt_key : opt_keys) {
+        const size_t steps_before  = steps.size();
+        const size_t osteps_before = osteps.size();
         if (steps_gcode.find(opt_key) != steps_gcode.end()) {
             // These options only affect G-code export or they are just notes without influence on the generated G-code,
             // so there is nothing to invalidate.
@@ -325,11 +364,20 @@ bool Print::invalidate_state_by_config_options(const ConfigOptionResolver & /* n
         } else {
             // for legacy, if we can't handle this option let's invalidate all steps
             //FIXME invalidate all steps of all objects as well?
+            BOOST_LOG_TRIVIAL(warning) << "Print::invalidate_state_by_config_options(): \"" << opt_key
+                << "\" is not listed in the invalidation table, invalidating all steps";
             invalidated |= this->invalidate_all_steps();
             // Continue with the other opt_keys to possibly invalidate any object specific steps.
         }
+        for (size_t i = steps_before; i < steps.size(); ++ i)
+            report += std::string(" ") + opt_key + "->" + print_step_name(steps[i]);
+        for (size_t i = osteps_before; i < osteps.size(); ++ i)
+            report += std::string(" ") + opt_key + "->" + print_object_step_name(osteps[i]);
     }
 
+    if (! report.empty())
+        BOOST_LOG_TRIVIAL(debug) << "Print config diff invalidates:" << report;
+
     sort_remove_duplicates(steps);
     for (PrintStep step : steps)
         invalidated |= this->invalidate_step(step);
@@ -1654,6 +1702,53 @@ void Print::process(long long *time_cost_with_cache, bool use_cache)
     if (m_objects.empty())
         return;
 
+    // Install the two-level progress model: weight the spans in between the coarse percent
+    // anchors reported by the milestones with workload metrics known up front, so that the
+    // reported progress is roughly linear in wall clock time and eta_seconds() can
+    // extrapolate a remaining time estimate from it.
+    {
+        double facets   = 0.;
+        double layers   = 0.;
+        bool   supports = false;
+        for (const PrintObject *obj : m_objects) {
+            facets   += double(obj->model_object()->facets_count());
+            layers   += unscale<double>(obj->height()) / std::max(obj->config().layer_height.value, double(EPSILON));
+            supports |= obj->config().enable_support.value || obj->config().enforce_support_layers.value > 0;
+        }
+        // Rough span costs in arbitrary units, only their ratios matter. To be tuned on the
+        // actual-vs-predicted log emitted after the G-code export.
+        const double cost_slice    = facets * 1e-6 + layers * 0.010;
+        const double cost_walls    = layers * 0.050;
+        const double cost_prepare  = layers * 0.020;
+        const double cost_infill   = layers * 0.040;
+        const double cost_support  = layers * (supports ? 0.040 : 0.005);
+        const double cost_skirt    = 1.;
+        const double cost_optimize = layers * 0.010;
+        const double cost_gcode    = layers * 0.060;
+        const double total = cost_slice + cost_walls + cost_prepare + cost_infill + cost_support + cost_skirt + cost_optimize + cost_gcode;
+        // The raw percents of the anchors are the ones the milestones report when starting
+        // the successor span, see the set_status() calls in PrintObject.cpp and GCode.cpp.
+        double acc = 0.;
+        std::vector<std::pair<int, double>> anchors;
+        anchors.emplace_back(0, 0.);
+        anchors.emplace_back(15,  (acc += cost_slice)    / total); // walls start
+        anchors.emplace_back(25,  (acc += cost_walls)    / total); // infill regions start
+        anchors.emplace_back(35,  (acc += cost_prepare)  / total); // infill toolpath start
+        anchors.emplace_back(50,  (acc += cost_infill)   / total); // support start
+        anchors.emplace_back(70,  (acc += cost_support)  / total); // skirt & brim start
+        anchors.emplace_back(75,  (acc += cost_skirt)    / total); // toolpath optimization start
+        anchors.emplace_back(80,  (acc += cost_optimize) / total); // G-code export start
+        anchors.emplace_back(100, 1.);
+        this->set_progress_model(std::move(anchors));
+    }
+
+    // The machine border is identical for every object on the plate. Compute it once here so
+    // the per-object support steps running in parallel below can query it read-only instead
+    // of each rebuilding the bed shape with the excluded areas.
+    m_plate_machine_border.contour = get_bed_shape_with_excluded_area(m_config);
+    m_plate_machine_border.holes.clear();
+    m_plate_machine_border.translate(Point(scale_(m_origin(0)), scale_(m_origin(1))));
+
     for (PrintObject *obj : m_objects)
         obj->clear_shared_object();
 
@@ -1752,71 +1847,57 @@ void Print::process(long long *time_cost_with_cache, bool use_cache)
     BOOST_LOG_TRIVIAL(info) << __FUNCTION__ << boost::format(": total object counts %1% in current print, need to slice %2%")%m_objects.size()%need_slicing_objects.size();
     BOOST_LOG_TRIVIAL(info) << "Starting the slicing process." << log_memory_info();
     if (!use_cache) {
-        for (PrintObject *obj : m_objects) {
-            if (need_slicing_objects.count(obj) != 0) {
-                obj->make_perimeters();
-            }
-            else {
-                if (obj->set_started(posSlice))
-                    obj->set_done(posSlice);
-                if (obj->set_started(posPerimeters))
-                    obj->set_done(posPerimeters);
-            }
-        }
-        for (PrintObject *obj : m_objects) {
-            if (need_slicing_objects.count(obj) != 0) {
-                obj->estimate_curled_extrusions();
-            }
-            else {
-                if (obj->set_started(posEstimateCurledExtrusions))
-                    obj->set_done(posEstimateCurledExtrusions);
-            }
-        }
-        for (PrintObject *obj : m_objects) {
-            if (need_slicing_objects.count(obj) != 0) {
-                obj->infill();
-            }
-            else {
-                if (obj->set_started(posPrepareInfill))
-                    obj->set_done(posPrepareInfill);
-                if (obj->set_started(posInfill))
-                    obj->set_done(posInfill);
-            }
-        }
-        for (PrintObject *obj : m_objects) {
-            if (need_slicing_objects.count(obj) != 0) {
-                obj->ironing();
-            }
-            else {
-                if (obj->set_started(posIroning))
-                    obj->set_done(posIroning);
-            }
-        }
-
-        tbb::parallel_for(tbb::blocked_range<int>(0, int(m_objects.size())),
-            [this, need_slicing_objects](const tbb::blocked_range<int>& range) {
-                for (int i = range.begin(); i < range.end(); i++) {
-                    PrintObject* obj = m_objects[i];
-                    if (need_slicing_objects.count(obj) != 0) {
+        // Each of the following steps only depends on earlier steps of the same object,
+        // so instead of walking the objects step by step (which leaves cores idle on the
+        // sync gap at the end of each step's internal parallel_for), run one task per
+        // object executing its whole step chain. The per-layer parallel loops inside the
+        // steps nest under TBB's work stealing, so a plate of many small objects keeps
+        // all cores busy while a single large object still parallelizes per layer.
+        tbb::task_group object_steps_tg;
+        try {
+            for (PrintObject *obj : m_objects) {
+                if (need_slicing_objects.count(obj) != 0) {
+                    object_steps_tg.run([obj, &object_steps_tg]() {
+                        obj->make_perimeters();
+                        // The curled extrusion estimation only needs the perimeters and its result
+                        // (per layer curled_lines) is not consumed before the G-code export, so
+                        // run it overlapped with the remaining steps of this object.
+                        object_steps_tg.run([obj]() { obj->estimate_curled_extrusions(); });
+                        obj->infill();
+                        obj->ironing();
                         obj->generate_support_material();
-                    }
-                    else {
-                        if (obj->set_started(posSupportMaterial))
-                            obj->set_done(posSupportMaterial);
-                    }
+                        obj->detect_overhangs_for_lift();
+                    });
+                }
+                else {
+                    if (obj->set_started(posSlice))
+                        obj->set_done(posSlice);
+                    if (obj->set_started(posPerimeters))
+                        obj->set_done(posPerimeters);
+                    if (obj->set_started(posEstimateCurledExtrusions))
+                        obj->set_done(posEstimateCurledExtrusions);
+                    if (obj->set_started(posPrepareInfill))
+                        obj->set_done(posPrepareInfill);
+                    if (obj->set_started(posInfill))
+                        obj->set_done(posInfill);
+                    if (obj->set_started(posIroning))
+                        obj->set_done(posIroning);
+                    if (obj->set_started(posSupportMaterial))
+                        obj->set_done(posSupportMaterial);
+                    if (obj->set_started(posDetectOverhangsForLift))
+                        obj->set_done(posDetectOverhangsForLift);
                 }
             }
-        );
-
-        for (PrintObject* obj : m_objects) {
-            if (need_slicing_objects.count(obj) != 0) {
-                obj->detect_overhangs_for_lift();
-            }
-            else {
-                if (obj->set_started(posDetectOverhangsForLift))
-                    obj->set_done(posDetectOverhangsForLift);
-            }
+        } catch (...) {
+            // Wait out the running tasks before unwinding (e.g. on cancellation),
+            // the task group must not be destroyed with tasks still running.
+            object_steps_tg.cancel();
+            object_steps_tg.wait();
+            throw;
         }
+        // wait() rethrows the first exception raised inside a task (CanceledException,
+        // SlicingError, ...) after the group has been canceled and drained.
+        object_steps_tg.wait();
     }
     else {
         for (PrintObject *obj : m_objects) {
@@ -2000,6 +2081,12 @@ void Print::process(long long *time_cost_with_cache, bool use_cache)
         }
     }
 
+    if (const auto sink_stats = ClipperUtils::sink_stats(); sink_stats.calls > 0)
+        BOOST_LOG_TRIVIAL(debug) << boost::format("Clipper sink overloads: %1% calls appended %2% expolygons without a returned temporary") % sink_stats.calls % sink_stats.expolygons;
+    if (const auto pool_stats = ClipperLib::pool_stats(); pool_stats.outpt_chunk_hits + pool_stats.outpt_chunk_misses > 0)
+        BOOST_LOG_TRIVIAL(debug) << boost::format("Clipper output pools: OutPt chunks %1% recycled / %2% allocated, OutRecs %3% recycled / %4% allocated")
+            % pool_stats.outpt_chunk_hits % pool_stats.outpt_chunk_misses % pool_stats.outrec_hits % pool_stats.outrec_misses;
+
     BOOST_LOG_TRIVIAL(info) << "Slicing process finished." << log_memory_info();
 }
 
@@ -2030,6 +2117,9 @@ std::string Print::export_gcode(const std::string& path_template, GCodeProcessor
     gcode.do_export(this, path.c_str(), result, thumbnail_cb);
     //BBS
     result->conflict_result = m_conflict_result;
+    // The G-code export is the last consumer of the progress model installed by process(),
+    // report how well the model matched this run.
+    this->log_progress_model_accuracy();
     return path.c_str();
 }
 
@@ -2059,27 +2149,36 @@ void Print::_make_skirt()
     // BBS
     std::map<PrintObject*, Polygon> object_convex_hulls;
     for (PrintObject *object : m_objects) {
-        Points object_points;
-        // Get object layers up to skirt_height_z.
-        for (const Layer *layer : object->m_layers) {
-            if (layer->print_z > skirt_height_z)
-                break;
-            for (const ExPolygon &expoly : layer->lslices)
-                // Collect the outer contour points only, ignore holes for the calculation of the convex hull.
-                append(object_points, expoly.contour.points);
-        }
-        // Get support layers up to skirt_height_z.
-        for (const SupportLayer *layer : object->support_layers()) {
-            if (layer->print_z > skirt_height_z)
-                break;
-            layer->support_fills.collect_points(object_points);
+        // The collected points are object-local, instance shifts are applied below.
+        // Cache the convex hull on the object, so that a pure instance move, which only
+        // invalidates psSkirtBrim, does not recollect the outlines of the whole plate.
+        if (object->m_skirt_hull_cache_height != skirt_height_z) {
+            Points object_points;
+            // Get object layers up to skirt_height_z.
+            for (const Layer *layer : object->m_layers) {
+                if (layer->print_z > skirt_height_z)
+                    break;
+                for (const ExPolygon &expoly : layer->lslices)
+                    // Collect the outer contour points only, ignore holes for the calculation of the convex hull.
+                    append(object_points, expoly.contour.points);
+            }
+            // Get support layers up to skirt_height_z.
+            for (const SupportLayer *layer : object->support_layers()) {
+                if (layer->print_z > skirt_height_z)
+                    break;
+                layer->support_fills.collect_points(object_points);
+            }
+            object->m_skirt_hull_cache        = Slic3r::Geometry::convex_hull(object_points);
+            object->m_skirt_hull_cache_height = skirt_height_z;
         }
+        const Polygon &hull = object->m_skirt_hull_cache;
 
-        object_convex_hulls.insert({ object, Slic3r::Geometry::convex_hull(object_points) });
+        object_convex_hulls.insert({ object, hull });
 
-        // Repeat points for each object copy.
+        // Repeat the hull points for each object copy. The convex hull of the shifted
+        // hulls equals the convex hull of all the shifted outline points.
         for (const PrintInstance &instance : object->instances()) {
-            Points copy_points = object_points;
+            Points copy_points = hull.points;
             for (Point &pt : copy_points)
                 pt += instance.shift;
             append(points, copy_points);
@@ -2755,6 +2854,13 @@ std::string PrintStatistics::finalize_output_path(const std::string &path_in) co
 #define JSON_ARC_FITTING            "arc_fitting"
 #define JSON_OBJECT_NAME            "name"
 #define JSON_IDENTIFY_ID          "identify_id"
+#define JSON_OBJECT_CONFIG_HASH   "object_config_hash"
+
+//BBS: meta data of the cached slicing data directory, used to decide whether
+// the cache of a previous session may still be used
+#define JSON_CACHE_INFO_FILE        "cache_info.json"
+#define JSON_CACHE_SLICER_VERSION   "slicer_version"
+#define JSON_CACHE_CONFIG_HASH      "config_hash"
 
 
 #define JSON_LAYERS                  "layers"
@@ -3385,6 +3491,8 @@ static void convert_layer_region_from_json(const json& j, LayerRegion& layer_reg
             throw Slic3r::FileIOError(error_buf);
         }
     }
+    // The cached fill classification is not serialized, rebuild it from the restored fills.
+    layer_region.classify_fills();
 
     return;
 }
@@ -3493,6 +3601,24 @@ static void from_json(const json& j, groupedVolumeSlices& firstlayer_group)
     }
 }
 
+//BBS: fingerprint of the configuration state the cached slicing data was produced with.
+// Per-region configs are already validated region by region when loading (see find_region
+// in load_cached_data), per-object configs per object file; this hash covers the print
+// config and the object / region config defaults the others are derived from.
+void Print::release_intermediate_geometry()
+{
+    for (PrintObject *obj : m_objects)
+        obj->release_intermediate_geometry();
+}
+
+size_t Print::cache_config_fingerprint() const
+{
+    size_t seed = m_config.hash();
+    boost::hash_combine(seed, m_default_object_config.hash());
+    boost::hash_combine(seed, m_default_region_config.hash());
+    return seed;
+}
+
 int Print::export_cached_data(const std::string& directory, bool with_space)
 {
     int ret = 0;
@@ -3580,6 +3706,7 @@ int Print::export_cached_data(const std::string& directory, bool with_space)
 
             root_json[JSON_OBJECT_NAME] = model_obj->name;
             root_json[JSON_IDENTIFY_ID] = identify_id;
+            root_json[JSON_OBJECT_CONFIG_HASH] = obj->config().hash();
 
             //export the layers
             std::vector<json> layers_json_vector(obj->layer_count());
@@ -3756,6 +3883,24 @@ int Print::export_cached_data(const std::string& directory, bool with_space)
         }
     );
 
+    //BBS: record the fingerprint of the state the data was produced with, so that a later
+    // session can tell whether the cache is still usable before deserializing any of it
+    if (!ret) {
+        try {
+            json info_json;
+            info_json[JSON_CACHE_SLICER_VERSION] = std::string(SLIC3R_VERSION);
+            info_json[JSON_CACHE_CONFIG_HASH]    = this->cache_config_fingerprint();
+            boost::nowide::ofstream c;
+            c.open(directory + "/" + JSON_CACHE_INFO_FILE, std::ios::out | std::ios::trunc);
+            c << std::setw(4) << info_json << std::endl;
+            c.close();
+        }
+        catch(std::exception &err) {
+            BOOST_LOG_TRIVIAL(error) << __FUNCTION__<< ": save cache info got a generic exception, reason = " << err.what();
+            ret = CLI_EXPORT_CACHE_WRITE_FAILED;
+        }
+    }
+
     BOOST_LOG_TRIVIAL(info) << __FUNCTION__<< boost::format(": total printobject count %1%, saved %2%, ret=%3%")%m_objects.size() %count %ret;
     return ret;
 }
@@ -3771,6 +3916,36 @@ int Print::load_cached_data(const std::string& directory)
         return CLI_IMPORT_CACHE_NOT_FOUND;
     }
 
+    //BBS: refuse the cached data when it was produced by a different slicer version or under
+    // a different configuration; the deserialized step results would silently not match the
+    // current settings. The fingerprint check makes reusing a cache across sessions safe.
+    {
+        std::string info_file = directory + "/" + JSON_CACHE_INFO_FILE;
+        if (!fs::exists(info_file)) {
+            BOOST_LOG_TRIVIAL(info) << __FUNCTION__<< boost::format(": no %1% under %2%, can not verify the cache, refuse to use it")%JSON_CACHE_INFO_FILE %directory;
+            return CLI_IMPORT_CACHE_DATA_CAN_NOT_USE;
+        }
+        try {
+            json info_json;
+            boost::nowide::ifstream ifs(info_file);
+            ifs >> info_json;
+            std::string cached_version = info_json.at(JSON_CACHE_SLICER_VERSION);
+            size_t      cached_hash    = info_json.at(JSON_CACHE_CONFIG_HASH);
+            if (cached_version != SLIC3R_VERSION) {
+                BOOST_LOG_TRIVIAL(info) << __FUNCTION__<< boost::format(": cache was produced by version %1%, current %2%, refuse to use it")%cached_version %SLIC3R_VERSION;
+                return CLI_IMPORT_CACHE_DATA_CAN_NOT_USE;
+            }
+            if (cached_hash != this->cache_config_fingerprint()) {
+                BOOST_LOG_TRIVIAL(info) << __FUNCTION__<< boost::format(": config fingerprint changed since the cache was produced, refuse to use it");
+                return CLI_IMPORT_CACHE_DATA_CAN_NOT_USE;
+            }
+        }
+        catch(std::exception &err) {
+            BOOST_LOG_TRIVIAL(error) << __FUNCTION__<< ": parse "<<info_file<<" got a generic exception, reason = " << err.what();
+            return CLI_IMPORT_CACHE_LOAD_FAILED;
+        }
+    }
+
     auto find_region = [this](PrintObject* object, size_t config_hash) -> const PrintRegion* {
         int regions_count = object->num_printing_regions();
         for (int index = 0; index < regions_count; index++ )
@@ -3845,6 +4020,11 @@ int Print::load_cached_data(const std::string& directory)
 
             std::string name = root_json.at(JSON_OBJECT_NAME);
             int identify_id = root_json.at(JSON_IDENTIFY_ID);
+            //BBS: per-object config overrides are not covered by the directory fingerprint, verify them here
+            if (size_t cached_config_hash = root_json.value(JSON_OBJECT_CONFIG_HASH, (size_t)0); cached_config_hash != obj->config().hash()) {
+                BOOST_LOG_TRIVIAL(info) << __FUNCTION__<< boost::format(": object %1%'s config changed since the cache was produced, refuse to use it")%name;
+                return CLI_IMPORT_CACHE_DATA_CAN_NOT_USE;
+            }
             int layer_count = 0, support_layer_count = 0, firstlayer_group_count = 0;
 
             layer_count = root_json[JSON_LAYERS].size();
@@ -97,6 +97,15 @@ enum PrintObjectStep {
     posCount,
 };
 
+// Names of the steps above, for logging / debugging purposes.
+const char* print_step_name(PrintStep step);
+const char* print_object_step_name(PrintObjectStep step);
+
+// Step names for the pipeline trace events, found by argument dependent lookup
+// from the PrintBaseWithState / PrintObjectBaseWithState step state machines.
+inline const char* trace_step_name(PrintStep step)       { return print_step_name(step); }
+inline const char* trace_step_name(PrintObjectStep step) { return print_object_step_name(step); }
+
 // A PrintRegion object represents a group of volumes to print
 // sharing the same config (including the same assigned extruder(s))
 class PrintRegion
@@ -355,6 +364,13 @@ public:
     size_t 			total_layer_count() const { return this->layer_count() + this->support_layer_count(); }
     size_t 			layer_count() const { return m_layers.size(); }
     void 			clear_layers();
+    // Drop per-layer geometry that was only consumed by the slicing milestones themselves
+    // and that the G-code export will not read again (thin fills were already copied into
+    // the fills, fill expolygons, overhang detection data ...). Only safe once no milestone
+    // of this PrintObject will be invalidated and re-run and the slicing data cache will not
+    // be exported, thus it is called from the CLI batch pipeline only, where it lowers the
+    // peak memory of exporting G-code of large plates.
+    void 			release_intermediate_geometry();
     const Layer* 	get_layer(int idx) const { return m_layers[idx]; }
     Layer* 			get_layer(int idx) 		 { return m_layers[idx]; }
     // Get a layer exactly at print_z.
@@ -453,12 +469,19 @@ public:
     PrintBase::ApplyStatus  set_instances(PrintInstances &&instances);
     // Invalidates the step, and its depending steps in PrintObject and Print.
     bool                    invalidate_step(PrintObjectStep step);
+    // Invalidates the step and its depending steps, recording that only the given Z span of the
+    // step's result went stale. posPerimeters and posInfill consume the recorded ranges, see
+    // make_perimeters() and infill().
+    bool                    invalidate_step_with_z_range(PrintObjectStep step, const t_layer_height_range &z_range);
     // Invalidates all PrintObject and Print steps.
     bool                    invalidate_all_steps();
     // Invalidate steps based on a set of parameters changed.
     // It may be called for both the PrintObjectConfig and PrintRegionConfig.
+    // If dirty_z_range is provided, the changed options are known to only affect the given
+    // Z span (a layer range config override), which allows partial regeneration of some steps.
     bool                    invalidate_state_by_config_options(
-        const ConfigOptionResolver &old_config, const ConfigOptionResolver &new_config, const std::vector<t_config_option_key> &opt_keys);
+        const ConfigOptionResolver &old_config, const ConfigOptionResolver &new_config, const std::vector<t_config_option_key> &opt_keys,
+        const t_layer_height_range *dirty_z_range = nullptr);
     // If ! m_slicing_params.valid, recalculate.
     void                    update_slicing_parameters();
 
@@ -495,6 +518,15 @@ private:
         const std::vector<std::pair<const Surface*, float>>& surfaces_w_bottom_z) const;
     FillLightning::GeneratorPtr prepare_lightning_infill_data();
 
+    // Whether any printing region uses a fill pattern generated from one object-global
+    // structure (the lightning tree, the adaptive cubic octree). Such fills cannot be
+    // regenerated for a Z band only, see invalidate_step_with_z_range().
+    bool has_globally_coupled_infill() const;
+    // Pad a dirty Z span by the vertical reach of prepare_infill()'s cross-layer logic,
+    // so that layers whose fill surfaces may be reclassified because of a change inside
+    // the span get their fills regenerated as well.
+    t_layer_height_range pad_dirty_z_range_by_infill_reach(const t_layer_height_range &z_range) const;
+
     // BBS
     SupportNecessaryType is_support_necessary();
 
@@ -519,6 +551,14 @@ private:
     // BBS
     std::shared_ptr<TreeSupportData>        m_tree_support_preview_cache;
 
+    // Object-local convex hull of the layer outlines and support extrusions up to
+    // m_skirt_hull_cache_height, feeding Print::_make_skirt(). Instance shifts are
+    // applied by the caller, thus the cache survives pure instance moves, which only
+    // invalidate psSkirtBrim. Dropped together with the slices / supports it was built from.
+    Polygon                                 m_skirt_hull_cache;
+    coordf_t                                m_skirt_hull_cache_height { -1. };
+    void clear_skirt_hull_cache() { m_skirt_hull_cache.clear(); m_skirt_hull_cache_height = -1.; }
+
     // this is set to true when LayerRegion->slices is split in top/internal/bottom
     // so that next call to make_perimeters() performs a union() before computing loops
     bool                    				m_typed_slices = false;
@@ -820,6 +860,9 @@ public:
     //return 0 means successful
     int                 export_cached_data(const std::string& dir_path, bool with_space=false);
     int                 load_cached_data(const std::string& directory);
+    // Free per-layer geometry that the G-code export does not read, on all print objects.
+    // See PrintObject::release_intermediate_geometry() for when this is safe to call.
+    void                release_intermediate_geometry();
 
     // methods for handling state
     bool                is_step_done(PrintStep step) const { return Inherited::is_step_done(step); }
@@ -902,6 +945,11 @@ public:
     //BBS: plate's origin related functions
     void set_plate_origin(Vec3d origin) { m_origin = origin; }
     const Vec3d get_plate_origin() const { return m_origin; }
+    // Plate-level machine border (bed shape with the excluded areas cut away, shifted to the
+    // plate origin). Computed once per process() run and queried read-only by the per-object
+    // support steps, so that each object does not rebuild it on its own. Empty until process()
+    // prepared it.
+    const ExPolygon& plate_machine_border() const { return m_plate_machine_border; }
     //BBS: export gcode from previous gcode file from 3mf
     void set_gcode_file_ready();
     void set_gcode_file_invalidated();
@@ -958,6 +1006,10 @@ private:
     //BBS
     static StringObjectException check_multi_filament_valid(const Print &print);
 
+    //BBS: fingerprint of the configuration state, used to validate cached slicing data
+    // (export_cached_data / load_cached_data) across sessions.
+    size_t              cache_config_fingerprint() const;
+
     bool                invalidate_state_by_config_options(const ConfigOptionResolver &new_config, const std::vector<t_config_option_key> &opt_keys);
 
     void                _make_skirt();
@@ -999,6 +1051,8 @@ private:
 
     //BBS: plate's origin
     Vec3d   m_origin;
+    // Shared plate-level machine border for the support steps, see plate_machine_border().
+    ExPolygon m_plate_machine_border;
     //BBS: modified_count
     int     m_modified_count {0};
     //BBS
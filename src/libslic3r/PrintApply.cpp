@@ -52,8 +52,11 @@ namespace Slic3r {
             delete mv_with_status.first;
 }
 
-static inline void model_volume_list_copy_configs(ModelObject &model_object_dst, const ModelObject &model_object_src, const ModelVolumeType type)
+// Returns true if any volume config differed (by its timestamp). The result feeds the fast path
+// deciding whether the print object regions need to be re-verified on this apply.
+static inline bool model_volume_list_copy_configs(ModelObject &model_object_dst, const ModelObject &model_object_src, const ModelVolumeType type)
 {
+    bool   configs_differed = false;
     size_t i_src, i_dst;
     for (i_src = 0, i_dst = 0; i_src < model_object_src.volumes.size() && i_dst < model_object_dst.volumes.size();) {
         const ModelVolume &mv_src = *model_object_src.volumes[i_src];
@@ -69,7 +72,10 @@ static inline void model_volume_list_copy_configs(ModelObject &model_object_dst,
         assert(mv_src.id() == mv_dst.id());
         // Copy the ModelVolume data.
         mv_dst.name   = mv_src.name;
-		mv_dst.config.assign_config(mv_src.config);
+        if (! mv_dst.config.timestamp_matches(mv_src.config)) {
+            mv_dst.config.assign_config(mv_src.config);
+            configs_differed = true;
+        }
         assert(mv_dst.supported_facets.id() == mv_src.supported_facets.id());
         mv_dst.supported_facets.assign(mv_src.supported_facets);
         assert(mv_dst.seam_facets.id() == mv_src.seam_facets.id());
@@ -81,11 +87,14 @@ static inline void model_volume_list_copy_configs(ModelObject &model_object_dst,
         ++ i_src;
         ++ i_dst;
     }
+    return configs_differed;
 }
 
-static inline void layer_height_ranges_copy_configs(t_layer_config_ranges &lr_dst, const t_layer_config_ranges &lr_src)
+// Returns true if any layer range config differed (by its timestamp), see model_volume_list_copy_configs().
+static inline bool layer_height_ranges_copy_configs(t_layer_config_ranges &lr_dst, const t_layer_config_ranges &lr_src)
 {
     assert(lr_dst.size() == lr_src.size());
+    bool configs_differed = false;
     auto it_src = lr_src.cbegin();
     for (auto &kvp_dst : lr_dst) {
         const auto &kvp_src = *it_src ++;
@@ -93,8 +102,12 @@ static inline void layer_height_ranges_copy_configs(t_layer_config_ranges &lr_ds
         assert(std::abs(kvp_dst.first.second - kvp_src.first.second) <= EPSILON);
         // Layer heights are allowed do differ in case the layer height table is being overriden by the smooth profile.
         // assert(std::abs(kvp_dst.second.option("layer_height")->getFloat() - kvp_src.second.option("layer_height")->getFloat()) <= EPSILON);
-        kvp_dst.second = kvp_src.second;
+        if (! kvp_dst.second.timestamp_matches(kvp_src.second)) {
+            kvp_dst.second = kvp_src.second;
+            configs_differed = true;
+        }
     }
+    return configs_differed;
 }
 
 static inline bool transform3d_lower(const Transform3d &lhs, const Transform3d &rhs)
@@ -129,6 +142,21 @@ struct PrintObjectTrafoAndInstances
     bool operator<(const PrintObjectTrafoAndInstances &rhs) const { return transform3d_lower(this->trafo, rhs.trafo); }
 };
 
+// Quantize a trafo for grouping instances into PrintObjects. Arrange and auto-orientation
+// produce rotations differing in the last few ulps between instances of the same part; the
+// exact element-wise comparison below then splits such instances into separate PrintObjects,
+// each sliced and supported from scratch. Snapping the matrix elements to a fixed 1e-9 grid
+// merges them; the resulting placement error is orders of magnitude below the G-code output
+// resolution.
+static inline Transform3d quantize_print_object_trafo(Transform3d trafo)
+{
+    typedef Transform3d::Scalar T;
+    T *v = trafo.data();
+    for (size_t i = 0; i < 16; ++ i, ++ v)
+        *v = std::round(*v * T(1e9)) * T(1e-9);
+    return trafo;
+}
+
 // Generate a list of trafos and XY offsets for instances of a ModelObject
 static std::vector<PrintObjectTrafoAndInstances> print_objects_from_model_object(const ModelObject &model_object)
 {
@@ -143,6 +171,9 @@ static std::vector<PrintObjectTrafoAndInstances> print_objects_from_model_object
             // Reset the XY axes of the transformation.
             trafo.trafo.data()[12] = 0;
             trafo.trafo.data()[13] = 0;
+            // Merge instances differing only by numerical noise into a single PrintObject,
+            // so repeated parts on a farm plate are sliced once and emitted per instance.
+            trafo.trafo = quantize_print_object_trafo(trafo.trafo);
             // Search or insert a trafo.
             auto it = trafos.emplace(trafo).first;
             const_cast<PrintObjectTrafoAndInstances&>(*it).instances.emplace_back(PrintInstance{ nullptr, model_instance, shift });
@@ -392,6 +423,11 @@ struct ModelObjectStatus {
     PrintObjectRegions                         *print_object_regions { nullptr };
     // Status of the above.
     PrintObjectRegionsStatus                    print_object_regions_status { PrintObjectRegionsStatus::Invalid };
+    // Set when synchronizing an otherwise unchanged ModelObject if any of its volume configs
+    // or layer range configs differed. If it stays false and the region config defaults did not
+    // change either, re-verifying the print object regions may be skipped altogether, which makes
+    // an apply() caused by a pure instance transform change nearly free.
+    bool                                        volume_or_range_configs_differ { false };
 
     // Search by id.
     bool operator<(const ModelObjectStatus &rhs) const { return id < rhs.id; }
@@ -697,7 +733,9 @@ bool verify_update_print_object_regions(
     size_t                              num_extruders,
     const std::vector<unsigned int>    &painting_extruders,
     PrintObjectRegions                 &print_object_regions,
-    const std::function<void(const PrintRegionConfig&, const PrintRegionConfig&, const t_config_option_keys&)> &callback_invalidate)
+    // Called with the Z span of the layer range the changed region belongs to, so the caller
+    // may invalidate just that Z span when the configs only differ inside a layer range override.
+    const std::function<void(const PrintRegionConfig&, const PrintRegionConfig&, const t_config_option_keys&, const t_layer_height_range&)> &callback_invalidate)
 {
     // Sort by ModelVolume ID.
     model_volumes_sort_by_id(model_volumes);
@@ -758,7 +796,7 @@ bool verify_update_print_object_regions(
                         // Region is referenced for the first time. Just change its parameters.
                         // Stop the background process before assigning new configuration to the regions.
                         t_config_option_keys diff = region.region->config().diff(cfg);
-                        callback_invalidate(region.region->config(), cfg, diff);
+                        callback_invalidate(region.region->config(), cfg, diff, layer_range.layer_height_range);
                         region.region->config_apply_only(cfg, diff, false);
                     } else {
                         // Region is referenced multiple times, thus the region is being split. We need to reslice.
@@ -783,7 +821,7 @@ bool verify_update_print_object_regions(
                     // Region is referenced for the first time. Just change its parameters.
                     // Stop the background process before assigning new configuration to the regions.
                     t_config_option_keys diff = region.region->config().diff(cfg);
-                    callback_invalidate(region.region->config(), cfg, diff);
+                    callback_invalidate(region.region->config(), cfg, diff, layer_range.layer_height_range);
                     region.region->config_apply_only(cfg, diff, false);
                 } else {
                     // Region is referenced multiple times, thus the region is being split. We need to reslice.
@@ -1070,6 +1108,10 @@ Print::ApplyStatus Print::apply(const Model &model, DynamicPrintConfig new_full_
     // which should be stopped if print_diff is not empty.
     size_t num_extruders  = m_config.filament_diameter.size();
     bool   num_extruders_changed  = false;
+    // Whether the region config defaults may have changed on this apply. Together with the
+    // per-object volume_or_range_configs_differ flags this decides whether the print object
+    // regions of unchanged objects need to be re-verified at all.
+    bool   region_defaults_changed = ! region_diff.empty();
     if (! full_config_diff.empty()) {
         //BBS: add more logs
         BOOST_LOG_TRIVIAL(info) << __FUNCTION__ << boost::format(" %1%: found full_config_diff changed.")%__LINE__;
@@ -1292,9 +1334,9 @@ Print::ApplyStatus Print::apply(const Model &model, DynamicPrintConfig new_full_
             }
             // Synchronize (just copy) the remaining data of ModelVolumes (name, config, custom supports data).
             //FIXME What to do with m_material_id?
-			model_volume_list_copy_configs(model_object /* dst */, model_object_new /* src */, ModelVolumeType::MODEL_PART);
-			model_volume_list_copy_configs(model_object /* dst */, model_object_new /* src */, ModelVolumeType::PARAMETER_MODIFIER);
-            layer_height_ranges_copy_configs(model_object.layer_config_ranges /* dst */, model_object_new.layer_config_ranges /* src */);
+			model_object_status.volume_or_range_configs_differ |= model_volume_list_copy_configs(model_object /* dst */, model_object_new /* src */, ModelVolumeType::MODEL_PART);
+			model_object_status.volume_or_range_configs_differ |= model_volume_list_copy_configs(model_object /* dst */, model_object_new /* src */, ModelVolumeType::PARAMETER_MODIFIER);
+            model_object_status.volume_or_range_configs_differ |= layer_height_ranges_copy_configs(model_object.layer_config_ranges /* dst */, model_object_new.layer_config_ranges /* src */);
             // Copy the ModelObject name, input_file and instances. The instances will be compared against PrintObject instances in the next step.
             model_object.name       = model_object_new.name;
             model_object.input_file = model_object_new.input_file;
@@ -1452,6 +1494,7 @@ Print::ApplyStatus Print::apply(const Model &model, DynamicPrintConfig new_full_
         m_default_object_config.apply_only(new_full_config, new_changed_keys, true);
         // Handle changes to regions config defaults
         m_default_region_config.apply_only(new_full_config, new_changed_keys, true);
+        region_defaults_changed = true;
         m_full_print_config = std::move(new_full_config);
     }
 
@@ -1492,6 +1535,13 @@ Print::ApplyStatus Print::apply(const Model &model, DynamicPrintConfig new_full_
                 print_object_regions->clear();
                 model_object_status.print_object_regions_status = ModelObjectStatus::PrintObjectRegionsStatus::Invalid;
                 print_regions_reshuffled = true;
+            } else if (print_object_regions &&
+                ! region_defaults_changed && ! num_extruders_changed && ! model_object_status.volume_or_range_configs_differ) {
+                // Fast path for applies that did not touch any input of the region graph of this object
+                // (region config defaults, volume & layer range configs, extruder count): re-verifying
+                // the regions volume by volume cannot change anything, so skip it. This keeps a pure
+                // instance transform change (moving an object on the plate) from paying the per-volume
+                // region config re-derivation for every object in the scene.
             } else if (print_object_regions &&
                 verify_update_print_object_regions(
                     print_object.model_object()->volumes,
@@ -1499,10 +1549,10 @@ Print::ApplyStatus Print::apply(const Model &model, DynamicPrintConfig new_full_
                     num_extruders ,
                     painting_extruders,
                     *print_object_regions,
-                    [it_print_object, it_print_object_end, &update_apply_status](const PrintRegionConfig &old_config, const PrintRegionConfig &new_config, const t_config_option_keys &diff_keys) {
+                    [it_print_object, it_print_object_end, &update_apply_status](const PrintRegionConfig &old_config, const PrintRegionConfig &new_config, const t_config_option_keys &diff_keys, const t_layer_height_range &z_range) {
                         for (auto it = it_print_object; it != it_print_object_end; ++it)
                             if ((*it)->m_shared_regions != nullptr)
-                                update_apply_status((*it)->invalidate_state_by_config_options(old_config, new_config, diff_keys));
+                                update_apply_status((*it)->invalidate_state_by_config_options(old_config, new_config, diff_keys, &z_range));
                     })) {
                 // Regions are valid, just keep them.
             } else {
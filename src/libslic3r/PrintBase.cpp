@@ -1,6 +1,8 @@
 #include "Exception.hpp"
 #include "PrintBase.hpp"
 
+#include <cmath>
+
 #include <boost/filesystem.hpp>
 #include <boost/lexical_cast.hpp>
 
@@ -101,13 +103,87 @@ std::string PrintBase::output_filepath(const std::string &path, const std::strin
     return path;
 }
 
+// Map a raw milestone percent onto the modeled fraction <0, 1> of the total slicing effort
+// by piecewise linear interpolation in between the progress model anchors.
+static double modeled_fraction(const std::vector<std::pair<int, double>> &anchors, int percent)
+{
+    if (percent <= anchors.front().first)
+        return anchors.front().second;
+    for (size_t i = 1; i < anchors.size(); ++ i)
+        if (percent <= anchors[i].first) {
+            const auto &[lo_percent, lo_fraction] = anchors[i - 1];
+            const auto &[hi_percent, hi_fraction] = anchors[i];
+            return lo_percent == hi_percent ? hi_fraction :
+                lo_fraction + (hi_fraction - lo_fraction) * double(percent - lo_percent) / double(hi_percent - lo_percent);
+        }
+    return anchors.back().second;
+}
+
 //BBS: move set_status from hpp to cpp
 void  PrintBase::set_status(int percent, const std::string &message, unsigned int flags, int warning_step) const
 {
+    int report_percent = percent;
+    {
+        std::lock_guard<std::mutex> lock(m_progress_mutex);
+        if (! m_progress_anchors.empty() && percent >= 0 && percent <= 100) {
+            double fraction = modeled_fraction(m_progress_anchors, percent);
+            report_percent  = int(std::lround(fraction * 100.));
+            m_progress_history.emplace_back(fraction,
+                std::chrono::duration<double>(std::chrono::steady_clock::now() - m_progress_start).count());
+        }
+        // The per-object milestones run concurrently and finish out of order, never report
+        // less than what was reported before.
+        report_percent   = std::max(report_percent, m_progress_floor);
+        m_progress_floor = report_percent;
+    }
 	if (m_status_callback)
-        m_status_callback(SlicingStatus(percent, message, flags, warning_step));
+        m_status_callback(SlicingStatus(report_percent, message, flags, warning_step));
     else
-        BOOST_LOG_TRIVIAL(debug) <<boost::format("Percent %1%: %2%\n")%percent %message.c_str();
+        BOOST_LOG_TRIVIAL(debug) <<boost::format("Percent %1%: %2%\n")%report_percent %message.c_str();
+}
+
+void PrintBase::set_progress_model(std::vector<std::pair<int, double>> anchors)
+{
+    std::lock_guard<std::mutex> lock(m_progress_mutex);
+    m_progress_anchors = std::move(anchors);
+    m_progress_floor   = 0;
+    m_progress_start   = std::chrono::steady_clock::now();
+    m_progress_history.clear();
+}
+
+double PrintBase::eta_seconds() const
+{
+    std::lock_guard<std::mutex> lock(m_progress_mutex);
+    if (m_progress_history.empty())
+        return -1.;
+    const double fraction = m_progress_history.back().first;
+    // Too early, the extrapolation would be wild.
+    if (fraction < 0.05)
+        return -1.;
+    const double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - m_progress_start).count();
+    return elapsed * (1. - fraction) / fraction;
+}
+
+void PrintBase::log_progress_model_accuracy() const
+{
+    std::lock_guard<std::mutex> lock(m_progress_mutex);
+    if (m_progress_history.size() < 2)
+        return;
+    const double total = m_progress_history.back().second;
+    if (total <= 0.)
+        return;
+    // One "predicted% -> actual%" pair per anchor hit: the modeled fraction at which a
+    // milestone reported vs. the fraction of the total wall clock time it reported at.
+    // Systematic deviations indicate which per-step weight of the progress model is off.
+    std::string report;
+    double last_fraction = -1.;
+    for (const auto &[fraction, elapsed] : m_progress_history) {
+        if (fraction == last_fraction)
+            continue;
+        last_fraction = fraction;
+        report += (boost::format(" %1%%%->%2%%%") % int(std::lround(fraction * 100.)) % int(std::lround(elapsed / total * 100.))).str();
+    }
+    BOOST_LOG_TRIVIAL(debug) << "Progress model accuracy (modeled -> actual % of wall time):" << report;
 }
 
 void PrintBase::status_update_warnings(int step, PrintStateBase::WarningLevel  warning_level,
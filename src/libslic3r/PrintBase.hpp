@@ -5,14 +5,17 @@
 #include <set>
 #include <vector>
 #include <string>
+#include <chrono>
 #include <functional>
 #include <atomic>
 #include <mutex>
+#include <optional>
 
 #include "ObjectID.hpp"
 #include "Model.hpp"
 #include "PlaceholderParser.hpp"
 #include "PrintConfig.hpp"
+#include "TraceEvents.hpp"
 
 namespace Slic3r {
 
@@ -95,6 +98,22 @@ public:
         std::vector<Warning>    warnings;
     };
 
+    // Tracks which Z spans of a step's result were invalidated since the step was last done.
+    // If every invalidation since the last set_done() carried an explicit Z range, a step may
+    // regenerate just the layers intersecting those ranges and keep the rest of its last result.
+    // Any invalidation without a range (the common case) degrades the record to "fully dirty".
+    struct DirtyZRanges
+    {
+        // Fully dirty: the last result cannot be partially reused. This is the initial state.
+        bool                                        full { true };
+        // Z spans (in unscaled object coordinates) invalidated since the step was last done.
+        // Only meaningful if ! full.
+        std::vector<std::pair<coordf_t, coordf_t>>  ranges;
+
+        void reset_clean() { full = false; ranges.clear(); }
+        void reset_full()  { full = true;  ranges.clear(); }
+    };
+
 protected:
     //FIXME last timestamp is shared between Print & SLAPrint,
     // and if multiple Print or SLAPrint instances are executed in parallel, modification of g_last_timestamp
@@ -189,6 +208,8 @@ public:
         state.state = DONE;
         state.timestamp = ++ g_last_timestamp;
         m_step_active = -1;
+        // The step was just fully recalculated, nothing of it is dirty anymore.
+        m_dirty_z_ranges[step].reset_clean();
         // Remove all non-current warnings.
     	auto it = std::remove_if(state.warnings.begin(), state.warnings.end(), [](const auto &w) { return ! w.current; });
     	bool update_warning_ui = false;
@@ -206,6 +227,8 @@ public:
     template<typename CancelationCallback>
     bool invalidate(StepType step, CancelationCallback cancel) {
         bool invalidated = m_state[step].state != INVALID;
+        // Invalidation without a Z range: whatever was calculated is fully dirty.
+        m_dirty_z_ranges[step].reset_full();
         if (invalidated) {
 #if 0
             if (mtx.state != mtx.HELD) {
@@ -228,11 +251,47 @@ public:
         return invalidated;
     }
 
+    // Make the step invalid the same way invalidate() does, but record that only the given
+    // Z range of the result went stale. If the step was already fully dirty, it stays so.
+    // The step may consume the accumulated ranges through take_dirty_z_ranges() to regenerate
+    // only the layers intersecting them.
+    template<typename CancelationCallback>
+    bool invalidate_z_range(StepType step, const std::pair<coordf_t, coordf_t> &z_range, CancelationCallback cancel) {
+        bool invalidated = m_state[step].state != INVALID;
+        DirtyZRanges &dirty = m_dirty_z_ranges[step];
+        if (! dirty.full)
+            dirty.ranges.emplace_back(z_range);
+        if (invalidated) {
+            PrintStateBase::StateWithWarnings &state = m_state[step];
+            state.state = INVALID;
+            state.timestamp = ++ g_last_timestamp;
+            // See invalidate() for the rationale of calling cancel() with the mutex held.
+            cancel();
+            state.mark_warnings_non_current();
+            m_step_active = -1;
+        }
+        return invalidated;
+    }
+
+    // Return the accumulated dirty Z ranges of a step if every invalidation since the step
+    // was last done carried one, otherwise nullopt (fully dirty). Consuming: the record is
+    // reset to fully dirty, so a canceled run falls back to full recalculation.
+    std::optional<std::vector<std::pair<coordf_t, coordf_t>>> take_dirty_z_ranges(StepType step, std::mutex &mtx) {
+        std::scoped_lock<std::mutex> lock(mtx);
+        DirtyZRanges &dirty = m_dirty_z_ranges[step];
+        std::optional<std::vector<std::pair<coordf_t, coordf_t>>> out;
+        if (! dirty.full && ! dirty.ranges.empty())
+            out = std::move(dirty.ranges);
+        dirty.reset_full();
+        return out;
+    }
+
     template<typename CancelationCallback, typename StepTypeIterator>
     bool invalidate_multiple(StepTypeIterator step_begin, StepTypeIterator step_end, CancelationCallback cancel) {
         bool invalidated = false;
         for (StepTypeIterator it = step_begin; it != step_end; ++ it) {
             StateWithTimeStamp &state = m_state[*it];
+            m_dirty_z_ranges[*it].reset_full();
             if (state.state != INVALID) {
                 invalidated = true;
                 state.state = INVALID;
@@ -268,6 +327,7 @@ public:
         bool invalidated = false;
         for (size_t i = 0; i < COUNT; ++ i) {
             StateWithTimeStamp &state = m_state[i];
+            m_dirty_z_ranges[i].reset_full();
             if (state.state != INVALID) {
                 invalidated = true;
                 state.state = INVALID;
@@ -321,6 +381,8 @@ public:
 
 private:
     StateWithWarnings   m_state[COUNT];
+    // Dirty Z spans accumulated by invalidate_z_range(), consumed by take_dirty_z_ranges().
+    DirtyZRanges        m_dirty_z_ranges[COUNT];
     // Active class StepType or -1 if none is active.
     // If the background processing is canceled, m_step_active may not be resetted
     // to -1, see the comment in this->set_started().
@@ -476,7 +538,15 @@ public:
     // Register a custom status callback.
     void                    set_status_callback(status_callback_type cb) { m_status_callback = cb; }
     // Calls a registered callback to update the status, or print out the default message.
+    // When a progress model was installed by process() (see set_progress_model()), the raw
+    // milestone percent is remapped onto the workload weighted fraction of the total effort
+    // and clamped to be monotone, as the per-object milestones finish out of order when
+    // running in parallel.
     void                    set_status(int percent, const std::string &message, unsigned int flags = SlicingStatus::DEFAULT, int warning_step = -1) const;
+    // Estimated remaining wall clock time of the currently running process() in seconds,
+    // extrapolated from the progress model. Returns -1. while no estimate is available
+    // (no progress model installed or too little progress reported yet).
+    double                  eta_seconds() const;
 
     typedef std::function<void()>  cancel_callback_type;
     // Various methods will call this callback to stop the background processing (the Print::process() call)
@@ -542,6 +612,16 @@ protected:
     // Wrapper around this->throw_if_canceled(), so that throw_if_canceled() may be passed to a function without making throw_if_canceled() public.
     PrintTryCancel         make_try_cancel() const { return PrintTryCancel(this); }
 
+    // Install the anchors of the two-level progress model: each pair maps a raw percent
+    // reported through set_status() onto the modeled fraction <0, 1> of the total slicing
+    // effort. To be called at the start of process() with fractions derived from workload
+    // metrics (layer count, facet count); also resets the monotone floor and the progress
+    // history of the previous run.
+    void                   set_progress_model(std::vector<std::pair<int, double>> anchors);
+    // Log how well the modeled progress matched the observed wall clock time of the
+    // finished run, to keep the per-step weights of the progress model honest.
+    void                   log_progress_model_accuracy() const;
+
     // To be called by this->output_filename() with the format string pulled from the configuration layer.
     std::string            output_filename(const std::string &format, const std::string &default_ext, const std::string &filename_base, const DynamicConfig *config_override = nullptr) const;
     // Update "scale", "input_filename", "input_filename_base" placeholders from the current printable ModelObjects.
@@ -572,6 +652,19 @@ private:
     // while the data influencing the stage is modified.
     mutable std::mutex                      m_state_mutex;
 
+    // State of the two-level progress model, see set_progress_model(). Guarded by
+    // m_progress_mutex, the per-object milestones report progress concurrently from
+    // TBB worker threads.
+    mutable std::mutex                            m_progress_mutex;
+    // Raw milestone percent -> modeled fraction <0, 1>, sorted by the raw percent.
+    std::vector<std::pair<int, double>>           m_progress_anchors;
+    // The highest percent reported so far, making the reported progress monotone.
+    mutable int                                   m_progress_floor { 0 };
+    // Start of the current process() run and the history of (modeled fraction, seconds
+    // since start) samples, consumed by eta_seconds() and log_progress_model_accuracy().
+    mutable std::chrono::steady_clock::time_point m_progress_start;
+    mutable std::vector<std::pair<double, double>> m_progress_history;
+
     friend PrintTryCancel;
 };
 
@@ -584,8 +677,20 @@ public:
     PrintStateBase::StateWithWarnings  step_state_with_warnings(PrintStepEnum step) const { return m_state.state_with_warnings(step, this->state_mutex()); }
 
 protected:
-    bool            set_started(PrintStepEnum step) { return m_state.set_started(step, this->state_mutex(), [this](){ this->throw_if_canceled(); }); }
+    bool            set_started(PrintStepEnum step) {
+        bool started = m_state.set_started(step, this->state_mutex(), [this](){ this->throw_if_canceled(); });
+        if (started && tracing::enabled()) {
+            // trace_step_name() is found by argument dependent lookup for the concrete step enum.
+            tracing::begin_scope(trace_step_name(step), "print_step");
+            tracing::set_alloc_tag(trace_step_name(step));
+        }
+        return started;
+    }
 	PrintStateBase::TimeStamp set_done(PrintStepEnum step) {
+        if (tracing::enabled()) {
+            tracing::end_scope();
+            tracing::set_alloc_tag(nullptr);
+        }
 		std::pair<PrintStateBase::TimeStamp, bool> status = m_state.set_done(step, this->state_mutex(), [this](){ this->throw_if_canceled(); });
         if (status.second)
             this->status_update_warnings(static_cast<int>(step), PrintStateBase::WarningLevel::NON_CRITICAL, std::string());
@@ -634,9 +739,19 @@ public:
 protected:
 	PrintObjectBaseWithState(PrintType *print, ModelObject *model_object) : PrintObjectBase(model_object), m_print(print) {}
 
-    bool            set_started(PrintObjectStepEnum step)
-        { return m_state.set_started(step, PrintObjectBase::state_mutex(m_print), [this](){ this->throw_if_canceled(); }); }
+    bool            set_started(PrintObjectStepEnum step) {
+        bool started = m_state.set_started(step, PrintObjectBase::state_mutex(m_print), [this](){ this->throw_if_canceled(); });
+        if (started && tracing::enabled()) {
+            tracing::begin_scope(trace_step_name(step), "print_object_step");
+            tracing::set_alloc_tag(trace_step_name(step));
+        }
+        return started;
+    }
 	PrintStateBase::TimeStamp set_done(PrintObjectStepEnum step) {
+        if (tracing::enabled()) {
+            tracing::end_scope();
+            tracing::set_alloc_tag(nullptr);
+        }
 		std::pair<PrintStateBase::TimeStamp, bool> status = m_state.set_done(step, PrintObjectBase::state_mutex(m_print), [this](){ this->throw_if_canceled(); });
         if (status.second)
             this->status_update_warnings(m_print, static_cast<int>(step), PrintStateBase::WarningLevel::NON_CRITICAL, std::string());
@@ -645,6 +760,12 @@ protected:
 
     bool            invalidate_step(PrintObjectStepEnum step)
         { return m_state.invalidate(step, PrintObjectBase::cancel_callback(m_print)); }
+    // Invalidate the step while recording that only the given Z span of its result went stale,
+    // see PrintState::invalidate_z_range().
+    bool            invalidate_step_with_z_range(PrintObjectStepEnum step, const std::pair<coordf_t, coordf_t> &z_range)
+        { return m_state.invalidate_z_range(step, z_range, PrintObjectBase::cancel_callback(m_print)); }
+    std::optional<std::vector<std::pair<coordf_t, coordf_t>>> take_step_dirty_z_ranges(PrintObjectStepEnum step)
+        { return m_state.take_dirty_z_ranges(step, PrintObjectBase::state_mutex(m_print)); }
     template<typename StepTypeIterator>
     bool            invalidate_steps(StepTypeIterator step_begin, StepTypeIterator step_end)
         { return m_state.invalidate_multiple(step_begin, step_end, PrintObjectBase::cancel_callback(m_print)); }
@@ -3179,6 +3179,16 @@ def = this->add("filament_loading_speed", coFloats);
     def->mode = comSimple;
     def->set_default_value(new ConfigOptionEnum<SeamPosition>(spAligned));
 
+    def = this->add("seam_visibility_triangle_budget", coInt);
+    def->label = L("Seam visibility mesh budget");
+    def->category = L("Quality");
+    def->tooltip = L("Triangle count of the simplified mesh used to estimate the seam visibility. "
+                     "The model is decimated to this budget before raycasting, so a larger budget follows "
+                     "fine surface detail more closely at the cost of a slower seam placement.");
+    def->min = 1000;
+    def->mode = comDevelop;
+    def->set_default_value(new ConfigOptionInt(16000));
+
     def = this->add("staggered_inner_seams", coBool);
     def->label = L("Staggered inner seams");
     def->tooltip = L("This option causes the inner seams to be shifted backwards based on their depth, forming a zigzag pattern.");
@@ -6229,6 +6239,19 @@ CLIMiscConfigDef::CLIMiscConfigDef()
     def->tooltip = L("Load custom gcode from json");
     def->cli_params = "custom_gcode_toolchange.json";
     def->set_default_value(new ConfigOptionString());
+
+    def = this->add("deterministic", coBool);
+    def->label = L("Deterministic slicing");
+    def->tooltip = L("Produce byte-identical output for identical input at any thread count, for release validation by diffing. "
+                     "Seeds the remaining random generators with fixed constants.");
+    def->set_default_value(new ConfigOptionBool(false));
+
+    def = this->add("trace_events", coString);
+    def->label = L("Trace events output");
+    def->tooltip = L("Write chrome://tracing JSON with the per-step timing of the slice job to the given file, "
+                     "viewable in chrome://tracing or Perfetto.");
+    def->cli_params = "trace.json";
+    def->set_default_value(new ConfigOptionString());
 }
 
 const CLIActionsConfigDef    cli_actions_config_def;
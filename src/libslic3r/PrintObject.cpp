@@ -302,15 +302,24 @@ void PrintObject::make_perimeters()
     if (! this->set_started(posPerimeters))
         return;
 
+    // If every invalidation of this step since it was last done carried an explicit Z range
+    // (a layer range config override was edited), only the layers intersecting those ranges
+    // need their walls regenerated; the other layers keep the result of the previous run.
+    std::optional<std::vector<t_layer_height_range>> dirty_z_ranges = this->take_step_dirty_z_ranges(posPerimeters);
+
     m_print->set_status(15, L("Generating walls"));
     BOOST_LOG_TRIVIAL(info) << "Generating walls..." << log_memory_info();
 
     // Revert the typed slices into untyped slices.
     if (m_typed_slices) {
-        for (Layer *layer : m_layers) {
-            layer->restore_untyped_slices();
-            m_print->throw_if_canceled();
-        }
+        tbb::parallel_for(tbb::blocked_range<size_t>(0, m_layers.size()),
+            [this](const tbb::blocked_range<size_t> &range) {
+                for (size_t layer_idx = range.begin(); layer_idx < range.end(); ++ layer_idx) {
+                    m_print->throw_if_canceled();
+                    m_layers[layer_idx]->restore_untyped_slices();
+                }
+            });
+        m_print->throw_if_canceled();
         m_typed_slices = false;
     }
 
@@ -388,10 +397,19 @@ void PrintObject::make_perimeters()
     BOOST_LOG_TRIVIAL(debug) << "Generating perimeters in parallel - start";
     tbb::parallel_for(
         tbb::blocked_range<size_t>(0, m_layers.size()),
-        [this](const tbb::blocked_range<size_t>& range) {
+        [this, &dirty_z_ranges](const tbb::blocked_range<size_t>& range) {
             for (size_t layer_idx = range.begin(); layer_idx < range.end(); ++ layer_idx) {
                 m_print->throw_if_canceled();
-                m_layers[layer_idx]->make_perimeters();
+                Layer &layer = *m_layers[layer_idx];
+                if (dirty_z_ranges) {
+                    // Partial regeneration: keep the previously generated walls of layers
+                    // not intersecting any dirty Z range.
+                    auto intersects = [&layer](const t_layer_height_range &r)
+                        { return layer.print_z > r.first - EPSILON && layer.print_z - layer.height < r.second + EPSILON; };
+                    if (std::none_of(dirty_z_ranges->begin(), dirty_z_ranges->end(), intersects))
+                        continue;
+                }
+                layer.make_perimeters();
             }
         }
     );
@@ -411,10 +429,14 @@ void PrintObject::prepare_infill()
         // The preceding step (perimeter generator) only modifies extra_perimeters and the extra perimeters are only used by discover_vertical_shells()
         // with more than a single region. If this step does not use Surface::extra_perimeters or Surface::extra_perimeters is always zero, it is safe
         // to reset to the untyped slices before re-runnning detect_surfaces_type().
-        for (Layer* layer : m_layers) {
-            layer->restore_untyped_slices_no_extra_perimeters();
-            m_print->throw_if_canceled();
-        }
+        tbb::parallel_for(tbb::blocked_range<size_t>(0, m_layers.size()),
+            [this](const tbb::blocked_range<size_t> &range) {
+                for (size_t layer_idx = range.begin(); layer_idx < range.end(); ++ layer_idx) {
+                    m_print->throw_if_canceled();
+                    m_layers[layer_idx]->restore_untyped_slices_no_extra_perimeters();
+                }
+            });
+        m_print->throw_if_canceled();
     }
 
     // This will assign a type (top/bottom/internal) to $layerm->slices.
@@ -428,11 +450,15 @@ void PrintObject::prepare_infill()
     // Here the stTop / stBottomBridge / stBottom infill is turned to just stInternal if zero top / bottom infill layers are configured.
     // Also tiny stInternal surfaces are turned to stInternalSolid.
     BOOST_LOG_TRIVIAL(info) << "Preparing fill surfaces..." << log_memory_info();
-    for (auto *layer : m_layers)
-        for (auto *region : layer->m_regions) {
-            region->prepare_fill_surfaces();
-            m_print->throw_if_canceled();
-        }
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, m_layers.size()),
+        [this](const tbb::blocked_range<size_t> &range) {
+            for (size_t layer_idx = range.begin(); layer_idx < range.end(); ++ layer_idx) {
+                m_print->throw_if_canceled();
+                for (auto *region : m_layers[layer_idx]->m_regions)
+                    region->prepare_fill_surfaces();
+            }
+        });
+    m_print->throw_if_canceled();
 
 
     // Add solid fills to ensure the shell vertical thickness.
@@ -543,17 +569,37 @@ void PrintObject::infill()
     this->prepare_infill();
 
     if (this->set_started(posInfill)) {
+        // If every invalidation of this step since it was last done carried an explicit Z range
+        // (a layer range config override was edited), only the layers intersecting those ranges
+        // (already padded by the reach of the fill surface reclassification, see
+        // invalidate_step_with_z_range()) need new fills; the other layers keep the result of
+        // the previous run, for which prepare_infill() has just recomputed identical surfaces.
+        std::optional<std::vector<t_layer_height_range>> dirty_z_ranges = this->take_step_dirty_z_ranges(posInfill);
+
         m_print->set_status(35, L("Generating infill toolpath"));
         const auto& adaptive_fill_octree = this->m_adaptive_fill_octrees.first;
         const auto& support_fill_octree = this->m_adaptive_fill_octrees.second;
 
         BOOST_LOG_TRIVIAL(debug) << "Filling layers in parallel - start";
+        // Hand out contiguous bands of layers instead of letting the partitioner split the range
+        // arbitrarily: neighboring layers share slicing data still hot in the worker's cache and
+        // repeating sparse islands hit the fill extrusion cache right after seeding it.
+        size_t grain_size = std::max(m_layers.size() / 16, size_t(1));
         tbb::parallel_for(
-            tbb::blocked_range<size_t>(0, m_layers.size()),
-            [this, &adaptive_fill_octree = adaptive_fill_octree, &support_fill_octree = support_fill_octree](const tbb::blocked_range<size_t>& range) {
+            tbb::blocked_range<size_t>(0, m_layers.size(), grain_size),
+            [this, &adaptive_fill_octree = adaptive_fill_octree, &support_fill_octree = support_fill_octree, &dirty_z_ranges](const tbb::blocked_range<size_t>& range) {
                 for (size_t layer_idx = range.begin(); layer_idx < range.end(); ++ layer_idx) {
                     m_print->throw_if_canceled();
-                    m_layers[layer_idx]->make_fills(adaptive_fill_octree.get(), support_fill_octree.get(), this->m_lightning_generator.get());
+                    Layer &layer = *m_layers[layer_idx];
+                    if (dirty_z_ranges) {
+                        // Partial regeneration: keep the previously generated fills of layers
+                        // not intersecting any dirty Z range.
+                        auto intersects = [&layer](const t_layer_height_range &r)
+                            { return layer.print_z > r.first - EPSILON && layer.print_z - layer.height < r.second + EPSILON; };
+                        if (std::none_of(dirty_z_ranges->begin(), dirty_z_ranges->end(), intersects))
+                            continue;
+                    }
+                    layer.make_fills(adaptive_fill_octree.get(), support_fill_octree.get(), this->m_lightning_generator.get());
                 }
             }
         );
@@ -809,6 +855,14 @@ void PrintObject::clear_layers()
     }
 }
 
+void PrintObject::release_intermediate_geometry()
+{
+    // Shared objects borrow their layers from the prototype object, do not touch them.
+    if (!m_shared_object)
+        for (Layer *l : m_layers)
+            l->release_intermediate_geometry();
+}
+
 Layer* PrintObject::add_layer(int id, coordf_t height, coordf_t print_z, coordf_t slice_z)
 {
     m_layers.emplace_back(new Layer(id, this, height, print_z, slice_z));
@@ -843,15 +897,34 @@ void PrintObject::clear_support_layers()
 
 std::shared_ptr<TreeSupportData> PrintObject::alloc_tree_support_preview_cache()
 {
-    if (!m_tree_support_preview_cache) {
-        const coordf_t layer_height = m_config.layer_height.value;
-        const coordf_t xy_distance = m_config.support_object_xy_distance.value;
-        const double angle = m_config.tree_support_branch_angle.value * M_PI / 180.;
-        const coordf_t max_move_distance
-            = (angle < M_PI / 2) ? (coordf_t)(tan(angle) * layer_height) : std::numeric_limits<coordf_t>::max();
-        const coordf_t radius_sample_resolution = g_config_tree_support_collision_resolution;
-
+    const coordf_t layer_height = m_config.layer_height.value;
+    const coordf_t xy_distance = m_config.support_object_xy_distance.value;
+    const double angle = m_config.tree_support_branch_angle.value * M_PI / 180.;
+    const coordf_t max_move_distance
+        = (angle < M_PI / 2) ? (coordf_t)(tan(angle) * layer_height) : std::numeric_limits<coordf_t>::max();
+    const coordf_t radius_sample_resolution = g_config_tree_support_collision_resolution;
+
+    // The cached volumes only depend on the layer outlines and the distances above, not on the
+    // painted support regions. A cache surviving from the previous support generation may thus
+    // be reused when the parameters still match (the cache is dropped on re-slicing), which
+    // makes repeated generation after a paint-on support edit re-grow the branches without
+    // recomputing the collision / avoidance volumes.
+    if (m_tree_support_preview_cache &&
+        (m_tree_support_preview_cache->m_xy_distance != xy_distance ||
+         m_tree_support_preview_cache->m_max_move != max_move_distance ||
+         m_tree_support_preview_cache->m_radius_sample_resolution != radius_sample_resolution ||
+         m_tree_support_preview_cache->m_layer_outlines.size() != this->layer_count()))
+        m_tree_support_preview_cache.reset();
+
+    if (!m_tree_support_preview_cache)
         m_tree_support_preview_cache = std::make_shared<TreeSupportData>(*this, xy_distance, max_move_distance, radius_sample_resolution);
+    else {
+        // Per-run outputs of the previous generation, only the collision volumes are kept.
+        // The avoidances have to go as well: they were propagated along the layer_heights
+        // table of the previous run, which the edited support contacts may re-plan.
+        m_tree_support_preview_cache->tree_nodes.clear();
+        m_tree_support_preview_cache->layer_heights.clear();
+        m_tree_support_preview_cache->m_avoidance_cache.clear();
     }
 
     return m_tree_support_preview_cache;
@@ -878,14 +951,20 @@ SupportLayerPtrs::iterator PrintObject::insert_support_layer(SupportLayerPtrs::i
 // Called by Print::apply().
 // This method only accepts PrintObjectConfig and PrintRegionConfig option keys.
 bool PrintObject::invalidate_state_by_config_options(
-    const ConfigOptionResolver &old_config, const ConfigOptionResolver &new_config, const std::vector<t_config_option_key> &opt_keys)
+    const ConfigOptionResolver &old_config, const ConfigOptionResolver &new_config, const std::vector<t_config_option_key> &opt_keys,
+    const t_layer_height_range *dirty_z_range)
 {
     if (opt_keys.empty())
         return false;
 
     std::vector<PrintObjectStep> steps;
     bool invalidated = false;
+    //BBS: report which changed option invalidated which step of this object, so that
+    // overly coarse entries in the table below (or options falling into the
+    // invalidate-all fallback) can be spotted from the logs.
+    std::string report;
     for (const t_config_option_key &opt_key : opt_keys) {
+        const size_t steps_before = steps.size();
         if (   opt_key == "brim_width"
             || opt_key == "brim_object_gap"
             || opt_key == "brim_type"
@@ -1126,6 +1205,7 @@ bool PrintObject::invalidate_state_by_config_options(
             steps.emplace_back(posSlice);
         } else if (
                opt_key == "seam_position"
+            || opt_key == "seam_visibility_triangle_budget"
             || opt_key == "support_speed"
             || opt_key == "support_interface_speed"
             || opt_key == "overhang_1_4_speed"
@@ -1142,25 +1222,130 @@ bool PrintObject::invalidate_state_by_config_options(
             || opt_key == "internal_solid_infill_speed"
             || opt_key == "top_surface_speed") {
             invalidated |= m_print->invalidate_step(psGCodeExport);
+            report += std::string(" ") + opt_key + "->" + print_step_name(psGCodeExport);
         } else if (
                opt_key == "flush_into_infill"
             || opt_key == "flush_into_objects"
             || opt_key == "flush_into_support") {
             invalidated |= m_print->invalidate_step(psWipeTower);
             invalidated |= m_print->invalidate_step(psGCodeExport);
+            report += std::string(" ") + opt_key + "->" + print_step_name(psWipeTower);
         } else {
             // for legacy, if we can't handle this option let's invalidate all steps
+            BOOST_LOG_TRIVIAL(warning) << "PrintObject::invalidate_state_by_config_options(): \"" << opt_key
+                << "\" is not listed in the invalidation table, invalidating all steps";
             this->invalidate_all_steps();
             invalidated = true;
         }
+        for (size_t i = steps_before; i < steps.size(); ++ i)
+            report += std::string(" ") + opt_key + "->" + print_object_step_name(steps[i]);
     }
 
+    if (! report.empty())
+        BOOST_LOG_TRIVIAL(debug) << "Print config diff for object " << this->model_object()->name << " invalidates:" << report;
+
     sort_remove_duplicates(steps);
+    // Switching the fill pattern inside a layer range override may couple the fills to an
+    // object-global structure (lightning, adaptive cubic) that the guard in
+    // invalidate_step_with_z_range() cannot see in the old region configs yet.
+    if (dirty_z_range != nullptr &&
+        std::find(opt_keys.begin(), opt_keys.end(), "sparse_infill_pattern") != opt_keys.end())
+        dirty_z_range = nullptr;
     for (PrintObjectStep step : steps)
+        invalidated |= (dirty_z_range != nullptr &&
+                        (step == posPerimeters || step == posPrepareInfill || step == posInfill)) ?
+            // The changed options only apply inside a layer range config override, thus only
+            // layers intersecting its Z span need their walls / fills regenerated.
+            this->invalidate_step_with_z_range(step, *dirty_z_range) :
+            this->invalidate_step(step);
+    return invalidated;
+}
+
+bool PrintObject::invalidate_step_with_z_range(PrintObjectStep step, const t_layer_height_range &z_range)
+{
+    assert(step == posPerimeters || step == posPrepareInfill || step == posInfill);
+    bool invalidated = false;
+
+    // posPerimeters consumes the Z ranges directly. prepare_infill() always re-runs fully:
+    // reclassifying the fill surfaces is cross-layer logic but cheap compared to generating
+    // the fills, which posInfill regenerates only for layers intersecting the recorded span
+    // padded by the reach of that reclassification.
+    // Fill patterns generated from one object-global structure cannot be banded, fall back
+    // to regenerating all fills for them.
+    bool scoped_infill = ! this->has_globally_coupled_infill();
+    auto invalidate_infill = [this, &z_range, scoped_infill]() {
+        return scoped_infill ?
+            Inherited::invalidate_step_with_z_range(posInfill, this->pad_dirty_z_range_by_infill_reach(z_range)) :
+            this->invalidate_steps({ posInfill });
+    };
+
+    // Propagate to dependent steps the same way invalidate_step() does. Apart from
+    // posPerimeters and posInfill, the dependent steps do not reuse partial results,
+    // they are invalidated fully.
+    switch (step) {
+    case posPerimeters:
+        invalidated |= Inherited::invalidate_step_with_z_range(posPerimeters, z_range);
+        invalidated |= this->invalidate_steps({ posPrepareInfill, posIroning, posSimplifyPath, posSimplifyInfill });
+        invalidated |= invalidate_infill();
+        break;
+    case posPrepareInfill:
+        invalidated |= this->invalidate_steps({ posPrepareInfill, posIroning, posSimplifyPath, posSimplifyInfill });
+        invalidated |= invalidate_infill();
+        break;
+    case posInfill:
+        invalidated |= this->invalidate_steps({ posIroning, posSimplifyInfill });
+        invalidated |= invalidate_infill();
+        break;
+    default:
+        assert(false);
         invalidated |= this->invalidate_step(step);
+        break;
+    }
+    invalidated |= m_print->invalidate_steps({ psSkirtBrim });
+    invalidated |= m_print->invalidate_step(psWipeTower);
+    invalidated |= m_print->invalidate_step(psGCodeExport);
     return invalidated;
 }
 
+bool PrintObject::has_globally_coupled_infill() const
+{
+    for (size_t region_id = 0; region_id < this->num_printing_regions(); ++ region_id) {
+        const InfillPattern pattern = this->printing_region(region_id).config().sparse_infill_pattern.value;
+        if (pattern == ipLightning || pattern == ipAdaptiveCubic || pattern == ipSupportCubic)
+            return true;
+    }
+    return false;
+}
+
+t_layer_height_range PrintObject::pad_dirty_z_range_by_infill_reach(const t_layer_height_range &z_range) const
+{
+    coordf_t layer_h = m_config.layer_height.value;
+    // A layer range override may locally increase the layer height.
+    for (const auto &kvp : this->model_object()->layer_config_ranges)
+        if (kvp.second.has("layer_height"))
+            layer_h = std::max(layer_h, kvp.second.option("layer_height")->getFloat());
+
+    // Top / bottom shell detection looks shell-many layers (or the shell thickness) up and
+    // down, internal bridge detection one layer further.
+    coordf_t reach = layer_h;
+    bool     combines_infill = false;
+    for (size_t region_id = 0; region_id < this->num_printing_regions(); ++ region_id) {
+        const PrintRegionConfig &cfg = this->printing_region(region_id).config();
+        const coordf_t shells    = coordf_t(std::max(cfg.top_shell_layers.value, cfg.bottom_shell_layers.value)) * layer_h;
+        const coordf_t thickness = std::max(cfg.top_shell_thickness.value, cfg.bottom_shell_thickness.value);
+        reach = std::max(reach, std::max(shells, thickness) + 2. * layer_h);
+        combines_infill |= cfg.infill_combination.value;
+    }
+    // Infill combination merges sparse infill of neighboring layers up to the nozzle diameter.
+    if (combines_infill) {
+        const auto &nozzle_diameters = m_print->config().nozzle_diameter.values;
+        if (! nozzle_diameters.empty())
+            reach += *std::max_element(nozzle_diameters.begin(), nozzle_diameters.end());
+    }
+
+    return { z_range.first - reach, z_range.second + reach };
+}
+
 bool PrintObject::invalidate_step(PrintObjectStep step)
 {
 	bool invalidated = Inherited::invalidate_step(step);
@@ -1178,10 +1363,17 @@ bool PrintObject::invalidate_step(PrintObjectStep step)
 		invalidated |= this->invalidate_steps({ posPerimeters, posPrepareInfill, posInfill, posIroning, posSupportMaterial, posSimplifyPath, posSimplifyInfill });
         invalidated |= m_print->invalidate_steps({ psSkirtBrim });
         m_slicing_params.valid = false;
+        // The tree support volumes are derived from the layer outlines, drop them with the slices.
+        // They survive a posSupportMaterial invalidation on purpose, so that paint-on support
+        // edits only re-grow the branches and reuse the collision / avoidance volumes.
+        this->clear_tree_support_preview_cache();
+        this->clear_skirt_hull_cache();
     } else if (step == posSupportMaterial) {
         invalidated |= this->invalidate_steps({ posSimplifySupportPath });
         invalidated |= m_print->invalidate_steps({ psSkirtBrim });
         m_slicing_params.valid = false;
+        // The skirt hull includes support extrusions.
+        this->clear_skirt_hull_cache();
     }
 
     // Wipe tower depends on the ordering of extruders, which in turn depends on everything.
@@ -1199,6 +1391,8 @@ bool PrintObject::invalidate_all_steps()
     bool result = Inherited::invalidate_all_steps() | m_print->invalidate_all_steps();
 	// Then reset some of the depending values.
 	m_slicing_params.valid = false;
+	this->clear_tree_support_preview_cache();
+	this->clear_skirt_hull_cache();
 	return result;
 }
 
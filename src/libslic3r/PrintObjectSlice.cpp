@@ -59,6 +59,10 @@ static std::vector<ExPolygons> slice_volume(
             params2.trafo = params2.trafo * volume.get_matrix();
             if (params2.trafo.rotation().determinant() < 0.)
                 its_flip_triangles(its);
+            // Operators tweak layer heights dozens of times per job; reuse the facet z-interval index
+            // across those reslices, only the binning into the new slicing planes is repeated.
+            // Flipping triangles above does not change the facet z-spans.
+            params2.facet_z_index = facet_z_interval_index(volume.id(), its, params2.trafo);
             layers = slice_mesh_ex(its, zs, params2, throw_on_cancel_callback);
             throw_on_cancel_callback();
         }
@@ -157,6 +161,18 @@ static std::vector<VolumeSlices> slice_volumes_inner(
     //const auto   extra_offset  = is_mm_painted ? 0.f : std::max(0.f, float(print_object_config.xy_contour_compensation.value));
     const auto   extra_offset = 0.f;
 
+    // Collect the per-volume slicing tasks first, then slice the volumes concurrently.
+    // Slicing a single volume is parallel over facets & layers already, but running the volumes
+    // through the TBB arena together lets the cheap tail stages of one volume overlap the front
+    // stages of the next one instead of a hard barrier per volume.
+    struct SliceTask {
+        const ModelVolume                *model_volume;
+        MeshSlicingParamsEx               params;
+        std::vector<t_layer_height_range> slicing_ranges;
+    };
+    std::vector<SliceTask> tasks;
+    tasks.reserve(model_volumes.size());
+
     for (const ModelVolume *model_volume : model_volumes)
         if (model_volume_needs_slicing(*model_volume)) {
             MeshSlicingParamsEx params { params_base };
@@ -175,10 +191,7 @@ static std::vector<VolumeSlices> slice_volumes_inner(
                         for (; params.slicing_mode_normal_below_layer < zs.size() && zs[params.slicing_mode_normal_below_layer] < region_config.bottom_shell_thickness - EPSILON;
                             ++ params.slicing_mode_normal_below_layer);
                     }
-                    out.push_back({
-                        model_volume->id(),
-                        slice_volume(*model_volume, zs, params, throw_on_cancel_callback)
-                    });
+                    tasks.push_back({ model_volume, std::move(params), {} });
                 }
             } else {
                 assert(! print_config.spiral_mode);
@@ -187,15 +200,29 @@ static std::vector<VolumeSlices> slice_volumes_inner(
                     if (layer_range.has_volume(model_volume->id()))
                         slicing_ranges.emplace_back(layer_range.layer_height_range);
                 if (! slicing_ranges.empty())
-                    out.push_back({
-                        model_volume->id(),
-                        slice_volume(*model_volume, zs, slicing_ranges, params, throw_on_cancel_callback)
-                    });
+                    tasks.push_back({ model_volume, std::move(params), slicing_ranges });
             }
-            if (! out.empty() && out.back().slices.empty())
-                out.pop_back();
         }
 
+    std::vector<VolumeSlices> sliced(tasks.size());
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, tasks.size(), 1),
+        [&tasks, &sliced, &zs, &throw_on_cancel_callback](const tbb::blocked_range<size_t> &range) {
+            for (size_t i = range.begin(); i < range.end(); ++ i) {
+                const SliceTask &task = tasks[i];
+                sliced[i] = {
+                    task.model_volume->id(),
+                    task.slicing_ranges.empty() ?
+                        slice_volume(*task.model_volume, zs, task.params, throw_on_cancel_callback) :
+                        slice_volume(*task.model_volume, zs, task.slicing_ranges, task.params, throw_on_cancel_callback)
+                };
+            }
+        });
+
+    // Keep the original ModelVolume::id() order, drop the volumes that produced no slices.
+    for (VolumeSlices &vs : sliced)
+        if (! vs.slices.empty())
+            out.emplace_back(std::move(vs));
+
     return out;
 }
 
@@ -1347,7 +1374,8 @@ ExPolygons PrintObject::_shrink_contour_holes(double contour_delta, double hole_
         } else {
             contours.push_back(ex_poly.contour);
         }
-        ExPolygons temp = diff_ex(union_(contours), union_(holes));
+        // Union of the contours, union of the holes and the difference are fused into a single Clipper execution.
+        ExPolygons temp = diff_ex({ &contours }, { &holes });
         new_ex_polys.insert(new_ex_polys.end(), std::make_move_iterator(temp.begin()), std::make_move_iterator(temp.end()));
     }
     return union_ex(new_ex_polys);
@@ -1,6 +1,7 @@
 #include "QuadricEdgeCollapse.hpp"
 #include <tuple>
 #include <optional>
+#include <unordered_map>
 #include "MutablePriorityQueue.hpp"
 #include <tbb/parallel_for.h>
 
@@ -134,6 +135,7 @@ namespace QuadricEdgeCollapse {
                           uint32_t vi0, uint32_t vi1, uint32_t vi_top0,
                           const Triangle &t1, CopyEdgeInfos& infos, EdgeInfos &e_infos1);
     void compact(const VertexInfos &v_infos, const TriangleInfos &t_infos, const EdgeInfos &e_infos, indexed_triangle_set &its);
+    void vertex_clustering(indexed_triangle_set &its, size_t target_triangle_count, const ThrowOnCancel &throw_on_cancel);
 
 #ifdef EXPENSIVE_DEBUG_CHECKS
     void store_surround(const char *obj_filename, size_t triangle_index, int depth, const indexed_triangle_set &its,
@@ -145,6 +147,12 @@ namespace QuadricEdgeCollapse {
     // constants --> may be move to config
     const uint32_t check_cancel_period = 16; // how many edge to reduce before call throw_on_cancel
     const size_t max_triangle_count_for_one_vertex = 50;
+    // meshes above this triangle count are decimated by the coarse vertex
+    // clustering pre-pass before running the exact quadric collapse
+    const size_t clustering_min_triangle_count = 2000000;
+    // how many times smaller than the input the wanted triangle count has to
+    // be for the clustering pre-pass to pay off
+    const size_t clustering_min_reduction = 8;
     // change speed of progress bargraph
     const int status_init_size = 10; // in percents
     // parts of init size
@@ -171,6 +179,19 @@ void Slic3r::its_quadric_edge_collapse(
     if (throw_on_cancel == nullptr) throw_on_cancel = []() {};
     if (status_fn == nullptr) status_fn = [](int) {};
 
+    // Huge meshes (typically raw 3D scans) reduced to a fraction of their
+    // triangle count are first decimated by the coarse clustering pre-pass,
+    // the expensive exact collapse then runs on the decimated mesh only.
+    // Error driven reductions (wanted triangle count of zero) skip the
+    // pre-pass as the clustering does not respect the error limit.
+    if (triangle_count > 0 &&
+        its.indices.size() > clustering_min_triangle_count &&
+        its.indices.size() > clustering_min_reduction * triangle_count) {
+        vertex_clustering(its, size_t(4) * triangle_count, throw_on_cancel);
+        throw_on_cancel();
+        if (triangle_count >= its.indices.size()) return;
+    }
+
     StatusFn init_status_fn = [&](int percent) {
         float n_percent = percent * status_init_size / 100.f;
         status_fn(static_cast<int>(std::round(n_percent)));
@@ -191,10 +212,12 @@ void Slic3r::its_quadric_edge_collapse(
     std::vector<size_t> ti_2_mpqi(its.indices.size(), {0});
     auto setter = [&ti_2_mpqi](const Error &e, size_t index) { ti_2_mpqi[e.triangle_index] = index; };
     auto less = [](const Error &e1, const Error &e2) -> bool { return e1.value < e2.value; };
-    auto mpq = make_miniheap_mutable_priority_queue<Error, 32, false>(std::move(setter), std::move(less)); 
-    //MutablePriorityQueue<Error, decltype(setter), decltype(less)> mpq(std::move(setter), std::move(less));
+    // The 4-ary heap beats the miniheap skip addressing here: the Error elements are tiny,
+    // all children of a node share a cache line and the initial queue is built in linear time.
+    auto mpq = make_dary_mutable_priority_queue<Error, 4, false>(std::move(setter), std::move(less));
     mpq.reserve(its.indices.size());
-    for (Error &error :errors) mpq.push(error);
+    for (Error &error :errors) mpq.push_unsorted(error);
+    mpq.heapify();
 
     CopyEdgeInfos ceis;
     ceis.reserve(max_triangle_count_for_one_vertex);
@@ -855,6 +878,85 @@ void QuadricEdgeCollapse::compact(const VertexInfos &   v_infos,
     its.indices.erase(its.indices.begin() + ti_new, its.indices.end());
 }
 
+// Coarse grid based decimation used as a cheap pre-pass for huge meshes
+// before running the exact quadric collapse. Vertices falling into the same
+// grid cell are merged into their average and the triangles degenerated by
+// the merge are dropped. The output triangle count only roughly tracks
+// target_triangle_count, the exact reduction is left to the collapse.
+void QuadricEdgeCollapse::vertex_clustering(indexed_triangle_set &its,
+                                            size_t                target_triangle_count,
+                                            const ThrowOnCancel  &throw_on_cancel)
+{
+    BoundingBoxf3 bbox;
+    for (const stl_vertex &v : its.vertices)
+        bbox.merge(v.cast<double>());
+
+    Vec3d sizes = bbox.size();
+    double max_size = sizes.maxCoeff();
+    if (max_size <= 0.) return;
+
+    // For a surface like mesh the count of occupied cells grows with the
+    // square of the grid resolution and every clustered vertex yields roughly
+    // two triangles, thus the resolution is derived from half of the target.
+    uint32_t resolution = std::clamp(
+        uint32_t(std::sqrt(target_triangle_count / 2.)), uint32_t(16), uint32_t(1024));
+    double cell_size = max_size / resolution;
+
+    Vec3i cell_counts;
+    for (int axis = 0; axis < 3; ++axis)
+        cell_counts[axis] = std::max(1, int(std::ceil(sizes[axis] / cell_size)));
+
+    // cell of every vertex encoded into a single number
+    std::vector<uint64_t> cell_ids(its.vertices.size());
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, its.vertices.size()),
+        [&](const tbb::blocked_range<size_t> &range) {
+        for (size_t i = range.begin(); i < range.end(); ++i) {
+            const stl_vertex &v = its.vertices[i];
+            uint64_t cell[3];
+            for (int axis = 0; axis < 3; ++axis)
+                cell[axis] = std::min(uint64_t(cell_counts[axis] - 1),
+                    uint64_t(std::max(0., (double(v[axis]) - bbox.min[axis]) / cell_size)));
+            cell_ids[i] = cell[0] + uint64_t(cell_counts[0]) *
+                         (cell[1] + uint64_t(cell_counts[1]) * cell[2]);
+        }
+    });
+    throw_on_cancel();
+
+    // assign a new vertex index to every occupied cell
+    std::unordered_map<uint64_t, uint32_t> cells;
+    cells.reserve(target_triangle_count);
+    std::vector<uint32_t> vertex_map(its.vertices.size());
+    for (size_t i = 0; i < its.vertices.size(); ++i) {
+        auto [it, inserted] = cells.try_emplace(cell_ids[i], uint32_t(cells.size()));
+        vertex_map[i] = it->second;
+    }
+    throw_on_cancel();
+
+    // place the clustered vertices into the average of their sources
+    std::vector<Vec3d>    centroids(cells.size(), Vec3d::Zero());
+    std::vector<uint32_t> counts(cells.size(), 0);
+    for (size_t i = 0; i < its.vertices.size(); ++i) {
+        centroids[vertex_map[i]] += its.vertices[i].cast<double>();
+        ++counts[vertex_map[i]];
+    }
+    Vertices new_vertices(cells.size());
+    for (size_t i = 0; i < cells.size(); ++i)
+        new_vertices[i] = (centroids[i] / counts[i]).cast<float>();
+    throw_on_cancel();
+
+    // remap the triangles, drop those degenerated by the clustering
+    Indices new_indices;
+    new_indices.reserve(std::min(its.indices.size(), 4 * target_triangle_count));
+    for (const Triangle &t : its.indices) {
+        Triangle nt(vertex_map[t[0]], vertex_map[t[1]], vertex_map[t[2]]);
+        if (nt[0] == nt[1] || nt[1] == nt[2] || nt[0] == nt[2]) continue;
+        new_indices.emplace_back(nt);
+    }
+
+    its.vertices = std::move(new_vertices);
+    its.indices  = std::move(new_indices);
+}
+
 #ifdef EXPENSIVE_DEBUG_CHECKS
 
 // store triangle surrounding to file
@@ -10,6 +10,9 @@ namespace Slic3r {
 
 /// <summary>
 /// Simplify mesh by Quadric metric
+/// Huge meshes reduced to a fraction of their triangle count are first
+/// decimated by a cheap grid based vertex clustering pre-pass, the exact
+/// quadric collapse then runs on the decimated mesh only.
 /// </summary>
 /// <param name="its">IN/OUT triangle mesh to be simplified.</param>
 /// <param name="triangle_count">Wanted triangle count.</param>
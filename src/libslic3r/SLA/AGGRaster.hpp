@@ -1,7 +1,11 @@
 #ifndef AGGRASTER_HPP
 #define AGGRASTER_HPP
 
+#include <cmath>
+#include <functional>
+
 #include <libslic3r/SLA/RasterBase.hpp>
+#include "libslic3r/BoundingBox.hpp"
 #include "libslic3r/ExPolygon.hpp"
 #include "libslic3r/MTUtils.hpp"
 
@@ -59,7 +63,13 @@ protected:
     Trafo m_trafo;
     Scanline m_scanlines;
     Rasterizer m_rasterizer;
-    
+
+    TColor m_foreground;
+    TColor m_background;
+    // The gamma function passed to the constructor, kept around to initialize the
+    // rasterizers of the concurrent bands of draw(const ExPolygons &).
+    std::function<double(double)> m_gammafn;
+
     void flipy(agg::path_storage &path) const
     {
         path.flip_y(0, double(m_resolution.height_px));
@@ -120,7 +130,79 @@ protected:
         
         agg::render_scanlines(m_rasterizer, m_scanlines, m_renderer);
     }
-    
+
+    // Vertical pixel span the polygon covers on the raster after the raster
+    // transformation, padded by one pixel on both sides for the anti-aliasing.
+    std::pair<long, long> vertical_span_px(const ExPolygon &poly)
+    {
+        BoundingBox bb = poly.contour.bounding_box();
+        // The y coordinate on the raster is produced by getPx() when the axes are
+        // flipped, see _to_path_flpxy(), and translated / mirrored the same way
+        // to_path() transforms the full path.
+        double lo = m_trafo.flipXY ? getPx(bb.min) : getPy(bb.min);
+        double hi = m_trafo.flipXY ? getPx(bb.max) : getPy(bb.max);
+        double off = double(m_trafo.center_y) * m_pxdim_scaled.h_mm;
+        lo += off;
+        hi += off;
+        if (m_trafo.mirror_y) {
+            double swp = lo;
+            lo = double(m_resolution.height_px) - hi;
+            hi = double(m_resolution.height_px) - swp;
+        }
+        return {long(std::floor(lo)) - 1, long(std::ceil(hi)) + 1};
+    }
+
+    // Render a batch of polygons split into horizontal bands rasterized concurrently.
+    // Each band clips its pixel writes to a disjoint row range, thus the bands share
+    // the frame buffer without synchronization.
+    void draw_bands(const ExPolygons &polys, size_t nbands)
+    {
+        size_t band_h = (m_resolution.height_px + nbands - 1) / nbands;
+
+        // Bucket the polygons into the bands their vertical span overlaps.
+        std::vector<std::vector<const ExPolygon*>> bands(nbands);
+        for (const ExPolygon &poly : polys) {
+            auto [lo, hi] = vertical_span_px(poly);
+            if (hi < 0 || lo >= long(m_resolution.height_px))
+                continue;
+            size_t from = size_t(std::max(lo, long(0))) / band_h;
+            size_t to   = std::min(size_t(std::max(hi, long(0))) / band_h, nbands - 1);
+            for (size_t b = from; b <= to; ++b)
+                bands[b].emplace_back(&poly);
+        }
+
+        ccr::for_each(size_t(0), nbands, [this, &bands, band_h](size_t b) {
+            if (bands[b].empty())
+                return;
+
+            int y0 = int(b * band_h);
+            int y1 = int(std::min((b + 1) * band_h, m_resolution.height_px));
+
+            PixelRenderer pixrenderer(m_rbuf);
+            agg::renderer_base<PixelRenderer> raw_renderer(pixrenderer);
+            // Pixel writes stay strictly within the band.
+            raw_renderer.clip_box(0, y0, int(m_resolution.width_px) - 1, y1 - 1);
+            Renderer<agg::renderer_base<PixelRenderer>> renderer(raw_renderer);
+            renderer.color(m_foreground);
+
+            Rasterizer rasterizer;
+            rasterizer.gamma(m_gammafn);
+            // One pixel of overlap keeps the anti-aliased coverage of the boundary
+            // rows identical to a single pass render, the renderer clip box above
+            // keeps the writes disjoint regardless.
+            rasterizer.clip_box(0., double(y0) - 1., double(m_resolution.width_px),
+                                double(y1) + 1.);
+            Scanline scanlines;
+
+            for (const ExPolygon *poly : bands[b]) {
+                rasterizer.reset();
+                rasterizer.add_path(to_path(contour(*poly)));
+                for (auto &h : holes(*poly)) rasterizer.add_path(to_path(h));
+                agg::render_scanlines(rasterizer, scanlines, renderer);
+            }
+        });
+    }
+
 public:
     template<class GammaFn>
     AGGRaster(const Resolution &res,
@@ -140,6 +222,9 @@ public:
         , m_raw_renderer(m_pixrenderer)
         , m_renderer(m_raw_renderer)
         , m_trafo(trafo)
+        , m_foreground(foreground)
+        , m_background(background)
+        , m_gammafn(gammafn)
     {
         // Visual Studio compiler gives warnings about possible division by zero.
         assert(pd.w_mm != 0 && pd.h_mm != 0);
@@ -162,7 +247,22 @@ public:
     }
     
     void draw(const ExPolygon &poly) override { _draw(poly); }
-    
+
+    void draw(const ExPolygons &polys) override
+    {
+        // Bands narrower than this are not worth the per band rasterizer setup.
+        constexpr size_t MinBandHeight = 128;
+
+        size_t nbands = std::min(ccr::max_concurreny(),
+                                 m_resolution.height_px / MinBandHeight);
+        if (nbands < 2 || polys.size() < 2)
+            for (const ExPolygon &poly : polys) _draw(poly);
+        else
+            draw_bands(polys, nbands);
+    }
+
+    void reset() override { clear(m_background); }
+
     EncodedRaster encode(RasterEncoder encoder) const override
     {
         return encoder(m_buf.data(), m_resolution.width_px, m_resolution.height_px, 1);    
@@ -1,4 +1,7 @@
+#include <cmath>
+#include <cstring>
 #include <functional>
+#include <mutex>
 #include <optional>
 
 #include <libslic3r/OpenVDBUtils.hpp>
@@ -30,6 +33,8 @@ struct Interior {
     double closing_distance = 0.;
     double thickness = 0.;
     double voxel_scale = 1.;
+    bool   holes_stamped = false; // mesh was re-extracted with drain holes
+
     double nb_in = 3.;  // narrow band width inwards
     double nb_out = 3.; // narrow band width outwards
     // Full narrow band is the sum of the two above values.
@@ -57,6 +62,58 @@ const indexed_triangle_set &get_mesh(const Interior &interior)
     return interior.mesh;
 }
 
+namespace {
+
+// Content hash of the mesh to be hollowed, used as the cache key for the
+// voxelized signed distance field below.
+uint64_t hollowing_mesh_hash(const indexed_triangle_set &its)
+{
+    auto combine = [](uint64_t &seed, uint64_t v) {
+        seed ^= v + 0x9e3779b97f4a7c15ull + (seed << 6) + (seed >> 2);
+    };
+
+    uint64_t seed = 0xcbf29ce484222325ull;
+    combine(seed, its.vertices.size());
+    combine(seed, its.indices.size());
+    for (const Vec3f &v : its.vertices)
+        for (int i = 0; i < 3; ++i) {
+            uint32_t bits;
+            std::memcpy(&bits, &v(i), sizeof(bits));
+            combine(seed, bits);
+        }
+    for (const Vec3i &f : its.indices)
+        for (int i = 0; i < 3; ++i)
+            combine(seed, uint64_t(uint32_t(f(i))));
+
+    return seed;
+}
+
+// Voxelizing the input mesh (mesh_to_grid) dominates the cost of hollowing,
+// while redistancing and isosurface extraction are comparatively cheap. The
+// unredistanced level-set grid is therefore retained between calls, keyed by
+// the mesh content and voxel scale, so that changing only the hollowing
+// thickness or closing distance re-extracts the offset surface from the
+// existing grid. A single entry is kept: the interactive use case is one mesh
+// being tuned at a time and the grid can take hundreds of megabytes.
+struct VoxelGridCacheEntry
+{
+    uint64_t mesh_hash   = 0;
+    double   voxel_scale = 0.;
+
+    // Narrow band widths the grid was built with. A cached grid can only be
+    // reused when its bands cover the widths required by the requested
+    // offsets, otherwise the level-set is truncated too close to the surface.
+    float out_range = 0.f;
+    float in_range  = 0.f;
+
+    openvdb::FloatGrid::Ptr grid;
+};
+
+std::mutex          voxel_grid_cache_mutex;
+VoxelGridCacheEntry voxel_grid_cache;
+
+} // namespace
+
 static InteriorPtr generate_interior_verbose(const TriangleMesh & mesh,
                                              const JobController &ctl,
                                              double min_thickness,
@@ -71,7 +128,40 @@ static InteriorPtr generate_interior_verbose(const TriangleMesh & mesh,
     if (ctl.stopcondition()) return {};
     else ctl.statuscb(0, L("Hollowing"));
 
-    auto gridptr = mesh_to_grid(mesh.its, {}, voxel_scale, out_range, in_range);
+    uint64_t mesh_hash = hollowing_mesh_hash(mesh.its);
+
+    openvdb::FloatGrid::Ptr gridptr;
+    bool had_entry_for_mesh = false;
+    {
+        std::lock_guard<std::mutex> lk{voxel_grid_cache_mutex};
+        if (voxel_grid_cache.grid && voxel_grid_cache.mesh_hash == mesh_hash &&
+            voxel_grid_cache.voxel_scale == voxel_scale) {
+            had_entry_for_mesh = true;
+            if (voxel_grid_cache.out_range >= out_range &&
+                voxel_grid_cache.in_range >= in_range)
+                gridptr = voxel_grid_cache.grid;
+        }
+    }
+
+    if (! gridptr) {
+        // A cached grid for this mesh that proved too narrow means the user
+        // is growing the thickness interactively. Build the new bands with
+        // headroom so that further increases keep hitting the cache.
+        float build_out_range = out_range, build_in_range = in_range;
+        if (had_entry_for_mesh) {
+            build_out_range *= 1.5f;
+            build_in_range  *= 1.5f;
+        }
+
+        gridptr = mesh_to_grid(mesh.its, {}, voxel_scale, build_out_range,
+                               build_in_range);
+
+        if (gridptr) {
+            std::lock_guard<std::mutex> lk{voxel_grid_cache_mutex};
+            voxel_grid_cache = {mesh_hash, voxel_scale, build_out_range,
+                                build_in_range, gridptr};
+        }
+    }
 
     assert(gridptr);
 
@@ -108,6 +198,23 @@ static InteriorPtr generate_interior_verbose(const TriangleMesh & mesh,
     return interior;
 }
 
+// The isosurface extraction yields a heavily over-tessellated mesh,
+// simplify it lossless.
+static void simplify_interior_mesh(indexed_triangle_set &m)
+{
+    // flip normals back...
+    swap_normals(m);
+
+    float loss_less_max_error = 2*std::numeric_limits<float>::epsilon();
+    its_quadric_edge_collapse(m, 0U, &loss_less_max_error);
+
+    its_compactify_vertices(m);
+    its_merge_vertices(m);
+
+    // flip normals back...
+    swap_normals(m);
+}
+
 InteriorPtr generate_interior(const TriangleMesh &   mesh,
                               const HollowingConfig &hc,
                               const JobController &  ctl)
@@ -128,21 +235,8 @@ InteriorPtr generate_interior(const TriangleMesh &   mesh,
         generate_interior_verbose(mesh, ctl, hc.min_thickness, voxel_scale,
                                   hc.closing_distance);
 
-    if (interior && !interior->mesh.empty()) {
-
-        // flip normals back...
-        swap_normals(interior->mesh);
-
-        // simplify mesh lossless
-        float loss_less_max_error = 2*std::numeric_limits<float>::epsilon();
-        its_quadric_edge_collapse(interior->mesh, 0U, &loss_less_max_error);
-
-        its_compactify_vertices(interior->mesh);
-        its_merge_vertices(interior->mesh);
-
-        // flip normals back...
-        swap_normals(interior->mesh);
-    }
+    if (interior && !interior->mesh.empty())
+        simplify_interior_mesh(interior->mesh);
 
     return interior;
 }
@@ -319,6 +413,91 @@ void hollow_mesh(TriangleMesh &mesh, const Interior &interior, int flags)
     mesh.merge(TriangleMesh{interior.mesh});
 }
 
+// Signed distance of point p to a capped cylinder with base center c, unit
+// axis n, radius r and height h. Negative inside.
+static double capped_cylinder_sd(const Vec3d &p, const Vec3d &c,
+                                 const Vec3d &n, double r, double h)
+{
+    Vec3d  d  = p - c;
+    double t  = d.dot(n);
+    double dr = (d - t * n).norm() - r;  // distance to the wall
+    double dh = std::max(-t, t - h);     // distance to the closer base
+
+    return std::min(std::max(dr, dh), 0.) +
+           std::hypot(std::max(dr, 0.), std::max(dh, 0.));
+}
+
+// Composite the union of all drain hole cylinders into the cavity level-set.
+// The cavity surface sits at the 'iso' value, so the cylinder distance fields
+// are shifted by iso and written with a pointwise minimum -- the CSG union on
+// signed distance fields.
+static void stamp_drainholes(openvdb::FloatGrid &grid,
+                             const DrainHoles &  holes,
+                             double              voxel_scale,
+                             double              iso)
+{
+    auto acc = grid.getAccessor();
+    const openvdb::math::Transform &tr = grid.transform();
+
+    for (const DrainHole &hole : holes) {
+        // The grid was sampled from the mesh scaled up by voxel_scale, the
+        // holes need the same scaling.
+        Vec3d  c = hole.pos.cast<double>() * voxel_scale;
+        Vec3d  n = hole.normal.cast<double>().normalized();
+        double r = double(hole.radius) * voxel_scale;
+        double h = double(hole.height) * voxel_scale;
+
+        // Pad the cylinder's bounding box with two voxels so that the zero
+        // crossing is fully covered by the written values.
+        Vec3d top  = c + h * n;
+        Vec3d pad  = Vec3d::Constant(r + 2.);
+        Vec3d bmin = c.cwiseMin(top) - pad;
+        Vec3d bmax = c.cwiseMax(top) + pad;
+
+        openvdb::Coord imin =
+            tr.worldToIndexCellCentered({bmin.x(), bmin.y(), bmin.z()});
+        openvdb::Coord imax =
+            tr.worldToIndexCellCentered({bmax.x(), bmax.y(), bmax.z()});
+
+        for (int x = imin.x(); x <= imax.x(); ++x)
+            for (int y = imin.y(); y <= imax.y(); ++y)
+                for (int z = imin.z(); z <= imax.z(); ++z) {
+                    openvdb::Coord xyz{x, y, z};
+                    openvdb::Vec3d wp = tr.indexToWorld(xyz);
+
+                    double sd = capped_cylinder_sd({wp.x(), wp.y(), wp.z()},
+                                                   c, n, r, h);
+
+                    float v = float(sd + iso);
+                    if (v < acc.getValue(xyz)) acc.setValueOn(xyz, v);
+                }
+    }
+}
+
+void drill_holes(Interior &interior, const DrainHoles &holes)
+{
+    if (!interior.gridptr) return;
+
+    // An empty hole set on a pristine interior is a no-op. If holes were
+    // stamped previously, fall through to restore the undrilled cavity.
+    if (holes.empty() && !interior.holes_stamped) return;
+
+    // Stamp into a copy, the pristine cavity grid is kept so that an edited
+    // hole set can be drilled into the same interior again.
+    openvdb::FloatGrid::Ptr grid = interior.gridptr;
+    if (!holes.empty()) {
+        grid = interior.gridptr->deepCopy();
+        stamp_drainholes(*grid, holes, interior.voxel_scale,
+                         interior.closing_distance);
+    }
+
+    interior.mesh = grid_to_mesh(*grid, interior.closing_distance, 0.);
+    interior.holes_stamped = !holes.empty();
+
+    if (!interior.mesh.empty())
+        simplify_interior_mesh(interior.mesh);
+}
+
 // Get the distance of p to the interior's zero iso_surface. Interior should
 // have its zero isosurface positioned at offset + closing_distance inwards form
 // the model surface.
@@ -80,6 +80,13 @@ void hollow_mesh(TriangleMesh &mesh, const HollowingConfig &cfg, int flags = 0);
 // Hollowing prepared in "interior", merge with original mesh
 void hollow_mesh(TriangleMesh &mesh, const Interior &interior, int flags = 0);
 
+// Drill the drain holes into the hollowed interior. All hole cylinders are
+// composited into the cavity's signed distance grid in a single pass and the
+// interior mesh is re-extracted from the result, so the cost does not grow
+// with a mesh boolean per hole. The pristine grid is kept aside, calling this
+// again with a different hole set re-drills from scratch.
+void drill_holes(Interior &interior, const DrainHoles &holes);
+
 void remove_inside_triangles(TriangleMesh &mesh, const Interior &interior,
                              const std::vector<bool> &exclude_mask = {});
 
@@ -88,7 +88,18 @@ public:
     
     /// Draw a polygon with holes.
     virtual void draw(const ExPolygon& poly) = 0;
-    
+
+    /// Draw a batch of polygons, e.g. a whole layer. The default implementation
+    /// draws them one by one, subclasses may render the batch in parallel.
+    virtual void draw(const ExPolygons &polys)
+    {
+        for (const ExPolygon &poly : polys) draw(poly);
+    }
+
+    /// Revert the raster to the clean, freshly constructed state so that its
+    /// buffers can be reused for another layer.
+    virtual void reset() = 0;
+
     /// Get the resolution of the raster.
     virtual Resolution resolution() const = 0;
     virtual PixelDim   pixel_dimensions() const = 0;
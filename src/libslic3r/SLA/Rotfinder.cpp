@@ -10,6 +10,7 @@
 
 #include "libslic3r/SLAPrint.hpp"
 #include "libslic3r/PrintConfig.hpp"
+#include "libslic3r/ShortEdgeCollapse.hpp"
 
 #include <libslic3r/Geometry.hpp>
 
@@ -252,6 +253,19 @@ std::vector<XYRotation> get_chull_rotations(const TriangleMesh &mesh, size_t max
     return ret;
 }
 
+// Decimated copy of the mesh for the coarse rounds of a rotation search.
+// Returns an empty mesh when the input is already small enough for the
+// decimation not to pay off.
+TriangleMesh decimated_mesh(const TriangleMesh &mesh, size_t target_facecount)
+{
+    if (mesh.its.indices.size() <= 2 * target_facecount) return {};
+
+    indexed_triangle_set its = mesh.its;
+    its_short_edge_collpase(its, target_facecount);
+
+    return TriangleMesh{std::move(its)};
+}
+
 // Find the best score from a set of function inputs. Evaluate for every point.
 template<size_t N, class Fn, class It, class StopCond>
 std::array<double, N> find_min_score(Fn &&fn, It from, It to, StopCond &&stopfn)
@@ -329,6 +343,15 @@ Vec2d find_best_misalignment_rotation(const ModelObject &      mo,
 {
     RotfinderBoilerplate<1000> bp{mo, params};
 
+    // Run the bulk of the grid search on a decimated mesh: the objective is an
+    // area weighted average over the faces, thus a coarse mesh ranks the
+    // candidate rotations reliably and only the winner needs to be refined on
+    // the full resolution mesh. The scoring of one candidate stays parallel
+    // over the faces through execution::reduce.
+    constexpr size_t CoarseFaceCount = 25000;
+    TriangleMesh coarse = decimated_mesh(bp.mesh, CoarseFaceCount);
+    const TriangleMesh &searchmesh = coarse.empty() ? bp.mesh : coarse;
+
     // Preparing the optimizer.
     size_t gridsize = std::sqrt(bp.max_tries);
     opt::Optimizer<opt::AlgBruteForce> solver(
@@ -343,13 +366,36 @@ Vec2d find_best_misalignment_rotation(const ModelObject &      mo,
     auto bounds = opt::bounds({ {-PI, PI}, {-PI, PI} });
 
     auto result = solver.to_max().optimize(
-        [&bp] (const XYRotation &rot)
+        [&bp, &searchmesh] (const XYRotation &rot)
         {
             bp.statusfn();
-            return get_misalginment_score(bp.mesh, to_transform3f(rot));
+            return get_misalginment_score(searchmesh, to_transform3f(rot));
         }, opt::initvals({0., 0.}), bounds);
 
-    return {result.optimum[0], result.optimum[1]};
+    XYRotation rot = result.optimum;
+
+    if (!coarse.empty()) {
+        // Refine the coarse winner on the full resolution mesh, searching one
+        // coarse grid cell around it with a tenth of the evaluation budget.
+        double cell = 2 * PI / gridsize;
+        auto refine_bounds = opt::bounds({ {rot[0] - cell, rot[0] + cell},
+                                           {rot[1] - cell, rot[1] + cell} });
+
+        size_t refine_tries = std::max(size_t(16), size_t(bp.max_tries) / 10);
+        opt::Optimizer<opt::AlgBruteForce> refine_solver(
+            opt::StopCriteria{}.max_iterations(refine_tries)
+                               .stop_condition([&bp] { return bp.stopcond(); }),
+            size_t(std::sqrt(refine_tries))
+        );
+
+        rot = refine_solver.to_max().optimize(
+            [&bp] (const XYRotation &r)
+            {
+                return get_misalginment_score(bp.mesh, to_transform3f(r));
+            }, opt::initvals({rot[0], rot[1]}), refine_bounds).optimum;
+    }
+
+    return {rot[0], rot[1]};
 }
 
 Vec2d find_least_supports_rotation(const ModelObject &      mo,
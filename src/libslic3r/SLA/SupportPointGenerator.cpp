@@ -1,6 +1,7 @@
 //#include "igl/random_points_on_mesh.h"
 //#include "igl/AABB.h"
 
+#include <tbb/blocked_range.h>
 #include <tbb/parallel_for.h>
 
 #include "SupportPointGenerator.hpp"
@@ -13,6 +14,7 @@
 #include "ClipperUtils.hpp"
 #include "Tesselate.hpp"
 #include "MinAreaBoundingBox.hpp"
+#include "Utils.hpp"
 #include "libslic3r.h"
 
 #include <iostream>
@@ -61,8 +63,12 @@ SupportPointGenerator::SupportPointGenerator(
         std::function<void(int)>  statusfn)
     : SupportPointGenerator(emesh, config, throw_on_cancel, statusfn)
 {
-    std::random_device rd;
-    m_rng.seed(rd());
+    if (deterministic_mode()) {
+        m_rng.seed(27644437);
+    } else {
+        std::random_device rd;
+        m_rng.seed(rd());
+    }
     execute(slices, heights);
 }
 
@@ -272,11 +278,36 @@ void SupportPointGenerator::process(const std::vector<ExPolygons>& slices, const
             }
         }
         // Now iterate over all polygons and append new points if needed.
-        for (Structure &s : layer_top->islands) {
+        for (Structure &s : layer_top->islands)
             // Penalization resulting from large diff from the last layer:
             s.supports_force_inherited /= std::max(1.f, 0.17f * (s.overhangs_area) / s.area);
 
-            add_support_points(s, point_grid);
+        // Sampling of an island only reads the shared point grid and touches its own
+        // bookkeeping, so the islands of one layer are sampled in parallel. The accepted
+        // samples are committed to the grid serially below, in island order, so that the
+        // minimum spacing against points of neighboring islands is still enforced.
+        std::vector<std::vector<PendingSupportPoint>> pending_per_island(layer_top->islands.size());
+        std::vector<std::mt19937::result_type>        island_seeds(layer_top->islands.size());
+        for (std::mt19937::result_type &s : island_seeds)
+            s = m_rng();
+        tbb::parallel_for(tbb::blocked_range<size_t>(0, layer_top->islands.size()),
+            [this, layer_top, &point_grid, &pending_per_island, &island_seeds](const tbb::blocked_range<size_t> &range) {
+                for (size_t island_idx = range.begin(); island_idx < range.end(); ++ island_idx) {
+                    std::mt19937 rng(island_seeds[island_idx]);
+                    add_support_points(layer_top->islands[island_idx], point_grid, rng, pending_per_island[island_idx]);
+                }
+            });
+        for (size_t island_idx = 0; island_idx < layer_top->islands.size(); ++ island_idx) {
+            Structure &s = layer_top->islands[island_idx];
+            for (const PendingSupportPoint &pt : pending_per_island[island_idx]) {
+                if (point_grid.collides_with(pt.pos, float(s.layer->print_z), pt.min_spacing)) {
+                    // A point of a neighboring island of this layer was committed too close.
+                    s.supports_force_this_layer -= m_config.support_force();
+                    continue;
+                }
+                m_output.emplace_back(float(pt.pos.x()), float(pt.pos.y()), s.zlevel, m_config.head_diameter/2.f, pt.is_new_island);
+                point_grid.insert(pt.pos, &s);
+            }
         }
 
         m_throw_on_cancel();
@@ -294,7 +325,8 @@ void SupportPointGenerator::process(const std::vector<ExPolygons>& slices, const
     }
 }
 
-void SupportPointGenerator::add_support_points(SupportPointGenerator::Structure &s, SupportPointGenerator::PointGrid3D &grid3d)
+void SupportPointGenerator::add_support_points(SupportPointGenerator::Structure &s, const SupportPointGenerator::PointGrid3D &grid3d,
+                                               std::mt19937 &rng, std::vector<PendingSupportPoint> &pending)
 {
     // Select each type of surface (overrhang, dangling, slope), derive the support
     // force deficit for it and call uniformly conver with the right params
@@ -305,12 +337,12 @@ void SupportPointGenerator::add_support_points(SupportPointGenerator::Structure
     if (s.islands_below.empty()) {
         // completely new island - needs support no doubt
         // deficit is full, there is nothing below that would hold this island
-        uniformly_cover({ *s.polygon }, s, s.area * tp, grid3d, IslandCoverageFlags(icfIsNew | icfWithBoundary) );
+        uniformly_cover({ *s.polygon }, s, s.area * tp, grid3d, rng, pending, IslandCoverageFlags(icfIsNew | icfWithBoundary) );
         return;
     }
 
     if (! s.overhangs.empty()) {
-        uniformly_cover(s.overhangs, s, s.overhangs_area * tp, grid3d);
+        uniformly_cover(s.overhangs, s, s.overhangs_area * tp, grid3d, rng, pending);
     }
 
     auto areafn = [](double sum, auto &p) { return sum + p.area() * SCALING_FACTOR * SCALING_FACTOR; };
@@ -321,13 +353,13 @@ void SupportPointGenerator::add_support_points(SupportPointGenerator::Structure
         // What we now have in polygons needs support, regardless of what the forces are, so we can add them.
 
         double a = std::accumulate(s.dangling_areas.begin(), s.dangling_areas.end(), 0., areafn);
-        uniformly_cover(s.dangling_areas, s, a * tp - a * current * s.area, grid3d, icfWithBoundary);
+        uniformly_cover(s.dangling_areas, s, a * tp - a * current * s.area, grid3d, rng, pending, icfWithBoundary);
     }
 
     current = s.supports_force_total();
     if (! s.overhangs_slopes.empty()) {
         double a = std::accumulate(s.overhangs_slopes.begin(), s.overhangs_slopes.end(), 0., areafn);
-        uniformly_cover(s.overhangs_slopes, s, a * tp - a * current / s.area, grid3d, icfWithBoundary);
+        uniformly_cover(s.overhangs_slopes, s, a * tp - a * current / s.area, grid3d, rng, pending, icfWithBoundary);
     }
 }
 
@@ -542,7 +574,8 @@ static inline std::vector<Vec2f> poisson_disk_from_samples(const std::vector<Vec
 }
 
 
-void SupportPointGenerator::uniformly_cover(const ExPolygons& islands, Structure& structure, float deficit, PointGrid3D &grid3d, IslandCoverageFlags flags)
+void SupportPointGenerator::uniformly_cover(const ExPolygons& islands, Structure& structure, float deficit, const PointGrid3D &grid3d,
+                                            std::mt19937 &rng, std::vector<PendingSupportPoint> &pending, IslandCoverageFlags flags)
 {
     //int num_of_points = std::max(1, (int)((island.area()*pow(SCALING_FACTOR, 2) * m_config.tear_pressure)/m_config.support_force));
 
@@ -580,14 +613,20 @@ void SupportPointGenerator::uniformly_cover(const ExPolygons& islands, Structure
     std::vector<Vec2f> raw_samples =
         flags & icfWithBoundary ?
             sample_expolygon_with_boundary(islands, samples_per_mm2,
-                                           5.f / poisson_radius, m_rng) :
-            sample_expolygon(islands, samples_per_mm2, m_rng);
+                                           5.f / poisson_radius, rng) :
+            sample_expolygon(islands, samples_per_mm2, rng);
 
     std::vector<Vec2f>  poisson_samples;
     for (size_t iter = 0; iter < 4; ++ iter) {
         poisson_samples = poisson_disk_from_samples(raw_samples, poisson_radius,
-            [&structure, &grid3d, min_spacing](const Vec2f &pos) {
-                return grid3d.collides_with(pos, structure.layer->print_z, min_spacing);
+            [&structure, &grid3d, &pending, min_spacing](const Vec2f &pos) {
+                if (grid3d.collides_with(pos, float(structure.layer->print_z), min_spacing))
+                    return true;
+                // Samples accepted for this island earlier are not in the shared grid yet.
+                for (const PendingSupportPoint &pt : pending)
+                    if ((pt.pos - pos).squaredNorm() < min_spacing * min_spacing)
+                        return true;
+                return false;
             });
         if (poisson_samples.size() >= poisson_samples_target || m_config.minimal_distance > poisson_radius-EPSILON)
             break;
@@ -613,13 +652,12 @@ void SupportPointGenerator::uniformly_cover(const ExPolygons& islands, Structure
 
 //    assert(! poisson_samples.empty());
     if (poisson_samples_target < poisson_samples.size()) {
-        std::shuffle(poisson_samples.begin(), poisson_samples.end(), m_rng);
+        std::shuffle(poisson_samples.begin(), poisson_samples.end(), rng);
         poisson_samples.erase(poisson_samples.begin() + poisson_samples_target, poisson_samples.end());
     }
     for (const Vec2f &pt : poisson_samples) {
-        m_output.emplace_back(float(pt(0)), float(pt(1)), structure.zlevel, m_config.head_diameter/2.f, flags & icfIsNew);
+        pending.push_back(PendingSupportPoint{pt, min_spacing, bool(flags & icfIsNew)});
         structure.supports_force_this_layer += m_config.support_force();
-        grid3d.insert(pt, &structure);
     }
 }
 
@@ -136,6 +136,16 @@ public:
         Vec3f        position;
         Structure   *island;
     };
+
+    // A sample accepted for an island, but not yet committed to the shared point grid.
+    // The islands of one layer are sampled in parallel against a frozen grid; the pending
+    // points are then committed serially in island order.
+    struct PendingSupportPoint {
+        Vec2f   pos;
+        // Minimum distance to other support points this sample was accepted with.
+        float   min_spacing;
+        bool    is_new_island;
+    };
     
     struct PointGrid3D {
         struct GridHash {
@@ -148,7 +158,7 @@ public:
         Vec3f   cell_size;
         Grid    grid;
         
-        Vec3i cell_id(const Vec3f &pos) {
+        Vec3i cell_id(const Vec3f &pos) const {
             return Vec3i(int(floor(pos.x() / cell_size.x())),
                          int(floor(pos.y() / cell_size.y())),
                          int(floor(pos.z() / cell_size.z())));
@@ -161,7 +171,7 @@ public:
             grid.emplace(cell_id(pt.position), pt);
         }
         
-        bool collides_with(const Vec2f &pos, float print_z, float radius) {
+        bool collides_with(const Vec2f &pos, float print_z, float radius) const {
             Vec3f pos3d(pos.x(), pos.y(), print_z);
             Vec3i cell = cell_id(pos3d);
             std::pair<Grid::const_iterator, Grid::const_iterator> it_pair = grid.equal_range(cell);
@@ -180,7 +190,7 @@ public:
         }
         
     private:
-        bool collides_with(const Vec3f &pos, float radius, Grid::const_iterator it_begin, Grid::const_iterator it_end) {
+        bool collides_with(const Vec3f &pos, float radius, Grid::const_iterator it_begin, Grid::const_iterator it_end) const {
             for (Grid::const_iterator it = it_begin; it != it_end; ++ it) {
                 float dist2 = (it->second.position - pos).squaredNorm();
                 if (dist2 < radius * radius)
@@ -206,9 +216,10 @@ public:
 
 private:
 
-    void uniformly_cover(const ExPolygons& islands, Structure& structure, float deficit, PointGrid3D &grid3d, IslandCoverageFlags flags = icfNone);
+    void uniformly_cover(const ExPolygons& islands, Structure& structure, float deficit, const PointGrid3D &grid3d,
+                         std::mt19937 &rng, std::vector<PendingSupportPoint> &pending, IslandCoverageFlags flags = icfNone);
 
-    void add_support_points(Structure& structure, PointGrid3D &grid3d);
+    void add_support_points(Structure& structure, const PointGrid3D &grid3d, std::mt19937 &rng, std::vector<PendingSupportPoint> &pending);
 
     void project_onto_mesh(std::vector<SupportPoint>& points) const;
 
@@ -127,45 +127,54 @@ const indexed_triangle_set &SupportTreeBuilder::merged_mesh(size_t steps) const
     if (m_meshcache_valid) return m_meshcache;
     
     indexed_triangle_set merged;
-    
+
+    // Collect the meshes of the individual elements first, the bulk merging
+    // overload of its_merge() can then assemble them with a single exact
+    // allocation instead of regrowing the merged mesh for every element.
+    std::vector<indexed_triangle_set> element_meshes;
+    element_meshes.reserve(m_heads.size() + m_pillars.size() +
+                           m_pedestals.size() + m_junctions.size() +
+                           m_bridges.size() + m_crossbridges.size() +
+                           m_diffbridges.size() + m_anchors.size());
+
     for (auto &head : m_heads) {
         if (ctl().stopcondition()) break;
-        if (head.is_valid()) its_merge(merged, get_mesh(head, steps));
+        if (head.is_valid()) element_meshes.emplace_back(get_mesh(head, steps));
     }
-    
+
     for (auto &pill : m_pillars) {
         if (ctl().stopcondition()) break;
-        its_merge(merged, get_mesh(pill, steps));
+        element_meshes.emplace_back(get_mesh(pill, steps));
     }
 
     for (auto &pedest : m_pedestals) {
         if (ctl().stopcondition()) break;
-        its_merge(merged, get_mesh(pedest, steps));
+        element_meshes.emplace_back(get_mesh(pedest, steps));
     }
-    
+
     for (auto &j : m_junctions) {
         if (ctl().stopcondition()) break;
-        its_merge(merged, get_mesh(j, steps));
+        element_meshes.emplace_back(get_mesh(j, steps));
     }
 
     for (auto &bs : m_bridges) {
         if (ctl().stopcondition()) break;
-        its_merge(merged, get_mesh(bs, steps));
+        element_meshes.emplace_back(get_mesh(bs, steps));
     }
-    
+
     for (auto &bs : m_crossbridges) {
         if (ctl().stopcondition()) break;
-        its_merge(merged, get_mesh(bs, steps));
+        element_meshes.emplace_back(get_mesh(bs, steps));
     }
 
     for (auto &bs : m_diffbridges) {
         if (ctl().stopcondition()) break;
-        its_merge(merged, get_mesh(bs, steps));
+        element_meshes.emplace_back(get_mesh(bs, steps));
     }
 
     for (auto &anch : m_anchors) {
         if (ctl().stopcondition()) break;
-        its_merge(merged, get_mesh(anch, steps));
+        element_meshes.emplace_back(get_mesh(anch, steps));
     }
 
     if (ctl().stopcondition()) {
@@ -173,7 +182,9 @@ const indexed_triangle_set &SupportTreeBuilder::merged_mesh(size_t steps) const
         m_meshcache = {};
         return m_meshcache;
     }
-    
+
+    its_merge(merged, element_meshes);
+
     m_meshcache = merged;
     
     // The mesh will be passed by const-pointer to TriangleMeshSlicer,
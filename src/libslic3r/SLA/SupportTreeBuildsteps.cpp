@@ -777,18 +777,26 @@ void SupportTreeBuildsteps::classify()
     // pillars and which shall be connected to the model surface (or
     // search a suitable path around the surface that leads to the
     // ground -- TODO)
-    for(unsigned i : m_iheads) {
+
+    // The downward collision scans of the heads are independent of each other,
+    // run them concurrently against the shared mesh index and do the serial
+    // classification from the collected results afterwards.
+    std::vector<IndexedMesh::hit_result> hits(m_iheads.size());
+
+    ccr::for_each(size_t(0), m_iheads.size(), [this, &hits](size_t n) {
         m_thr();
 
-        Head &head = m_builder.head(i);
-        double r = head.r_back_mm;
-        Vec3d headjp = head.junction_point();
+        Head &head = m_builder.head(m_iheads[n]);
+        hits[n] = bridge_mesh_intersect(head.junction_point(), DOWN,
+                                        head.r_back_mm);
+    });
 
-        // collision check
-        auto hit = bridge_mesh_intersect(headjp, DOWN, r);
+    for (size_t n = 0; n < m_iheads.size(); ++n) {
+        unsigned i = m_iheads[n];
+        const auto &hit = hits[n];
 
         if(std::isinf(hit.distance())) ground_head_indices.emplace_back(i);
-        else if(m_cfg.ground_facing_only)  head.invalidate();
+        else if(m_cfg.ground_facing_only)  m_builder.head(i).invalidate();
         else m_iheads_onmodel.emplace_back(i);
 
         m_head_to_ground_scans[i] = hit;
@@ -817,10 +825,18 @@ void SupportTreeBuildsteps::classify()
 
 void SupportTreeBuildsteps::routing_to_ground()
 {
-    ClusterEl cl_centroids;
-    cl_centroids.reserve(m_pillar_clusters.size());
+    // Head id marking a cluster without a routed centroid (e.g. an empty one).
+    constexpr unsigned NoCentroid = std::numeric_limits<unsigned>::max();
+
+    ClusterEl cl_centroids(m_pillar_clusters.size(), NoCentroid);
+
+    // The clusters are spatially independent by construction, create their
+    // centroid pillars concurrently. The builder and the pillar index are
+    // guarded, only the classification output needs a local lock.
+    ccr::BlockingMutex onmodel_mtx;
 
-    for (auto &cl : m_pillar_clusters) {
+    ccr::for_each(size_t(0), m_pillar_clusters.size(),
+                  [this, &cl_centroids, &onmodel_mtx](size_t ci) {
         m_thr();
 
         // place all the centroid head positions into the index. We
@@ -831,7 +847,8 @@ void SupportTreeBuildsteps::routing_to_ground()
         // sidehead is allowed to connect to a nearby pillar to
         // increase structural stability.
 
-        if (cl.empty()) continue;
+        const ClusterEl &cl = m_pillar_clusters[ci];
+        if (cl.empty()) return;
 
         // get the current cluster centroid
         auto &      thr    = m_thr;
@@ -847,28 +864,32 @@ void SupportTreeBuildsteps::routing_to_ground()
         assert(lcid >= 0);
         unsigned hid = cl[size_t(lcid)]; // Head ID
 
-        cl_centroids.emplace_back(hid);
+        cl_centroids[ci] = hid;
 
         Head &h = m_builder.head(hid);
 
         if (!create_ground_pillar(h.junction_point(), h.dir, h.r_back_mm, h.id)) {
             BOOST_LOG_TRIVIAL(warning)
                 << "Pillar cannot be created for support point id: " << hid;
+            std::lock_guard<ccr::BlockingMutex> lk(onmodel_mtx);
             m_iheads_onmodel.emplace_back(h.id);
-            continue;
         }
-    }
+    });
 
     // now we will go through the clusters ones again and connect the
     // sidepoints with the cluster centroid (which is a ground pillar)
-    // or a nearby pillar if the centroid is unreachable.
-    size_t ci = 0;
-    for (auto cl : m_pillar_clusters) {
+    // or a nearby pillar if the centroid is unreachable. The clusters only
+    // share the guarded pillar index and builder, so they can be routed
+    // concurrently as well.
+    ccr::for_each(size_t(0), m_pillar_clusters.size(),
+                  [this, &cl_centroids](size_t ci) {
         m_thr();
 
-        auto cidx = cl_centroids[ci++];
+        const ClusterEl &cl = m_pillar_clusters[ci];
+        unsigned cidx = cl_centroids[ci];
+        if (cidx == NoCentroid) return;
 
-        auto q = m_pillar_index.query(m_builder.head(cidx).junction_point(), 1);
+        auto q = m_pillar_index.guarded_query(m_builder.head(cidx).junction_point(), 1);
         if (!q.empty()) {
             long centerpillarID = q.front().second;
             for (auto c : cl) {
@@ -886,7 +907,7 @@ void SupportTreeBuildsteps::routing_to_ground()
                 }
             }
         }
-    }
+    });
 }
 
 bool SupportTreeBuildsteps::connect_to_ground(Head &head, const Vec3d &dir)
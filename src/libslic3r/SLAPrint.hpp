@@ -29,6 +29,31 @@ enum SLAPrintObjectStep : unsigned int {
 	slaposCount
 };
 
+// Step names for the pipeline trace events, found by argument dependent lookup
+// from the PrintBaseWithState / PrintObjectBaseWithState step state machines.
+inline const char* trace_step_name(SLAPrintStep step)
+{
+    switch (step) {
+    case slapsMergeSlicesAndEval: return "merge_slices_and_eval";
+    case slapsRasterize:          return "rasterize";
+    default:                      return "unknown";
+    }
+}
+
+inline const char* trace_step_name(SLAPrintObjectStep step)
+{
+    switch (step) {
+    case slaposHollowing:     return "hollowing";
+    case slaposDrillHoles:    return "drill_holes";
+    case slaposObjectSlice:   return "object_slice";
+    case slaposSupportPoints: return "support_points";
+    case slaposSupportTree:   return "support_tree";
+    case slaposPad:           return "pad";
+    case slaposSliceSupports: return "slice_supports";
+    default:                  return "unknown";
+    }
+}
+
 class SLAPrint;
 class GLCanvas;
 
@@ -271,6 +296,9 @@ protected:
 
     void                    set_trafo(const Transform3d& trafo, bool left_handed) {
         m_transformed_rmesh.invalidate([this, &trafo, left_handed](){ m_trafo = trafo; m_left_handed = left_handed; });
+        // The pad blueprint is sampled from the transformed mesh, it goes
+        // stale together with the transformed mesh cache.
+        m_pad_blueprint_cache.valid = false;
     }
 
     template<class InstVec> inline void set_instances(InstVec&& instances) { m_instances = std::forward<InstVec>(instances); }
@@ -308,6 +336,19 @@ private:
     // Caching the transformed (m_trafo) raw mesh of the object
     mutable CachedObject<TriangleMesh>      m_transformed_rmesh;
 
+    // Cache of the pad blueprint -- the silhouette of the model footprint
+    // sampled from the bottom of the transformed mesh. It only depends on the
+    // transformed mesh and the sampling heights, not on the support points,
+    // thus support point edits re-running the pad step can reuse it.
+    struct PadBlueprintCache
+    {
+        ExPolygons blueprint;
+        float      sampling_height = 0.f;
+        float      layer_height    = 0.f;
+        bool       valid           = false;
+    };
+    mutable PadBlueprintCache               m_pad_blueprint_cache;
+
     class SupportData : public sla::SupportableMesh
     {
     public:
@@ -408,15 +449,36 @@ public:
         const EP & ep       = {})
     {
         m_layers.resize(layer_num);
+
+        // The rasters of a high resolution printer hold large frame buffers. Reuse
+        // them across the layers instead of allocating and clearing a fresh one for
+        // each: a worker takes a pooled raster, resets it and returns it when done.
+        std::mutex pool_mtx;
+        std::vector<std::unique_ptr<sla::RasterBase>> pool;
+
         execution::for_each(
             ep, size_t(0), m_layers.size(),
-            [this, &drawfn, &cancelfn](size_t idx) {
+            [this, &drawfn, &cancelfn, &pool_mtx, &pool](size_t idx) {
                 if (cancelfn()) return;
 
-                sla::EncodedRaster &enc = m_layers[idx];
-                auto                rst = create_raster();
+                std::unique_ptr<sla::RasterBase> rst;
+                {
+                    std::lock_guard<std::mutex> lk{pool_mtx};
+                    if (! pool.empty()) {
+                        rst = std::move(pool.back());
+                        pool.pop_back();
+                    }
+                }
+                if (rst)
+                    rst->reset();
+                else
+                    rst = create_raster();
+
                 drawfn(*rst, idx);
-                enc = rst->encode(get_encoder());
+                m_layers[idx] = rst->encode(get_encoder());
+
+                std::lock_guard<std::mutex> lk{pool_mtx};
+                pool.emplace_back(std::move(rst));
             },
             execution::max_concurrency(ep));
     }
@@ -16,6 +16,7 @@
 #include <libslic3r/AABBTreeIndirect.hpp>
 
 #include <libslic3r/ClipperUtils.hpp>
+#include <libslic3r/Utils.hpp>
 
 #include <boost/log/trivial.hpp>
 
@@ -74,7 +75,7 @@ std::string PRINT_STEP_LABELS(size_t idx)
 
 SLAPrint::Steps::Steps(SLAPrint *print)
     : m_print{print}
-    , m_rng{std::random_device{}()}
+    , m_rng{deterministic_mode() ? std::mt19937::result_type(27644437) : std::mt19937::result_type(std::random_device{}())}
     , objcount{m_print->m_objects.size()}
     , ilhd{m_print->m_material_config.initial_layer_height.getFloat()}
     , ilh{float(ilhd)}
@@ -335,7 +336,6 @@ remove_unconnected_vertices(const indexed_triangle_set &its)
 // Drill holes into the hollowed/original mesh.
 void SLAPrint::Steps::drill_holes(SLAPrintObject &po)
 {
-    /*
     bool needs_drilling = ! po.m_model_object->sla_drain_holes.empty();
     bool is_hollowed =
         (po.m_hollowing_data && po.m_hollowing_data->interior &&
@@ -348,125 +348,38 @@ void SLAPrint::Steps::drill_holes(SLAPrintObject &po)
         return;
     }
 
-    if (! po.m_hollowing_data)
-        po.m_hollowing_data.reset(new SLAPrintObject::HollowingData());
-
-    // Hollowing and/or drilling is active, m_hollowing_data is valid.
-
-    // Regenerate hollowed mesh, even if it was there already. It may contain
-    // holes that are no longer on the frontend.
-    TriangleMesh &hollowed_mesh = po.m_hollowing_data->hollow_mesh_with_holes;
-    hollowed_mesh = po.transformed_mesh();
-    if (is_hollowed)
-        sla::hollow_mesh(hollowed_mesh, *po.m_hollowing_data->interior);
-
-    TriangleMesh &mesh_view = po.m_hollowing_data->hollow_mesh_with_holes_trimmed;
-
-    if (! needs_drilling) {
-        mesh_view = po.transformed_mesh();
-
-        if (is_hollowed)
-            sla::hollow_mesh(mesh_view, *po.m_hollowing_data->interior,
-                             sla::hfRemoveInsideTriangles);
-
-        BOOST_LOG_TRIVIAL(info) << "Drilling skipped (no holes).";
+    if (! is_hollowed) {
+        // The holes are stamped into the level-set grid of the hollowed
+        // interior, without hollowing there is nothing to drill into.
+        BOOST_LOG_TRIVIAL(warning)
+            << "Drain holes are only drilled into hollowed models.";
         return;
     }
 
-    BOOST_LOG_TRIVIAL(info) << "Drilling drainage holes.";
-    sla::DrainHoles drainholes = po.transformed_drainhole_points();
-
-    auto tree = AABBTreeIndirect::build_aabb_tree_over_indexed_triangle_set(
-        hollowed_mesh.its.vertices,
-        hollowed_mesh.its.indices
-    );
-
-    std::uniform_real_distribution<float> dist(0., float(EPSILON));
-    auto holes_mesh_cgal = MeshBoolean::cgal::triangle_mesh_to_cgal({}, {});
-    indexed_triangle_set part_to_drill = hollowed_mesh.its;
-
-    bool hole_fail = false;
-    for (size_t i = 0; i < drainholes.size(); ++i) {
-        sla::DrainHole holept = drainholes[i];
-
-        holept.normal += Vec3f{dist(m_rng), dist(m_rng), dist(m_rng)};
-        holept.normal.normalize();
-        holept.pos += Vec3f{dist(m_rng), dist(m_rng), dist(m_rng)};
-        indexed_triangle_set m = holept.to_mesh();
-
-        part_to_drill.indices.clear();
-        auto bb = bounding_box(m);
-        Eigen::AlignedBox<float, 3> ebb{bb.min.cast<float>(),
-                                        bb.max.cast<float>()};
-
-        AABBTreeIndirect::traverse(
-                    tree,
-                    AABBTreeIndirect::intersecting(ebb),
-                    [&part_to_drill, &hollowed_mesh](size_t faceid)
-        {
-            part_to_drill.indices.emplace_back(hollowed_mesh.its.indices[faceid]);
-        });
-
-        auto cgal_meshpart = MeshBoolean::cgal::triangle_mesh_to_cgal(
-            remove_unconnected_vertices(part_to_drill));
-
-        if (MeshBoolean::cgal::does_self_intersect(*cgal_meshpart)) {
-            BOOST_LOG_TRIVIAL(error) << "Failed to drill hole";
-
-            hole_fail = drainholes[i].failed =
-                    po.model_object()->sla_drain_holes[i].failed = true;
-
-            continue;
-        }
-
-        auto cgal_hole = MeshBoolean::cgal::triangle_mesh_to_cgal(m);
-        MeshBoolean::cgal::plus(*holes_mesh_cgal, *cgal_hole);
-    }
-
-    if (MeshBoolean::cgal::does_self_intersect(*holes_mesh_cgal))
-        throw Slic3r::SlicingError(L("Too many overlapping holes."));
-
-    auto hollowed_mesh_cgal = MeshBoolean::cgal::triangle_mesh_to_cgal(hollowed_mesh);
-
-    if (!MeshBoolean::cgal::does_bound_a_volume(*hollowed_mesh_cgal)) {
-        po.active_step_add_warning(
-            PrintStateBase::WarningLevel::NON_CRITICAL,
-            L("Mesh to be hollowed is not suitable for hollowing (does not "
-              "bound a volume)."));
-    }
-
-    if (!MeshBoolean::cgal::empty(*holes_mesh_cgal)
-        && !MeshBoolean::cgal::does_bound_a_volume(*holes_mesh_cgal)) {
-        po.active_step_add_warning(
-            PrintStateBase::WarningLevel::NON_CRITICAL,
-            L("Unable to drill the current configuration of holes into the "
-              "model."));
-    }
-
-    try {
-        if (!MeshBoolean::cgal::empty(*holes_mesh_cgal))
-            MeshBoolean::cgal::minus(*hollowed_mesh_cgal, *holes_mesh_cgal);
+    sla::Interior &interior = *po.m_hollowing_data->interior;
 
-        hollowed_mesh = MeshBoolean::cgal::cgal_to_triangle_mesh(*hollowed_mesh_cgal);
-        mesh_view = hollowed_mesh;
+    if (needs_drilling)
+        BOOST_LOG_TRIVIAL(info) << "Drilling drainage holes.";
+    else
+        BOOST_LOG_TRIVIAL(info) << "Drilling skipped (no holes).";
 
-        if (is_hollowed) {
-            auto &interior = *po.m_hollowing_data->interior;
-            std::vector<bool> exclude_mask =
-                    create_exclude_mask(mesh_view.its, interior, drainholes);
+    // All hole cylinders are composited into the cavity's distance grid in
+    // one pass and the interior mesh is re-extracted. An empty hole set
+    // restores the undrilled cavity. The exterior shell is not modified
+    // here: slicing subtracts the interior from the model slices, which cuts
+    // the holes through the shell wherever the cylinders poke out of it.
+    sla::drill_holes(interior, po.transformed_drainhole_points());
+    throw_if_canceled();
 
-            sla::remove_inside_triangles(mesh_view, interior, exclude_mask);
-        }
-    } catch (const Slic3r::RuntimeError &) {
-        throw Slic3r::SlicingError(L(
-            "Drilling holes into the mesh failed. "
-            "This is usually caused by broken model. Try to fix it first."));
-    }
+    // Regenerate the cached meshes, the interior may contain holes that are
+    // no longer on the frontend.
+    TriangleMesh &hollowed_mesh = po.m_hollowing_data->hollow_mesh_with_holes;
+    hollowed_mesh = po.transformed_mesh();
+    sla::hollow_mesh(hollowed_mesh, interior);
 
-    if (hole_fail)
-        po.active_step_add_warning(PrintStateBase::WarningLevel::NON_CRITICAL,
-                                   L("Failed to drill some holes into the model"));
-     */
+    TriangleMesh &mesh_view = po.m_hollowing_data->hollow_mesh_with_holes_trimmed;
+    mesh_view = po.transformed_mesh();
+    sla::hollow_mesh(mesh_view, interior, sla::hfRemoveInsideTriangles);
 }
 
 // The slicing will be performed on an imaginary 1D grid which starts from
@@ -713,9 +626,24 @@ void SLAPrint::Steps::generate_pad(SLAPrintObject &po) {
             // we sometimes call it "builtin pad" is enabled so we will
             // get a sample from the bottom of the mesh and use it for pad
             // creation.
-            sla::pad_blueprint(trmesh.its, bp, float(pad_h),
-                               float(po.m_config.layer_height.getFloat()),
-                               [this](){ throw_if_canceled(); });
+
+            // The blueprint only depends on the transformed mesh and the
+            // sampling heights. Support point edits re-run this step without
+            // changing the footprint, so reuse the cached silhouette and
+            // resample only when the mesh transform or the heights changed.
+            auto &cache   = po.m_pad_blueprint_cache;
+            float layer_h = float(po.m_config.layer_height.getFloat());
+            if (!cache.valid || cache.sampling_height != float(pad_h) ||
+                cache.layer_height != layer_h) {
+                cache.blueprint.clear();
+                sla::pad_blueprint(trmesh.its, cache.blueprint, float(pad_h),
+                                   layer_h, [this](){ throw_if_canceled(); });
+                cache.sampling_height = float(pad_h);
+                cache.layer_height    = layer_h;
+                cache.valid           = true;
+            }
+
+            bp = cache.blueprint;
         }
 
         po.m_supportdata->create_pad(bp, pcfg);
@@ -1074,8 +1002,8 @@ void SLAPrint::Steps::rasterize()
         PrintLayer& printlayer = m_print->m_printer_input[idx];
         if(canceled()) return;
 
-        for (const ExPolygon& poly : printlayer.transformed_slices())
-            raster.draw(poly);
+        // Batched draw, the raster may rasterize the layer in parallel bands.
+        raster.draw(printlayer.transformed_slices());
 
         // Status indication guarded with the spinlock
         {
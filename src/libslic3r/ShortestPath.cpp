@@ -13,6 +13,9 @@
 #include <cmath>
 #include <cassert>
 
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+
 namespace Slic3r {
 
 // Naive implementation of the Traveling Salesman Problem, it works by always taking the next closest neighbor.
@@ -179,20 +182,31 @@ std::vector<std::pair<size_t, bool>> chain_segments_greedy_constrained_reversals
 		EndPoint *last_point = nullptr;
 
 		// Assign the closest point and distance to the end points.
-		for (EndPoint &end_point : end_points) {
-	    	assert(end_point.edge_out == nullptr);
-	    	if (&end_point != first_point) {
-		    	size_t this_idx = &end_point - &end_points.front();
-		    	// Find the closest point to this end_point, which lies on a different extrusion path (filtered by the lambda).
-		    	// Ignore the starting point as the starting point is considered to be occupied, no end point coud connect to it.
-				size_t next_idx = find_closest_point(kdtree, end_point.pos, 
-					[this_idx, first_point_idx](size_t idx){ return idx != first_point_idx && (idx ^ this_idx) > 1; });
-				assert(next_idx < end_points.size());
-				EndPoint &end_point2 = end_points[next_idx];
-				end_point.edge_out = &end_point2;
-				end_point.distance_out = (end_point2.pos - end_point.pos).squaredNorm();
+		// Each end point is queried independently against the constant KD tree, thus the queries
+		// may run in parallel and the result does not depend on the number of threads.
+		auto assign_closest = [&end_points, &kdtree, first_point, first_point_idx](size_t range_begin, size_t range_end) {
+			for (size_t i = range_begin; i < range_end; ++ i) {
+				EndPoint &end_point = end_points[i];
+		    	assert(end_point.edge_out == nullptr);
+		    	if (&end_point != first_point) {
+			    	size_t this_idx = i;
+			    	// Find the closest point to this end_point, which lies on a different extrusion path (filtered by the lambda).
+			    	// Ignore the starting point as the starting point is considered to be occupied, no end point coud connect to it.
+					size_t next_idx = find_closest_point(kdtree, end_point.pos,
+						[this_idx, first_point_idx](size_t idx){ return idx != first_point_idx && (idx ^ this_idx) > 1; });
+					assert(next_idx < end_points.size());
+					EndPoint &end_point2 = end_points[next_idx];
+					end_point.edge_out = &end_point2;
+					end_point.distance_out = (end_point2.pos - end_point.pos).squaredNorm();
+				}
 			}
-		}
+		};
+		if (end_points.size() < 256)
+			// Not worth the scheduling overhead of the thread pool.
+			assign_closest(0, end_points.size());
+		else
+			tbb::parallel_for(tbb::blocked_range<size_t>(0, end_points.size()),
+				[&assign_closest](const tbb::blocked_range<size_t> &range) { assign_closest(range.begin(), range.end()); });
 
 	    // Initialize a heap of end points sorted by the lowest distance to the next valid point of a path.
 	    auto queue = make_mutable_priority_queue<EndPoint*, false>(
@@ -675,20 +689,31 @@ std::vector<std::pair<size_t, bool>> chain_segments_greedy_constrained_reversals
 		EndPoint *last_point = nullptr;
 
 		// Assign the closest point and distance to the end points.
-		for (EndPoint &end_point : end_points) {
-	    	assert(end_point.edge_candidate == nullptr);
-	    	if (&end_point != first_point) {
-		    	size_t this_idx = end_point.index(end_points);
-		    	// Find the closest point to this end_point, which lies on a different extrusion path (filtered by the lambda).
-		    	// Ignore the starting point as the starting point is considered to be occupied, no end point coud connect to it.
-				size_t next_idx = find_closest_point(kdtree, end_point.pos, 
-					[this_idx, first_point_idx](size_t idx){ return idx != first_point_idx && (idx ^ this_idx) > 1; });
-				assert(next_idx < end_points.size());
-				EndPoint &end_point2 = end_points[next_idx];
-				end_point.edge_candidate = &end_point2;
-				end_point.distance_out = (end_point2.pos - end_point.pos).norm();
+		// Each end point is queried independently against the constant KD tree, thus the queries
+		// may run in parallel and the result does not depend on the number of threads.
+		auto assign_closest = [&end_points, &kdtree, first_point, first_point_idx](size_t range_begin, size_t range_end) {
+			for (size_t i = range_begin; i < range_end; ++ i) {
+				EndPoint &end_point = end_points[i];
+		    	assert(end_point.edge_candidate == nullptr);
+		    	if (&end_point != first_point) {
+			    	size_t this_idx = i;
+			    	// Find the closest point to this end_point, which lies on a different extrusion path (filtered by the lambda).
+			    	// Ignore the starting point as the starting point is considered to be occupied, no end point coud connect to it.
+					size_t next_idx = find_closest_point(kdtree, end_point.pos,
+						[this_idx, first_point_idx](size_t idx){ return idx != first_point_idx && (idx ^ this_idx) > 1; });
+					assert(next_idx < end_points.size());
+					EndPoint &end_point2 = end_points[next_idx];
+					end_point.edge_candidate = &end_point2;
+					end_point.distance_out = (end_point2.pos - end_point.pos).norm();
+				}
 			}
-		}
+		};
+		if (end_points.size() < 256)
+			// Not worth the scheduling overhead of the thread pool.
+			assign_closest(0, end_points.size());
+		else
+			tbb::parallel_for(tbb::blocked_range<size_t>(0, end_points.size()),
+				[&assign_closest](const tbb::blocked_range<size_t> &range) { assign_closest(range.begin(), range.end()); });
 
 	    // Initialize a heap of end points sorted by the lowest distance to the next valid point of a path.
 	    auto queue = make_mutable_priority_queue<EndPoint*, true>(
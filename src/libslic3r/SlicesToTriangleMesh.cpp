@@ -8,7 +8,6 @@
 #include "libslic3r/Tesselate.hpp"
 
 #include <tbb/parallel_for.h>
-#include <tbb/parallel_reduce.h>
 
 namespace Slic3r {
 
@@ -100,12 +99,10 @@ indexed_triangle_set slices_to_mesh(
         its_merge(layers[i], straight_walls(upper, grid[i], grid[i + 1]));
     });
 
-    auto merge_fn = []( const indexed_triangle_set &a, const indexed_triangle_set &b ) {
-        indexed_triangle_set res{a}; its_merge(res, b); return res;
-    };
-
-    auto ret = execution::reduce(ex_tbb, layers.begin(), layers.end(),
-                                 indexed_triangle_set{}, merge_fn);
+    // Merge the layer meshes in one parallel bulk copy instead of a pairwise
+    // reduction which would copy the intermediate results over and over.
+    indexed_triangle_set ret;
+    its_merge(ret, layers);
 
     its_merge(ret, triangulate_expolygons_3d(slices.front(), zmin, NORMALS_DOWN));
     its_merge(ret, straight_walls(slices.front(), zmin, grid.front()));
@@ -13,6 +13,7 @@
 #include "../TriangleMeshSlicer.hpp"
 
 #include <cassert>
+#include <unordered_map>
 
 #include <tbb/parallel_for.h>
 
@@ -561,29 +562,41 @@ static void triangulate_strip(indexed_triangle_set &its, int ibegin1, int iend1,
     }
 }
 
+// Canonical unit circle at a given discretization level. The levels requested while extruding
+// branch tubes are few (one per rounded vertex count), so the rings are built once per thread
+// and instanced by a scaled frame transform, saving the per-vertex sin/cos evaluations.
+static const std::vector<Vec2f>& unit_circle_ring(int nsteps)
+{
+    static thread_local std::unordered_map<int, std::vector<Vec2f>> rings;
+    std::vector<Vec2f> &ring = rings[nsteps];
+    if (ring.empty()) {
+        ring.reserve(nsteps);
+        const float angle_step = 2 * M_PI / nsteps;
+        for (int i = 0; i < nsteps; ++ i)
+            ring.emplace_back(cos(i * angle_step), sin(i * angle_step));
+    }
+    return ring;
+}
+
 // Discretize 3D circle, append to output vector, return ranges of indices of the points added.
 static std::pair<int, int> discretize_circle(const Vec3f &center, const Vec3f &normal, const float radius, const float eps, std::vector<Vec3f> &pts)
 {
     // Calculate discretization step and number of steps.
     float angle_step = 2. * acos(1. - eps / radius);
     auto  nsteps     = int(ceil(2 * M_PI / angle_step));
-    angle_step = 2 * M_PI / nsteps;
 
     // Prepare coordinate system for the circle plane.
     Vec3f x = normal.cross(Vec3f(0.f, -1.f, 0.f)).normalized();
     Vec3f y = normal.cross(x).normalized();
     assert(std::abs(x.cross(y).dot(normal) - 1.f) < EPSILON);
 
-    // Discretize the circle.
+    // Instance the canonical ring into the circle plane.
     int begin = int(pts.size());
     pts.reserve(pts.size() + nsteps);
-    float angle = 0;
     x *= radius;
     y *= radius;
-    for (int i = 0; i < nsteps; ++ i) {
-        pts.emplace_back(center + x * cos(angle) + y * sin(angle));
-        angle += angle_step;
-    }
+    for (const Vec2f &pt : unit_circle_ring(nsteps))
+        pts.emplace_back(center + x * pt.x() + y * pt.y());
     return { begin, int(pts.size()) };
 }
 
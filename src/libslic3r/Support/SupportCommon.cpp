@@ -166,31 +166,39 @@ std::pair<SupportGeneratorLayersPtr, SupportGeneratorLayersPtr> generate_interfa
                     smooth_outward(closing(std::move(bottom), closing_distance + minimum_island_radius, closing_distance, SUPPORT_SURFACES_OFFSET_PARAMETERS), smoothing_distance) :
                     union_safety_offset(std::move(bottom)),
                 intermediate_layer.polygons);
+            // Don't trim the precomputed Organic supports top interface with base layer
+            // as the precomputed top interface likely expands over multiple tree tips.
+            // The interface consists of the projected contacts (bottom) united with that
+            // precomputed top interface. ClipperLib unites all operands of one execution
+            // implicitly, thus both sets are passed to the boolean calls below as separate
+            // operands instead of materializing their union up front.
+            Polygons top_interface_polygons;
             if (has_top_interface) {
-                // Don't trim the precomputed Organic supports top interface with base layer
-                // as the precomputed top interface likely expands over multiple tree tips.
-                bottom = union_(std::move(top_interface_layer->polygons), bottom);
+                top_interface_polygons = std::move(top_interface_layer->polygons);
                 top_interface_layer->polygons.clear();
             }
-            if (! bottom.empty()) {
+            if (! bottom.empty() || ! top_interface_polygons.empty()) {
                 //FIXME Remove non-printable tiny islands, let them be printed using the base support.
                 //bottom = opening(std::move(bottom), minimum_island_radius);
-                if (! bottom.empty()) {
-                    SupportGeneratorLayer &layer_new = top_interface_layer ? *top_interface_layer : layer_storage.allocate(type);
-                    layer_new.polygons   = std::move(bottom);
-                    layer_new.print_z    = intermediate_layer.print_z;
-                    layer_new.bottom_z   = intermediate_layer.bottom_z;
-                    layer_new.height     = intermediate_layer.height;
-                    layer_new.bridging   = intermediate_layer.bridging;
-                    // Subtract the interface from the base regions.
-                    intermediate_layer.polygons = diff(intermediate_layer.polygons, layer_new.polygons);
-                    if (subtract)
-                        // Trim the base interface layer with the interface layer.
-                        layer_new.polygons = diff(std::move(layer_new.polygons), *subtract);
-                    //FIXME filter layer_new.polygons islands by a minimum area?
-        //                  $interface_area = [ grep abs($_->area) >= $area_threshold, @$interface_area ];
-                    return &layer_new;
-                }
+                SupportGeneratorLayer &layer_new = top_interface_layer ? *top_interface_layer : layer_storage.allocate(type);
+                layer_new.print_z    = intermediate_layer.print_z;
+                layer_new.bottom_z   = intermediate_layer.bottom_z;
+                layer_new.height     = intermediate_layer.height;
+                layer_new.bridging   = intermediate_layer.bridging;
+                // Subtract the interface from the base regions, with both interface operands
+                // as clips of a single execution.
+                intermediate_layer.polygons = diff(intermediate_layer.polygons, { &bottom, &top_interface_polygons });
+                if (subtract)
+                    // Trim the base interface layer with the interface layer, uniting the
+                    // interface operands and subtracting in the same execution.
+                    layer_new.polygons = diff({ &bottom, &top_interface_polygons }, { subtract });
+                else if (has_top_interface)
+                    layer_new.polygons = union_(std::move(top_interface_polygons), std::move(bottom));
+                else
+                    layer_new.polygons = std::move(bottom);
+                //FIXME filter layer_new.polygons islands by a minimum area?
+    //                  $interface_area = [ grep abs($_->area) >= $area_threshold, @$interface_area ];
+                return &layer_new;
             }
             return nullptr;
         };
@@ -1101,13 +1101,22 @@ std::vector<Polygons> PrintObjectSupportMaterial::buildplate_covered(const Print
 struct SupportAnnotations
 {
     SupportAnnotations(const PrintObject &object, const std::vector<Polygons> &buildplate_covered) :
-        enforcers_layers(object.slice_support_enforcers()),
-        blockers_layers(object.slice_support_blockers()),
         buildplate_covered(buildplate_covered)
     {
-        // Append custom supports.
-        object.project_and_append_custom_facets(false, EnforcerBlockerType::ENFORCER, enforcers_layers);
-        object.project_and_append_custom_facets(false, EnforcerBlockerType::BLOCKER, blockers_layers);
+        // Slicing the enforcer / blocker volumes and projecting the respective painted facets
+        // are two independent chains, run them concurrently. They delay the parallel overhang
+        // detection when executed serially.
+        tbb::task_group task_group;
+        task_group.run([this, &object] {
+            enforcers_layers = object.slice_support_enforcers();
+            // Append custom supports.
+            object.project_and_append_custom_facets(false, EnforcerBlockerType::ENFORCER, enforcers_layers);
+        });
+        task_group.run([this, &object] {
+            blockers_layers = object.slice_support_blockers();
+            object.project_and_append_custom_facets(false, EnforcerBlockerType::BLOCKER, blockers_layers);
+        });
+        task_group.wait();
     }
 
     std::vector<Polygons>         enforcers_layers;
@@ -1219,12 +1228,12 @@ static inline std::tuple<Polygons, Polygons, Polygons, float> detect_overhangs(
             Polygons layerm_polygons = to_polygons(layerm->slices.surfaces);
             if (lower_layer_offset == 0.f) {
                 // Support everything.
-                diff_polygons = diff(layerm_polygons, lower_layer_polygons);
-                if (buildplate_only) {
-                    // Don't support overhangs above the top surfaces.
-                    // This step is done before the contact surface is calculated by growing the overhang region.
-                    diff_polygons = diff(diff_polygons, annotations.buildplate_covered[layer_id]);
-                }
+                // Don't support overhangs above the top surfaces when buildplate_only.
+                // This step is done before the contact surface is calculated by growing the overhang region.
+                // Both clip sets are subtracted in a single Clipper execution.
+                diff_polygons = buildplate_only ?
+                    diff(layerm_polygons, { &lower_layer_polygons, &annotations.buildplate_covered[layer_id] }) :
+                    diff(layerm_polygons, lower_layer_polygons);
             } else if (support_auto) {
                 // Get the regions needing a suport, collapse very tiny spots.
                 //FIXME cache the lower layer offset if this layer has multiple regions.
@@ -1241,15 +1250,14 @@ static inline std::tuple<Polygons, Polygons, Polygons, float> detect_overhangs(
                     // no support at all for not so steep overhangs.
                     0.1f * fw);
 #else
-                diff_polygons = 
-                    diff(layerm_polygons,
-                            expand(lower_layer_polygons, lower_layer_offset, SUPPORT_SURFACES_OFFSET_PARAMETERS));
+                const Polygons lower_layer_polygons_expanded = expand(lower_layer_polygons, lower_layer_offset, SUPPORT_SURFACES_OFFSET_PARAMETERS);
+                // Don't support overhangs above the top surfaces when buildplate_only.
+                // This step is done before the contact surface is calculated by growing the overhang region.
+                // Both clip sets are subtracted in a single Clipper execution.
+                diff_polygons = (buildplate_only && ! annotations.buildplate_covered[layer_id].empty()) ?
+                    diff(layerm_polygons, { &lower_layer_polygons_expanded, &annotations.buildplate_covered[layer_id] }) :
+                    diff(layerm_polygons, lower_layer_polygons_expanded);
 #endif
-                if (buildplate_only && ! annotations.buildplate_covered[layer_id].empty()) {
-                    // Don't support overhangs above the top surfaces.
-                    // This step is done before the contact surface is calculated by growing the overhang region.
-                    diff_polygons = diff(diff_polygons, annotations.buildplate_covered[layer_id]);
-                }
                 if (! diff_polygons.empty()) {
                     // Offset the support regions back to a full overhang, restrict them to the full overhang.
                     // This is done to increase size of the supporting columns below, as they are calculated by 
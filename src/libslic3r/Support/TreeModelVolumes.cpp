@@ -23,9 +23,14 @@
 #include "../Utils.hpp"
 #include "../format.hpp"
 
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
 #include <string_view>
 
+#include <boost/filesystem.hpp>
 #include <boost/log/trivial.hpp>
+#include <boost/nowide/fstream.hpp>
 
 #include <tbb/parallel_for.h>
 #include <tbb/task_group.h>
@@ -186,6 +191,23 @@ void TreeModelVolumes::precalculate(const PrintObject& print_object, const coord
 
     throw_on_cancel();
 
+    // Optional persistent cache for farms reslicing identical geometry repeatedly: when
+    // ORCA_TREE_SUPPORT_CACHE_DIR points to a directory, try to load the precalculated
+    // volumes of a previous run with the same outlines and parameters instead of
+    // recomputing them, and store them there after a fresh precalculation.
+    std::string cache_path;
+    uint64_t    cache_hash   = 0;
+    bool        cache_loaded = false;
+    if (const char *cache_dir = std::getenv("ORCA_TREE_SUPPORT_CACHE_DIR"); cache_dir != nullptr && *cache_dir != '\0') {
+        cache_hash = this->persistent_cache_hash(max_layer);
+        char hash_str[17];
+        snprintf(hash_str, sizeof(hash_str), "%016llx", static_cast<unsigned long long>(cache_hash));
+        cache_path   = std::string(cache_dir) + "/tree_support_volumes_" + hash_str + ".bin";
+        cache_loaded = this->load_persistent_cache(cache_path, cache_hash);
+        if (cache_loaded)
+            BOOST_LOG_TRIVIAL(info) << "Tree support volumes loaded from persistent cache " << cache_path;
+    }
+
     // it may seem that the required avoidance can be of a smaller radius when going to model (no initial layer diameter for to model branches)
     // but as for every branch going towards the bp, the to model avoidance is required to check for possible merges with to model branches, this assumption is in-fact wrong.
     std::unordered_map<coord_t, LayerIndex> radius_until_layer;
@@ -223,30 +245,54 @@ void TreeModelVolumes::precalculate(const PrintObject& print_object, const coord
     // Now that required_avoidance_limit contains the maximum of ild and regular required radius just copy.
     std::vector<RadiusLayerPair> relevant_collision_radiis{ radius_until_layer.begin(), radius_until_layer.end() };
 
-    // Calculate the relevant collisions
-    calculateCollision(relevant_collision_radiis, throw_on_cancel);
-
-    // calculate a separate Collisions with all holes removed. These are relevant for some avoidances that try to avoid holes (called safe)
-    std::vector<RadiusLayerPair> relevant_hole_collision_radiis;
-    for (RadiusLayerPair key : relevant_avoidance_radiis)
-        if (key.first < m_increase_until_radius + m_current_min_xy_dist_delta)
-            relevant_hole_collision_radiis.emplace_back(key);
-
-    // Calculate collisions without holes, built from regular collision
-    calculateCollisionHolefree(relevant_hole_collision_radiis, throw_on_cancel);
-    // Let placables be calculated from calculateAvoidance() for better parallelization.
-    if (m_support_rests_on_model)
-        calculatePlaceables(relevant_avoidance_radiis, throw_on_cancel);
-
     auto t_coll = std::chrono::high_resolution_clock::now();
+    if (! cache_loaded) {
+        // Calculate the relevant collisions
+        calculateCollision(relevant_collision_radiis, throw_on_cancel);
+
+        // calculate a separate Collisions with all holes removed. These are relevant for some avoidances that try to avoid holes (called safe)
+        std::vector<RadiusLayerPair> relevant_hole_collision_radiis;
+        for (RadiusLayerPair key : relevant_avoidance_radiis)
+            if (key.first < m_increase_until_radius + m_current_min_xy_dist_delta)
+                relevant_hole_collision_radiis.emplace_back(key);
+
+        // Calculate collisions without holes, built from regular collision
+        calculateCollisionHolefree(relevant_hole_collision_radiis, throw_on_cancel);
+        // Let placables be calculated from calculateAvoidance() for better parallelization.
+        if (m_support_rests_on_model)
+            calculatePlaceables(relevant_avoidance_radiis, throw_on_cancel);
+
+        t_coll = std::chrono::high_resolution_clock::now();
+
+        // Calculate the relevant avoidances in parallel as far as possible
+        {
+            tbb::task_group task_group;
+            task_group.run([this, relevant_avoidance_radiis, throw_on_cancel]{ calculateAvoidance(relevant_avoidance_radiis, true, m_support_rests_on_model, throw_on_cancel); });
+            task_group.run([this, relevant_avoidance_radiis, throw_on_cancel]{ calculateWallRestrictions(relevant_avoidance_radiis, throw_on_cancel); });
+            task_group.wait();
+        }
+    }
 
-    // Calculate the relevant avoidances in parallel as far as possible
-    {
-        tbb::task_group task_group;
-        task_group.run([this, relevant_avoidance_radiis, throw_on_cancel]{ calculateAvoidance(relevant_avoidance_radiis, true, m_support_rests_on_model, throw_on_cancel); });
-        task_group.run([this, relevant_avoidance_radiis, throw_on_cancel]{ calculateWallRestrictions(relevant_avoidance_radiis, throw_on_cancel); });
-        task_group.wait();
+    // Freeze the caches: tree generation reads them from all workers and the per-read mutex
+    // would serialize the whole wavefront. Lookups of areas still missing (and computed lazily
+    // afterwards) keep falling back to the locked path.
+    m_collision_cache.freeze();
+    m_collision_cache_holefree.freeze();
+    m_avoidance_cache.freeze();
+    m_avoidance_cache_slow.freeze();
+    m_avoidance_cache_to_model.freeze();
+    m_avoidance_cache_to_model_slow.freeze();
+    m_placeable_areas_cache.freeze();
+    m_avoidance_cache_holefree.freeze();
+    m_avoidance_cache_holefree_to_model.freeze();
+    m_wall_restrictions_cache.freeze();
+    m_wall_restrictions_cache_min.freeze();
+
+    if (! cache_loaded && ! cache_path.empty()) {
+        throw_on_cancel();
+        this->save_persistent_cache(cache_path, cache_hash);
     }
+
     auto t_end = std::chrono::high_resolution_clock::now();
     auto dur_col = 0.001 * std::chrono::duration_cast<std::chrono::microseconds>(t_coll - t_start).count();
     auto dur_avo = 0.001 * std::chrono::duration_cast<std::chrono::microseconds>(t_end - t_coll).count();
@@ -292,6 +338,196 @@ void TreeModelVolumes::precalculate(const PrintObject& print_object, const coord
 #endif
 }
 
+namespace {
+
+// Bump when the serialization format or any of the algorithms producing the cached areas change.
+static constexpr const char     persistent_cache_magic[8] = { 'S', 'l', 'T', 'r', 'e', 'e', 'V', 'C' };
+static constexpr const uint32_t persistent_cache_version  = 1;
+// Sanity limit for counts read from a cache file, to fail gracefully on a corrupt file.
+static constexpr const uint64_t persistent_cache_max_count = uint64_t(1) << 30;
+
+template<typename T>
+void write_pod(std::ostream &out, const T &value)
+{
+    out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template<typename T>
+bool read_pod(std::istream &in, T &value)
+{
+    in.read(reinterpret_cast<char*>(&value), sizeof(T));
+    return bool(in);
+}
+
+void write_polygons(std::ostream &out, const Polygons &polygons)
+{
+    write_pod(out, uint64_t(polygons.size()));
+    for (const Polygon &polygon : polygons) {
+        write_pod(out, uint64_t(polygon.points.size()));
+        out.write(reinterpret_cast<const char*>(polygon.points.data()), std::streamsize(polygon.points.size() * sizeof(Point)));
+    }
+}
+
+bool read_polygons(std::istream &in, Polygons &polygons)
+{
+    uint64_t num_polygons;
+    if (! read_pod(in, num_polygons) || num_polygons > persistent_cache_max_count)
+        return false;
+    polygons.resize(size_t(num_polygons));
+    for (Polygon &polygon : polygons) {
+        uint64_t num_points;
+        if (! read_pod(in, num_points) || num_points > persistent_cache_max_count)
+            return false;
+        polygon.points.resize(size_t(num_points));
+        in.read(reinterpret_cast<char*>(polygon.points.data()), std::streamsize(polygon.points.size() * sizeof(Point)));
+        if (! in)
+            return false;
+    }
+    return true;
+}
+
+} // anonymous namespace
+
+std::array<const TreeModelVolumes::RadiusLayerPolygonCache*, 11> TreeModelVolumes::cache_slots() const
+{
+    return { &m_collision_cache, &m_collision_cache_holefree, &m_avoidance_cache, &m_avoidance_cache_slow,
+             &m_avoidance_cache_to_model, &m_avoidance_cache_to_model_slow, &m_placeable_areas_cache,
+             &m_avoidance_cache_holefree, &m_avoidance_cache_holefree_to_model, &m_wall_restrictions_cache,
+             &m_wall_restrictions_cache_min };
+}
+
+std::array<TreeModelVolumes::RadiusLayerPolygonCache*, 11> TreeModelVolumes::cache_slots()
+{
+    return { &m_collision_cache, &m_collision_cache_holefree, &m_avoidance_cache, &m_avoidance_cache_slow,
+             &m_avoidance_cache_to_model, &m_avoidance_cache_to_model_slow, &m_placeable_areas_cache,
+             &m_avoidance_cache_holefree, &m_avoidance_cache_holefree_to_model, &m_wall_restrictions_cache,
+             &m_wall_restrictions_cache_min };
+}
+
+uint64_t TreeModelVolumes::persistent_cache_hash(const LayerIndex max_layer) const
+{
+    // FNV-1a offset basis, combined the same way as the other content hash caches in this code base.
+    uint64_t seed    = 0xcbf29ce484222325ull;
+    auto     combine = [&seed](uint64_t v) { seed ^= v + 0x9e3779b97f4a7c15ull + (seed << 6) + (seed >> 2); };
+    auto     combine_double = [combine](double v) {
+        uint64_t bits;
+        static_assert(sizeof(bits) == sizeof(v));
+        std::memcpy(&bits, &v, sizeof(bits));
+        combine(bits);
+    };
+    auto combine_polygons = [combine](const Polygons &polygons) {
+        combine(polygons.size());
+        for (const Polygon &polygon : polygons) {
+            combine(polygon.points.size());
+            for (const Point &pt : polygon.points) {
+                combine(uint64_t(pt.x()));
+                combine(uint64_t(pt.y()));
+            }
+        }
+    };
+
+    combine(persistent_cache_version);
+    combine(uint64_t(max_layer));
+    combine(uint64_t(m_max_move));
+    combine(uint64_t(m_max_move_slow));
+    combine(uint64_t(m_current_min_xy_dist));
+    combine(uint64_t(m_current_min_xy_dist_delta));
+    combine(uint64_t(m_increase_until_radius));
+    combine(uint64_t(m_radius_0));
+    combine(uint64_t(m_min_resolution));
+    combine(uint64_t(m_support_rests_on_model));
+    combine(m_raft_layers.size());
+    for (double height : m_raft_layers)
+        combine_double(height);
+    const std::vector<Polygons> &outlines = m_layer_outlines[m_current_outline_idx].second;
+    combine(outlines.size());
+    for (const Polygons &layer_outline : outlines)
+        combine_polygons(layer_outline);
+    combine(m_anti_overhang.size());
+    for (const Polygons &layer_anti_overhang : m_anti_overhang)
+        combine_polygons(layer_anti_overhang);
+    combine_polygons(m_machine_border);
+    return seed;
+}
+
+bool TreeModelVolumes::load_persistent_cache(const std::string &path, const uint64_t content_hash)
+{
+    boost::nowide::ifstream in(path, std::ios::binary);
+    if (! in)
+        return false;
+
+    char     magic[sizeof(persistent_cache_magic)];
+    uint32_t version;
+    uint64_t hash;
+    in.read(magic, sizeof(magic));
+    if (! in || std::memcmp(magic, persistent_cache_magic, sizeof(magic)) != 0 ||
+        ! read_pod(in, version) || version != persistent_cache_version ||
+        ! read_pod(in, hash) || hash != content_hash)
+        return false;
+
+    // Deserialize everything before touching the caches, so a truncated or corrupt file
+    // leaves them empty instead of partially filled.
+    auto slots = this->cache_slots();
+    std::array<std::vector<std::pair<RadiusLayerPair, Polygons>>, 11> loaded;
+    for (size_t slot_idx = 0; slot_idx < slots.size(); ++ slot_idx) {
+        uint64_t num_entries;
+        if (! read_pod(in, num_entries) || num_entries > persistent_cache_max_count)
+            return false;
+        loaded[slot_idx].reserve(size_t(num_entries));
+        for (uint64_t i = 0; i < num_entries; ++ i) {
+            int64_t  radius;
+            int64_t  layer_idx;
+            Polygons polygons;
+            if (! read_pod(in, radius) || ! read_pod(in, layer_idx) || layer_idx < 0 || ! read_polygons(in, polygons))
+                return false;
+            loaded[slot_idx].emplace_back(RadiusLayerPair{ coord_t(radius), LayerIndex(layer_idx) }, std::move(polygons));
+        }
+    }
+
+    for (size_t slot_idx = 0; slot_idx < slots.size(); ++ slot_idx)
+        slots[slot_idx]->insert(std::move(loaded[slot_idx]));
+    return true;
+}
+
+void TreeModelVolumes::save_persistent_cache(const std::string &path, const uint64_t content_hash) const
+{
+    // Write to a temporary file first and rename it into place, so that concurrent jobs
+    // mapping the cache never observe a partially written file.
+    std::string tmp_path = path + ".tmp";
+    {
+        boost::nowide::ofstream out(tmp_path, std::ios::binary | std::ios::trunc);
+        if (! out) {
+            BOOST_LOG_TRIVIAL(warning) << "Failed to open tree support volume cache " << tmp_path << " for writing.";
+            return;
+        }
+        out.write(persistent_cache_magic, sizeof(persistent_cache_magic));
+        write_pod(out, persistent_cache_version);
+        write_pod(out, content_hash);
+        for (const RadiusLayerPolygonCache *slot : this->cache_slots()) {
+            const auto entries = slot->sorted();
+            write_pod(out, uint64_t(entries.size()));
+            for (const auto &entry : entries) {
+                write_pod(out, int64_t(entry.first.first));
+                write_pod(out, int64_t(entry.first.second));
+                write_polygons(out, entry.second.get());
+            }
+        }
+        if (! out) {
+            BOOST_LOG_TRIVIAL(warning) << "Failed to write tree support volume cache " << tmp_path;
+            out.close();
+            boost::system::error_code ec;
+            boost::filesystem::remove(tmp_path, ec);
+            return;
+        }
+    }
+    boost::system::error_code ec;
+    boost::filesystem::rename(tmp_path, path, ec);
+    if (ec)
+        BOOST_LOG_TRIVIAL(warning) << "Failed to move tree support volume cache to " << path << ": " << ec.message();
+    else
+        BOOST_LOG_TRIVIAL(info) << "Tree support volumes stored in persistent cache " << path;
+}
+
 const Polygons& TreeModelVolumes::getCollision(const coord_t orig_radius, LayerIndex layer_idx, bool min_xy_dist) const
 {
     const coord_t radius = this->ceilRadius(orig_radius, min_xy_dist);
@@ -853,6 +1089,22 @@ coord_t TreeModelVolumes::ceilRadius(const coord_t radius) const
     return out;
 }
 
+void TreeModelVolumes::RadiusLayerPolygonCache::freeze()
+{
+    std::lock_guard<std::mutex> guard(m_mutex);
+    m_frozen.clear();
+    m_frozen.resize(m_data.size());
+    for (size_t layer_idx = 0; layer_idx < m_data.size(); ++ layer_idx) {
+        const LayerData &layer = m_data[layer_idx];
+        std::vector<std::pair<coord_t, const Polygons*>> &frozen_layer = m_frozen[layer_idx];
+        frozen_layer.reserve(layer.size());
+        // std::map iterates in radius order, the snapshot comes out sorted for binary search.
+        for (const auto &radius_and_area : layer)
+            frozen_layer.emplace_back(radius_and_area.first, &radius_and_area.second);
+    }
+    m_frozen_valid.store(true, std::memory_order_release);
+}
+
 void TreeModelVolumes::RadiusLayerPolygonCache::allocate_layers(size_t num_layers)
 {
     if (num_layers > m_data.size()) {
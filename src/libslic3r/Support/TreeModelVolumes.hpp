@@ -13,6 +13,8 @@
 #ifndef slic3r_TreeModelVolumes_hpp
 #define slic3r_TreeModelVolumes_hpp
 
+#include <array>
+#include <atomic>
 #include <mutex>
 #include <unordered_map>
 
@@ -207,8 +209,13 @@ private:
         using Layers = std::vector<LayerData>;
     public:
         RadiusLayerPolygonCache() = default;
-        RadiusLayerPolygonCache(RadiusLayerPolygonCache &&rhs) : m_data(std::move(rhs.m_data)) {}
-        RadiusLayerPolygonCache& operator=(RadiusLayerPolygonCache &&rhs) { m_data = std::move(rhs.m_data); return *this; }
+        RadiusLayerPolygonCache(RadiusLayerPolygonCache &&rhs) : m_data(std::move(rhs.m_data)), m_frozen(std::move(rhs.m_frozen)), m_frozen_valid(rhs.m_frozen_valid.load(std::memory_order_relaxed)) {}
+        RadiusLayerPolygonCache& operator=(RadiusLayerPolygonCache &&rhs) {
+            m_data = std::move(rhs.m_data);
+            m_frozen = std::move(rhs.m_frozen);
+            m_frozen_valid.store(rhs.m_frozen_valid.load(std::memory_order_relaxed), std::memory_order_relaxed);
+            return *this;
+        }
 
         RadiusLayerPolygonCache(const RadiusLayerPolygonCache&) = delete;
         RadiusLayerPolygonCache& operator=(const RadiusLayerPolygonCache&) = delete;
@@ -243,6 +250,18 @@ private:
          * \return A wrapped optional reference of the requested area (if it was found, an empty optional if nothing was found)
          */
         std::optional<std::reference_wrapper<const Polygons>> getArea(const TreeModelVolumes::RadiusLayerPair &key) const {
+            // Lock free lookup in the immutable snapshot taken by freeze() after precalculation.
+            // Tree generation queries these caches from all workers, a mutex here serializes them.
+            if (m_frozen_valid.load(std::memory_order_acquire)) {
+                if (key.second < LayerIndex(m_frozen.size())) {
+                    const std::vector<std::pair<coord_t, const Polygons*>> &layer = m_frozen[key.second];
+                    auto it = std::lower_bound(layer.begin(), layer.end(), key.first,
+                        [](const std::pair<coord_t, const Polygons*> &l, coord_t radius) { return l.first < radius; });
+                    if (it != layer.end() && it->first == key.first)
+                        return std::optional<std::reference_wrapper<const Polygons>>{ *it->second };
+                }
+                // Fall through: an area missing in the snapshot may have been computed lazily since.
+            }
             std::lock_guard<std::mutex> guard(m_mutex);
             if (key.second >= LayerIndex(m_data.size()))
                 return std::optional<std::reference_wrapper<const Polygons>>{};
@@ -253,6 +272,15 @@ private:
         }
         // Get a collision area at a given layer for a radius that is a lower or equial to the key radius.
         std::optional<std::pair<coord_t, std::reference_wrapper<const Polygons>>> get_lower_bound_area(const TreeModelVolumes::RadiusLayerPair &key) const {
+            // Only an exact match may be answered from the snapshot without locking: a lazily
+            // computed area inserted after freeze() could be a better lower bound.
+            if (m_frozen_valid.load(std::memory_order_acquire) && key.second < LayerIndex(m_frozen.size())) {
+                const std::vector<std::pair<coord_t, const Polygons*>> &layer = m_frozen[key.second];
+                auto it = std::lower_bound(layer.begin(), layer.end(), key.first,
+                    [](const std::pair<coord_t, const Polygons*> &l, coord_t radius) { return l.first < radius; });
+                if (it != layer.end() && it->first == key.first)
+                    return std::make_pair(it->first, std::reference_wrapper<const Polygons>(*it->second));
+            }
             std::lock_guard<std::mutex> guard(m_mutex);
             if (key.second >= LayerIndex(m_data.size()))
                 return {};
@@ -287,8 +315,14 @@ private:
         // For debugging purposes, sorted by layer index, then by radius.
         [[nodiscard]] std::vector<std::pair<RadiusLayerPair, std::reference_wrapper<const Polygons>>> sorted() const;
 
-        void clear() { m_data.clear(); }
-        void clear_all_but_radius0() { 
+        // Take an immutable per-layer snapshot of the areas calculated so far, sorted by radius,
+        // so that subsequent getArea() lookups do not have to take the mutex. Areas inserted
+        // later are still found through the locked fallback path.
+        void freeze();
+
+        void clear() { this->thaw(); m_data.clear(); }
+        void clear_all_but_radius0() {
+            this->thaw();
             for (LayerData &l : m_data) {
                 auto begin = l.begin();
                 auto end = l.end();
@@ -303,9 +337,19 @@ private:
             return m_data[layer_idx];
         }
         void                allocate_layers(size_t num_layers);
+        // Drop the frozen snapshot, the pointers into m_data are about to become invalid.
+        void                thaw() {
+            m_frozen_valid.store(false, std::memory_order_release);
+            m_frozen.clear();
+        }
 
         Layers              m_data;
         mutable std::mutex  m_mutex;
+        // Snapshot of m_data taken by freeze(): per layer the (radius, area) pairs sorted by
+        // radius. The map nodes of m_data are stable to insertion, thus the pointers stay valid
+        // even when areas are added lazily after the snapshot was taken.
+        std::vector<std::vector<std::pair<coord_t, const Polygons*>>> m_frozen;
+        std::atomic<bool>   m_frozen_valid { false };
     };
 
 
@@ -417,6 +461,16 @@ private:
         calculateWallRestrictions(std::vector<RadiusLayerPair>{ RadiusLayerPair(key) }, []{});
     }
 
+    // Persistent on-disk cache of the precalculated volumes for repeated jobs on identical
+    // geometry, keyed by a content hash of the layer outlines and all parameters the cached
+    // areas depend on. Opt-in through the ORCA_TREE_SUPPORT_CACHE_DIR environment variable.
+    // All caches, in the fixed order used by the cache file serialization.
+    std::array<const RadiusLayerPolygonCache*, 11> cache_slots() const;
+    std::array<RadiusLayerPolygonCache*, 11>       cache_slots();
+    uint64_t persistent_cache_hash(LayerIndex max_layer) const;
+    bool     load_persistent_cache(const std::string &path, uint64_t content_hash);
+    void     save_persistent_cache(const std::string &path, uint64_t content_hash) const;
+
     /*!
      * \brief The maximum distance that the center point of a tree branch may move in consecutive layers if it has to avoid the model.
      */
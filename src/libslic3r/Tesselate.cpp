@@ -189,22 +189,30 @@ private:
     bool            m_flipped;
 };
 
+// The GLU tesselator allocates its internal mesh pools on gluNewTess() and frees them
+// on gluDeleteTess(). Creating a fresh context for each ExPolygon is measurable when
+// tesselating many small contours (bed model, object cut caps), therefore one context
+// is kept alive per thread and reused. GluTessWrapper resets all per-call state at the
+// start of tesselate3d(), so reuse is safe.
+static GluTessWrapper& glu_tess_wrapper()
+{
+    static thread_local GluTessWrapper tess;
+    return tess;
+}
+
 std::vector<Vec3d> triangulate_expolygon_3d(const ExPolygon &poly, coordf_t z, bool flip)
 {
-    GluTessWrapper tess;
-    return tess.tesselate3d(poly, z, flip);
+    return glu_tess_wrapper().tesselate3d(poly, z, flip);
 }
 
 std::vector<Vec3d> triangulate_expolygons_3d(const ExPolygons &polys, coordf_t z, bool flip)
 {
-	GluTessWrapper tess;
-    return tess.tesselate3d(polys, z, flip);
+    return glu_tess_wrapper().tesselate3d(polys, z, flip);
 }
 
 std::vector<Vec2d> triangulate_expolygon_2d(const ExPolygon &poly, bool flip)
 {
-    GluTessWrapper tess;
-    std::vector<Vec3d> triangles = tess.tesselate3d(poly, 0, flip);
+    std::vector<Vec3d> triangles = glu_tess_wrapper().tesselate3d(poly, 0, flip);
     std::vector<Vec2d> out;
     out.reserve(triangles.size());
     for (const Vec3d &pt : triangles)
@@ -214,8 +222,7 @@ std::vector<Vec2d> triangulate_expolygon_2d(const ExPolygon &poly, bool flip)
 
 std::vector<Vec2d> triangulate_expolygons_2d(const ExPolygons &polys, bool flip)
 {
-    GluTessWrapper tess;
-    std::vector<Vec3d> triangles = tess.tesselate3d(polys, 0, flip);
+    std::vector<Vec3d> triangles = glu_tess_wrapper().tesselate3d(polys, 0, flip);
     std::vector<Vec2d> out;
     out.reserve(triangles.size());
     for (const Vec3d &pt : triangles)
@@ -225,8 +232,7 @@ std::vector<Vec2d> triangulate_expolygons_2d(const ExPolygons &polys, bool flip)
 
 std::vector<Vec2f> triangulate_expolygon_2f(const ExPolygon &poly, bool flip)
 {
-    GluTessWrapper tess;
-    std::vector<Vec3d> triangles = tess.tesselate3d(poly, 0, flip);
+    std::vector<Vec3d> triangles = glu_tess_wrapper().tesselate3d(poly, 0, flip);
     std::vector<Vec2f> out;
     out.reserve(triangles.size());
     for (const Vec3d &pt : triangles)
@@ -236,8 +242,7 @@ std::vector<Vec2f> triangulate_expolygon_2f(const ExPolygon &poly, bool flip)
 
 std::vector<Vec2f> triangulate_expolygons_2f(const ExPolygons &polys, bool flip)
 {
-    GluTessWrapper tess;
-    std::vector<Vec3d> triangles = tess.tesselate3d(polys, 0, flip);
+    std::vector<Vec3d> triangles = glu_tess_wrapper().tesselate3d(polys, 0, flip);
     std::vector<Vec2f> out;
     out.reserve(triangles.size());
     for (const Vec3d &pt : triangles)
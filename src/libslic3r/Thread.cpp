@@ -6,6 +6,7 @@
 	#include <pthread.h>
 #endif
 
+#include <algorithm>
 #include <atomic>
 #include <condition_variable>
 #include <mutex>
@@ -273,4 +274,23 @@ void name_tbb_thread_pool_threads_set_locale()
         });
 }
 
+tbb::task_arena& slicing_task_arena()
+{
+	// The arena priority is fixed at construction in oneTBB, the workers themselves come from
+	// the common pool, thus the tier priorities are expressed here and not on the threads
+	// named by name_tbb_thread_pool_threads_set_locale().
+	static tbb::task_arena arena(
+		std::max(1, tbb::this_task_arena::max_concurrency() - 1), 1,
+		tbb::task_arena::priority::low);
+	return arena;
+}
+
+tbb::task_arena& interactive_task_arena()
+{
+	static tbb::task_arena arena(
+		std::min(4, tbb::this_task_arena::max_concurrency()), 1,
+		tbb::task_arena::priority::high);
+	return arena;
+}
+
 }
@@ -5,6 +5,7 @@
 #include <string>
 #include <thread>
 #include <boost/thread.hpp>
+#include <tbb/task_arena.h>
 
 namespace Slic3r {
 
@@ -43,6 +44,17 @@ std::optional<std::string> get_current_thread_name();
 // Also it sets locale of the worker threads to "C" for the G-code generator to produce "." as a decimal separator.
 void name_tbb_thread_pool_threads_set_locale();
 
+// Arena in which the heavy background slicing work shall run. Bounded one hardware thread
+// below the shared TBB pool and scheduled at low priority, so the interactive arena below
+// and the UI thread keep getting CPU time while a plate is being sliced.
+// The workers are borrowed from the common pool named by name_tbb_thread_pool_threads_set_locale(),
+// no extra threads are spawned.
+tbb::task_arena& slicing_task_arena();
+// Small high priority arena for short latency critical parallel jobs triggered by the GUI
+// (gizmo raycaster builds and the like), so they are not starved while the slicing arena
+// saturates the thread pool.
+tbb::task_arena& interactive_task_arena();
+
 template<class Fn>
 inline boost::thread create_thread(boost::thread::attributes &attrs, Fn &&fn)
 {
@@ -0,0 +1,371 @@
+#include "TraceEvents.hpp"
+
+#include <chrono>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#ifdef SLIC3R_ALLOC_TRACE
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <ostream>
+#endif
+
+#include <boost/log/trivial.hpp>
+#include <boost/nowide/fstream.hpp>
+
+namespace Slic3r {
+namespace tracing {
+
+std::atomic<bool> g_collecting { false };
+
+namespace {
+
+struct Event
+{
+    // Literal strings, nullptr for an end event.
+    const char *name;
+    const char *category;
+    // 'B' begins a scope on a thread, 'E' ends the innermost open scope of the same thread.
+    char        phase;
+    // Microseconds since tracing::start().
+    long long   timestamp;
+    size_t      thread;
+};
+
+struct Collector
+{
+    std::mutex                            mutex;
+    std::string                           path;
+    std::vector<Event>                    events;
+    std::chrono::steady_clock::time_point t0;
+};
+
+Collector& collector()
+{
+    static Collector instance;
+    return instance;
+}
+
+void record(const char *name, const char *category, char phase)
+{
+    Collector &c  = collector();
+    long long ts  = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - c.t0).count();
+    size_t    tid = std::hash<std::thread::id>{}(std::this_thread::get_id());
+    std::lock_guard<std::mutex> lock(c.mutex);
+    // Collection may have been stopped in between the caller's enabled() check and here,
+    // drop the event in that case instead of growing an orphaned buffer.
+    if (g_collecting.load(std::memory_order_relaxed))
+        c.events.push_back({ name, category, phase, ts, tid });
+}
+
+#ifdef SLIC3R_ALLOC_TRACE
+
+// Per allocation size histogram bucket i counts allocations of [2^i, 2^(i+1)) bytes.
+constexpr size_t num_size_classes = 40;
+// Distinct step tags seen by one thread. A slice job has a few tens of steps, the slots
+// are cheap, overflowing tags fall into the last slot as "(overflow)".
+constexpr size_t max_alloc_tags   = 64;
+
+struct TagStats
+{
+    const char        *tag;
+    unsigned long long alloc_count;
+    unsigned long long alloc_bytes;
+    unsigned long long free_count;
+    // Only sized deallocations contribute, the unsized operator delete does not know the
+    // block size, thus free_bytes is a lower bound.
+    unsigned long long free_bytes;
+    unsigned long long size_class_count[num_size_classes];
+};
+
+// Allocation statistics of one thread. Trivial and allocated with malloc so the shim never
+// recurses into operator new, registered globally so the data survives thread exit and can
+// be merged by stop().
+struct ThreadAllocStats
+{
+    size_t   thread;
+    size_t   num_tags;
+    TagStats tags[max_alloc_tags];
+};
+
+struct AllocRegistry
+{
+    std::mutex                     mutex;
+    std::vector<ThreadAllocStats*> threads;
+};
+
+AllocRegistry& alloc_registry()
+{
+    static AllocRegistry instance;
+    return instance;
+}
+
+thread_local const char       *t_alloc_tag      = nullptr;
+thread_local ThreadAllocStats *t_alloc_stats    = nullptr;
+// Set while the shim itself allocates (growing the registry vector), so those allocations
+// are not counted and do not recurse.
+thread_local bool              t_in_alloc_shim  = false;
+
+ThreadAllocStats* thread_alloc_stats()
+{
+    if (t_alloc_stats == nullptr) {
+        auto *stats = static_cast<ThreadAllocStats*>(std::calloc(1, sizeof(ThreadAllocStats)));
+        if (stats == nullptr)
+            return nullptr;
+        stats->thread = std::hash<std::thread::id>{}(std::this_thread::get_id());
+        AllocRegistry &registry = alloc_registry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        registry.threads.push_back(stats);
+        t_alloc_stats = stats;
+    }
+    return t_alloc_stats;
+}
+
+TagStats* tag_stats(ThreadAllocStats &stats)
+{
+    for (size_t i = 0; i < stats.num_tags; ++ i)
+        if (stats.tags[i].tag == t_alloc_tag)
+            return &stats.tags[i];
+    if (stats.num_tags == max_alloc_tags) {
+        stats.tags[max_alloc_tags - 1].tag = "(overflow)";
+        return &stats.tags[max_alloc_tags - 1];
+    }
+    TagStats &slot = stats.tags[stats.num_tags ++];
+    slot.tag = t_alloc_tag;
+    return &slot;
+}
+
+size_t size_class(size_t bytes)
+{
+    size_t c = 0;
+    while ((bytes >>= 1) != 0 && c + 1 < num_size_classes)
+        ++ c;
+    return c;
+}
+
+void reset_alloc_stats()
+{
+    AllocRegistry &registry = alloc_registry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    for (ThreadAllocStats *stats : registry.threads) {
+        std::memset(stats->tags, 0, sizeof(stats->tags));
+        stats->num_tags = 0;
+    }
+}
+
+void write_alloc_stats(std::ostream &out)
+{
+    AllocRegistry &registry = alloc_registry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    bool first = true;
+    for (const ThreadAllocStats *stats : registry.threads)
+        for (size_t i = 0; i < stats->num_tags; ++ i) {
+            const TagStats &tag = stats->tags[i];
+            out << (first ? "" : ",\n")
+                << "{\"tid\":" << stats->thread
+                << ",\"tag\":\"" << (tag.tag == nullptr ? "(untagged)" : tag.tag)
+                << "\",\"allocs\":" << tag.alloc_count << ",\"allocBytes\":" << tag.alloc_bytes
+                << ",\"frees\":" << tag.free_count << ",\"freeBytes\":" << tag.free_bytes
+                << ",\"sizeClassCounts\":[";
+            size_t last = num_size_classes;
+            while (last > 0 && tag.size_class_count[last - 1] == 0)
+                -- last;
+            for (size_t j = 0; j < last; ++ j)
+                out << (j == 0 ? "" : ",") << tag.size_class_count[j];
+            out << "]}";
+            first = false;
+        }
+    if (! first)
+        out << "\n";
+}
+
+#endif // SLIC3R_ALLOC_TRACE
+
+} // namespace
+
+#ifdef SLIC3R_ALLOC_TRACE
+
+void set_alloc_tag(const char *name)
+{
+    t_alloc_tag = name;
+}
+
+void record_alloc(std::size_t bytes) noexcept
+{
+    if (! enabled() || t_in_alloc_shim)
+        return;
+    t_in_alloc_shim = true;
+    if (ThreadAllocStats *stats = thread_alloc_stats(); stats != nullptr) {
+        TagStats *tag = tag_stats(*stats);
+        ++ tag->alloc_count;
+        tag->alloc_bytes += bytes;
+        ++ tag->size_class_count[size_class(bytes)];
+    }
+    t_in_alloc_shim = false;
+}
+
+void record_free(std::size_t bytes) noexcept
+{
+    if (! enabled() || t_in_alloc_shim)
+        return;
+    t_in_alloc_shim = true;
+    if (ThreadAllocStats *stats = thread_alloc_stats(); stats != nullptr) {
+        TagStats *tag = tag_stats(*stats);
+        ++ tag->free_count;
+        tag->free_bytes += bytes;
+    }
+    t_in_alloc_shim = false;
+}
+
+#endif // SLIC3R_ALLOC_TRACE
+
+void start(const std::string &path)
+{
+    Collector &c = collector();
+    std::lock_guard<std::mutex> lock(c.mutex);
+    c.path = path;
+    c.events.clear();
+    // A slice job emits a couple of events per milestone and object, reserve generously.
+    c.events.reserve(4096);
+    c.t0 = std::chrono::steady_clock::now();
+#ifdef SLIC3R_ALLOC_TRACE
+    // Start each job with fresh histograms. No thread records while collection is off.
+    reset_alloc_stats();
+#endif
+    g_collecting.store(true, std::memory_order_release);
+}
+
+void stop()
+{
+    Collector         &c = collector();
+    std::vector<Event> events;
+    std::string        path;
+    {
+        std::lock_guard<std::mutex> lock(c.mutex);
+        if (! g_collecting.exchange(false))
+            return;
+        events.swap(c.events);
+        path.swap(c.path);
+    }
+    boost::nowide::ofstream out(path.c_str());
+    if (! out.good()) {
+        BOOST_LOG_TRIVIAL(error) << "Cannot write trace events to " << path;
+        return;
+    }
+    out << "{\"traceEvents\":[\n";
+    for (size_t i = 0; i < events.size(); ++ i) {
+        const Event &e = events[i];
+        out << "{\"ph\":\"" << e.phase << "\",\"pid\":1,\"tid\":" << e.thread << ",\"ts\":" << e.timestamp;
+        if (e.phase == 'B')
+            out << ",\"name\":\"" << e.name << "\",\"cat\":\"" << e.category << "\"";
+        out << (i + 1 == events.size() ? "}\n" : "},\n");
+    }
+    out << "]";
+#ifdef SLIC3R_ALLOC_TRACE
+    out << ",\n\"allocStats\":[\n";
+    write_alloc_stats(out);
+    out << "]";
+#endif
+    out << "}\n";
+    BOOST_LOG_TRIVIAL(info) << "Wrote " << events.size() << " trace events to " << path;
+}
+
+void begin_scope(const char *name, const char *category)
+{
+    record(name, category, 'B');
+}
+
+void end_scope()
+{
+    record(nullptr, nullptr, 'E');
+}
+
+} // namespace tracing
+} // namespace Slic3r
+
+#ifdef SLIC3R_ALLOC_TRACE
+
+// Global allocator overrides routing every allocation through the attribution counters.
+// The allocations are served by malloc the same way the replaced default operators would
+// (including a possible tbbmalloc redirection of malloc), only the bookkeeping is added.
+
+namespace {
+
+void* traced_alloc(std::size_t size)
+{
+    void *ptr = std::malloc(size == 0 ? 1 : size);
+    if (ptr == nullptr)
+        throw std::bad_alloc();
+    Slic3r::tracing::record_alloc(size);
+    return ptr;
+}
+
+void* traced_alloc_aligned(std::size_t size, std::size_t align)
+{
+#ifdef _WIN32
+    void *ptr = _aligned_malloc(size == 0 ? 1 : size, align);
+#else
+    void *ptr = nullptr;
+    if (posix_memalign(&ptr, align, size == 0 ? 1 : size) != 0)
+        ptr = nullptr;
+#endif
+    if (ptr == nullptr)
+        throw std::bad_alloc();
+    Slic3r::tracing::record_alloc(size);
+    return ptr;
+}
+
+void traced_free(void *ptr, std::size_t size) noexcept
+{
+    if (ptr == nullptr)
+        return;
+    Slic3r::tracing::record_free(size);
+    std::free(ptr);
+}
+
+void traced_free_aligned(void *ptr, std::size_t size) noexcept
+{
+    if (ptr == nullptr)
+        return;
+    Slic3r::tracing::record_free(size);
+#ifdef _WIN32
+    _aligned_free(ptr);
+#else
+    std::free(ptr);
+#endif
+}
+
+} // namespace
+
+void* operator new(std::size_t size) { return traced_alloc(size); }
+void* operator new[](std::size_t size) { return traced_alloc(size); }
+void* operator new(std::size_t size, std::align_val_t align) { return traced_alloc_aligned(size, std::size_t(align)); }
+void* operator new[](std::size_t size, std::align_val_t align) { return traced_alloc_aligned(size, std::size_t(align)); }
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+    { try { return traced_alloc(size); } catch (const std::bad_alloc&) { return nullptr; } }
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept
+    { try { return traced_alloc(size); } catch (const std::bad_alloc&) { return nullptr; } }
+void* operator new(std::size_t size, std::align_val_t align, const std::nothrow_t&) noexcept
+    { try { return traced_alloc_aligned(size, std::size_t(align)); } catch (const std::bad_alloc&) { return nullptr; } }
+void* operator new[](std::size_t size, std::align_val_t align, const std::nothrow_t&) noexcept
+    { try { return traced_alloc_aligned(size, std::size_t(align)); } catch (const std::bad_alloc&) { return nullptr; } }
+
+void operator delete(void *ptr) noexcept { traced_free(ptr, 0); }
+void operator delete[](void *ptr) noexcept { traced_free(ptr, 0); }
+void operator delete(void *ptr, std::size_t size) noexcept { traced_free(ptr, size); }
+void operator delete[](void *ptr, std::size_t size) noexcept { traced_free(ptr, size); }
+void operator delete(void *ptr, const std::nothrow_t&) noexcept { traced_free(ptr, 0); }
+void operator delete[](void *ptr, const std::nothrow_t&) noexcept { traced_free(ptr, 0); }
+
+void operator delete(void *ptr, std::align_val_t) noexcept { traced_free_aligned(ptr, 0); }
+void operator delete[](void *ptr, std::align_val_t) noexcept { traced_free_aligned(ptr, 0); }
+void operator delete(void *ptr, std::size_t size, std::align_val_t) noexcept { traced_free_aligned(ptr, size); }
+void operator delete[](void *ptr, std::size_t size, std::align_val_t) noexcept { traced_free_aligned(ptr, size); }
+void operator delete(void *ptr, std::align_val_t, const std::nothrow_t&) noexcept { traced_free_aligned(ptr, 0); }
+void operator delete[](void *ptr, std::align_val_t, const std::nothrow_t&) noexcept { traced_free_aligned(ptr, 0); }
+
+#endif // SLIC3R_ALLOC_TRACE
@@ -0,0 +1,76 @@
+#ifndef slic3r_TraceEvents_hpp_
+#define slic3r_TraceEvents_hpp_
+
+#include <atomic>
+#include <cstddef>
+#include <string>
+
+namespace Slic3r {
+
+// Lightweight scoped tracing of the slicing pipeline, written out in the chrome://tracing
+// JSON format (viewable in chrome://tracing and Perfetto). Collection is disabled by default
+// and enabled per slice job by tracing::start(); tracing::stop() writes the collected events and
+// disables collection again. The collector is thread safe, begin/end pairs are matched per
+// thread the way the trace viewers expect.
+
+namespace tracing {
+
+extern std::atomic<bool> g_collecting;
+// Whether trace events are being collected. Cheap enough to poll in hot code.
+inline bool enabled() { return g_collecting.load(std::memory_order_relaxed); }
+
+// Start collecting trace events, to be written to the given file by stop().
+void start(const std::string &path);
+// Write the collected events as chrome://tracing JSON and disable collection. No-op when
+// collection is not active.
+void stop();
+
+// Raw event emitters. The name and category must be literals or otherwise outlive stop().
+void begin_scope(const char *name, const char *category);
+void end_scope();
+
+// RAII scope emitting a begin/end event pair, near zero cost while collection is off.
+class Scope
+{
+public:
+    Scope(const char *name, const char *category) {
+        if (enabled()) {
+            m_armed = true;
+            begin_scope(name, category);
+        }
+    }
+    ~Scope() {
+        if (m_armed)
+            end_scope();
+    }
+    Scope(const Scope&) = delete;
+    Scope& operator=(const Scope&) = delete;
+
+private:
+    bool m_armed = false;
+};
+
+// --- Allocation attribution ---------------------------------------------------------------
+// Opt-in allocator instrumentation (configure with SLIC3R_ALLOC_TRACE): global operator
+// new / delete overrides in TraceEvents.cpp bin every heap allocation into per-thread
+// histograms keyed by the pipeline step the allocating thread is tagged with, and stop()
+// appends the merged histograms to the trace file as an "allocStats" table. A tag does not
+// propagate to worker threads a step spawns, allocations made on a worker are attributed
+// to whatever step tagged that worker last.
+#ifdef SLIC3R_ALLOC_TRACE
+// Tag the calling thread with the step it executes, nullptr to clear. The name must be a
+// literal or otherwise outlive stop().
+void set_alloc_tag(const char *name);
+// Called by the operator new / delete overrides, bytes is zero when the size of the block
+// being freed is not known.
+void record_alloc(std::size_t bytes) noexcept;
+void record_free(std::size_t bytes) noexcept;
+#else
+inline void set_alloc_tag(const char*) {}
+#endif
+
+} // namespace tracing
+
+} // namespace Slic3r
+
+#endif // slic3r_TraceEvents_hpp_
@@ -700,10 +700,18 @@ TreeSupport::TreeSupport(PrintObject& object, const SlicingParameters &slicing_p
     // by default tree support needs no infill, unless it's tree hybrid which contains normal nodes.
     with_infill                              = support_pattern != smpNone && support_pattern != smpDefault;
     const PrintConfig& print_config = m_object->print()->config();
-    m_machine_border.contour = get_bed_shape_with_excluded_area(print_config);
-    Vec3d plate_offset       = m_object->print()->get_plate_origin();
+    // The machine border in plate coordinates is shared by all objects on the plate and is
+    // prepared once by Print::process(); only the translation into this object's coordinates
+    // is per-object. The support preview gizmo runs outside of process(), so fall back to a
+    // local computation when the shared border has not been prepared yet.
+    m_machine_border = m_object->print()->plate_machine_border();
+    if (m_machine_border.empty()) {
+        m_machine_border.contour = get_bed_shape_with_excluded_area(print_config);
+        Vec3d plate_offset = m_object->print()->get_plate_origin();
+        m_machine_border.translate(Point(scale_(plate_offset(0)), scale_(plate_offset(1))));
+    }
     // align with the centered object in current plate (may not be the 1st plate, so need to add the plate offset)
-    m_machine_border.translate(Point(scale_(plate_offset(0)), scale_(plate_offset(1))) - m_object->instances().front().shift);
+    m_machine_border.translate(- m_object->instances().front().shift);
 #ifdef SUPPORT_TREE_DEBUG_TO_SVG
     SVG svg("SVG/machine_boarder.svg", m_object->bounding_box());
     if (svg.is_opened()) svg.draw(m_machine_border, "yellow");
@@ -720,7 +728,10 @@ void TreeSupport::detect_overhangs(bool detect_first_sharp_tail_only)
 
     // Clear and create Tree Support Layers
     m_object->clear_support_layers();
-    m_object->clear_tree_support_preview_cache();
+    // Do not clear the tree support preview cache here: the collision / avoidance volumes in it
+    // do not depend on the painted support regions, so an edit of the paint-on supports can
+    // reuse them. alloc_tree_support_preview_cache() validates the cache and resets it when the
+    // relevant parameters changed, invalidating posSlice drops it with the outlines.
     create_tree_support_layers();
 
     const PrintObjectConfig& config = m_object->config();
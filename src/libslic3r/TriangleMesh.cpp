@@ -454,8 +454,22 @@ BoundingBoxf3 TriangleMesh::bounding_box() const
 BoundingBoxf3 TriangleMesh::transformed_bounding_box(const Transform3d &trafo) const
 {
     BoundingBoxf3 bbox;
-    for (const stl_vertex &v : this->its.vertices)
-        bbox.merge(trafo * v.cast<double>());
+    if (! this->its.vertices.empty()) {
+        // Fold in single precision over the vertex span with branch free min / max,
+        // same as the world_min_z variant below: the per-point merge() would test the
+        // "defined" flag and convert to double on every vertex, which dominates the fold.
+        const Transform3f trafof = trafo.cast<float>();
+        Vec3f bmin = trafof * this->its.vertices.front();
+        Vec3f bmax = bmin;
+        for (const stl_vertex &v : this->its.vertices) {
+            const Vec3f pt = trafof * v;
+            bmin = bmin.cwiseMin(pt);
+            bmax = bmax.cwiseMax(pt);
+        }
+        bbox.min = bmin.cast<double>();
+        bbox.max = bmax.cast<double>();
+        bbox.defined = true;
+    }
     return bbox;
 }
 
@@ -1399,6 +1413,46 @@ void its_merge(indexed_triangle_set &A, const indexed_triangle_set &B)
         A.indices[n] += Vec3i{N, N, N};
 }
 
+void its_merge(indexed_triangle_set &A, const std::vector<indexed_triangle_set> &meshes)
+{
+    size_t num_vertices = A.vertices.size();
+    size_t num_indices  = A.indices.size();
+
+    // Precompute the destination offset of every source mesh.
+    std::vector<std::pair<size_t, size_t>> offsets;
+    offsets.reserve(meshes.size());
+    for (const indexed_triangle_set &m : meshes) {
+        offsets.emplace_back(num_vertices, num_indices);
+        num_vertices += m.vertices.size();
+        num_indices  += m.indices.size();
+    }
+
+    A.vertices.resize(num_vertices);
+    A.indices.resize(num_indices);
+
+    execution::for_each(ex_tbb, size_t(0), meshes.size(),
+        [&A, &meshes, &offsets](size_t mesh_idx) {
+            const indexed_triangle_set &m = meshes[mesh_idx];
+            auto [vertex_offs, index_offs] = offsets[mesh_idx];
+            std::copy(m.vertices.begin(), m.vertices.end(), A.vertices.begin() + vertex_offs);
+            const Vec3i shift = Vec3i::Constant(int(vertex_offs));
+            for (size_t i = 0; i < m.indices.size(); ++i)
+                A.indices[index_offs + i] = m.indices[i] + shift;
+        });
+}
+
+void its_transform_par(indexed_triangle_set &its, const Transform3d &t, bool fix_left_handed)
+{
+    execution::for_each(ex_tbb, size_t(0), its.vertices.size(),
+        [&its, &t](size_t i) {
+            stl_vertex &v = its.vertices[i];
+            v = (t * v.cast<double>()).cast<float>().eval();
+        }, size_t(1) << 14);
+
+    if (fix_left_handed && t.matrix().block(0, 0, 3, 3).determinant() < 0.)
+        its_flip_triangles(its);
+}
+
 void its_merge(indexed_triangle_set &A, const std::vector<Vec3f> &triangles)
 {
     const size_t offs = A.vertices.size();
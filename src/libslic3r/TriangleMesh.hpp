@@ -335,6 +335,15 @@ float its_average_edge_length(const indexed_triangle_set &its);
 void its_merge(indexed_triangle_set &A, const indexed_triangle_set &B);
 void its_merge(indexed_triangle_set &A, const std::vector<Vec3f> &triangles);
 void its_merge(indexed_triangle_set &A, const Pointf3s &triangles);
+// Merge a batch of meshes into A in one pass: the target vectors are resized
+// exactly once to the precomputed final size and the sources are bulk-copied
+// in parallel. Considerably faster than repeated its_merge() calls when
+// assembling a mesh from many pieces.
+void its_merge(indexed_triangle_set &A, const std::vector<indexed_triangle_set> &meshes);
+
+// Parallel version of its_transform() from admesh/stl.h, meant for meshes with
+// millions of vertices where the serial vertex loop becomes measurable.
+void its_transform_par(indexed_triangle_set &its, const Transform3d &t, bool fix_left_handed = false);
 
 std::vector<Vec3f> its_face_normals(const indexed_triangle_set &its);
 inline Vec3f face_normal(const stl_vertex vertex[3]) { return  (vertex[1] - vertex[0]).cross(vertex[2] - vertex[1]).normalized(); }
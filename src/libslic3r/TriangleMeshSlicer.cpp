@@ -13,7 +13,9 @@
 
 #include <algorithm>
 #include <cmath>
+#include <atomic>
 #include <deque>
+#include <map>
 #include <queue>
 #include <mutex>
 #include <utility>
@@ -21,6 +23,7 @@
 #include <boost/log/trivial.hpp>
 
 #include <tbb/parallel_for.h>
+#include <tbb/task_arena.h>
 
 #ifndef NDEBUG
 //    #define EXPENSIVE_DEBUG_CHECKS
@@ -328,20 +331,24 @@ void slice_facet_at_zs(
     const Vec3i                                      &edge_ids,
     // Scaled or unscaled zs. If vertices have their zs scaled or transform_vertex_fn scales them, then zs have to be scaled as well.
     const std::vector<float>                         &zs,
+    // Facet z-span (min_z, max_z) from the structure-of-arrays staging buffer.
+    const std::pair<float, float>                    &facet_z_span,
     std::vector<IntersectionLines>                   &lines,
     std::array<std::mutex, 64>                       &lines_mutex)
 {
-    stl_vertex vertices[3] { transform_vertex_fn(mesh_vertices[indices(0)]), transform_vertex_fn(mesh_vertices[indices(1)]), transform_vertex_fn(mesh_vertices[indices(2)]) };
+    const float min_z = facet_z_span.first;
+    const float max_z = facet_z_span.second;
 
-    // find facet extents
-    const float min_z = fminf(vertices[0].z(), fminf(vertices[1].z(), vertices[2].z()));
-    const float max_z = fmaxf(vertices[0].z(), fmaxf(vertices[1].z(), vertices[2].z()));
-    
-    // find layer extents
+    // find layer extents first: most facets of a high-poly mesh span just a couple of layers,
+    // thus the early exit below skips the vertex gather for facets landing in between two planes.
     auto min_layer = std::lower_bound(zs.begin(), zs.end(), min_z); // first layer whose slice_z is >= min_z
     auto max_layer = std::upper_bound(min_layer, zs.end(), max_z); // first layer whose slice_z is > max_z
+    if (min_layer == max_layer)
+        return;
+
+    stl_vertex vertices[3] { transform_vertex_fn(mesh_vertices[indices(0)]), transform_vertex_fn(mesh_vertices[indices(1)]), transform_vertex_fn(mesh_vertices[indices(2)]) };
     int  idx_vertex_lowest = (vertices[1].z() == min_z) ? 1 : ((vertices[2].z() == min_z) ? 2 : 0);
-    
+
     for (auto it = min_layer; it != max_layer; ++ it) {
         IntersectionLine il;
         // Ignore horizontal triangles. Any valid horizontal triangle must have a vertical triangle connected, otherwise the part has zero volume.
@@ -354,6 +361,24 @@ void slice_facet_at_zs(
     }
 }
 
+// Build per-facet (min_z, max_z) spans from a flat vertex z buffer.
+static std::vector<std::pair<float, float>> make_facet_z_spans(
+    const std::vector<stl_triangle_vertex_indices> &indices,
+    const std::vector<float>                       &vertex_z)
+{
+    std::vector<std::pair<float, float>> facet_z_spans(indices.size());
+    tbb::parallel_for(
+        tbb::blocked_range<int>(0, int(indices.size()), 4096),
+        [&indices, &vertex_z, &facet_z_spans](const tbb::blocked_range<int> &range) {
+            for (int i = range.begin(); i < range.end(); ++ i) {
+                const stl_triangle_vertex_indices &tri = indices[i];
+                const float z0 = vertex_z[tri(0)], z1 = vertex_z[tri(1)], z2 = vertex_z[tri(2)];
+                facet_z_spans[i] = { fminf(z0, fminf(z1, z2)), fmaxf(z0, fmaxf(z1, z2)) };
+            }
+        });
+    return facet_z_spans;
+}
+
 template<typename TransformVertex, typename ThrowOnCancel>
 static inline std::vector<IntersectionLines> slice_make_lines(
     const std::vector<stl_vertex>                   &vertices,
@@ -361,17 +386,62 @@ static inline std::vector<IntersectionLines> slice_make_lines(
     const std::vector<stl_triangle_vertex_indices>  &indices,
     const std::vector<Vec3i>                        &face_edge_ids,
     const std::vector<float>                        &zs,
+    // Optional facet z-spans reused from a previous reslice of the same mesh & trafo, see FacetZIntervalIndex.
+    const std::vector<std::pair<float, float>>      *cached_facet_z_spans,
     const ThrowOnCancel                              throw_on_cancel_fn)
 {
     std::vector<IntersectionLines>  lines(zs.size(), IntersectionLines());
     std::array<std::mutex, 64>      lines_mutex;
+
+    // Stage transformed vertex z coordinates into a flat structure-of-arrays buffer.
+    // A vertex is shared by roughly six facets on a manifold mesh, thus transforming it once
+    // here instead of per facet saves redundant work, and the tight per-component loops below
+    // auto-vectorize to SIMD min/max on both x86 and ARM.
+    std::vector<std::pair<float, float>> facet_z_spans_storage;
+    if (cached_facet_z_spans == nullptr) {
+        std::vector<float> vertex_z(vertices.size());
+        tbb::parallel_for(
+            tbb::blocked_range<int>(0, int(vertices.size()), 4096),
+            [&vertices, &transform_vertex_fn, &vertex_z](const tbb::blocked_range<int> &range) {
+                for (int i = range.begin(); i < range.end(); ++ i)
+                    vertex_z[i] = transform_vertex_fn(vertices[i]).z();
+            });
+        facet_z_spans_storage = make_facet_z_spans(indices, vertex_z);
+    }
+    const std::vector<std::pair<float, float>> &facet_z_spans = cached_facet_z_spans ? *cached_facet_z_spans : facet_z_spans_storage;
+
+    // Count the intersection lines per layer from the staged z-spans and reserve exact-fit storage
+    // up front. Growing the per-layer vectors underneath the sharded mutexes serializes the threads
+    // on the allocator and leaves up to 2x waste in grow-by-doubling capacity; after this pass each
+    // layer performs a single allocation. The count is a tight upper bound (horizontal facets and
+    // cut-type intersections are counted but not emitted).
+    {
+        std::vector<std::atomic<int>> line_counts(zs.size());
+        tbb::parallel_for(
+            tbb::blocked_range<int>(0, int(indices.size()), 4096),
+            [&zs, &facet_z_spans, &line_counts](const tbb::blocked_range<int> &range) {
+                for (int i = range.begin(); i < range.end(); ++ i) {
+                    const std::pair<float, float> &span = facet_z_spans[i];
+                    if (span.first == span.second)
+                        // Horizontal facets are never emitted.
+                        continue;
+                    auto min_layer = std::lower_bound(zs.begin(), zs.end(), span.first);
+                    auto max_layer = std::upper_bound(min_layer, zs.end(), span.second);
+                    for (auto it = min_layer; it != max_layer; ++ it)
+                        line_counts[it - zs.begin()].fetch_add(1, std::memory_order_relaxed);
+                }
+            });
+        for (size_t i = 0; i < zs.size(); ++ i)
+            lines[i].reserve(line_counts[i].load(std::memory_order_relaxed));
+    }
+
     tbb::parallel_for(
         tbb::blocked_range<int>(0, int(indices.size())),
-        [&vertices, &transform_vertex_fn, &indices, &face_edge_ids, &zs, &lines, &lines_mutex, throw_on_cancel_fn](const tbb::blocked_range<int> &range) {
+        [&vertices, &transform_vertex_fn, &indices, &face_edge_ids, &zs, &facet_z_spans, &lines, &lines_mutex, throw_on_cancel_fn](const tbb::blocked_range<int> &range) {
             for (int face_idx = range.begin(); face_idx < range.end(); ++ face_idx) {
                 if ((face_idx & 0x0ffff) == 0)
                     throw_on_cancel_fn();
-                slice_facet_at_zs(vertices, transform_vertex_fn, indices[face_idx], face_edge_ids[face_idx], zs, lines, lines_mutex);
+                slice_facet_at_zs(vertices, transform_vertex_fn, indices[face_idx], face_edge_ids[face_idx], zs, facet_z_spans[face_idx], lines, lines_mutex);
             }
         }
     );
@@ -1328,19 +1398,53 @@ static Polygons make_loops(
     return loops;
 }
 
+// Split layers into chunks of roughly equal cost, where the cost of a layer is estimated
+// from the number of intersection lines produced by binning the facets into z-spans.
+// Loop chaining cost is wildly non-uniform (a few dense layers may dominate tall thin parts),
+// thus a flat tbb::blocked_range leaves most cores idle on the tail. Feeding variable-sized,
+// cost-balanced chunks into the work-stealing scheduler with a simple_partitioner batches
+// the cheap layers and isolates the expensive ones.
+static std::vector<std::pair<size_t, size_t>> layer_chunks_by_cost(const std::vector<IntersectionLines> &lines)
+{
+    size_t total_cost = 0;
+    for (const IntersectionLines &l : lines)
+        total_cost += l.size();
+    // Aim at several chunks per hardware thread to give the work-stealing scheduler
+    // enough slack to balance the load.
+    const size_t num_chunks_target = size_t(tbb::this_task_arena::max_concurrency()) * 4;
+    const size_t cost_per_chunk    = std::max<size_t>(1, total_cost / std::max<size_t>(1, num_chunks_target));
+    std::vector<std::pair<size_t, size_t>> chunks;
+    chunks.reserve(std::min(lines.size(), num_chunks_target + 1));
+    size_t chunk_begin = 0;
+    size_t chunk_cost  = 0;
+    for (size_t i = 0; i < lines.size(); ++ i) {
+        chunk_cost += lines[i].size();
+        if (chunk_cost >= cost_per_chunk) {
+            chunks.emplace_back(chunk_begin, i + 1);
+            chunk_begin = i + 1;
+            chunk_cost  = 0;
+        }
+    }
+    if (chunk_begin < lines.size())
+        chunks.emplace_back(chunk_begin, lines.size());
+    return chunks;
+}
+
 template<typename ThrowOnCancel>
 static std::vector<Polygons> make_loops(
     // Lines will have their flags modified.
-    std::vector<IntersectionLines> &lines, 
-    const MeshSlicingParams        &params, 
+    std::vector<IntersectionLines> &lines,
+    const MeshSlicingParams        &params,
     ThrowOnCancel                   throw_on_cancel)
 {
     std::vector<Polygons> layers;
     layers.resize(lines.size());
+    const std::vector<std::pair<size_t, size_t>> chunks = layer_chunks_by_cost(lines);
     tbb::parallel_for(
-        tbb::blocked_range<size_t>(0, lines.size()),
-        [&lines, &layers, &params, throw_on_cancel](const tbb::blocked_range<size_t> &range) {
-            for (size_t line_idx = range.begin(); line_idx < range.end(); ++ line_idx) {
+        tbb::blocked_range<size_t>(0, chunks.size(), 1),
+        [&lines, &layers, &params, &chunks, throw_on_cancel](const tbb::blocked_range<size_t> &chunk_range) {
+            for (size_t chunk_idx = chunk_range.begin(); chunk_idx < chunk_range.end(); ++ chunk_idx)
+            for (size_t line_idx = chunks[chunk_idx].first; line_idx < chunks[chunk_idx].second; ++ line_idx) {
                 if ((line_idx & 0x0ffff) == 0)
                     throw_on_cancel();
 
@@ -1374,7 +1478,8 @@ static std::vector<Polygons> make_loops(
                     }
                 }
             }
-        }
+        },
+        tbb::simple_partitioner()
     );
 
     return layers;
@@ -1709,6 +1814,59 @@ static std::vector<stl_vertex> transform_mesh_vertices_for_slicing(const indexed
     return out;
 }
 
+void FacetZIntervalIndex::build(const indexed_triangle_set &mesh, const Transform3d &trafo)
+{
+    m_trafo        = trafo;
+    m_num_vertices = mesh.vertices.size();
+    // Mirror the vertex transformation applied by slice_make_lines() / transform_mesh_vertices_for_slicing():
+    // the z coordinate is left unscaled in both the identity and the general branch.
+    std::vector<float> vertex_z(mesh.vertices.size());
+    if (is_identity(trafo)) {
+        tbb::parallel_for(
+            tbb::blocked_range<int>(0, int(mesh.vertices.size()), 4096),
+            [&mesh, &vertex_z](const tbb::blocked_range<int> &range) {
+                for (int i = range.begin(); i < range.end(); ++ i)
+                    vertex_z[i] = mesh.vertices[i].z();
+            });
+    } else {
+        const Transform3f tf = make_trafo_for_slicing(trafo);
+        tbb::parallel_for(
+            tbb::blocked_range<int>(0, int(mesh.vertices.size()), 4096),
+            [&mesh, &tf, &vertex_z](const tbb::blocked_range<int> &range) {
+                for (int i = range.begin(); i < range.end(); ++ i)
+                    vertex_z[i] = (tf * mesh.vertices[i]).z();
+            });
+    }
+    m_facet_z_spans = make_facet_z_spans(mesh.indices, vertex_z);
+}
+
+std::shared_ptr<const FacetZIntervalIndex> facet_z_interval_index(
+    const ObjectID                   &mesh_id,
+    const indexed_triangle_set       &mesh,
+    const Transform3d                &trafo)
+{
+    static std::mutex                                               cache_mutex;
+    static std::map<size_t, std::shared_ptr<const FacetZIntervalIndex>> cache;
+    {
+        boost::lock_guard<std::mutex> lock(cache_mutex);
+        auto it = cache.find(mesh_id.id);
+        if (it != cache.end() && it->second->valid_for(mesh, trafo))
+            return it->second;
+    }
+    // Build outside of the lock, the construction may take a while on a big mesh.
+    auto index = std::make_shared<FacetZIntervalIndex>();
+    index->build(mesh, trafo);
+    {
+        boost::lock_guard<std::mutex> lock(cache_mutex);
+        // Keep the cache bounded: the spans cost 8 bytes per facet, dropping everything once in a while
+        // is cheaper than a LRU for the expected handful of volumes per plate.
+        if (cache.size() > 64)
+            cache.clear();
+        cache[mesh_id.id] = index;
+    }
+    return index;
+}
+
 std::vector<Polygons> slice_mesh(
     const indexed_triangle_set       &mesh,
     // Unscaled Zs
@@ -1726,22 +1884,26 @@ std::vector<Polygons> slice_mesh(
         // However facets_edges assigns a single edge ID to two triangles only, thus when factoring facets_edges out, one will have
         // to make sure that no code relies on it.
         std::vector<Vec3i> face_edge_ids = its_face_edge_ids(mesh);
+        // Reuse the facet z-interval index if the caller provided one for this very mesh & trafo.
+        const std::vector<std::pair<float, float>> *cached_facet_z_spans =
+            params.facet_z_index && params.facet_z_index->valid_for(mesh, params.trafo) ?
+                &params.facet_z_index->facet_z_spans() : nullptr;
         if (zs.size() <= 1) {
             // It likely is not worthwile to copy the vertices. Apply the transformation in place.
             if (is_identity(params.trafo)) {
                 lines = slice_make_lines(
-                    mesh.vertices, [](const Vec3f &p) { return Vec3f(scaled<float>(p.x()), scaled<float>(p.y()), p.z()); }, 
-                    mesh.indices, face_edge_ids, zs, throw_on_cancel);
+                    mesh.vertices, [](const Vec3f &p) { return Vec3f(scaled<float>(p.x()), scaled<float>(p.y()), p.z()); },
+                    mesh.indices, face_edge_ids, zs, cached_facet_z_spans, throw_on_cancel);
             } else {
                 // Transform the vertices, scale up in XY, not in Z.
                 Transform3f tf = make_trafo_for_slicing(params.trafo);
-                lines = slice_make_lines(mesh.vertices, [tf](const Vec3f &p) { return tf * p; }, mesh.indices, face_edge_ids, zs, throw_on_cancel);
+                lines = slice_make_lines(mesh.vertices, [tf](const Vec3f &p) { return tf * p; }, mesh.indices, face_edge_ids, zs, cached_facet_z_spans, throw_on_cancel);
             }
         } else {
             // Copy and scale vertices in XY, don't scale in Z. Possibly apply the transformation.
             lines = slice_make_lines(
-                transform_mesh_vertices_for_slicing(mesh, params.trafo), 
-                [](const Vec3f &p) { return p; },  mesh.indices, face_edge_ids, zs, throw_on_cancel);
+                transform_mesh_vertices_for_slicing(mesh, params.trafo),
+                [](const Vec3f &p) { return p; },  mesh.indices, face_edge_ids, zs, cached_facet_z_spans, throw_on_cancel);
         }
     }
 
@@ -6,12 +6,42 @@
 #define slic3r_TriangleMeshSlicer_hpp_
 
 #include <functional>
+#include <memory>
 #include <vector>
+#include "ObjectID.hpp"
 #include "Polygon.hpp"
 #include "ExPolygon.hpp"
 
 namespace Slic3r {
 
+// Facet z-interval index: per-facet z-spans of the transformed mesh, independent of the slicing planes.
+// Reslicing the same mesh with new layer heights (the common Plater workflow) then only rebins facets
+// into the new planes instead of rescanning and transforming all triangles again.
+class FacetZIntervalIndex
+{
+public:
+    void build(const indexed_triangle_set &mesh, const Transform3d &trafo);
+    // The index is only reusable for the very same geometry and transformation it was built with.
+    bool valid_for(const indexed_triangle_set &mesh, const Transform3d &trafo) const
+    {
+        return m_num_vertices == mesh.vertices.size() && m_facet_z_spans.size() == mesh.indices.size() &&
+               m_trafo.matrix() == trafo.matrix();
+    }
+    const std::vector<std::pair<float, float>>& facet_z_spans() const { return m_facet_z_spans; }
+
+private:
+    std::vector<std::pair<float, float>> m_facet_z_spans;
+    Transform3d                          m_trafo { Transform3d::Identity() };
+    size_t                               m_num_vertices { 0 };
+};
+
+// Build or fetch a FacetZIntervalIndex from a process-wide cache, keyed by the ObjectID of the mesh owner
+// (ModelVolume). A stale entry (geometry or transformation changed) is rebuilt in place.
+std::shared_ptr<const FacetZIntervalIndex> facet_z_interval_index(
+    const ObjectID                   &mesh_id,
+    const indexed_triangle_set       &mesh,
+    const Transform3d                &trafo);
+
 struct MeshSlicingParams
 {
     enum class SlicingMode : uint32_t {
@@ -37,6 +67,9 @@ struct MeshSlicingParams
     SlicingMode   mode_below { SlicingMode::Regular };
     // Transforming faces during the slicing.
     Transform3d   trafo { Transform3d::Identity() };
+    // Optional facet z-interval index built for this mesh & trafo, see facet_z_interval_index().
+    // Ignored if null or stale.
+    std::shared_ptr<const FacetZIntervalIndex> facet_z_index;
 };
 
 struct MeshSlicingParamsEx : public MeshSlicingParams
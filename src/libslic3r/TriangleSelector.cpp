@@ -351,8 +351,10 @@ void TriangleSelector::seed_fill_select_triangles(const Vec3f &hit, int facet_st
                         // Child triangle shares normal with its parent. Select it.
                         facet_queue.push(child);
                 }
-            } else
+            } else {
                 m_triangles[current_facet].select_by_seed_fill();
+                touch_root(m_triangles[current_facet]);
+            }
 
             if (current_facet < m_orig_size_indices)
                 // Propagate over the original triangles.
@@ -490,6 +492,7 @@ void TriangleSelector::bucket_fill_select_triangles(const Vec3f& hit, int facet_
 
     if (!propagate) {
         m_triangles[start_facet_idx].select_by_seed_fill();
+        touch_root(m_triangles[start_facet_idx]);
         return;
     }
 
@@ -524,6 +527,7 @@ void TriangleSelector::bucket_fill_select_triangles(const Vec3f& hit, int facet_
 
         if (!visited[current_facet]) {
             m_triangles[current_facet].select_by_seed_fill();
+            touch_root(m_triangles[current_facet]);
 
             std::vector<int> touching_triangles = get_all_touching_triangles(current_facet, neighbors[current_facet], neighbors_propagated[current_facet]);
             for(const int tr_idx : touching_triangles) {
@@ -920,6 +924,7 @@ bool TriangleSelector::select_triangle_recursive(int facet_idx, const Vec3i &nei
         // dump any subdivision and select whole triangle
         undivide_triangle(facet_idx);
         tr->set_state(type);
+        touch_root(*tr);
     } else {
         // the triangle is partially inside, let's recursively divide it
         // (if not already) and try selecting its children.
@@ -932,8 +937,10 @@ bool TriangleSelector::select_triangle_recursive(int facet_idx, const Vec3i &nei
 
         if (triangle_splitting)
             split_triangle(facet_idx, neighbors);
-        else if (!m_triangles[facet_idx].is_split())
+        else if (!m_triangles[facet_idx].is_split()) {
             m_triangles[facet_idx].set_state(type);
+            touch_root(m_triangles[facet_idx]);
+        }
         tr = &m_triangles[facet_idx]; // might have been invalidated by split_triangle().
 
         int num_of_children = tr->number_of_split_sides() + 1;
@@ -958,6 +965,7 @@ void TriangleSelector::set_facet(int facet_idx, EnforcerBlockerType state)
     undivide_triangle(facet_idx);
     assert(! m_triangles[facet_idx].is_split());
     m_triangles[facet_idx].set_state(state);
+    touch_root(m_triangles[facet_idx]);
 }
 
 // called by select_patch()->select_triangle()...select_triangle()
@@ -1278,6 +1286,7 @@ void TriangleSelector::reset()
     }
     m_orig_size_vertices = int(m_vertices.size());
     m_orig_size_indices  = int(m_triangles.size());
+    m_root_touched.assign(m_orig_size_indices, false);
 }
 
 void TriangleSelector::set_edge_limit(float edge_limit)
@@ -1321,6 +1330,7 @@ int TriangleSelector::push_triangle(int a, int b, int c, int source_triangle, co
 // Midpoint vertices are possibly reused by traversing children of neighbor triangles.
 void TriangleSelector::perform_split(int facet_idx, const Vec3i &neighbors, EnforcerBlockerType old_state)
 {
+    touch_root(m_triangles[facet_idx]);
     // Reserve space for the new triangles upfront, so that the reference to this triangle will not change.
     {
         size_t num_triangles_new = m_triangles.size() + m_triangles[facet_idx].number_of_split_sides() + 1;
@@ -1685,13 +1695,18 @@ std::pair<std::vector<std::pair<int, int>>, std::vector<bool>> TriangleSelector:
     } out { this };
 
     out.data.first.reserve(m_orig_size_indices);
-    for (int i=0; i<m_orig_size_indices; ++i)
+    for (int i=0; i<m_orig_size_indices; ++i) {
+        // Subtrees never touched by painting cannot carry any state, skip them without
+        // reading the Triangle data.
+        if (! m_root_touched[i])
+            continue;
         if (const Triangle& tr = m_triangles[i]; tr.is_split() || tr.get_state() != EnforcerBlockerType::NONE) {
             // Store index of the first bit assigned to ith triangle.
             out.data.first.emplace_back(i, int(out.data.second.size()));
             // out the triangle bits.
             out.serialize(i);
         }
+    }
 
     // May be stored onto Undo / Redo stack, thus conserve memory.
     out.data.first.shrink_to_fit();
@@ -1762,6 +1777,7 @@ void TriangleSelector::deserialize(const std::pair<std::vector<std::pair<int, in
                 } else {
                     // root is not split. just set the state and that's it.
                     m_triangles[triangle_id].set_state(state);
+                    touch_root(m_triangles[triangle_id]);
                     break;
                 }
             }
@@ -1867,8 +1883,10 @@ void TriangleSelector::seed_fill_unselect_all_triangles()
 void TriangleSelector::seed_fill_apply_on_triangles(EnforcerBlockerType new_state)
 {
     for (Triangle &triangle : m_triangles)
-        if (!triangle.is_split() && triangle.is_selected_by_seed_fill())
+        if (!triangle.is_split() && triangle.is_selected_by_seed_fill()) {
             triangle.set_state(new_state);
+            touch_root(triangle);
+        }
 
     for (Triangle &triangle : m_triangles)
         if (triangle.is_split() && triangle.valid()) {
@@ -353,6 +353,30 @@ protected:
     void append_touching_subtriangles(int itriangle, int vertexi, int vertexj, std::vector<int>& touching_subtriangles_out) const;
     bool verify_triangle_neighbors(const Triangle& tr, const Vec3i& neighbors) const;
 
+    // Mark the subtree of the original mesh triangle owning tr as possibly carrying painting data.
+    // Only cleared by reset(), so the set of touched subtrees is a superset of the painted ones
+    // and may contain subtrees that were painted over and cleared again.
+    void touch_root(const Triangle &tr) { m_root_touched[tr.source_triangle] = true; }
+
+    // Visit all valid leaf triangles of the touched subtrees. Untouched subtrees cannot carry
+    // any state or splits, thus the traversal cost is proportional to the area ever painted
+    // instead of the mesh size. The visitor is called with the triangle index.
+    template<typename VisitorType> void visit_touched_leaves(VisitorType visitor) const {
+        for (int root = 0; root < int(m_root_touched.size()); ++ root)
+            if (m_root_touched[root])
+                this->visit_leaves_recursive(root, visitor);
+    }
+    template<typename VisitorType> void visit_leaves_recursive(int facet_idx, VisitorType &visitor) const {
+        const Triangle &tr = m_triangles[facet_idx];
+        if (! tr.valid())
+            return;
+        if (tr.is_split()) {
+            for (int i = 0; i <= tr.number_of_split_sides(); ++ i)
+                this->visit_leaves_recursive(tr.children[i], visitor);
+        } else
+            visitor(facet_idx);
+    }
+
 
     // Lists of vertices and triangles, both original and new
     std::vector<Vertex> m_vertices;
@@ -374,6 +398,11 @@ protected:
     int m_orig_size_vertices = 0;
     int m_orig_size_indices = 0;
 
+    // For each original mesh triangle, whether its subtree was ever touched by painting,
+    // splitting or seed fill selection. Lets serialization and the paint overlay skip the
+    // untouched part of the mesh. See touch_root() / visit_touched_leaves().
+    std::vector<bool> m_root_touched;
+
     std::unique_ptr<Cursor> m_cursor;
     // Zero indicates an uninitialized state.
     float m_old_cursor_radius_sqr = 0;
@@ -87,6 +87,11 @@ extern std::string format_memsize_MB(size_t n);
 // Latter is used to get the memory info from SysInfoDialog.
 extern std::string log_memory_info(bool ignore_loglevel = false);
 extern void disable_multi_threading();
+// Deterministic mode for release validation: produce byte identical output for identical input
+// at any thread count by seeding the remaining run seeded random generators with fixed constants.
+// To be set from the --deterministic CLI flag before slicing starts.
+extern void set_deterministic_mode(bool enable);
+extern bool deterministic_mode();
 // Returns the size of physical memory (RAM) in bytes.
 extern size_t total_physical_memory();
 
@@ -111,6 +111,23 @@ void Zipper::add_entry(const std::string &name, const void *data, size_t l)
     m_data.clear();
 }
 
+void Zipper::add_entry_deflated(const std::string &name, const void *deflated,
+                                size_t l, size_t uncomp_size,
+                                unsigned int uncomp_crc32)
+{
+    if(!m_impl->is_alive()) return;
+
+    finish_entry();
+
+    if(!mz_zip_writer_add_mem_ex(&m_impl->arch, name.c_str(), deflated, l,
+                                 nullptr, 0, MZ_ZIP_FLAG_COMPRESSED_DATA,
+                                 uncomp_size, uncomp_crc32))
+        m_impl->blow_up();
+
+    m_entry.clear();
+    m_data.clear();
+}
+
 void Zipper::finish_entry()
 {
     if(!m_impl->is_alive()) return;
@@ -51,6 +51,14 @@ public:
     /// This method throws exactly like finish_entry() does.
     void add_entry(const std::string& name, const void* data, size_t bytes);
 
+    /// Add a new binary file entry whose content the caller has already deflated
+    /// (a raw deflate stream, e.g. on a worker thread). The buffer is written into
+    /// the archive as-is, stamped with the given size and CRC-32 of the original,
+    /// uncompressed data. Throws like add_entry() does.
+    void add_entry_deflated(const std::string& name, const void* deflated,
+                            size_t bytes, size_t uncomp_size,
+                            unsigned int uncomp_crc32);
+
     // Writing data to the archive works like with standard streams. The target
     // within the zip file is the entry created with the add_entry method.
 
@@ -532,11 +532,23 @@ void CalibPressureAdvancePattern::generate_custom_gcodes(const DynamicPrintConfi
                                                          Model                    &model,
                                                          const Vec3d              &origin)
 {
+    refresh_setup(config, is_bbl_machine, model, origin);
+
+    // The plater regenerates the pattern before every reslice. When neither the
+    // calibration parameters nor any of the config values feeding the generator
+    // changed, re-emitting the G-code would reproduce the previous result
+    // verbatim, so the cached one is re-applied instead.
+    if (m_cache_valid && is_bbl_machine == m_cached_is_bbl_machine && origin == m_cached_origin &&
+        m_starting_point == m_cached_starting_point &&
+        m_params.start == m_cached_params.start && m_params.end == m_cached_params.end && m_params.step == m_cached_params.step &&
+        m_config.equals(m_cached_config)) {
+        model.plates_custom_gcodes[model.curr_plate_index] = m_cached_gcodes;
+        return;
+    }
+
     std::stringstream gcode;
     gcode << "; start pressure advance pattern for layer\n";
 
-        refresh_setup(config, is_bbl_machine, model, origin);
-
     gcode << move_to(Vec2d(m_starting_point.x(), m_starting_point.y()), m_writer, "Move to start XY position");
     gcode << m_writer.travel_to_z(height_first_layer(), "Move to start Z position");
     gcode << m_writer.set_pressure_advance(m_params.start);
@@ -664,6 +676,14 @@ void CalibPressureAdvancePattern::generate_custom_gcodes(const DynamicPrintConfi
     info.gcodes = gcode_items;
 
     model.plates_custom_gcodes[model.curr_plate_index] = info;
+
+    m_cache_valid            = true;
+    m_cached_config          = m_config;
+    m_cached_params          = m_params;
+    m_cached_origin          = origin;
+    m_cached_starting_point  = m_starting_point;
+    m_cached_is_bbl_machine  = is_bbl_machine;
+    m_cached_gcodes          = std::move(info);
 }
 
 void CalibPressureAdvancePattern::set_start_offset(const Vec3d &offset)
@@ -6,6 +6,7 @@
 #include "GCodeWriter.hpp"
 #include "PrintConfig.hpp"
 #include "BoundingBox.hpp"
+#include "CustomGCode.hpp"
 
 namespace Slic3r {
 
@@ -293,6 +294,18 @@ private:
 
     const Calib_Params &m_params;
 
+    // Cache of the last generated pattern. The plater re-runs the generator on
+    // every reslice while a calibration pattern is loaded; when none of the
+    // inputs changed since the last run, the cached result is re-applied
+    // instead of re-emitting the whole pattern.
+    bool               m_cache_valid = false;
+    DynamicPrintConfig m_cached_config;
+    Calib_Params       m_cached_params;
+    Vec3d              m_cached_origin{Vec3d::Zero()};
+    Vec3d              m_cached_starting_point{Vec3d::Zero()};
+    bool               m_cached_is_bbl_machine = false;
+    CustomGCode::Info  m_cached_gcodes;
+
     GCodeWriter        m_writer;
     Vec3d              m_starting_point;
     bool               m_is_start_point_fixed = false;
@@ -22,6 +22,7 @@
 #include <vector>
 #include <cassert>
 #include <cmath>
+#include <limits>
 #include <type_traits>
 #include <optional>
 
@@ -56,6 +57,11 @@ static constexpr double EPSILON = 1e-4;
 // int32_t fits an interval of (-2147.48mm, +2147.48mm)
 // with int64_t we don't have to worry anymore about the size of the int.
 static constexpr double SCALING_FACTOR = 0.000001;
+// The scaled coordinate range must cover the build volumes we target: one meter at the
+// SCALING_FACTOR resolution. With the 32bit coord_t above this holds with margin
+// (+-2147mm); this trips at compile time should either constant ever change incompatibly.
+static_assert(double(std::numeric_limits<coord_t>::max()) * SCALING_FACTOR >= 1000.,
+              "coord_t at SCALING_FACTOR resolution must cover a one meter build volume");
 // for creating circles (for brim_ear)
 #define POLY_SIDES 24
 static constexpr double PI = 3.141592653589793238;
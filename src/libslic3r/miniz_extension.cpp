@@ -1,4 +1,5 @@
 #include <exception>
+#include <limits>
 
 #include "miniz_extension.hpp"
 
@@ -6,6 +7,15 @@
 #include "boost/nowide/cstdio.hpp"
 #endif
 
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <map>
+#include <mutex>
+#endif
+
 #include "I18N.hpp"
 
 //! macro used to mark string used at localization,
@@ -61,10 +71,75 @@ bool close_zip(mz_zip_archive *zip, bool isread)
     }
     return ret;
 }
+
+#ifndef _WIN32
+// Archives opened for reading are memory mapped and handed to miniz as a memory based
+// archive: the central directory and the inflate input then read straight from the page
+// cache instead of going through buffered FILE I/O, and miniz passes stored
+// (uncompressed) entries to extraction callbacks directly from the mapping without an
+// intermediate read buffer. The mappings are tracked per archive so that
+// close_zip_reader() can unmap them; archives not found in the registry were opened
+// through the cfile fallback and are closed by close_zip() above.
+struct MappedArchive
+{
+    void   *addr;
+    size_t  size;
+};
+std::mutex                             g_mapped_archives_mutex;
+std::map<mz_zip_archive*, MappedArchive> g_mapped_archives;
+
+bool open_zip_reader_mmap(mz_zip_archive *zip, const char *fname)
+{
+    int fd = ::open(fname, O_RDONLY);
+    if (fd < 0)
+        return false;
+    struct stat st;
+    if (::fstat(fd, &st) != 0 || st.st_size <= 0 || !S_ISREG(st.st_mode) ||
+        uint64_t(st.st_size) > uint64_t(std::numeric_limits<size_t>::max())) {
+        ::close(fd);
+        return false;
+    }
+    size_t size = size_t(st.st_size);
+    void  *addr = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    // The mapping holds its own reference to the file.
+    ::close(fd);
+    if (addr == MAP_FAILED)
+        return false;
+    if (!mz_zip_reader_init_mem(zip, addr, size, 0)) {
+        ::munmap(addr, size);
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(g_mapped_archives_mutex);
+    g_mapped_archives[zip] = MappedArchive{ addr, size };
+    return true;
+}
+
+// Returns true if the archive was memory mapped and has been closed, with the result of
+// mz_zip_reader_end() stored into closed_ok.
+bool close_zip_reader_mmap(mz_zip_archive *zip, bool &closed_ok)
+{
+    MappedArchive mapping;
+    {
+        std::lock_guard<std::mutex> lock(g_mapped_archives_mutex);
+        auto it = g_mapped_archives.find(zip);
+        if (it == g_mapped_archives.end())
+            return false;
+        mapping = it->second;
+        g_mapped_archives.erase(it);
+    }
+    closed_ok = bool(mz_zip_reader_end(zip));
+    ::munmap(mapping.addr, mapping.size);
+    return true;
+}
+#endif // _WIN32
 }
 
 bool open_zip_reader(mz_zip_archive *zip, const std::string &fname)
 {
+#ifndef _WIN32
+    if (zip != nullptr && open_zip_reader_mmap(zip, fname.c_str()))
+        return true;
+#endif
     return open_zip(zip, fname.c_str(), true);
 }
 
@@ -73,7 +148,17 @@ bool open_zip_writer(mz_zip_archive *zip, const std::string &fname)
     return open_zip(zip, fname.c_str(), false);
 }
 
-bool close_zip_reader(mz_zip_archive *zip) { return close_zip(zip, true); }
+bool close_zip_reader(mz_zip_archive *zip)
+{
+#ifndef _WIN32
+    if (zip != nullptr) {
+        bool closed_ok = false;
+        if (close_zip_reader_mmap(zip, closed_ok))
+            return closed_ok;
+    }
+#endif
+    return close_zip(zip, true);
+}
 bool close_zip_writer(mz_zip_archive *zip) { return close_zip(zip, false); }
 
 MZ_Archive::MZ_Archive()
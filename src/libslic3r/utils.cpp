@@ -194,6 +194,19 @@ void disable_multi_threading()
 #endif // TBB_HAS_GLOBAL_CONTROL
 }
 
+// Set once at startup before the worker threads are spawned, read only afterwards.
+static bool g_deterministic_mode = false;
+
+void set_deterministic_mode(bool enable)
+{
+    g_deterministic_mode = enable;
+}
+
+bool deterministic_mode()
+{
+    return g_deterministic_mode;
+}
+
 static std::string g_var_dir;
 
 void set_var_dir(const std::string &dir)
@@ -39,6 +39,12 @@
 #include <string.h>
 #include <assert.h>
 
+#include <algorithm>
+#include <array>
+
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+
 #include <boost/log/trivial.hpp>
 
 #include <boost/filesystem/operations.hpp>
@@ -643,8 +649,13 @@ int GLVolumeCollection::load_object_volume(
 #if ENABLE_SMOOTH_NORMALS
     v.model.init_from(mesh, true);
 #else
-    v.model.init_from(*mesh);
-    v.mesh_raycaster = std::make_unique<GUI::MeshRaycaster>(mesh);
+    if (m_deferred_geometry_enabled)
+        // the expensive conversion to render data is done in parallel by finalize_deferred_geometry()
+        m_deferred_geometry.emplace_back(&v, mesh);
+    else {
+        v.model.init_from(*mesh);
+        v.mesh_raycaster = GUI::get_shared_mesh_raycaster(mesh);
+    }
 #endif // ENABLE_SMOOTH_NORMALS
     v.composite_id = GLVolume::CompositeID(obj_idx, volume_idx, instance_idx);
     if (model_volume->is_model_part()) {
@@ -671,6 +682,28 @@ int GLVolumeCollection::load_object_volume(
     return int(this->volumes.size() - 1);
 }
 
+void GLVolumeCollection::finalize_deferred_geometry()
+{
+    m_deferred_geometry_enabled = false;
+    if (m_deferred_geometry.empty())
+        return;
+
+    // Converting the meshes to interleaved vertex/normal data and building the
+    // raycasting trees is the expensive part of (re)loading a scene, the GL upload
+    // is not: it happens lazily at the first render of each model, so none of this
+    // touches the GL context and it may run on worker threads.
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, m_deferred_geometry.size()),
+        [this](const tbb::blocked_range<size_t>& range) {
+        for (size_t i = range.begin(); i < range.end(); ++i) {
+            GLVolume* volume = m_deferred_geometry[i].first;
+            const std::shared_ptr<const TriangleMesh>& mesh = m_deferred_geometry[i].second;
+            volume->model.init_from(*mesh);
+            volume->mesh_raycaster = GUI::get_shared_mesh_raycaster(mesh);
+        }
+    });
+    m_deferred_geometry.clear();
+}
+
 // Load SLA auxiliary GLVolumes (for support trees or pad).
 // This function produces volumes for multiple instances in a single shot,
 // as some object specific mesh conversions may be expensive.
@@ -699,7 +732,7 @@ void GLVolumeCollection::load_object_auxiliary(
 #else
         v.model.init_from(mesh);
         v.model.set_color((milestone == slaposPad) ? GLVolume::SLA_PAD_COLOR : GLVolume::SLA_SUPPORT_COLOR);
-        v.mesh_raycaster = std::make_unique<GUI::MeshRaycaster>(std::make_shared<const TriangleMesh>(mesh));
+        v.mesh_raycaster = std::make_shared<const GUI::MeshRaycaster>(std::make_shared<const TriangleMesh>(mesh));
 #endif // ENABLE_SMOOTH_NORMALS
         v.composite_id = GLVolume::CompositeID(obj_idx, -int(milestone), (int)instance_idx.first);
         v.geometry_id = std::pair<size_t, size_t>(timestamp, model_instance.id().id);
@@ -751,7 +784,7 @@ int GLVolumeCollection::load_wipe_tower_preview(
         v.model_per_colors[i].init_from(color_part);
     }
     v.model.init_from(wipe_tower_shell);
-    v.mesh_raycaster = std::make_unique<GUI::MeshRaycaster>(std::make_shared<const TriangleMesh>(wipe_tower_shell));
+    v.mesh_raycaster = std::make_shared<const GUI::MeshRaycaster>(std::make_shared<const TriangleMesh>(wipe_tower_shell));
     v.set_convex_hull(wipe_tower_shell);
     v.set_volume_offset(Vec3d(pos_x, pos_y, 0.0));
     v.set_volume_rotation(Vec3d(0., 0., (M_PI / 180.) * rotation_angle));
@@ -831,6 +864,39 @@ void GLVolumeCollection::render(GLVolumeCollection::ERenderType type, bool disab
     if (to_render.empty())
         return;
 
+    // extract the six planes of the camera frustum from the view-projection matrix (Gribb-Hartmann),
+    // as pairs (normal, offset) with the normals pointing inside the frustum, and drop the volumes
+    // laying completely outside of it. The per-volume world space bounding box is cached and only
+    // re-computed when the volume transform changes, so orbiting a densely populated plate pays
+    // one plane test per volume instead of a full draw.
+    std::array<std::pair<Vec3d, double>, 6> frustum_planes;
+    // multiply the raw 4x4 matrices, composing the Transform3d objects would drop the
+    // projective bottom row of the perspective projection matrix
+    const Eigen::Matrix4d vp_matrix = projection_matrix.matrix() * view_matrix.matrix();
+    for (int i = 0; i < 3; ++i) {
+        frustum_planes[2 * i]     = { Vec3d(vp_matrix(3, 0) + vp_matrix(i, 0), vp_matrix(3, 1) + vp_matrix(i, 1), vp_matrix(3, 2) + vp_matrix(i, 2)), vp_matrix(3, 3) + vp_matrix(i, 3) };
+        frustum_planes[2 * i + 1] = { Vec3d(vp_matrix(3, 0) - vp_matrix(i, 0), vp_matrix(3, 1) - vp_matrix(i, 1), vp_matrix(3, 2) - vp_matrix(i, 2)), vp_matrix(3, 3) - vp_matrix(i, 3) };
+    }
+    auto is_inside_frustum = [&frustum_planes](const BoundingBoxf3& bbox) {
+        if (!bbox.defined)
+            return true;
+        for (const auto& [normal, offset] : frustum_planes) {
+            // test the bounding box corner farthest along the plane normal
+            const Vec3d p(normal.x() >= 0.0 ? bbox.max.x() : bbox.min.x(),
+                          normal.y() >= 0.0 ? bbox.max.y() : bbox.min.y(),
+                          normal.z() >= 0.0 ? bbox.max.z() : bbox.min.z());
+            if (normal.dot(p) + offset < 0.0)
+                return false;
+        }
+        return true;
+    };
+    to_render.erase(std::remove_if(to_render.begin(), to_render.end(), [&is_inside_frustum](const GLVolumeWithIdAndZ& volume) {
+        // sinking contours are rendered below the printbed, keep their volumes
+        return !volume.first->is_sinking() && !is_inside_frustum(volume.first->transformed_bounding_box());
+    }), to_render.end());
+    if (to_render.empty())
+        return;
+
     GLShaderProgram* shader = GUI::wxGetApp().get_current_shader();
     if (shader == nullptr)
         return;
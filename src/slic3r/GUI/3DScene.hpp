@@ -215,7 +215,9 @@ public:
 
     GUI::GLModel            model;
     // raycaster used for picking
-    std::unique_ptr<GUI::MeshRaycaster> mesh_raycaster;
+    // shared with the per-mesh raycaster cache (see GUI::get_shared_mesh_raycaster())
+    // whenever the volume renders a ModelVolume mesh
+    std::shared_ptr<const GUI::MeshRaycaster> mesh_raycaster;
     // BBS
     mutable std::vector<GUI::GLModel> mmuseg_models;
     mutable ObjectBase::Timestamp       mmuseg_ts;
@@ -428,6 +430,11 @@ private:
     Slope m_slope;
     bool m_show_sinking_contours = false;
 
+    // newly loaded volumes whose geometry conversion was deferred while
+    // m_deferred_geometry_enabled, converted in parallel by finalize_deferred_geometry()
+    std::vector<std::pair<GLVolume*, std::shared_ptr<const TriangleMesh>>> m_deferred_geometry;
+    bool m_deferred_geometry_enabled{ false };
+
 public:
     GLVolumePtrs volumes;
 
@@ -452,6 +459,13 @@ public:
         bool               in_assemble_view = false,
         bool               use_loaded_id = false);
 
+    // While enabled, load_object_volume() skips the expensive conversion of the mesh
+    // to render data and records the new volume instead. finalize_deferred_geometry()
+    // then performs the recorded conversions in parallel worker threads and disables
+    // the deferring again; the GL buffers are created lazily at the first render.
+    void enable_deferred_geometry() { m_deferred_geometry_enabled = true; }
+    void finalize_deferred_geometry();
+
     // Load SLA auxiliary GLVolumes (for support trees or pad).
     void load_object_auxiliary(
         const SLAPrintObject           *print_object,
@@ -475,7 +489,7 @@ public:
                 std::function<bool(const GLVolume &)> filter_func  = std::function<bool(const GLVolume &)>(), bool with_outline = true) const;
 
     // Clear the geometry
-    void clear() { for (auto *v : volumes) delete v; volumes.clear(); }
+    void clear() { for (auto *v : volumes) delete v; volumes.clear(); m_deferred_geometry.clear(); }
 
     bool empty() const { return volumes.empty(); }
     void set_range(double low, double high) { for (GLVolume *vol : this->volumes) vol->set_range(low, high); }
@@ -226,7 +226,9 @@ void BackgroundSlicingProcess::process_fff()
 		m_gcode_result->reset();
 
 		BOOST_LOG_TRIVIAL(info) << __FUNCTION__ << boost::format(" %1%: gcode_result reseted, will start print::process")%__LINE__;
-		m_print->process();
+		// Run the slicing pipeline inside the bounded low priority arena, so the UI thread and
+		// the latency critical interactive jobs keep getting CPU time while the plate is sliced.
+		slicing_task_arena().execute([this]{ m_print->process(); });
 		BOOST_LOG_TRIVIAL(info) << __FUNCTION__ << boost::format(" %1%: after print::process, send slicing complete event to gui...")%__LINE__;
 
 		wxCommandEvent evt(m_event_slicing_completed_id);
@@ -237,7 +239,9 @@ void BackgroundSlicingProcess::process_fff()
 
 		//BBS: add plate index into render params
 		m_temp_output_path = this->get_current_plate()->get_tmp_gcode_path();
-		m_fff_print->export_gcode(m_temp_output_path, m_gcode_result, [this](const ThumbnailsParams& params) { return this->render_thumbnails(params); });
+		slicing_task_arena().execute([this]{
+			m_fff_print->export_gcode(m_temp_output_path, m_gcode_result, [this](const ThumbnailsParams& params) { return this->render_thumbnails(params); });
+		});
 		BOOST_LOG_TRIVIAL(info) << __FUNCTION__ << boost::format(": export gcode finished");
 	}
 	if (this->set_step_started(bspsGCodeFinalize)) {
@@ -268,7 +272,7 @@ static void write_thumbnail(Zipper& zipper, const ThumbnailData& data)
 void BackgroundSlicingProcess::process_sla()
 {
     assert(m_print == m_sla_print);
-    m_print->process();
+    slicing_task_arena().execute([this]{ m_print->process(); });
     if (this->set_step_started(bspsGCodeFinalize)) {
         if (! m_export_path.empty()) {
 			wxQueueEvent(GUI::wxGetApp().mainframe->m_plater, new wxCommandEvent(m_event_export_began_id));
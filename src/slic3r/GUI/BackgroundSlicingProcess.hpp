@@ -119,6 +119,10 @@ public:
 	PrinterTechnology   current_printer_technology() const;
 	// Get the current print. It is either m_fff_print or m_sla_print.
 	const PrintBase*    current_print() const { return m_print; }
+	// Estimated remaining wall clock time of the currently running slicing job in seconds,
+	// extrapolated from the progress model of the print, or -1. if no estimate is available
+	// (not running, or too little progress reported yet).
+	double              eta_seconds() const { return m_print != nullptr && this->running() ? m_print->eta_seconds() : -1.; }
 	const Print* 		fff_print() const { return m_fff_print; }
 	Print* 				fff_print() { return m_fff_print; }
 	const SLAPrint* 	sla_print() const { return m_sla_print; }
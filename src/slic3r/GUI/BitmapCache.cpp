@@ -308,17 +308,22 @@ error:
 wxBitmap* BitmapCache::load_svg(const std::string &bitmap_name, unsigned target_width, unsigned target_height, 
     const bool grayscale/* = false*/, const bool dark_mode/* = false*/, const std::string& new_color /*= ""*/, const float scale_in_center/* = 0*/)
 {
-    std::string bitmap_key = bitmap_name + ( target_height !=0 ? 
-                                           "-h" + std::to_string(target_height) : 
+    std::string bitmap_key = bitmap_name + ( target_height !=0 ?
+                                           "-h" + std::to_string(target_height) :
                                            "-w" + std::to_string(target_width))
                                          + (m_scale != 1.0f ? "-s" + float_to_string_decimal_point(m_scale) : "")
                                          + (dark_mode ? "-dm" : "")
                                          + (grayscale ? "-gs" : "")
+                                         + (scale_in_center > 0.f ? "-c" + float_to_string_decimal_point(scale_in_center) : "")
                                          + new_color;
 
-    /*auto it = m_map.find(bitmap_key);
+    // The key encodes everything the rasterization depends on (size, scale, theme,
+    // grayscale, centering, color override), so a dark mode or DPI toggle simply
+    // fills new entries while repeated requests reuse the already rasterized icon
+    // instead of re-parsing and re-rasterizing the SVG file.
+    auto it = m_map.find(bitmap_key);
     if (it != m_map.end())
-        return it->second;*/
+        return it->second;
 
     // map of color replaces
     std::map<std::string, std::string> replaces;
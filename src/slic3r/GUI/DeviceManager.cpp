@@ -2861,6 +2861,17 @@ std::string MachineObject::setting_id_to_type(std::string setting_id, std::strin
 }
 
 int MachineObject::parse_json(std::string payload)
+{
+    try {
+        return this->parse_json(json::parse(payload));
+    }
+    catch (...) {
+        BOOST_LOG_TRIVIAL(trace) << "parse_json failed! dev_id=" << this->dev_id << ", payload = " << payload;
+        return -1;
+    }
+}
+
+int MachineObject::parse_json(json j_pre)
 {
     CNumericLocalesSetter locales_setter;
 
@@ -2875,7 +2886,6 @@ int MachineObject::parse_json(std::string payload)
     try {
         bool restored_json = false;
         json j;
-        json j_pre = json::parse(payload);
         if (j_pre.empty()) {
             return 0;
         }
@@ -4472,7 +4482,7 @@ int MachineObject::parse_json(std::string payload)
         parse_state_changed_event();
     }
     catch (...) {
-        BOOST_LOG_TRIVIAL(trace) << "parse_json failed! dev_id=" << this->dev_id <<", payload = " << payload;
+        BOOST_LOG_TRIVIAL(trace) << "parse_json failed! dev_id=" << this->dev_id <<", payload = " << j_pre.dump();
     }
 
     std::chrono::system_clock::time_point clock_stop = std::chrono::system_clock::now();
@@ -923,6 +923,10 @@ public:
     int cloud_publish_json(std::string json_str, int qos = 0);
     int local_publish_json(std::string json_str, int qos = 0);
     int parse_json(std::string payload);
+    // The status push payloads are large and arrive several times per second per
+    // printer; the DOM can be parsed on the network thread and only the state
+    // update has to run on the UI thread.
+    int parse_json(json j_pre);
     int publish_gcode(std::string gcode_str);
 
     std::string setting_id_to_type(std::string setting_id, std::string tray_type);
@@ -35,6 +35,9 @@
 #include <wx/progdlg.h>
 #include <wx/numformatter.h>
 
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_reduce.h>
+
 #include <array>
 #include <algorithm>
 #include <chrono>
@@ -168,6 +171,7 @@ void GCodeViewer::IBuffer::reset()
 
     vbo = 0;
     count = 0;
+    bbox.reset();
 }
 
 bool GCodeViewer::Path::matches(const GCodeProcessorResult::MoveVertex& move) const
@@ -816,8 +820,11 @@ void GCodeViewer::init(ConfigOptionMode mode, PresetBundle* preset_bundle)
         case EMoveType::Wipe:
         case EMoveType::Extrude: {
             buffer.render_primitive_type = TBuffer::ERenderPrimitiveType::Triangle;
-            buffer.vertices.format = VBuffer::EFormat::PositionNormal3;
-            buffer.shader = "gouraud_light";
+            // The tubes are flat shaded per face, so the normals are not stored per vertex,
+            // the toolpaths_flat shader derives them from screen space derivatives. This
+            // halves the size of the biggest vertex buffers of the preview.
+            buffer.vertices.format = VBuffer::EFormat::Position;
+            buffer.shader = "toolpaths_flat";
             break;
         }
         case EMoveType::Travel: {
@@ -1127,41 +1134,46 @@ void GCodeViewer::refresh(const GCodeProcessorResult& gcode_result, const std::v
     }
 
     // update ranges for coloring / legend
+    // The scan is pure min/max bookkeeping per move, reduce it in parallel so
+    // that large prints do not stall the UI thread when the preview opens.
+    // Skips the first vertex.
     m_extrusions.reset_ranges();
-    for (size_t i = 0; i < m_moves_count; ++i) {
-        // skip first vertex
-        if (i == 0)
-            continue;
+    m_extrusions.ranges = tbb::parallel_reduce(
+        tbb::blocked_range<size_t>(1, m_moves_count), m_extrusions.ranges,
+        [this, &gcode_result](const tbb::blocked_range<size_t>& range, Extrusions::Ranges ranges) {
+            for (size_t i = range.begin(); i < range.end(); ++i) {
+                const GCodeProcessorResult::MoveVertex& curr = gcode_result.moves[i];
 
-        const GCodeProcessorResult::MoveVertex& curr = gcode_result.moves[i];
+                switch (curr.type)
+                {
+                case EMoveType::Extrude:
+                {
+                    ranges.height.update_from(round_to_bin(curr.height));
+                    ranges.width.update_from(round_to_bin(curr.width));
+                    ranges.fan_speed.update_from(curr.fan_speed);
+                    ranges.temperature.update_from(curr.temperature);
+                    if (curr.extrusion_role != erCustom || is_visible(erCustom))
+                        ranges.volumetric_rate.update_from(round_to_bin(curr.volumetric_rate()));
+
+                    if (curr.layer_duration > 0.f) {
+                        ranges.layer_duration.update_from(curr.layer_duration);
+                        ranges.layer_duration_log.update_from(curr.layer_duration);
+                    }
+                    [[fallthrough]];
+                }
+                case EMoveType::Travel:
+                {
+                    if (m_buffers[buffer_id(curr.type)].visible)
+                        ranges.feedrate.update_from(curr.feedrate);
 
-        switch (curr.type)
-        {
-        case EMoveType::Extrude:
-        {
-            m_extrusions.ranges.height.update_from(round_to_bin(curr.height));
-            m_extrusions.ranges.width.update_from(round_to_bin(curr.width));
-            m_extrusions.ranges.fan_speed.update_from(curr.fan_speed);
-            m_extrusions.ranges.temperature.update_from(curr.temperature);
-            if (curr.extrusion_role != erCustom || is_visible(erCustom))
-                m_extrusions.ranges.volumetric_rate.update_from(round_to_bin(curr.volumetric_rate()));
-
-            if (curr.layer_duration > 0.f) {
-                m_extrusions.ranges.layer_duration.update_from(curr.layer_duration);
-m_extrusions.ranges.layer_duration_log.update_from(curr.layer_duration);
+                    break;
+                }
+                default: { break; }
+                }
             }
-            [[fallthrough]];
-        }
-        case EMoveType::Travel:
-        {
-            if (m_buffers[buffer_id(curr.type)].visible)
-                m_extrusions.ranges.feedrate.update_from(curr.feedrate);
-
-            break;
-        }
-        default: { break; }
-        }
-    }
+            return ranges;
+        },
+        [](Extrusions::Ranges lhs, const Extrusions::Ranges& rhs) { lhs.merge(rhs); return lhs; });
 
 #if ENABLE_GCODE_VIEWER_STATISTICS
     m_statistics.refresh_time = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::high_resolution_clock::now() - start_time).count();
@@ -1207,6 +1219,8 @@ void GCodeViewer::reset()
     m_moves_count = 0;
     m_ssid_to_moveid_map.clear();
     m_ssid_to_moveid_map.shrink_to_fit();
+    m_interpolation_points_prefix_sum.clear();
+    m_interpolation_points_prefix_sum.shrink_to_fit();
     for (TBuffer& buffer : m_buffers) {
         buffer.reset();
     }
@@ -1920,7 +1934,6 @@ void GCodeViewer::export_toolpaths_to_obj(const char* filename) const
     const size_t floats_per_vertex = t_buffer.vertices.vertex_size_floats();
 
     std::vector<Vec3f> out_vertices;
-    std::vector<Vec3f> out_normals;
 
     struct VerticesOffset
     {
@@ -1941,7 +1954,6 @@ void GCodeViewer::export_toolpaths_to_obj(const char* filename) const
         for (size_t j = 0; j < vertices_count; ++j) {
             const size_t base = j * floats_per_vertex;
             out_vertices.push_back({ vertices[base + 0], vertices[base + 1], vertices[base + 2] });
-            out_normals.push_back({ vertices[base + 3], vertices[base + 4], vertices[base + 5] });
         }
 
         if (i < t_buffer.vertices.vbos.size() - 1)
@@ -1954,20 +1966,14 @@ void GCodeViewer::export_toolpaths_to_obj(const char* filename) const
         fprintf(fp, "v %g %g %g\n", v.x(), v.y(), v.z());
     }
 
-    // save normals to file
-    fprintf(fp, "\n# normals\n");
-    for (const Vec3f& n : out_normals) {
-        fprintf(fp, "vn %g %g %g\n", n.x(), n.y(), n.z());
-    }
-
-    size_t i = 0;
-    for (const ColorRGBA& color : colors) {
-        // save material triangles to file
-        fprintf(fp, "\nusemtl material_%zu\n", i + 1);
-        fprintf(fp, "# triangles material %zu\n", i + 1);
-
+    // get indices data from index buffers on gpu.
+    // The vertex buffers store positions only, so the per-face flat normals are computed
+    // from the triangles here, one normal per exported triangle.
+    struct ObjTriangle { size_t v1; size_t v2; size_t v3; };
+    std::vector<std::vector<ObjTriangle>> triangles_per_color(colors.size());
+    for (size_t i = 0; i < colors.size(); ++i) {
         for (const RenderPath& render_path : t_buffer.render_paths) {
-            if (render_path.color != color)
+            if (render_path.color != colors[i])
                 continue;
 
             const IBuffer& ibuffer = t_buffer.indices[render_path.ibuffer_id];
@@ -1980,7 +1986,6 @@ void GCodeViewer::export_toolpaths_to_obj(const char* filename) const
                 }
             }
 
-            // get indices data from index buffer on gpu
             glsafe(::glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ibuffer.ibo));
             for (size_t j = 0; j < render_path.sizes.size(); ++j) {
                 IndexBuffer indices(render_path.sizes[j]);
@@ -1995,12 +2000,34 @@ void GCodeViewer::export_toolpaths_to_obj(const char* filename) const
                     const size_t v3 = 1 + static_cast<size_t>(indices[base + 2]) + vertices_offset;
                     if (v1 != v2)
                         // do not export dummy triangles
-                        fprintf(fp, "f %zu//%zu %zu//%zu %zu//%zu\n", v1, v1, v2, v2, v3, v3);
+                        triangles_per_color[i].push_back({ v1, v2, v3 });
                 }
             }
             glsafe(::glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0));
         }
-        ++i;
+    }
+
+    // save normals to file, one per triangle
+    fprintf(fp, "\n# normals\n");
+    for (const std::vector<ObjTriangle>& triangles : triangles_per_color) {
+        for (const ObjTriangle& t : triangles) {
+            const Vec3f& p1 = out_vertices[t.v1 - 1];
+            const Vec3f& p2 = out_vertices[t.v2 - 1];
+            const Vec3f n = (p2 - p1).cross(out_vertices[t.v3 - 1] - p1).normalized();
+            fprintf(fp, "vn %g %g %g\n", n.x(), n.y(), n.z());
+        }
+    }
+
+    size_t normal_id = 0;
+    for (size_t i = 0; i < colors.size(); ++i) {
+        // save material triangles to file
+        fprintf(fp, "\nusemtl material_%zu\n", i + 1);
+        fprintf(fp, "# triangles material %zu\n", i + 1);
+
+        for (const ObjTriangle& t : triangles_per_color[i]) {
+            ++normal_id;
+            fprintf(fp, "f %zu//%zu %zu//%zu %zu//%zu\n", t.v1, normal_id, t.v2, normal_id, t.v3, normal_id);
+        }
     }
 
     fclose(fp);
@@ -2073,15 +2100,12 @@ void GCodeViewer::load_toolpaths(const GCodeProcessorResult& gcode_result, const
 
     // format data into the buffers to be rendered as solid.
     auto add_vertices_as_solid = [](const GCodeProcessorResult::MoveVertex& prev, const GCodeProcessorResult::MoveVertex& curr, TBuffer& buffer, unsigned int vbuffer_id, VertexBuffer& vertices, size_t move_id) {
-        auto store_vertex = [](VertexBuffer& vertices, const Vec3f& position, const Vec3f& normal) {
-            // append position
+        auto store_vertex = [](VertexBuffer& vertices, const Vec3f& position) {
+            // append position, no normal is stored: the faces are flat shaded
+            // and the toolpaths_flat shader derives the normal per fragment
             vertices.push_back(position.x());
             vertices.push_back(position.y());
             vertices.push_back(position.z());
-            // append normal
-            vertices.push_back(normal.x());
-            vertices.push_back(normal.y());
-            vertices.push_back(normal.z());
         };
 
         if (buffer.paths.empty() || prev.type != curr.type || !buffer.paths.back().matches(curr)) {
@@ -2098,9 +2122,7 @@ void GCodeViewer::load_toolpaths(const GCodeProcessorResult& gcode_result, const
 
             const Vec3f dir = (curr_position - prev_position).normalized();
             const Vec3f right = Vec3f(dir.y(), -dir.x(), 0.0f).normalized();
-            const Vec3f left = -right;
             const Vec3f up = right.cross(dir);
-            const Vec3f down = -up;
             const float half_width = 0.5f * last_path.width;
             const float half_height = 0.5f * last_path.height;
             const Vec3f prev_pos = prev_position - half_height * up;
@@ -2111,19 +2133,19 @@ void GCodeViewer::load_toolpaths(const GCodeProcessorResult& gcode_result, const
             const Vec3f d_left = -half_width * right;
 
             if ((last_path.vertices_count() == 1 || vertices.empty()) && i == 0) {
-                store_vertex(vertices, prev_pos + d_up, up);
-                store_vertex(vertices, prev_pos + d_right, right);
-                store_vertex(vertices, prev_pos + d_down, down);
-                store_vertex(vertices, prev_pos + d_left, left);
+                store_vertex(vertices, prev_pos + d_up);
+                store_vertex(vertices, prev_pos + d_right);
+                store_vertex(vertices, prev_pos + d_down);
+                store_vertex(vertices, prev_pos + d_left);
             } else {
-                store_vertex(vertices, prev_pos + d_right, right);
-                store_vertex(vertices, prev_pos + d_left, left);
+                store_vertex(vertices, prev_pos + d_right);
+                store_vertex(vertices, prev_pos + d_left);
             }
 
-            store_vertex(vertices, curr_pos + d_up, up);
-            store_vertex(vertices, curr_pos + d_right, right);
-            store_vertex(vertices, curr_pos + d_down, down);
-            store_vertex(vertices, curr_pos + d_left, left);
+            store_vertex(vertices, curr_pos + d_up);
+            store_vertex(vertices, curr_pos + d_right);
+            store_vertex(vertices, curr_pos + d_down);
+            store_vertex(vertices, curr_pos + d_left);
         }
 
         last_path.sub_paths.back().last = { vbuffer_id, vertices.size(), move_id, curr.position };
@@ -2547,6 +2569,18 @@ void GCodeViewer::load_toolpaths(const GCodeProcessorResult& gcode_result, const
     for (size_t i = 0; i < m_moves_count - biased_seams_ids.size(); i++)
         m_ssid_to_moveid_map.push_back(extract_move_id(i));
 
+    // precompute prefix sums of arc interpolation point counts, so that refresh_render_paths()
+    // can size any visible s_id range with a single subtraction instead of walking the moves
+    m_interpolation_points_prefix_sum.clear();
+    m_interpolation_points_prefix_sum.reserve(m_ssid_to_moveid_map.size());
+    size_t interpolation_points_count = 0;
+    for (size_t move_id : m_ssid_to_moveid_map) {
+        const GCodeProcessorResult::MoveVertex& move = gcode_result.moves[move_id];
+        if (move.is_arc_move())
+            interpolation_points_count += move.interpolation_points.size();
+        m_interpolation_points_prefix_sum.push_back(interpolation_points_count);
+    }
+
     //BBS: smooth toolpaths corners for the given TBuffer using triangles
     auto smooth_triangle_toolpaths_corners = [&gcode_result, this](const TBuffer& t_buffer, MultiVertexBuffer& v_multibuffer) {
         auto extract_position_at = [](const VertexBuffer& vertices, size_t offset) {
@@ -2833,6 +2867,10 @@ void GCodeViewer::load_toolpaths(const GCodeProcessorResult& gcode_result, const
     using VboIndexList = std::vector<unsigned int>;
     std::vector<VboIndexList> vbo_indices(m_buffers.size());
 
+    // variable used to collect, per index buffer, the bounding box of the indexed segments
+    // used at render time for view frustum culling
+    std::vector<std::vector<BoundingBoxf3>> ibuffer_bboxes(m_buffers.size());
+
     seams_count = 0;
 
     for (size_t i = 0; i < m_moves_count; ++i) {
@@ -2905,6 +2943,18 @@ void GCodeViewer::load_toolpaths(const GCodeProcessorResult& gcode_result, const
 
         IndexBuffer& i_buffer = i_multibuffer.back();
 
+        // merge the segment endpoints into the bounding box of the current index buffer
+        std::vector<BoundingBoxf3>& bboxes = ibuffer_bboxes[id];
+        bboxes.resize(i_multibuffer.size());
+        BoundingBoxf3& i_bbox = bboxes[i_multibuffer.size() - 1];
+        i_bbox.merge(prev.position.cast<double>());
+        i_bbox.merge(curr.position.cast<double>());
+        if (curr.is_arc_move_with_interpolation_points()) {
+            for (const Vec3f& point : curr.interpolation_points) {
+                i_bbox.merge(point.cast<double>());
+            }
+        }
+
         switch (t_buffer.render_primitive_type)
         {
         case TBuffer::ERenderPrimitiveType::Line: {
@@ -2944,6 +2994,10 @@ void GCodeViewer::load_toolpaths(const GCodeProcessorResult& gcode_result, const
                 IBuffer& ibuf = t_buffer.indices.back();
                 ibuf.count = size_elements;
                 ibuf.vbo = vbo_indices[i][t_buffer.indices.size() - 1];
+                if (t_buffer.indices.size() <= ibuffer_bboxes[i].size())
+                    // the collected bounding box tracks the segment endpoints, inflate it to account
+                    // for the triangulated geometry extruded around the centerline
+                    ibuf.bbox = ibuffer_bboxes[i][t_buffer.indices.size() - 1].inflated(1.0);
 
 #if ENABLE_GCODE_VIEWER_STATISTICS
                 m_statistics.total_indices_gpu_size += static_cast<int64_t>(size_bytes);
@@ -3398,25 +3452,15 @@ m_no_render_path = false;
                         unsigned int offset = static_cast<unsigned int>(m_sequential_view.current.last - sub_path.first.s_id);
                         if (offset > 0) {
                             if (buffer.render_primitive_type == TBuffer::ERenderPrimitiveType::Line) {
-                                for (size_t i = sub_path.first.s_id + 1; i < m_sequential_view.current.last + 1; i++) {
-                                    size_t move_id = m_ssid_to_moveid_map[i];
-                                    const GCodeProcessorResult::MoveVertex& curr = m_gcode_result->moves[move_id];
-                                    if (curr.is_arc_move()) {
-                                        offset += curr.interpolation_points.size();
-                                    }
-                                }
+                                offset += static_cast<unsigned int>(m_interpolation_points_prefix_sum[m_sequential_view.current.last] -
+                                                                    m_interpolation_points_prefix_sum[sub_path.first.s_id]);
                                 offset = 2 * offset - 1;
                             }
                             else if (buffer.render_primitive_type == TBuffer::ERenderPrimitiveType::Triangle) {
                                 unsigned int indices_count = buffer.indices_per_segment();
                                 // BBS: modify to support moves which has internal point
-                                for (size_t i = sub_path.first.s_id + 1; i < m_sequential_view.current.last + 1; i++) {
-                                    size_t move_id = m_ssid_to_moveid_map[i];
-                                    const GCodeProcessorResult::MoveVertex& curr = m_gcode_result->moves[move_id];
-                                    if (curr.is_arc_move()) {
-                                        offset += curr.interpolation_points.size();
-                                    }
-                                }
+                                offset += static_cast<unsigned int>(m_interpolation_points_prefix_sum[m_sequential_view.current.last] -
+                                                                    m_interpolation_points_prefix_sum[sub_path.first.s_id]);
                                 offset = indices_count * (offset - 1) + (indices_count - 2);
                                 if (sub_path_id == 0)
                                     offset += 6; // add 2 triangles for starting cap
@@ -3508,13 +3552,8 @@ m_no_render_path = false;
             size_t max_s_id = std::min(m_sequential_view.current.last, sub_path.last.s_id);
             size_t min_s_id = std::max(m_sequential_view.current.first, sub_path.first.s_id);
             unsigned int segments_count = max_s_id - min_s_id;
-            for (size_t i = min_s_id + 1; i < max_s_id + 1; i++) {
-                size_t move_id = m_ssid_to_moveid_map[i];
-                const GCodeProcessorResult::MoveVertex& curr = m_gcode_result->moves[move_id];
-                if (curr.is_arc_move()) {
-                    segments_count += curr.interpolation_points.size();
-                }
-            }
+            segments_count += static_cast<unsigned int>(m_interpolation_points_prefix_sum[max_s_id] -
+                                                        m_interpolation_points_prefix_sum[min_s_id]);
             size_in_indices = buffer.indices_per_segment() * segments_count;
             break;
         }
@@ -3874,6 +3913,32 @@ void GCodeViewer::render_toolpaths()
         return (zoom < 5.0) ? 1.0 : (1.0 + 5.0 * (zoom - 5.0) / (100.0 - 5.0));
     };
 
+    // extract the six planes of the camera frustum from the view-projection matrix (Gribb-Hartmann),
+    // as pairs (normal, offset) with the normals pointing inside the frustum
+    std::array<std::pair<Vec3d, double>, 6> frustum_planes;
+    // multiply the raw 4x4 matrices, composing the Transform3d objects would drop the
+    // projective bottom row of the perspective projection matrix
+    const Eigen::Matrix4d vp_matrix = camera.get_projection_matrix().matrix() * camera.get_view_matrix().matrix();
+    for (int i = 0; i < 3; ++i) {
+        frustum_planes[2 * i]     = { Vec3d(vp_matrix(3, 0) + vp_matrix(i, 0), vp_matrix(3, 1) + vp_matrix(i, 1), vp_matrix(3, 2) + vp_matrix(i, 2)), vp_matrix(3, 3) + vp_matrix(i, 3) };
+        frustum_planes[2 * i + 1] = { Vec3d(vp_matrix(3, 0) - vp_matrix(i, 0), vp_matrix(3, 1) - vp_matrix(i, 1), vp_matrix(3, 2) - vp_matrix(i, 2)), vp_matrix(3, 3) - vp_matrix(i, 3) };
+    }
+
+    auto is_inside_frustum = [&frustum_planes](const BoundingBoxf3& bbox) {
+        if (!bbox.defined)
+            // no bounding box was collected for this buffer, do not cull it
+            return true;
+        for (const auto& [normal, offset] : frustum_planes) {
+            // test the bounding box corner farthest along the plane normal
+            const Vec3d p(normal.x() >= 0.0 ? bbox.max.x() : bbox.min.x(),
+                          normal.y() >= 0.0 ? bbox.max.y() : bbox.min.y(),
+                          normal.z() >= 0.0 ? bbox.max.z() : bbox.min.z());
+            if (normal.dot(p) + offset < 0.0)
+                return false;
+        }
+        return true;
+    };
+
     const unsigned char begin_id = buffer_id(EMoveType::Retract);
     const unsigned char end_id   = buffer_id(EMoveType::Count);
 
@@ -3918,6 +3983,15 @@ void GCodeViewer::render_toolpaths()
                     // Not found. This shall not happen.
                     continue;
 
+                // skip buffers laying completely outside of the camera frustum,
+                // the loop above realigns it_path at the next iteration
+                if (!is_inside_frustum(i_buffer.bbox)) {
+#if ENABLE_GCODE_VIEWER_STATISTICS
+                    ++m_statistics.culled_ibuffers_count;
+#endif // ENABLE_GCODE_VIEWER_STATISTICS
+                    continue;
+                }
+
                 glsafe(::glBindBuffer(GL_ARRAY_BUFFER, i_buffer.vbo));
                 if (position_id != -1) {
                     glsafe(::glVertexAttribPointer(position_id, buffer.vertices.position_size_floats(), GL_FLOAT, GL_FALSE, buffer.vertices.vertex_size_bytes(), (const void*)buffer.vertices.position_offset_bytes()));
@@ -4433,6 +4507,44 @@ void GCodeViewer::render_legend(float &legend_height, int canvas_width, int canv
         }
     };
 
+    // shows the slowest layers with their dominant feature and how many planner blocks ran
+    // at the acceleration limit, so slow layers can be picked directly from the legend;
+    // clicking an entry restricts the layers slider to that layer
+    auto append_slowest_layers = [this, &imgui]() {
+        const PrintEstimatedStatistics::Mode& mode = m_print_statistics.modes[static_cast<size_t>(PrintEstimatedStatistics::ETimeMode::Normal)];
+        if (mode.layers_times.empty())
+            return;
+
+        std::vector<size_t> slowest(mode.layers_times.size());
+        for (size_t i = 0; i < slowest.size(); ++i) {
+            slowest[i] = i;
+        }
+        const size_t count = std::min<size_t>(5, slowest.size());
+        std::partial_sort(slowest.begin(), slowest.begin() + count, slowest.end(),
+            [&mode](size_t a, size_t b) { return mode.layers_times[a] > mode.layers_times[b]; });
+
+        ImGui::Spacing();
+        imgui.title(_u8L("Slowest layers"));
+        for (size_t i = 0; i < count; ++i) {
+            const size_t layer_id = slowest[i];
+            std::string label = std::to_string(layer_id + 1) + ": " + short_time(get_time_dhms(mode.layers_times[layer_id]));
+            if (layer_id < mode.layers_stats.size()) {
+                const PrintEstimatedStatistics::Mode::LayerStats& layer_stats = mode.layers_stats[layer_id];
+                const size_t dominant_role = std::distance(layer_stats.roles_times.begin(),
+                    std::max_element(layer_stats.roles_times.begin(), layer_stats.roles_times.end()));
+                label += "  " + _u8L(ExtrusionEntity::role_to_string(static_cast<ExtrusionRole>(dominant_role)));
+                if (layer_stats.acceleration_saturated_blocks > 0)
+                    label += "  (" + std::to_string(layer_stats.acceleration_saturated_blocks) + " " + _u8L("accel capped") + ")";
+            }
+            if (ImGui::Selectable(label.c_str()) && layer_id < m_layers.size()) {
+                m_layers_slider->SetLowerValue(static_cast<int>(layer_id));
+                m_layers_slider->SetHigherValue(static_cast<int>(layer_id));
+                // the canvas propagates the new slider values on the next render of the sliders
+                wxGetApp().plater()->get_current_canvas3D()->set_as_dirty();
+            }
+        }
+    };
+
     auto append_headers = [&imgui](const std::vector<std::pair<std::string, float>>& title_offsets) {
         for (size_t i = 0; i < title_offsets.size(); i++) {
             ImGui::SameLine(title_offsets[i].second);
@@ -4834,8 +4946,8 @@ void GCodeViewer::render_legend(float &legend_height, int canvas_width, int canv
     }
     case EViewType::FanSpeed:       { append_range(m_extrusions.ranges.fan_speed, 0); break; }
     case EViewType::Temperature:    { append_range(m_extrusions.ranges.temperature, 0); break; }
-    case EViewType::LayerTime:      { append_range(m_extrusions.ranges.layer_duration, true); break; }
-    case EViewType::LayerTimeLog:   { append_range(m_extrusions.ranges.layer_duration_log, true); break; }
+    case EViewType::LayerTime:      { append_range(m_extrusions.ranges.layer_duration, true); append_slowest_layers(); break; }
+    case EViewType::LayerTimeLog:   { append_range(m_extrusions.ranges.layer_duration_log, true); append_slowest_layers(); break; }
     case EViewType::VolumetricRate: { append_range(m_extrusions.ranges.volumetric_rate, 2); break; }
     case EViewType::Tool:
     {
@@ -5630,6 +5742,7 @@ void GCodeViewer::render_statistics()
         ImGui::Separator();
         add_counter(std::string("Instanced models:"), m_statistics.gl_instanced_models_calls_count);
         add_counter(std::string("Batched models:"), m_statistics.gl_batched_models_calls_count);
+        add_counter(std::string("Culled IBuffers:"), m_statistics.culled_ibuffers_count);
     }
 
     if (ImGui::CollapsingHeader("CPU memory")) {
@@ -180,6 +180,9 @@ class GCodeViewer
         unsigned int ibo{ 0 };
         // count of indices, updated after data are sent to gpu
         size_t count{ 0 };
+        // axis aligned bounding box of the toolpath segments indexed by this buffer,
+        // used at render time to skip buffers laying outside of the camera frustum
+        BoundingBoxf3 bbox;
 
         void reset();
     };
@@ -406,6 +409,12 @@ class GCodeViewer
                 max = std::max(max, value);
             }
             void reset(bool log = false) { min = FLT_MAX; max = -FLT_MAX; count = 0; log_scale = log; }
+            // combine with a range gathered over another subset of the moves
+            void merge(const Range& other) {
+                min = std::min(min, other.min);
+                max = std::max(max, other.max);
+                count += other.count;
+            }
 
             float step_size() const;
             ColorRGBA get_color_at(float value) const;
@@ -440,6 +449,16 @@ Range layer_duration_log;
                 layer_duration.reset();
                 layer_duration_log.reset(true);
             }
+            void merge(const Ranges& other) {
+                height.merge(other.height);
+                width.merge(other.width);
+                feedrate.merge(other.feedrate);
+                fan_speed.merge(other.fan_speed);
+                volumetric_rate.merge(other.volumetric_rate);
+                temperature.merge(other.temperature);
+                layer_duration.merge(other.layer_duration);
+                layer_duration_log.merge(other.layer_duration_log);
+            }
         };
 
         unsigned int role_visibility_flags{ 0 };
@@ -536,6 +555,7 @@ Range layer_duration_log;
         int64_t gl_triangles_calls_count{ 0 };
         int64_t gl_instanced_models_calls_count{ 0 };
         int64_t gl_batched_models_calls_count{ 0 };
+        int64_t culled_ibuffers_count{ 0 };
         // memory
         int64_t results_size{ 0 };
         int64_t total_vertices_gpu_size{ 0 };
@@ -578,6 +598,7 @@ Range layer_duration_log;
             gl_triangles_calls_count = 0;
             gl_instanced_models_calls_count = 0;
             gl_batched_models_calls_count = 0;
+            culled_ibuffers_count = 0;
         }
 
         void reset_sizes() {
@@ -737,6 +758,10 @@ private:
     //BBS: add only gcode mode
     bool m_only_gcode_in_preview {false};
     std::vector<size_t> m_ssid_to_moveid_map;
+    // Prefix sums of arc interpolation point counts over m_ssid_to_moveid_map: element i holds
+    // the total count of interpolation points of all arc moves with s_id <= i. Lets
+    // refresh_render_paths() size a visible range in O(1) instead of walking every move in it.
+    std::vector<size_t> m_interpolation_points_prefix_sum;
 
     std::vector<TBuffer> m_buffers{ static_cast<size_t>(EMoveType::Extrude) };
     // bounding box of toolpaths
@@ -150,6 +150,7 @@ void GLCanvas3D::LayersEditing::set_config(const DynamicPrintConfig* config)
     delete m_slicing_parameters;
     m_slicing_parameters = nullptr;
     m_layers_texture.valid = false;
+    m_layers_texture.dirty_min_z = 0.0f;
     m_layer_height_profile.clear();
 }
 
@@ -166,6 +167,7 @@ void GLCanvas3D::LayersEditing::select_object(const Model& model, int object_id)
         delete m_slicing_parameters;
         m_slicing_parameters = nullptr;
         m_layers_texture.valid = false;
+        m_layers_texture.dirty_min_z = 0.0f;
         this->last_object_id = object_id;
         m_model_object = model_object_new;
         m_object_max_z = new_max_z;
@@ -569,10 +571,30 @@ void GLCanvas3D::LayersEditing::render_volumes(const GLCanvas3D& canvas, const G
     const GLsizei half_h = h / 2;
     glsafe(::glPixelStorei(GL_UNPACK_ALIGNMENT, 1));
     glsafe(::glBindTexture(GL_TEXTURE_2D, m_z_texture_id));
-    glsafe(::glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, w, h, 0, GL_RGBA, GL_UNSIGNED_BYTE, 0));
-    glsafe(::glTexImage2D(GL_TEXTURE_2D, 1, GL_RGBA, half_w, half_h, 0, GL_RGBA, GL_UNSIGNED_BYTE, 0));
-    glsafe(::glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, w, h, GL_RGBA, GL_UNSIGNED_BYTE, m_layers_texture.data.data()));
-    glsafe(::glTexSubImage2D(GL_TEXTURE_2D, 1, 0, 0, half_w, half_h, GL_RGBA, GL_UNSIGNED_BYTE, m_layers_texture.data.data() + m_layers_texture.width * m_layers_texture.height * 4));
+    if (!m_layers_texture.allocated) {
+        glsafe(::glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, w, h, 0, GL_RGBA, GL_UNSIGNED_BYTE, 0));
+        glsafe(::glTexImage2D(GL_TEXTURE_2D, 1, GL_RGBA, half_w, half_h, 0, GL_RGBA, GL_UNSIGNED_BYTE, 0));
+        m_layers_texture.allocated = true;
+        m_layers_texture.uploaded = false;
+        m_layers_texture.dirty_min_z = 0.0f;
+    }
+    if (!m_layers_texture.uploaded) {
+        // Only the texture rows from the bottom of the edited band up changed since
+        // the last upload, re-send just that band (see dirty_min_z).
+        GLsizei row0 = 0;
+        if (m_layers_texture.dirty_min_z > 0.0f && m_layers_texture.cells > 0 && m_object_max_z > 0.0f) {
+            // keep in sync with the z_to_texture_row mapping used by the variable_layer_height shader
+            const float cell = m_layers_texture.dirty_min_z * float(m_layers_texture.cells - 1) / m_object_max_z;
+            row0 = std::clamp((GLsizei)(cell / float(w)), (GLsizei)0, h - 1);
+        }
+        glsafe(::glTexSubImage2D(GL_TEXTURE_2D, 0, 0, row0, w, h - row0, GL_RGBA, GL_UNSIGNED_BYTE,
+            m_layers_texture.data.data() + (size_t)row0 * (size_t)w * 4));
+        const GLsizei half_row0 = row0 / 2;
+        glsafe(::glTexSubImage2D(GL_TEXTURE_2D, 1, 0, half_row0, half_w, half_h - half_row0, GL_RGBA, GL_UNSIGNED_BYTE,
+            m_layers_texture.data.data() + m_layers_texture.width * m_layers_texture.height * 4 + (size_t)half_row0 * (size_t)half_w * 4));
+        m_layers_texture.uploaded = true;
+        m_layers_texture.dirty_min_z = FLT_MAX;
+    }
     for (GLVolume* glvolume : volumes.volumes) {
         // Render the object using the layer editing shader and texture.
         if (!glvolume->is_active || glvolume->composite_id.object_id != this->last_object_id || glvolume->is_modifier)
@@ -597,6 +619,9 @@ void GLCanvas3D::LayersEditing::adjust_layer_height_profile()
     this->update_slicing_parameters();
     PrintObject::update_layer_height_profile(*m_model_object, *m_slicing_parameters, m_layer_height_profile);
     Slic3r::adjust_layer_height_profile(*m_slicing_parameters, m_layer_height_profile, this->last_z, this->strength, this->band_width, this->last_action);
+    // the layer boundaries above the edited band shift as well, so everything
+    // from the bottom of the band up needs to be refreshed on the GPU
+    m_layers_texture.dirty_min_z = std::min(m_layers_texture.dirty_min_z, std::max(0.0f, this->last_z - this->band_width));
     m_layers_texture.valid = false;
 }
 
@@ -605,6 +630,7 @@ void GLCanvas3D::LayersEditing::reset_layer_height_profile(GLCanvas3D & canvas)
     const_cast<ModelObject*>(m_model_object)->layer_height_profile.clear();
     m_layer_height_profile.clear();
     m_layers_texture.valid = false;
+    m_layers_texture.dirty_min_z = 0.0f;
     canvas.post_event(SimpleEvent(EVT_GLCANVAS_SCHEDULE_BACKGROUND_PROCESS));
     wxGetApp().obj_list()->update_info_items(last_object_id);
 }
@@ -615,6 +641,7 @@ void GLCanvas3D::LayersEditing::adaptive_layer_height_profile(GLCanvas3D & canva
     m_layer_height_profile = layer_height_profile_adaptive(*m_slicing_parameters, *m_model_object, quality_factor);
     const_cast<ModelObject*>(m_model_object)->layer_height_profile.set(m_layer_height_profile);
     m_layers_texture.valid = false;
+    m_layers_texture.dirty_min_z = 0.0f;
     canvas.post_event(SimpleEvent(EVT_GLCANVAS_SCHEDULE_BACKGROUND_PROCESS));
     wxGetApp().obj_list()->update_info_items(last_object_id);
 }
@@ -625,6 +652,7 @@ void GLCanvas3D::LayersEditing::smooth_layer_height_profile(GLCanvas3D & canvas,
     m_layer_height_profile = smooth_height_profile(m_layer_height_profile, *m_slicing_parameters, smoothing_params);
     const_cast<ModelObject*>(m_model_object)->layer_height_profile.set(m_layer_height_profile);
     m_layers_texture.valid = false;
+    m_layers_texture.dirty_min_z = 0.0f;
     canvas.post_event(SimpleEvent(EVT_GLCANVAS_SCHEDULE_BACKGROUND_PROCESS));
     wxGetApp().obj_list()->update_info_items(last_object_id);
 }
@@ -636,6 +664,7 @@ void GLCanvas3D::LayersEditing::generate_layer_height_texture()
     bool update = !m_layers_texture.valid;
     if (PrintObject::update_layer_height_profile(*m_model_object, *m_slicing_parameters, m_layer_height_profile)) {
         // Initialized to the default value.
+        m_layers_texture.dirty_min_z = 0.0f;
         update = true;
     }
     // Update if the layer height profile was changed, or when the texture is not valid.
@@ -656,6 +685,7 @@ void GLCanvas3D::LayersEditing::generate_layer_height_texture()
         Slic3r::generate_object_layers(*m_slicing_parameters, m_layer_height_profile),
         m_layers_texture.data.data(), m_layers_texture.height, m_layers_texture.width, level_of_detail_2nd_level);
     m_layers_texture.valid = true;
+    m_layers_texture.uploaded = false;
 }
 
 void GLCanvas3D::LayersEditing::accept_changes(GLCanvas3D & canvas)
@@ -2027,6 +2057,7 @@ void GLCanvas3D::render(bool only_init)
 
     m_canvas->SwapBuffers();
     m_render_stats.increment_fps_counter();
+    m_last_render_time = std::chrono::steady_clock::now();
 }
 
 void GLCanvas3D::render_thumbnail(ThumbnailData& thumbnail_data, unsigned int w, unsigned int h, const ThumbnailsParams& thumbnail_params, Camera::EType camera_type, bool use_top_view, bool for_picking)
@@ -2464,6 +2495,10 @@ void GLCanvas3D::reload_scene(bool refresh_immediately, bool force_full_scene_re
         }
     }
     m_volumes.volumes = std::move(glvolumes_new);
+    // Defer the geometry conversion of the new volumes, so that after e.g. an arrange
+    // of a fully populated plate the render data of all changed volumes is generated
+    // in parallel by finalize_deferred_geometry() below instead of one by one here.
+    m_volumes.enable_deferred_geometry();
     for (unsigned int obj_idx = 0; obj_idx < (unsigned int)m_model->objects.size(); ++ obj_idx) {
         const ModelObject &model_object = *m_model->objects[obj_idx];
         for (int volume_idx = 0; volume_idx < (int)model_object.volumes.size(); ++ volume_idx) {
@@ -2500,6 +2535,7 @@ void GLCanvas3D::reload_scene(bool refresh_immediately, bool force_full_scene_re
             }
         }
     }
+    m_volumes.finalize_deferred_geometry();
     if (printer_technology == ptSLA) {
         size_t idx = 0;
         const SLAPrint *sla_print = this->sla_print();
@@ -2550,7 +2586,7 @@ void GLCanvas3D::reload_scene(bool refresh_immediately, bool force_full_scene_re
                                 volume.model.init_from(mesh, true);
 #else
                                 volume.model.init_from(mesh);
-                                volume.mesh_raycaster = std::make_unique<GUI::MeshRaycaster>(std::make_shared<TriangleMesh>(mesh));
+                                volume.mesh_raycaster = std::make_shared<const GUI::MeshRaycaster>(std::make_shared<TriangleMesh>(mesh));
 #endif // ENABLE_SMOOTH_NORMALS
                             }
                             else {
@@ -2560,7 +2596,7 @@ void GLCanvas3D::reload_scene(bool refresh_immediately, bool force_full_scene_re
 #else
                                 const TriangleMesh& new_mesh = m_model->objects[volume.object_idx()]->volumes[volume.volume_idx()]->mesh();
                                 volume.model.init_from(new_mesh);
-                                volume.mesh_raycaster = std::make_unique<GUI::MeshRaycaster>(std::make_shared<TriangleMesh>(new_mesh));
+                                volume.mesh_raycaster = std::make_shared<const GUI::MeshRaycaster>(std::make_shared<TriangleMesh>(new_mesh));
 #endif // ENABLE_SMOOTH_NORMALS
                             }
 	                    }
@@ -2941,6 +2977,16 @@ void GLCanvas3D::on_idle(wxIdleEvent& evt)
     if (!m_dirty)
         return;
 
+    // Cap the frame rate while continuous interaction (e.g. orbiting) keeps the canvas dirty,
+    // mouse events may arrive much faster than the display can refresh.
+    static constexpr int FRAME_MIN_INTERVAL_MS = 1000 / 60;
+    const int since_last_render = (int)std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - m_last_render_time).count();
+    if (since_last_render < FRAME_MIN_INTERVAL_MS) {
+        // keep m_dirty set and render when the timer wakes up the idle handler again
+        schedule_extra_frame(FRAME_MIN_INTERVAL_MS - since_last_render);
+        return;
+    }
+
 #if ENABLE_ENHANCED_IMGUI_SLIDER_FLOAT
     // this needs to be done here.
     // during the render launched by the refresh the value may be set again
@@ -4897,15 +4943,16 @@ std::vector<Vec2f> GLCanvas3D::get_empty_cells(const Vec2f start_point, const Ve
     BoundingBoxf3 build_volume = plate->get_build_volume();
     Vec2d vmin(build_volume.min.x(), build_volume.min.y()), vmax(build_volume.max.x(), build_volume.max.y());
     BoundingBoxf bbox(vmin, vmax);
-    std::vector<Vec2f> cells;
-    for (float x = bbox.min.x(); x < bbox.max.x(); x += step(0))
-        for (float y = bbox.min.y(); y < bbox.max.y(); y += step(1))
-        {
-            cells.emplace_back(x, y);
-        }
+    const int cols = (int)std::ceil((bbox.max.x() - bbox.min.x()) / step(0));
+    const int rows = (int)std::ceil((bbox.max.y() - bbox.min.y()) / step(1));
+    if (cols <= 0 || rows <= 0)
+        return std::vector<Vec2f>();
+
+    // occupancy grid over the cell centers: each instance hull only visits the cells
+    // covered by its bounding box instead of being tested against every cell of the plate
+    std::vector<bool> occupied((size_t)cols * (size_t)rows, false);
     for (size_t i = 0; i < m_model->objects.size(); ++i) {
         ModelObject* model_object = m_model->objects[i];
-        auto id = model_object->id().id;
         ModelInstance* model_instance0 = model_object->instances.front();
         Polygon hull_2d = model_object->convex_hull_2d(Geometry::assemble_transform({ 0.0, 0.0, model_instance0->get_offset().z() }, model_instance0->get_rotation(),
             model_instance0->get_scaling_factor(), model_instance0->get_mirror()));
@@ -4922,16 +4969,28 @@ std::vector<Vec2f> GLCanvas3D::get_empty_cells(const Vec2f start_point, const Ve
             const Transform3d& trafo = transformation.get_matrix();
             Polygon inst_hull_2d = hull_2d.transform(trafo);
 
-            for (auto it = cells.begin(); it != cells.end(); )
-            {
-                if (inst_hull_2d.contains(Point(scale_(it->x()), scale_(it->y()))))
-                    it = cells.erase(it);
-                else
-                    it++;
-            }
+            const BoundingBox hull_bb = inst_hull_2d.bounding_box();
+            const int ix0 = std::max(0, (int)std::ceil((unscale<double>(hull_bb.min.x()) - bbox.min.x()) / step(0)));
+            const int ix1 = std::min(cols - 1, (int)std::floor((unscale<double>(hull_bb.max.x()) - bbox.min.x()) / step(0)));
+            const int iy0 = std::max(0, (int)std::ceil((unscale<double>(hull_bb.min.y()) - bbox.min.y()) / step(1)));
+            const int iy1 = std::min(rows - 1, (int)std::floor((unscale<double>(hull_bb.max.y()) - bbox.min.y()) / step(1)));
+            for (int ix = ix0; ix <= ix1; ++ix)
+                for (int iy = iy0; iy <= iy1; ++iy) {
+                    const size_t idx = (size_t)ix * rows + iy;
+                    if (!occupied[idx] &&
+                        inst_hull_2d.contains(Point(scale_(bbox.min.x() + ix * step(0)), scale_(bbox.min.y() + iy * step(1)))))
+                        occupied[idx] = true;
+                }
         }
     }
 
+    std::vector<Vec2f> cells;
+    cells.reserve((size_t)cols * (size_t)rows);
+    for (int ix = 0; ix < cols; ++ix)
+        for (int iy = 0; iy < rows; ++iy)
+            if (!occupied[(size_t)ix * rows + iy])
+                cells.emplace_back(float(bbox.min.x() + ix * step(0)), float(bbox.min.y() + iy * step(1)));
+
     Vec2f start = start_point;
     if (start_point(0) < 0 && start_point(1) < 0) {
         start(0) = bbox.center()(0);
@@ -5029,6 +5088,16 @@ void GLCanvas3D::update_sequential_clearance()
             transform = v->get_instance_transformation();
     }
 
+    // the caches may be stale if the model changed since they were last built
+    // (e.g. when this is triggered by a gizmo drag), rebuild them in that case
+    if (!m_sequential_print_clearance_first_displacement) {
+        bool stale = m_sequential_print_clearance.m_instances_cache.size() != m_model->objects.size();
+        for (size_t i = 0; !stale && i < m_model->objects.size(); ++i)
+            stale = m_sequential_print_clearance.m_instances_cache[i].size() != m_model->objects[i]->instances.size();
+        if (stale)
+            m_sequential_print_clearance_first_displacement = true;
+    }
+
     // calculates objects 2d hulls (see also: Print::sequential_print_horizontal_clearance_valid())
     // this is done only the first time this method is called while moving the mouse,
     // the results are then cached for following displacements
@@ -5055,6 +5124,13 @@ void GLCanvas3D::update_sequential_clearance()
                 cache_hull_2d.emplace_back(unscale<double>(p.x()), unscale<double>(p.y()), 0.0);
             }
         }
+
+        // invalidate the per-instance cache, it is rebuilt lazily below
+        m_sequential_print_clearance.m_instances_cache.clear();
+        m_sequential_print_clearance.m_instances_cache.resize(m_model->objects.size());
+        for (size_t i = 0; i < m_model->objects.size(); ++i) {
+            m_sequential_print_clearance.m_instances_cache[i].resize(m_model->objects[i]->instances.size());
+        }
         m_sequential_print_clearance_first_displacement = false;
     }
 
@@ -5072,32 +5148,43 @@ void GLCanvas3D::update_sequential_clearance()
         BoundingBox    bounding_box;
         Polygon        hull_polygon;
     };
+    const BoundingBox plate_bb = plate->get_bounding_box_crd();
     for (size_t i = 0; i < instance_transforms.size(); ++i) {
         const auto& instances = instance_transforms[i];
         double rotation_z0 = instances.front()->get_rotation().z();
         int index = 0;
         for (const auto& instance : instances) {
-            Geometry::Transformation transformation;
-            const Vec3d& offset = instance->get_offset();
-            transformation.set_offset({ offset.x(), offset.y(), 0.0 });
-            transformation.set_rotation(Z, instance->get_rotation().z() - rotation_z0);
-            const Transform3d& trafo = transformation.get_matrix();
-            const Pointf3s& hull_2d = m_sequential_print_clearance.m_hull_2d_cache[i];
-            Points inst_pts;
-            inst_pts.reserve(hull_2d.size());
-            for (size_t j = 0; j < hull_2d.size(); ++j) {
-                const Vec3d p = trafo * hull_2d[j];
-                inst_pts.emplace_back(scaled<double>(p.x()), scaled<double>(p.y()));
-            }
-            Polygon convex_hull(std::move(inst_pts));
-            BoundingBox bouding_box = convex_hull.bounding_box();
-            BoundingBox plate_bb = plate->get_bounding_box_crd();
-            double instance_height = m_model->objects[i]->get_instance_max_z(index++);
+            // the transformed hull and the instance height are cached, keyed by the full instance
+            // matrix (and the reference rotation of the first instance), so that while dragging
+            // only the instances being moved pay for the recomputation
+            SequentialPrintClearance::InstanceCache& cache = m_sequential_print_clearance.m_instances_cache[i][index];
+            const Transform3d instance_matrix = instance->get_matrix();
+            if (!cache.valid || cache.trafo.matrix() != instance_matrix.matrix() || cache.base_rotation_z != rotation_z0) {
+                Geometry::Transformation transformation;
+                const Vec3d& offset = instance->get_offset();
+                transformation.set_offset({ offset.x(), offset.y(), 0.0 });
+                transformation.set_rotation(Z, instance->get_rotation().z() - rotation_z0);
+                const Transform3d& trafo = transformation.get_matrix();
+                const Pointf3s& hull_2d = m_sequential_print_clearance.m_hull_2d_cache[i];
+                Points inst_pts;
+                inst_pts.reserve(hull_2d.size());
+                for (size_t j = 0; j < hull_2d.size(); ++j) {
+                    const Vec3d p = trafo * hull_2d[j];
+                    inst_pts.emplace_back(scaled<double>(p.x()), scaled<double>(p.y()));
+                }
+                cache.hull_polygon = Polygon(std::move(inst_pts));
+                cache.bounding_box = cache.hull_polygon.bounding_box();
+                cache.height = m_model->objects[i]->get_instance_max_z(index);
+                cache.trafo = instance_matrix;
+                cache.base_rotation_z = rotation_z0;
+                cache.valid = true;
+            }
+            ++index;
             //skip the object for not current plate
-            if (!plate_bb.overlap(bouding_box))
+            if (!plate_bb.overlap(cache.bounding_box))
                 continue;
-            convex_and_bounding_boxes.push_back({instance_height, bouding_box, convex_hull});
-            polygons.emplace_back(std::move(convex_hull));
+            convex_and_bounding_boxes.push_back({cache.height, cache.bounding_box, cache.hull_polygon});
+            polygons.emplace_back(cache.hull_polygon);
         }
     }
 
@@ -252,6 +252,13 @@ class GLCanvas3D
             size_t              cells{ 0 };
             // Does it need to be refreshed?
             bool                valid{ false };
+            // Has the texture storage been allocated on the GPU?
+            bool                allocated{ false };
+            // Is the GPU copy of the data in sync with the CPU data?
+            bool                uploaded{ false };
+            // Lowest z whose texture rows changed since the last upload.
+            // Used to re-upload only the affected band (everything from that z up).
+            float               dirty_min_z{ 0.0f };
         };
         LayersTexture   m_layers_texture;
 
@@ -553,6 +560,8 @@ private:
 
     // Screen is only refreshed from the OnIdle handler if it is dirty.
     bool m_dirty;
+    // When the last frame was presented, used to cap the frame rate during continuous interaction.
+    std::chrono::steady_clock::time_point m_last_render_time;
     bool m_initialized;
     //BBS: add flag to controll rendering
     bool m_render_preview{ true };
@@ -659,6 +668,19 @@ public:
 
         std::vector<Pointf3s> m_hull_2d_cache;
 
+        //BBS: per-instance cache of the transformed hulls, bounding boxes and heights,
+        // so that while dragging only the instances being moved are recomputed
+        struct InstanceCache
+        {
+            Transform3d trafo{ Transform3d::Identity() };
+            double      base_rotation_z{ 0.0 };
+            Polygon     hull_polygon;
+            BoundingBox bounding_box;
+            double      height{ 0.0 };
+            bool        valid{ false };
+        };
+        std::vector<std::vector<InstanceCache>> m_instances_cache;
+
     public:
         //BBS: add the height logic
         void set_polygons(const Polygons& polygons, const std::vector<std::pair<Polygon, float>>& height_polygons);
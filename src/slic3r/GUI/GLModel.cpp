@@ -545,6 +545,19 @@ bool GLModel::init_from_file(const std::string& filename)
 }
 
 void GLModel::reset()
+{
+    // the gpu buffers are kept alive (see release_gpu()), so that a following
+    // init_from()/send_to_gpu() cycle streams into the existing allocations
+    // instead of re-creating them
+    m_render_data.vertices_count = 0;
+    m_render_data.indices_count  = 0;
+    m_render_data.geometry.vertices = std::vector<float>();
+    m_render_data.geometry.indices  = std::vector<unsigned int>();
+    m_bounding_box = BoundingBoxf3();
+    m_filename = std::string();
+}
+
+void GLModel::release_gpu()
 {
     // release gpu memory
     if (m_render_data.ibo_id > 0) {
@@ -555,13 +568,8 @@ void GLModel::reset()
         glsafe(::glDeleteBuffers(1, &m_render_data.vbo_id));
         m_render_data.vbo_id = 0;
     }
-
-    m_render_data.vertices_count = 0;
-    m_render_data.indices_count  = 0;
-    m_render_data.geometry.vertices = std::vector<float>();
-    m_render_data.geometry.indices  = std::vector<unsigned int>();
-    m_bounding_box = BoundingBoxf3();
-    m_filename = std::string();
+    m_render_data.vbo_capacity = 0;
+    m_render_data.ibo_capacity = 0;
 }
 
 static GLenum get_primitive_mode(const GLModel::Geometry::Format& format)
@@ -607,8 +615,8 @@ void GLModel::render(const std::pair<size_t, size_t>& range)
     if (shader == nullptr)
         return;
 
-    // sends data to gpu if not done yet
-    if (m_render_data.vbo_id == 0 || m_render_data.ibo_id == 0) {
+    // sends data to gpu if not done yet or if the geometry has been refilled since the last upload
+    if (m_render_data.vbo_id == 0 || m_render_data.ibo_id == 0 || !m_render_data.geometry.vertices.empty()) {
         if (m_render_data.geometry.vertices_count() > 0 && m_render_data.geometry.indices_count() > 0 && !send_to_gpu())
             return;
     }
@@ -688,7 +696,7 @@ void GLModel::render_instanced(unsigned int instances_vbo, unsigned int instance
     if (offset_id == -1 || scales_id == -1)
         return;
 
-    if (m_render_data.vbo_id == 0 || m_render_data.ibo_id == 0) {
+    if (m_render_data.vbo_id == 0 || m_render_data.ibo_id == 0 || !m_render_data.geometry.vertices.empty()) {
         if (!send_to_gpu())
             return;
     }
@@ -743,27 +751,37 @@ void GLModel::render_instanced(unsigned int instances_vbo, unsigned int instance
 
 bool GLModel::send_to_gpu()
 {
-    if (m_render_data.vbo_id > 0 || m_render_data.ibo_id > 0) {
-        assert(false);
-        return false;
-    }
-
     Geometry& data = m_render_data.geometry;
     if (data.vertices.empty() || data.indices.empty()) {
         assert(false);
         return false;
     }
 
+    // Uploads into the buffer kept alive across reset() whenever the new data fits,
+    // so that models rebuilt every frame (gizmo handles, selection boxes while dragging)
+    // stream sub-range updates instead of re-creating their gpu buffers.
+    // A buffer is re-allocated when the data outgrew it or uses less than half of it.
+    auto upload = [](GLenum target, size_t size_bytes, const void* data_ptr, size_t& capacity) {
+        if (size_bytes <= capacity && 2 * size_bytes >= capacity)
+            glsafe(::glBufferSubData(target, 0, size_bytes, data_ptr));
+        else {
+            glsafe(::glBufferData(target, size_bytes, data_ptr, GL_STATIC_DRAW));
+            capacity = size_bytes;
+        }
+    };
+
     // vertices
-    glsafe(::glGenBuffers(1, &m_render_data.vbo_id));
+    if (m_render_data.vbo_id == 0)
+        glsafe(::glGenBuffers(1, &m_render_data.vbo_id));
     glsafe(::glBindBuffer(GL_ARRAY_BUFFER, m_render_data.vbo_id));
-    glsafe(::glBufferData(GL_ARRAY_BUFFER, data.vertices_size_bytes(), data.vertices.data(), GL_STATIC_DRAW));
+    upload(GL_ARRAY_BUFFER, data.vertices_size_bytes(), data.vertices.data(), m_render_data.vbo_capacity);
     glsafe(::glBindBuffer(GL_ARRAY_BUFFER, 0));
     m_render_data.vertices_count = vertices_count();
     data.vertices = std::vector<float>();
 
     // indices
-    glsafe(::glGenBuffers(1, &m_render_data.ibo_id));
+    if (m_render_data.ibo_id == 0)
+        glsafe(::glGenBuffers(1, &m_render_data.ibo_id));
     glsafe(::glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_render_data.ibo_id));
     const size_t indices_count = data.indices.size();
     if (m_render_data.vertices_count <= 256) {
@@ -773,7 +791,7 @@ bool GLModel::send_to_gpu()
             reduced_indices[i] = (unsigned char)data.indices[i];
         }
         data.index_type = Geometry::EIndexType::UBYTE;
-        glsafe(::glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices_count * sizeof(unsigned char), reduced_indices.data(), GL_STATIC_DRAW));
+        upload(GL_ELEMENT_ARRAY_BUFFER, indices_count * sizeof(unsigned char), reduced_indices.data(), m_render_data.ibo_capacity);
         glsafe(::glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0));
     }
     else if (m_render_data.vertices_count <= 65536) {
@@ -783,12 +801,12 @@ bool GLModel::send_to_gpu()
             reduced_indices[i] = (unsigned short)data.indices[i];
         }
         data.index_type = Geometry::EIndexType::USHORT;
-        glsafe(::glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices_count * sizeof(unsigned short), reduced_indices.data(), GL_STATIC_DRAW));
+        upload(GL_ELEMENT_ARRAY_BUFFER, indices_count * sizeof(unsigned short), reduced_indices.data(), m_render_data.ibo_capacity);
         glsafe(::glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0));
     }
     else {
         data.index_type = Geometry::EIndexType::UINT;
-        glsafe(::glBufferData(GL_ELEMENT_ARRAY_BUFFER, data.indices_size_bytes(), data.indices.data(), GL_STATIC_DRAW));
+        upload(GL_ELEMENT_ARRAY_BUFFER, data.indices_size_bytes(), data.indices.data(), m_render_data.ibo_capacity);
         glsafe(::glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0));
     }
     m_render_data.indices_count = indices_count;
@@ -137,6 +137,10 @@ namespace GUI {
             Geometry geometry;
             unsigned int vbo_id{ 0 };
             unsigned int ibo_id{ 0 };
+            // allocated size of the gpu buffers, may exceed the size of the current data
+            // so that frequently re-initialized models stream into the same buffers
+            size_t vbo_capacity{ 0 };
+            size_t ibo_capacity{ 0 };
             size_t vertices_count{ 0 };
             size_t indices_count{ 0 };
         };
@@ -156,7 +160,7 @@ namespace GUI {
 
     public:
         GLModel() = default;
-        virtual ~GLModel() { reset(); }
+        virtual ~GLModel() { reset(); release_gpu(); }
 
         size_t vertices_count() const { return m_render_data.vertices_count > 0 ?
             m_render_data.vertices_count : m_render_data.geometry.vertices_count(); }
@@ -180,6 +184,8 @@ namespace GUI {
         const ColorRGBA& get_color() const { return m_render_data.geometry.color; }
 
         void reset();
+        // release the gpu buffers kept across reset() for reuse
+        void release_gpu();
         void render();
         void render(const std::pair<size_t, size_t>& range);
         void render_instanced(unsigned int instances_vbo, unsigned int instances_count);
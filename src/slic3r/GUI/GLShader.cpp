@@ -6,6 +6,7 @@
 #include "libslic3r/format.hpp"
 #include "libslic3r/Color.hpp"
 
+#include <boost/filesystem.hpp>
 #include <boost/nowide/fstream.hpp>
 #include <GL/glew.h>
 #include <cassert>
@@ -14,6 +15,78 @@
 
 namespace Slic3r {
 
+// Cache of linked program binaries (GL_ARB_get_program_binary) in the user data directory,
+// used to skip compiling and linking unchanged shaders on the next start. The file name
+// carries a hash of the driver identification and of the shader sources, so a driver update
+// or a source edit simply misses the cache; in addition drivers reject binaries of a format
+// they no longer understand, in which case the program is compiled and the file rewritten.
+namespace {
+
+std::string program_binary_cache_path(const std::string &name, const GLShaderProgram::ShaderSources &sources)
+{
+    if (! GLEW_ARB_get_program_binary)
+        return std::string();
+    GLint num_formats = 0;
+    glsafe(::glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &num_formats));
+    if (num_formats <= 0)
+        // The extension is exposed, but the driver does not offer any binary format.
+        return std::string();
+
+    std::string key;
+    for (GLenum str_id : { GL_VENDOR, GL_RENDERER, GL_VERSION })
+        if (const char *str = reinterpret_cast<const char*>(::glGetString(str_id)); str != nullptr)
+            key += str;
+    for (const std::string &source : sources)
+        key += source;
+
+    boost::system::error_code ec;
+    boost::filesystem::path dir = boost::filesystem::path(data_dir()) / "shader_cache";
+    boost::filesystem::create_directory(dir, ec);
+    if (ec)
+        return std::string();
+    return (dir / (name + "_" + format("%016x", std::hash<std::string>{}(key)) + ".bin")).string();
+}
+
+bool load_program_binary(GLuint program_id, const std::string &path)
+{
+    boost::nowide::ifstream file(path, boost::nowide::ifstream::binary);
+    if (! file.good())
+        return false;
+    std::string blob(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>{});
+    if (! file.good() || blob.size() <= sizeof(GLenum))
+        return false;
+    GLenum format;
+    memcpy(&format, blob.data(), sizeof(GLenum));
+    // Call unchecked: a driver is free to reject a stale binary with a GL error,
+    // which is an expected cache miss, not a failure to assert on.
+    ::glProgramBinary(program_id, format, blob.data() + sizeof(GLenum), GLsizei(blob.size() - sizeof(GLenum)));
+    while (::glGetError() != GL_NO_ERROR)
+        ; // drain errors of a rejected binary
+    GLint params = 0;
+    glsafe(::glGetProgramiv(program_id, GL_LINK_STATUS, &params));
+    return params == GL_TRUE;
+}
+
+void store_program_binary(GLuint program_id, const std::string &path)
+{
+    GLint length = 0;
+    glsafe(::glGetProgramiv(program_id, GL_PROGRAM_BINARY_LENGTH, &length));
+    if (length <= 0)
+        return;
+    std::string blob(sizeof(GLenum) + length, '\0');
+    GLenum  format  = 0;
+    GLsizei written = 0;
+    glsafe(::glGetProgramBinary(program_id, length, &written, &format, blob.data() + sizeof(GLenum)));
+    if (written <= 0)
+        return;
+    memcpy(blob.data(), &format, sizeof(GLenum));
+    blob.resize(sizeof(GLenum) + written);
+    boost::nowide::ofstream file(path, boost::nowide::ofstream::binary);
+    file.write(blob.data(), blob.size());
+}
+
+} // namespace
+
 GLShaderProgram::~GLShaderProgram()
 {
     if (m_id > 0)
@@ -118,6 +191,21 @@ bool GLShaderProgram::init_from_texts(const std::string& name, const ShaderSourc
 
     m_name = name;
 
+    const std::string binary_cache_path = program_binary_cache_path(name, sources);
+    if (! binary_cache_path.empty() && boost::filesystem::exists(binary_cache_path)) {
+        m_id = ::glCreateProgram();
+        glcheck();
+        if (m_id > 0) {
+            if (load_program_binary(m_id, binary_cache_path))
+                return true;
+            // The driver rejected the cached binary, compile from sources and refresh the file.
+            boost::system::error_code ec;
+            boost::filesystem::remove(binary_cache_path, ec);
+            glsafe(::glDeleteProgram(m_id));
+            m_id = 0;
+        }
+    }
+
     std::array<GLuint, static_cast<size_t>(EShaderType::Count)> shader_ids = { 0 };
 
     for (size_t i = 0; i < static_cast<size_t>(EShaderType::Count); ++i) {
@@ -169,6 +257,10 @@ bool GLShaderProgram::init_from_texts(const std::string& name, const ShaderSourc
             glsafe(::glAttachShader(m_id, shader_ids[i]));
     }
 
+    if (! binary_cache_path.empty())
+        // Ask the driver to keep the binary retrievable for the cache below.
+        glsafe(::glProgramParameteri(m_id, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE));
+
     glsafe(::glLinkProgram(m_id));
     GLint params;
     glsafe(::glGetProgramiv(m_id, GL_LINK_STATUS, &params));
@@ -192,6 +284,9 @@ bool GLShaderProgram::init_from_texts(const std::string& name, const ShaderSourc
     // release shaders, they are no more needed
     release_shaders(shader_ids);
 
+    if (! binary_cache_path.empty())
+        store_program_binary(m_id, binary_cache_path);
+
     return true;
 }
 
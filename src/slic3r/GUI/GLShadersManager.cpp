@@ -48,6 +48,13 @@ std::pair<bool, std::string> GLShadersManager::init()
     valid &= append_shader("gouraud_light", { prefix + "gouraud_light.vs", prefix + "gouraud_light.fs" });
     //used to render thumbnail
     valid &= append_shader("thumbnail", { prefix + "thumbnail.vs", prefix + "thumbnail.fs"});
+    // used to render extrusion toolpaths in the gcode preview; the vertex buffers carry positions
+    // only, the flat per-face normal is derived from screen space derivatives in the fragment shader.
+    // The FLIP_TRIANGLE_NORMALS workaround matches the one applied to mm_gouraud below.
+    if (platform_flavor() == PlatformFlavor::OSXOnArm && wxPlatformInfo::Get().GetOSMajorVersion() < 12)
+        valid &= append_shader("toolpaths_flat", { prefix + "toolpaths_flat.vs", prefix + "toolpaths_flat.fs" }, { "FLIP_TRIANGLE_NORMALS"sv });
+    else
+        valid &= append_shader("toolpaths_flat", { prefix + "toolpaths_flat.vs", prefix + "toolpaths_flat.fs" });
     // used to render printbed
     valid &= append_shader("printbed", { prefix + "printbed.vs", prefix + "printbed.fs" });
     // used to render options in gcode preview
@@ -19,6 +19,7 @@
 #include <exception>
 #include <cstdlib>
 #include <regex>
+#include <chrono>
 #include <thread>
 #include <string_view>
 #include <boost/algorithm/string/predicate.hpp>
@@ -1932,13 +1933,23 @@ void GUI_App::init_networking_callbacks()
             if (m_is_closing) {
                 return;
             }
-            CallAfter([this, dev_id, msg] {
+            // BBS: parse the payload into a DOM already on the network thread; the status
+            // pushes are large and arrive several times per second per printer, and only
+            // the machine state update has to run on the UI thread.
+            json j;
+            try {
+                j = json::parse(msg);
+            } catch (...) {
+                BOOST_LOG_TRIVIAL(trace) << "parse_json failed! dev_id=" << dev_id << ", payload = " << msg;
+                return;
+            }
+            CallAfter([this, dev_id, j = std::move(j)]() mutable {
                 if (m_is_closing)
                     return;
                 MachineObject* obj = this->m_device_manager->get_user_machine(dev_id);
                 if (obj) {
                     obj->is_ams_need_update = false;
-                    obj->parse_json(msg);
+                    obj->parse_json(std::move(j));
 
                     auto sel = this->m_device_manager->get_selected_machine();
                     if ((sel == obj || sel == nullptr) && obj->is_ams_need_update) {
@@ -1954,7 +1965,14 @@ void GUI_App::init_networking_callbacks()
             if (m_is_closing) {
                 return;
             }
-            CallAfter([this, dev_id, msg] {
+            json j;
+            try {
+                j = json::parse(msg);
+            } catch (...) {
+                BOOST_LOG_TRIVIAL(trace) << "parse_json failed! dev_id=" << dev_id << ", payload = " << msg;
+                return;
+            }
+            CallAfter([this, dev_id, j = std::move(j)]() mutable {
                 if (m_is_closing)
                     return;
 
@@ -1964,7 +1982,7 @@ void GUI_App::init_networking_callbacks()
                 }
 
                 if (obj) {
-                    obj->parse_json(msg);
+                    obj->parse_json(std::move(j));
                     if (this->m_device_manager->get_selected_machine() == obj && obj->is_ams_need_update) {
                         GUI::wxGetApp().sidebar().load_ams_list(obj->dev_id, obj);
                     }
@@ -2278,8 +2296,36 @@ class wxBoostLog : public wxLog
     }
 };
 
+// BBS: log wall-clock durations of the cold-start phases of on_init_inner().
+// The instrumentation stays enabled in release builds; it costs a few log
+// lines, and the per-phase timings are what a slow-startup report needs.
+class StartupTimer
+{
+public:
+    StartupTimer() : m_start(std::chrono::steady_clock::now()), m_phase_start(m_start) {}
+    ~StartupTimer()
+    {
+        BOOST_LOG_TRIVIAL(info) << "startup: on_init_inner total "
+                                << std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - m_start).count()
+                                << " ms";
+    }
+
+    void phase_done(const char *name)
+    {
+        auto now = std::chrono::steady_clock::now();
+        BOOST_LOG_TRIVIAL(info) << "startup: phase \"" << name << "\" took "
+                                << std::chrono::duration_cast<std::chrono::milliseconds>(now - m_phase_start).count() << " ms";
+        m_phase_start = now;
+    }
+
+private:
+    std::chrono::steady_clock::time_point m_start;
+    std::chrono::steady_clock::time_point m_phase_start;
+};
+
 bool GUI_App::on_init_inner()
 {
+    StartupTimer startup_timer;
     wxLog::SetActiveTarget(new wxBoostLog());
 #if BBL_RELEASE_TO_PUBLIC
     wxLog::SetLogLevel(wxLOG_Message);
@@ -2413,6 +2459,8 @@ bool GUI_App::on_init_inner()
 #endif
 #endif
 
+    startup_timer.phase_done("language, colors and fonts");
+
     if (m_last_config_version) {
         int last_major = m_last_config_version->maj();
         int last_minor = m_last_config_version->min();
@@ -2456,6 +2504,7 @@ bool GUI_App::on_init_inner()
 #endif
         scrn->SetText(_L("Loading configuration")+ dots);
     }
+    startup_timer.phase_done("splash screen");
 
     BOOST_LOG_TRIVIAL(info) << "loading systen presets...";
     preset_bundle = new PresetBundle();
@@ -2463,6 +2512,7 @@ bool GUI_App::on_init_inner()
     // just checking for existence of Slic3r::data_dir is not enough : it may be an empty directory
     // supplied as argument to --datadir; in that case we should still run the wizard
     preset_bundle->setup_directories();
+    startup_timer.phase_done("preset bundle directories");
 
 
     if (m_init_app_config_from_older)
@@ -2470,16 +2520,20 @@ bool GUI_App::on_init_inner()
 
     if (is_editor()) {
 #ifdef __WXMSW__
-        if (app_config->get("associate_3mf") == "true")
-            associate_files(L"3mf");
-        if (app_config->get("associate_stl") == "true")
-            associate_files(L"stl");
-        if (app_config->get("associate_step") == "true") {
-            associate_files(L"step");
-            associate_files(L"stp");
-        }
-        if (app_config->get("associate_gcode") == "true")
-            associate_files(L"gcode");
+        // BBS: the registry writes do not have to delay the first window; run them
+        // from the event loop once the startup sequence has finished.
+        CallAfter([this] {
+            if (app_config->get("associate_3mf") == "true")
+                associate_files(L"3mf");
+            if (app_config->get("associate_stl") == "true")
+                associate_files(L"stl");
+            if (app_config->get("associate_step") == "true") {
+                associate_files(L"step");
+                associate_files(L"stp");
+            }
+            if (app_config->get("associate_gcode") == "true")
+                associate_files(L"gcode");
+        });
 #endif // __WXMSW__
 
         preset_updater = new PresetUpdater();
@@ -2574,8 +2628,10 @@ bool GUI_App::on_init_inner()
     }
     else {
 #ifdef __WXMSW__
-        if (app_config->get("associate_gcode") == "true")
-            associate_files(L"gcode");
+        CallAfter([this] {
+            if (app_config->get("associate_gcode") == "true")
+                associate_files(L"gcode");
+        });
 #endif // __WXMSW__
     }
 
@@ -2592,6 +2648,7 @@ bool GUI_App::on_init_inner()
 
     copy_network_if_available();
     on_init_network();
+    startup_timer.phase_done("network plugin init");
 
     if (m_agent && m_agent->is_user_login()) {
         enable_user_preset_folder(true);
@@ -2611,6 +2668,7 @@ bool GUI_App::on_init_inner()
             show_error(nullptr, ex.what());
         }
     //}
+    startup_timer.phase_done("load system presets");
 
     if (app_config->get("sync_user_preset") == "true") {
         //BBS loading user preset
@@ -2642,6 +2700,7 @@ bool GUI_App::on_init_inner()
     sidebar().obj_list()->init();
     //sidebar().aux_list()->init_auxiliary();
     //mainframe->m_auxiliary->init_auxiliary();
+    startup_timer.phase_done("create main window");
 
 //     update_mode(); // !!! do that later
     SetTopWindow(mainframe);
@@ -2658,6 +2717,7 @@ bool GUI_App::on_init_inner()
     }
     else
         load_current_presets();
+    startup_timer.phase_done("load current presets");
 
     if (plater_ != nullptr) {
         plater_->reset_project_dirty_initial_presets();
@@ -2670,6 +2730,7 @@ bool GUI_App::on_init_inner()
 #endif
     mainframe->Show(true);
     BOOST_LOG_TRIVIAL(info) << "main frame firstly shown";
+    startup_timer.phase_done("show main window");
 
 //#if BBL_HAS_FIRST_PAGE
     //BBS: set tp3DEditor firstly
@@ -5122,6 +5183,8 @@ bool GUI_App::load_language(wxString language, bool initial)
     // to load possibly different dictionary, for example, load Czech dictionary for Slovak language.
     wxTranslations::Get()->SetLanguage(language_dict);
     m_wxLocale->AddCatalog(SLIC3R_APP_KEY);
+    // Translations cached before the catalog switch are stale now.
+    I18N::clear_translation_cache();
     m_imgui->set_language(into_u8(language_info->CanonicalName));
 
     //FIXME This is a temporary workaround, the correct solution is to switch to "C" locale during file import / export only.
@@ -11,6 +11,7 @@
 
 #include "libslic3r/PresetBundle.hpp"
 #include "libslic3r/MeasureUtils.hpp"
+#include "libslic3r/Thread.hpp"
 
 #include <imgui/imgui_internal.h>
 
@@ -1061,12 +1062,16 @@ void GLGizmoMeasure::update_if_needed()
         const auto& measuring = m_measuring;
 
         //for (int idx = 0; idx < m_measuring->get_num_of_planes(); ++idx) {
-        tbb::parallel_for(tbb::blocked_range<size_t>(0, m_measuring->get_num_of_planes()),
-        [&plane_models_cache, &measuring, &its](const tbb::blocked_range<size_t>& range) {
-            for (size_t idx = range.begin(); idx != range.end(); ++idx) {
-                GLModel::Geometry init_data = init_plane_data(its, measuring->get_plane_triangle_indices(idx));
-                plane_models_cache[idx].init_from(std::move(init_data));
-            }
+        // Run in the high priority interactive arena, so the gizmo stays responsive even while
+        // a background slicing job saturates the TBB thread pool.
+        interactive_task_arena().execute([&plane_models_cache, &measuring, &its]() {
+            tbb::parallel_for(tbb::blocked_range<size_t>(0, measuring->get_num_of_planes()),
+            [&plane_models_cache, &measuring, &its](const tbb::blocked_range<size_t>& range) {
+                for (size_t idx = range.begin(); idx != range.end(); ++idx) {
+                    GLModel::Geometry init_data = init_plane_data(its, measuring->get_plane_triangle_indices(idx));
+                    plane_models_cache[idx].init_from(std::move(init_data));
+                }
+            });
         });
     };
 
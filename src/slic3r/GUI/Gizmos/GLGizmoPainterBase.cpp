@@ -1189,9 +1189,12 @@ void TriangleSelectorGUI::update_render_data()
     // small value used to offset triangles along their normal to avoid z-fighting
     static const float offset = 0.001f;
 
-    for (const Triangle &tr : m_triangles) {
-        if (!tr.valid() || tr.is_split() || (tr.get_state() == EnforcerBlockerType::NONE && !tr.is_selected_by_seed_fill()))
-            continue;
+    // Only subtrees of original triangles ever touched by painting may carry state,
+    // skip the rest of the mesh without reading it.
+    visit_touched_leaves([&](int facet_idx) {
+        const Triangle &tr = m_triangles[facet_idx];
+        if (tr.get_state() == EnforcerBlockerType::NONE && !tr.is_selected_by_seed_fill())
+            return;
 
         int tr_state = int(tr.get_state());
         GLModel::Geometry &iva = tr.is_selected_by_seed_fill()                   ? iva_seed_fills_data[tr_state] :
@@ -1213,7 +1216,7 @@ void TriangleSelectorGUI::update_render_data()
         iva.add_vertex(v2 + offset_n, n);
         iva.add_triangle((unsigned int)cnt, (unsigned int)cnt + 1, (unsigned int)cnt + 2);
         cnt += 3;
-    }
+    });
 
     if (!iva_enforcers_data.is_empty())
         m_iva_enforcers.init_from(std::move(iva_enforcers_data));
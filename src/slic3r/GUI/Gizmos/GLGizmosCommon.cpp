@@ -228,8 +228,12 @@ void Raycaster::on_update()
 
     if (meshes != m_old_meshes) {
         m_raycasters.clear();
-        for (const TriangleMesh* mesh : meshes)
-            m_raycasters.emplace_back(new MeshRaycaster(std::make_shared<const TriangleMesh>(*mesh)));
+        // the raycasters are shared with the scene, so activating a gizmo on a mesh
+        // whose tree was already built (e.g. when loading the volumes) is free
+        for (const ModelVolume* mv : mvs) {
+            if (mv->is_model_part())
+                m_raycasters.emplace_back(get_shared_mesh_raycaster(mv->mesh_ptr()));
+        }
         m_old_meshes = meshes;
     }
 }
@@ -243,8 +247,8 @@ void Raycaster::on_release()
 std::vector<const MeshRaycaster*> Raycaster::raycasters() const
 {
     std::vector<const MeshRaycaster*> mrcs;
-    for (const auto& raycaster_unique_ptr : m_raycasters)
-        mrcs.push_back(raycaster_unique_ptr.get());
+    for (const auto& raycaster : m_raycasters)
+        mrcs.push_back(raycaster.get());
     return mrcs;
 }
 
@@ -221,7 +221,7 @@ protected:
     void on_release() override;
 
 private:
-    std::vector<std::unique_ptr<MeshRaycaster>> m_raycasters;
+    std::vector<std::shared_ptr<const MeshRaycaster>> m_raycasters;
     std::vector<const TriangleMesh*> m_old_meshes;
 };
 
@@ -1,6 +1,40 @@
 #include "I18N.hpp"
 
-namespace Slic3r { namespace GUI { 
+#include <mutex>
+#include <unordered_map>
+
+namespace Slic3r { namespace GUI {
+
+namespace I18N {
+
+namespace {
+	// Translations keyed by the source (msgid) string. Guarded by a mutex, the status
+	// callbacks of the background processing translate from worker threads.
+	std::mutex                                   g_cache_mutex;
+	std::unordered_map<std::string, std::string> g_cache;
+}
+
+std::string translate_utf8_cached(const std::string &s)
+{
+	{
+		std::lock_guard<std::mutex> lock(g_cache_mutex);
+		auto it = g_cache.find(s);
+		if (it != g_cache.end())
+			return it->second;
+	}
+	// Translate outside of the lock, wxGetTranslation() may take its time on a cache miss.
+	std::string translated = wxGetTranslation(wxString(s.c_str(), wxConvUTF8)).ToUTF8().data();
+	std::lock_guard<std::mutex> lock(g_cache_mutex);
+	return g_cache.emplace(s, std::move(translated)).first->second;
+}
+
+void clear_translation_cache()
+{
+	std::lock_guard<std::mutex> lock(g_cache_mutex);
+	g_cache.clear();
+}
+
+} // namespace I18N
 
 wxString L_str(const std::string &str)
 {
@@ -40,6 +40,13 @@
 namespace Slic3r { namespace GUI { 
 
 namespace I18N {
+	// Cached singular translation. wxGetTranslation() performs a catalog lookup plus two
+	// encoding conversions, and the ImGui render paths translate the same strings every frame.
+	// Translations are materialized lazily on first use and kept until the language changes,
+	// GUI_App::load_language() flushes the cache.
+	std::string translate_utf8_cached(const std::string &s);
+	void        clear_translation_cache();
+
 	inline wxString translate(const char         *s) { return wxGetTranslation(wxString(s, wxConvUTF8)); }
 	inline wxString translate(const wchar_t      *s) { return wxGetTranslation(s); }
 	inline wxString translate(const std::string  &s) { return wxGetTranslation(wxString(s.c_str(), wxConvUTF8)); }
@@ -52,9 +59,9 @@ namespace I18N {
 	inline wxString translate(const std::wstring &s, const std::wstring &plural, unsigned int n) { return wxGetTranslation(s.c_str(), plural.c_str(), n); }
 	inline wxString translate(const wxString     &s, const wxString     &plural, unsigned int n) { return wxGetTranslation(s, plural, n); }
 
-	inline std::string translate_utf8(const char         *s) { return wxGetTranslation(wxString(s, wxConvUTF8)).ToUTF8().data(); }
+	inline std::string translate_utf8(const char         *s) { return translate_utf8_cached(s); }
 	inline std::string translate_utf8(const wchar_t      *s) { return wxGetTranslation(s).ToUTF8().data(); }
-	inline std::string translate_utf8(const std::string  &s) { return wxGetTranslation(wxString(s.c_str(), wxConvUTF8)).ToUTF8().data(); }
+	inline std::string translate_utf8(const std::string  &s) { return translate_utf8_cached(s); }
 	inline std::string translate_utf8(const std::wstring &s) { return wxGetTranslation(s.c_str()).ToUTF8().data(); }
 	inline std::string translate_utf8(const wxString     &s) { return wxGetTranslation(s).ToUTF8().data(); }
 
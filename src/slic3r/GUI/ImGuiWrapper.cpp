@@ -328,6 +328,7 @@ ImGuiWrapper::~ImGuiWrapper()
 {
     //destroy_fonts_texture();
     destroy_font();
+    destroy_draw_list_buffers();
     ImGui::DestroyContext();
 }
 
@@ -2575,15 +2576,31 @@ void ImGuiWrapper::render_draw_data(ImDrawData *draw_data)
         const GLsizeiptr vtx_buffer_size = (GLsizeiptr)cmd_list->VtxBuffer.Size * (int)sizeof(ImDrawVert);
         const GLsizeiptr idx_buffer_size = (GLsizeiptr)cmd_list->IdxBuffer.Size * (int)sizeof(ImDrawIdx);
 
-        GLuint vbo_id;
-        glsafe(::glGenBuffers(1, &vbo_id));
-        glsafe(::glBindBuffer(GL_ARRAY_BUFFER, vbo_id));
-        glsafe(::glBufferData(GL_ARRAY_BUFFER, vtx_buffer_size, vtx_buffer, GL_STATIC_DRAW));
+        // stream the draw list into the persistent buffer pair for this slot, growing
+        // it when needed, instead of creating and destroying fresh buffers every frame
+        if (size_t(n) >= m_draw_list_buffers.size())
+            m_draw_list_buffers.emplace_back();
+        DrawListBuffers& buffers = m_draw_list_buffers[n];
+
+        if (buffers.vbo_id == 0)
+            glsafe(::glGenBuffers(1, &buffers.vbo_id));
+        glsafe(::glBindBuffer(GL_ARRAY_BUFFER, buffers.vbo_id));
+        if (size_t(vtx_buffer_size) <= buffers.vbo_capacity)
+            glsafe(::glBufferSubData(GL_ARRAY_BUFFER, 0, vtx_buffer_size, vtx_buffer));
+        else {
+            glsafe(::glBufferData(GL_ARRAY_BUFFER, vtx_buffer_size, vtx_buffer, GL_STREAM_DRAW));
+            buffers.vbo_capacity = size_t(vtx_buffer_size);
+        }
 
-        GLuint ibo_id;
-        glsafe(::glGenBuffers(1, &ibo_id));
-        glsafe(::glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ibo_id));
-        glsafe(::glBufferData(GL_ELEMENT_ARRAY_BUFFER, idx_buffer_size, idx_buffer, GL_STATIC_DRAW));
+        if (buffers.ibo_id == 0)
+            glsafe(::glGenBuffers(1, &buffers.ibo_id));
+        glsafe(::glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, buffers.ibo_id));
+        if (size_t(idx_buffer_size) <= buffers.ibo_capacity)
+            glsafe(::glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, 0, idx_buffer_size, idx_buffer));
+        else {
+            glsafe(::glBufferData(GL_ELEMENT_ARRAY_BUFFER, idx_buffer_size, idx_buffer, GL_STREAM_DRAW));
+            buffers.ibo_capacity = size_t(idx_buffer_size);
+        }
 
         const int position_id = shader->get_attrib_location("Position");
         if (position_id != -1) {
@@ -2631,9 +2648,6 @@ void ImGuiWrapper::render_draw_data(ImDrawData *draw_data)
 
         glsafe(::glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0));
         glsafe(::glBindBuffer(GL_ARRAY_BUFFER, 0));
-
-        glsafe(::glDeleteBuffers(1, &ibo_id));
-        glsafe(::glDeleteBuffers(1, &vbo_id));
     }
 
     // Restore modified state
@@ -2667,6 +2681,17 @@ void ImGuiWrapper::destroy_font()
     }
 }
 
+void ImGuiWrapper::destroy_draw_list_buffers()
+{
+    for (DrawListBuffers& buffers : m_draw_list_buffers) {
+        if (buffers.ibo_id != 0)
+            glsafe(::glDeleteBuffers(1, &buffers.ibo_id));
+        if (buffers.vbo_id != 0)
+            glsafe(::glDeleteBuffers(1, &buffers.vbo_id));
+    }
+    m_draw_list_buffers.clear();
+}
+
 void ImGuiWrapper::destroy_fonts_texture() {
     //if (m_font_another_texture != 0) {
     //    if (m_new_frame_open) {
@@ -68,6 +68,16 @@ class ImGuiWrapper
     std::map<wchar_t, int> m_custom_glyph_rects_ids;
     std::string m_clipboard_text;
 
+    // gpu buffers used by render_draw_data(), one vbo/ibo pair per ImGui draw list,
+    // kept across frames and grown on demand instead of re-created every frame
+    struct DrawListBuffers {
+        unsigned int vbo_id{ 0 };
+        unsigned int ibo_id{ 0 };
+        size_t vbo_capacity{ 0 };
+        size_t ibo_capacity{ 0 };
+    };
+    std::vector<DrawListBuffers> m_draw_list_buffers;
+
 public:
     struct LastSliderStatus {
         bool hovered { false };
@@ -258,6 +268,7 @@ private:
     void render_draw_data(ImDrawData *draw_data);
     bool display_initialized() const;
     void destroy_font();
+    void destroy_draw_list_buffers();
     std::vector<unsigned char> load_svg(const std::string& bitmap_name, unsigned target_width, unsigned target_height, unsigned *outwidth, unsigned *outheight);
 
     static const char* clipboard_get(void* user_data);
@@ -22,6 +22,8 @@
 #include <igl/unproject.h>
 
 #include <cstdint>
+#include <map>
+#include <mutex>
 
 
 namespace Slic3r {
@@ -585,5 +587,32 @@ int MeshRaycaster::get_closest_facet(const Vec3f &point) const
     return facet_idx;
 }
 
+std::shared_ptr<const MeshRaycaster> get_shared_mesh_raycaster(const std::shared_ptr<const TriangleMesh>& mesh)
+{
+    struct CacheEntry {
+        std::weak_ptr<const TriangleMesh>    mesh;
+        std::shared_ptr<const MeshRaycaster> raycaster;
+    };
+    static std::mutex cache_mutex;
+    static std::map<const TriangleMesh*, CacheEntry> cache;
+
+    assert(mesh);
+    {
+        std::lock_guard<std::mutex> lock(cache_mutex);
+        // drop the entries whose mesh died, their address may have been reused by a new mesh
+        for (auto it = cache.begin(); it != cache.end();)
+            it = it->second.mesh.expired() ? cache.erase(it) : std::next(it);
+        auto it = cache.find(mesh.get());
+        if (it != cache.end())
+            return it->second.raycaster;
+    }
+    // build outside of the lock, so that concurrent builds for different meshes
+    // (e.g. from GLVolumeCollection::finalize_deferred_geometry()) do not serialize
+    auto raycaster = std::make_shared<const MeshRaycaster>(mesh);
+    std::lock_guard<std::mutex> lock(cache_mutex);
+    // in case another thread built the same raycaster meanwhile, keep the first one
+    return cache.emplace(mesh.get(), CacheEntry{ mesh, std::move(raycaster) }).first->second.raycaster;
+}
+
 } // namespace GUI
 } // namespace Slic3r
@@ -235,6 +235,14 @@ private:
     std::vector<stl_normal> m_normals;
 };
 
+// Returns the raycaster for the given mesh, building its AABB tree on the first
+// request and returning the cached instance afterwards. The cache is shared by the
+// scene (GLVolume), the gizmos and everything else raycasting a model mesh, so
+// switching gizmos on a big mesh does not re-pay the tree construction. A changed
+// ModelVolume mesh is a new TriangleMesh object, hence the mesh identity also keys
+// the revision; entries die together with their mesh. Thread safe.
+std::shared_ptr<const MeshRaycaster> get_shared_mesh_raycaster(const std::shared_ptr<const TriangleMesh>& mesh);
+
 struct PickingModel
 {
     GLModel model;
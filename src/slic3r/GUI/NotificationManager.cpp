@@ -1312,6 +1312,16 @@ void NotificationManager::PrintHostUploadNotification::set_percentage(float perc
 		m_has_cancel_button = true;
 	}
 }
+bool NotificationManager::PrintHostUploadNotification::set_percentage_if_changed(float percent)
+{
+	const UploadJobState prev_state    = m_uj_state;
+	const int            prev_percent  = (int)(m_percentage * 100.f);
+	const int            prev_uploaded = (int)(m_file_size * m_percentage * 100.f);
+	set_percentage(percent);
+	return m_uj_state != prev_state ||
+		   (int)(m_percentage * 100.f) != prev_percent ||
+		   (int)(m_file_size * m_percentage * 100.f) != prev_uploaded;
+}
 void NotificationManager::PrintHostUploadNotification::render_bar(ImGuiWrapper& imgui, const float win_size_x, const float win_size_y, const float win_pos_x, const float win_pos_y)
 {
 	std::string text;
@@ -2099,8 +2109,11 @@ void NotificationManager::set_upload_job_notification_percentage(int id, const s
 		if (notification->get_type() == NotificationType::PrintHostUpload) {
 			PrintHostUploadNotification* phun = dynamic_cast<PrintHostUploadNotification*>(notification.get());
 			if (phun->compare_job_id(id)) {
-				phun->set_percentage(percentage);
-				wxGetApp().plater()->get_current_canvas3D()->schedule_extra_frame(0);
+				// Upload progress callbacks fire once per sent chunk, far more often than the
+				// rendered text changes. Only wake the render loop when the notification will
+				// actually look different.
+				if (phun->set_percentage_if_changed(percentage))
+					wxGetApp().plater()->get_current_canvas3D()->schedule_extra_frame(0);
 				break;
 			}
 		}
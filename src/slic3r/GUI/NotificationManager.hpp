@@ -617,6 +617,11 @@ private:
 		}
 		static std::string	get_upload_job_text(int id, const std::string& filename, const std::string& host) { return /*"[" + std::to_string(id) + "] " + */filename + " -> " + host; }
 		void				set_percentage(float percent) override;
+		// Like set_percentage(), but returns true only when the update changed what the notification
+		// renders (upload state, displayed whole percent or uploaded size at the 0.01 MB granularity
+		// shown in the text), so the caller may skip scheduling a redraw for the remaining
+		// upload progress callbacks.
+		bool				set_percentage_if_changed(float percent);
 		void				cancel() { m_uj_state = UploadJobState::PB_CANCELLED; m_has_cancel_button = false; }
 		void				error()  { m_uj_state = UploadJobState::PB_ERROR;     m_has_cancel_button = false; init(); }
 		bool				compare_job_id(const int other_id) const { return m_job_id == other_id; }
@@ -6138,6 +6138,17 @@ void Plater::priv::on_process_completed(SlicingProcessCompletedEvent &evt)
     {
         BOOST_LOG_TRIVIAL(info) << __FUNCTION__ << boost::format(":slicing all, plate %1% finished, start next slice...")%m_cur_slice_plate;
         m_cur_slice_plate++;
+        //BBS: each plate keeps its own Print instance and cached gcode result, so plates
+        // whose slice result is still valid don't need another select/apply/restart round
+        // trip (with the Freeze/scene refresh it causes); jump straight to the next plate
+        // that actually needs slicing. The apply check of the plate we finally select
+        // remains the authoritative fallback. The last plate is always selected so the
+        // finish logic above sees it as the current plate.
+        while ((m_cur_slice_plate < (partplate_list.get_plate_count() - 1))
+            && partplate_list.get_plate(m_cur_slice_plate)->is_slice_result_valid()) {
+            BOOST_LOG_TRIVIAL(info) << __FUNCTION__ << boost::format(":slicing all, plate %1% already has a valid result, skip")%m_cur_slice_plate;
+            m_cur_slice_plate++;
+        }
 
         q->Freeze();
         q->select_plate(m_cur_slice_plate);
@@ -7971,7 +7982,7 @@ int Plater::save_project(bool saveAs)
         return wxID_CANCEL;
 
     //BBS export 3mf without gcode
-    if (export_3mf(into_path(filename), SaveStrategy::SplitModel | SaveStrategy::ShareMesh) < 0) {
+    if (export_3mf(into_path(filename), SaveStrategy::SplitModel | SaveStrategy::ShareMesh | SaveStrategy::Incremental) < 0) {
         MessageDialog(this, _L("Failed to save the project.\nPlease check whether the folder exists online or if other programs open the project file."),
             _L("Save project"), wxOK | wxICON_WARNING).ShowModal();
         return wxID_CANCEL;
@@ -8907,11 +8918,30 @@ wxString Plater::get_project_name()
 
 void Plater::update_all_plate_thumbnails(bool force_update)
 {
+    if (force_update) {
+        for (int i = 0; i < get_partplate_list().get_plate_count(); i++) {
+            get_partplate_list().get_plate(i)->thumbnail_data.reset();
+        }
+    }
+
+    // The thumbnails are rendered with the main GL context, so when several plates need
+    // a refresh they are generated one per event-loop pass instead of all synchronously,
+    // to keep the UI responsive on projects with many plates.
+    bool rendered = false;
     for (int i = 0; i < get_partplate_list().get_plate_count(); i++) {
         PartPlate* plate = get_partplate_list().get_plate(i);
-        ThumbnailsParams thumbnail_params = { {}, false, true, true, true, i};
-        if (force_update || !plate->thumbnail_data.is_valid()) {
+        if (!plate->thumbnail_data.is_valid()) {
+            if (rendered) {
+                // generate the remaining ones from the event loop, one at a time
+                wxGetApp().CallAfter([this]() {
+                    update_all_plate_thumbnails(false);
+                    get_preview_canvas3D()->update_plate_thumbnails();
+                });
+                return;
+            }
+            ThumbnailsParams thumbnail_params = { {}, false, true, true, true, i};
             get_view3D_canvas3D()->render_thumbnail(plate->thumbnail_data, plate->plate_thumbnail_width, plate->plate_thumbnail_height, thumbnail_params, Camera::EType::Ortho);
+            rendered = true;
         }
     }
 }
@@ -10383,9 +10413,9 @@ int Plater::export_3mf(const boost::filesystem::path& output_path, SaveStrategy
     if (!(strategy & SaveStrategy::Backup)) {
         for (int i = 0; i < p->partplate_list.get_plate_count(); i++) {
             ThumbnailData* thumbnail_data = &p->partplate_list.get_plate(i)->thumbnail_data;
-            if (p->partplate_list.get_plate(i)->thumbnail_data.is_valid() &&  using_exported_file()) {
-                //no need to generate thumbnail
-                BOOST_LOG_TRIVIAL(info) << __FUNCTION__ << boost::format(": non need to re-generate thumbnail for gcode/exported mode of plate %1%")%i;
+            if (p->partplate_list.get_plate(i)->thumbnail_data.is_valid()) {
+                // the cached data is reset whenever the plate content changes, so valid means up to date
+                BOOST_LOG_TRIVIAL(info) << __FUNCTION__ << boost::format(": no need to re-generate thumbnail of plate %1%")%i;
             }
             else {
                 BOOST_LOG_TRIVIAL(info) << __FUNCTION__ << boost::format(": re-generate thumbnail for plate %1%") % i;
@@ -10402,9 +10432,8 @@ int Plater::export_3mf(const boost::filesystem::path& output_path, SaveStrategy
 
             //generate top and picking thumbnails
             ThumbnailData* top_thumbnail = &p->partplate_list.get_plate(i)->top_thumbnail_data;
-            if (top_thumbnail->is_valid() &&  using_exported_file()) {
-                //no need to generate thumbnail
-                BOOST_LOG_TRIVIAL(info) << __FUNCTION__ << boost::format(": non need to re-generate top_thumbnail for gcode/exported mode of plate %1%")%i;
+            if (top_thumbnail->is_valid()) {
+                BOOST_LOG_TRIVIAL(info) << __FUNCTION__ << boost::format(": no need to re-generate top_thumbnail of plate %1%")%i;
             }
             else {
                 BOOST_LOG_TRIVIAL(info) << __FUNCTION__ << boost::format(": re-generate top_thumbnail for plate %1%") % i;
@@ -10415,9 +10444,8 @@ int Plater::export_3mf(const boost::filesystem::path& output_path, SaveStrategy
             top_thumbnails.push_back(top_thumbnail);
 
             ThumbnailData* picking_thumbnail = &p->partplate_list.get_plate(i)->pick_thumbnail_data;
-            if (picking_thumbnail->is_valid() &&  using_exported_file()) {
-                //no need to generate thumbnail
-                BOOST_LOG_TRIVIAL(info) << __FUNCTION__ << boost::format(": non need to re-generate pick_thumbnail for gcode/exported mode of plate %1%")%i;
+            if (picking_thumbnail->is_valid()) {
+                BOOST_LOG_TRIVIAL(info) << __FUNCTION__ << boost::format(": no need to re-generate pick_thumbnail of plate %1%")%i;
             }
             else {
                 BOOST_LOG_TRIVIAL(info) << __FUNCTION__ << boost::format(": re-generate pick_thumbnail for plate %1%") % i;
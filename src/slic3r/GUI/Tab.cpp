@@ -1854,6 +1854,7 @@ void TabPrint::build()
 
         optgroup = page->new_optgroup(L("Seam"), L"param_seam");
         optgroup->append_single_option_line("seam_position", "seam");
+        optgroup->append_single_option_line("seam_visibility_triangle_budget", "seam");
         optgroup->append_single_option_line("staggered_inner_seams", "seam");
         optgroup->append_single_option_line("seam_gap","seam");
         optgroup->append_single_option_line("role_based_wipe_speed","seam");
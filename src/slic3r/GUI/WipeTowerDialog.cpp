@@ -11,6 +11,7 @@
 #include "Widgets/Button.hpp"
 #include "slic3r/Utils/ColorSpaceConvert.hpp"
 #include "MainFrame.hpp"
+#include <wx/wupdlock.h>
 
 #include <wx/sizer.h>
 
@@ -530,9 +531,13 @@ WipingPanel::WipingPanel(wxWindow* parent, const std::vector<float>& matrix, con
                     _L("Warning"), wxICON_WARNING | wxOK);
                 dlg.ShowModal();
             }
-            for (unsigned int i = 0; i < m_number_of_extruders; ++i) {
-                for (unsigned int j = 0; j < m_number_of_extruders; ++j) {
-                    edit_boxes[i][j]->SetValue(to_string(int(m_matrix[m_number_of_extruders * j + i] * multiplier)));
+            {
+                // BBS: batch the NxN repaints, see calc_flushing_volumes()
+                wxWindowUpdateLocker freeze_guard(m_page_advanced);
+                for (unsigned int i = 0; i < m_number_of_extruders; ++i) {
+                    for (unsigned int j = 0; j < m_number_of_extruders; ++j) {
+                        edit_boxes[i][j]->SetValue(to_string(int(m_matrix[m_number_of_extruders * j + i] * multiplier)));
+                    }
                 }
             }
 
@@ -695,6 +700,9 @@ void WipingPanel::update_warning_texts()
 
 void WipingPanel::calc_flushing_volumes()
 {
+    // BBS: refreshing NxN text controls one by one stalls the dialog on large
+    // extruder counts, batch the repaints
+    wxWindowUpdateLocker freeze_guard(m_page_advanced);
     for (int from_idx = 0; from_idx < m_colours.size(); from_idx++) {
         const wxColour& from = m_colours[from_idx];
         bool is_from_support = is_support_filament(from_idx);
@@ -871,6 +871,21 @@ void Bonjour::priv::lookup_perform()
 
 	std::vector<LookupSocket*> sockets;
 
+	// A socket is created per interface and a device announces itself on every interface
+	// it is reachable through, so the same reply arrives multiple times. Forward each
+	// distinct reply only once. All reply callbacks run on the io_service thread
+	// (same as the timer), thus no mutex is needed for the dedup storage.
+	std::vector<BonjourReply> seen_replies;
+	Bonjour::ReplyFn dedup_replyfn = replyfn;
+	if (replyfn) {
+		dedup_replyfn = [this, &seen_replies](BonjourReply &&reply) {
+			if (std::find(seen_replies.begin(), seen_replies.end(), reply) == seen_replies.end()) {
+				seen_replies.push_back(reply);
+				replyfn(std::move(reply));
+			}
+		};
+	}
+
 	// resolve intefaces - from PR#6646
 	std::vector<boost::asio::ip::address> interfaces;
 	asio::ip::udp::resolver resolver(*io_service);
@@ -886,12 +901,12 @@ void Bonjour::priv::lookup_perform()
 		// create ipv4 socket for each interface
 		// each will send to querry to for both ipv4 and ipv6
 		for (const auto& intrfc : interfaces) 		
-			sockets.emplace_back(new LookupSocket(txt_keys, service, service_dn, protocol, replyfn, BonjourRequest::MCAST_IP4, intrfc, io_service));
+			sockets.emplace_back(new LookupSocket(txt_keys, service, service_dn, protocol, dedup_replyfn, BonjourRequest::MCAST_IP4, intrfc, io_service));
 	} else {
 		BOOST_LOG_TRIVIAL(info) << "Failed to resolve ipv4 interfaces: " << ec.message();
 	}
 	if (sockets.empty())
-		sockets.emplace_back(new LookupSocket(txt_keys, service, service_dn, protocol, replyfn, BonjourRequest::MCAST_IP4, io_service));
+		sockets.emplace_back(new LookupSocket(txt_keys, service, service_dn, protocol, dedup_replyfn, BonjourRequest::MCAST_IP4, io_service));
 	// ipv6 interfaces
 	interfaces.clear();
 	//udp::resolver::query query(host, PORT, boost::asio::ip::resolver_query_base::numeric_service);
@@ -906,9 +921,9 @@ void Bonjour::priv::lookup_perform()
 		// create ipv6 socket for each interface
 		// each will send to querry to for both ipv4 and ipv6
 		for (const auto& intrfc : interfaces)
-			sockets.emplace_back(new LookupSocket(txt_keys, service, service_dn, protocol, replyfn, BonjourRequest::MCAST_IP6, intrfc, io_service));
+			sockets.emplace_back(new LookupSocket(txt_keys, service, service_dn, protocol, dedup_replyfn, BonjourRequest::MCAST_IP6, intrfc, io_service));
 		if (interfaces.empty())
-			sockets.emplace_back(new LookupSocket(txt_keys, service, service_dn, protocol, replyfn, BonjourRequest::MCAST_IP6, io_service));
+			sockets.emplace_back(new LookupSocket(txt_keys, service, service_dn, protocol, dedup_replyfn, BonjourRequest::MCAST_IP6, io_service));
 	} else {
 		BOOST_LOG_TRIVIAL(info)<< "Failed to resolve ipv6 interfaces: " << ec.message();
 	}
@@ -2,6 +2,7 @@
 
 #include <cstdlib>
 #include <functional>
+#include <mutex>
 #include <thread>
 #include <deque>
 #include <sstream>
@@ -83,6 +84,44 @@ struct CurlGlobalInit
 
 std::unique_ptr<CurlGlobalInit> CurlGlobalInit::instance;
 
+// Shared curl handle keeping DNS entries, TLS sessions and established
+// connections alive across the short-lived easy handles created per request.
+// Status polls and uploads hit the same hosts over and over; without sharing,
+// every request pays a fresh DNS lookup plus TCP and TLS handshake.
+struct CurlShare
+{
+	::CURLSH  *share;
+	std::mutex mutexes[CURL_LOCK_DATA_LAST];
+
+	static CurlShare& get_instance()
+	{
+		static CurlShare instance;
+		return instance;
+	}
+
+	CurlShare() : share(::curl_share_init())
+	{
+		::curl_share_setopt(share, CURLSHOPT_LOCKFUNC, lock_cb);
+		::curl_share_setopt(share, CURLSHOPT_UNLOCKFUNC, unlock_cb);
+		::curl_share_setopt(share, CURLSHOPT_USERDATA, this);
+		::curl_share_setopt(share, CURLSHOPT_SHARE, CURL_LOCK_DATA_DNS);
+		::curl_share_setopt(share, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION);
+		// Connection cache sharing is functional since libcurl 7.57; older
+		// versions reject the option, which leaves just DNS and TLS sharing.
+		::curl_share_setopt(share, CURLSHOPT_SHARE, CURL_LOCK_DATA_CONNECT);
+	}
+	~CurlShare() { ::curl_share_cleanup(share); }
+
+	static void lock_cb(::CURL * /* handle */, ::curl_lock_data data, ::curl_lock_access /* access */, void *userp)
+	{
+		static_cast<CurlShare*>(userp)->mutexes[data].lock();
+	}
+	static void unlock_cb(::CURL * /* handle */, ::curl_lock_data data, void *userp)
+	{
+		static_cast<CurlShare*>(userp)->mutexes[data].unlock();
+	}
+};
+
 std::map<std::string, std::string> extra_headers;
 
 struct Http::priv
@@ -129,6 +168,7 @@ struct Http::priv
 
 	void set_timeout_connect(long timeout);
     void set_timeout_max(long timeout);
+	void set_upload_buffersize();
 	void form_add_file(const char *name, const fs::path &path, const char* filename);
 	/* mime */
 	void mime_form_add_text(const char* name, const char* value);
@@ -178,6 +218,8 @@ Http::priv::priv(const std::string &url)
 #endif
 	::curl_easy_setopt(curl, CURLOPT_SSL_VERIFYPEER, 0L);
 	::curl_easy_setopt(curl, CURLOPT_SSL_VERIFYHOST, 0L);
+	::curl_easy_setopt(curl, CURLOPT_SHARE, CurlShare::get_instance().share);
+	::curl_easy_setopt(curl, CURLOPT_TCP_KEEPALIVE, 1L);
 }
 
 Http::priv::~priv()
@@ -283,6 +325,15 @@ void Http::priv::set_timeout_max(long timeout)
     ::curl_easy_setopt(curl, CURLOPT_TIMEOUT, timeout);
 }
 
+void Http::priv::set_upload_buffersize()
+{
+	// The default 16kB upload buffer means many small send() calls, which measurably
+	// slows down uploads of multi-hundred-MB G-code files over LAN; ask for the maximum.
+#if LIBCURL_VERSION_NUM >= 0x073E00
+	::curl_easy_setopt(curl, CURLOPT_UPLOAD_BUFFERSIZE, 512 * 1024L);
+#endif
+}
+
 void Http::priv::form_add_file(const char *name, const fs::path &path, const char* filename)
 {
 	// We can't use CURLFORM_FILECONTENT, because curl doesn't support Unicode filenames on Windows
@@ -307,6 +358,7 @@ void Http::priv::form_add_file(const char *name, const fs::path &path, const cha
 			CURLFORM_CONTENTSLENGTH, static_cast<long>(size),
 			CURLFORM_END
 		);
+		set_upload_buffersize();
 	}
 }
 
@@ -336,6 +388,7 @@ void Http::priv::mime_form_add_file(const char* name, const char* path)
 	curl_mime_filedata(part, path);
 	// BBS specify filename after filedata
 	curl_mime_filename(part, name);
+	set_upload_buffersize();
 }
 
 //FIXME may throw! Is the caller aware of it?
@@ -360,6 +413,7 @@ void Http::priv::set_put_body(const fs::path &path)
 		::curl_easy_setopt(curl, CURLOPT_UPLOAD, 1L);
 		::curl_easy_setopt(curl, CURLOPT_READDATA, (void *) (putFile.get()));
 		::curl_easy_setopt(curl, CURLOPT_INFILESIZE, filesize);
+		set_upload_buffersize();
 	}
 }
 
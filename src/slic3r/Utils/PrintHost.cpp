@@ -1,5 +1,9 @@
 #include "PrintHost.hpp"
 
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <set>
 #include <vector>
 #include <thread>
 #include <exception>
@@ -74,35 +78,43 @@ wxString PrintHost::format_error(const std::string &body, const std::string &err
 
 struct PrintHostJobQueue::priv
 {
-    // XXX: comment on how bg thread works
+    // Jobs are grouped by their target host: each distinct host gets its own worker thread
+    // with its own job channel, so that uploads to different printers run in parallel while
+    // uploads to the same printer remain serialized in enqueue order. Job ids are handed out
+    // in enqueue() and therefore match the rows of the queue dialog. Cancel requests for the
+    // currently running jobs are kept in a shared id set consulted by the progress callbacks.
 
     PrintHostJobQueue *q;
 
-    Channel<PrintHostJob> channel_jobs;
-    Channel<size_t> channel_cancels;
-    size_t job_id = 0;
-    int prev_progress = -1;
-    fs::path source_to_remove;
+    struct Worker
+    {
+        Channel<PrintHostJob> channel_jobs;
+        std::thread bg_thread;
+    };
 
-    std::thread bg_thread;
-    bool bg_exit = false;
+    std::mutex mutex;   // Guards workers and cancelled_ids
+    std::map<std::string, std::unique_ptr<Worker>> workers;
+    std::set<size_t> cancelled_ids;
+    size_t next_job_id = 0;
+    std::atomic<bool> bg_exit { false };
 
     PrintHostQueueDialog *queue_dialog;
 
     priv(PrintHostJobQueue *q) : q(q) {}
 
-    void emit_progress(int progress);
-    void emit_error(wxString error);
+    void emit_progress(size_t job_id, int progress);
+    void emit_error(size_t job_id, wxString error);
     void emit_cancel(size_t id);
-    void emit_info(wxString tag, wxString status);
-    void start_bg_thread();
-    void stop_bg_thread();
-    void bg_thread_main();
-    void progress_fn(Http::Progress progress, bool &cancel);
-    void error_fn(wxString error);
-    void info_fn(wxString tag, wxString status);
+    void emit_info(size_t job_id, wxString tag, wxString status);
+    Worker& get_worker(const std::string &host);
+    void stop_bg_threads();
+    void bg_thread_main(Worker *worker);
+    bool is_cancelled(size_t job_id);
+    bool take_cancelled(size_t job_id);
+    void progress_fn(size_t job_id, int &prev_progress, Http::Progress progress, bool &cancel);
+    void error_fn(size_t job_id, wxString error);
+    void info_fn(size_t job_id, wxString tag, wxString status);
     void remove_source(const fs::path &path);
-    void remove_source();
     void perform_job(PrintHostJob the_job);
 };
 
@@ -114,22 +126,22 @@ PrintHostJobQueue::PrintHostJobQueue(PrintHostQueueDialog *queue_dialog)
 
 PrintHostJobQueue::~PrintHostJobQueue()
 {
-    if (p) { p->stop_bg_thread(); }
+    if (p) { p->stop_bg_threads(); }
 }
 
-void PrintHostJobQueue::priv::emit_progress(int progress)
+void PrintHostJobQueue::priv::emit_progress(size_t job_id, int progress)
 {
     auto evt = new PrintHostQueueDialog::Event(GUI::EVT_PRINTHOST_PROGRESS, queue_dialog->GetId(), job_id, progress);
     wxQueueEvent(queue_dialog, evt);
 }
 
-void PrintHostJobQueue::priv::emit_error(wxString error)
+void PrintHostJobQueue::priv::emit_error(size_t job_id, wxString error)
 {
     auto evt = new PrintHostQueueDialog::Event(GUI::EVT_PRINTHOST_ERROR, queue_dialog->GetId(), job_id, std::move(error));
     wxQueueEvent(queue_dialog, evt);
 }
 
-void PrintHostJobQueue::priv::emit_info(wxString tag, wxString status)
+void PrintHostJobQueue::priv::emit_info(size_t job_id, wxString tag, wxString status)
 {
     auto evt = new PrintHostQueueDialog::Event(GUI::EVT_PRINTHOST_INFO, queue_dialog->GetId(), job_id, std::move(tag), std::move(status));
     wxQueueEvent(queue_dialog, evt);
@@ -141,66 +153,101 @@ void PrintHostJobQueue::priv::emit_cancel(size_t id)
     wxQueueEvent(queue_dialog, evt);
 }
 
-void PrintHostJobQueue::priv::start_bg_thread()
+PrintHostJobQueue::priv::Worker& PrintHostJobQueue::priv::get_worker(const std::string &host)
 {
-    if (bg_thread.joinable()) { return; }
+    std::lock_guard<std::mutex> lock(mutex);
+
+    auto it = workers.find(host);
+    if (it == workers.end()) {
+        it = workers.emplace(host, std::make_unique<Worker>()).first;
+        Worker *worker = it->second.get();
+
+        std::shared_ptr<priv> p2 = q->p;
+        worker->bg_thread = std::thread([p2, worker]() {
+            p2->bg_thread_main(worker);
+        });
+    }
 
-    std::shared_ptr<priv> p2 = q->p;
-    bg_thread = std::thread([p2]() {
-        p2->bg_thread_main();
-    });
+    return *it->second;
 }
 
-void PrintHostJobQueue::priv::stop_bg_thread()
+void PrintHostJobQueue::priv::stop_bg_threads()
 {
-    if (bg_thread.joinable()) {
-        bg_exit = true;
-        channel_jobs.push(PrintHostJob()); // Push an empty job to wake up bg_thread in case it's sleeping
-        bg_thread.detach();                // Let the background thread go, it should exit on its own
+    std::lock_guard<std::mutex> lock(mutex);
+
+    bg_exit = true;
+    for (auto &worker : workers) {
+        if (worker.second->bg_thread.joinable()) {
+            worker.second->channel_jobs.push(PrintHostJob()); // Push an empty job to wake up the thread in case it's sleeping
+            worker.second->bg_thread.detach();                // Let the background thread go, it should exit on its own
+        }
     }
 }
 
-void PrintHostJobQueue::priv::bg_thread_main()
+void PrintHostJobQueue::priv::bg_thread_main(Worker *worker)
 {
-    // bg thread entry point
+    // bg thread entry point, one instance runs per distinct host
+
+    fs::path source_to_remove;
+    size_t current_id = 0;
 
     try {
-        // Pick up jobs from the job channel:
+        // Pick up jobs from this worker's job channel:
         while (! bg_exit) {
-            auto job = channel_jobs.pop();   // Sleeps in a cond var if there are no jobs
+            auto job = worker->channel_jobs.pop();   // Sleeps in a cond var if there are no jobs
             if (job.empty()) {
                 // This happens when the thread is being stopped
                 break;
             }
 
+            current_id = job.id;
             source_to_remove = job.upload_data.source_path;
 
             BOOST_LOG_TRIVIAL(debug) << boost::format("PrintHostJobQueue/bg_thread: Received job: [%1%]: `%2%` -> `%3%`, cancelled: %4%")
-                % job_id
+                % job.id
                 % job.upload_data.upload_path
                 % job.printhost->get_host()
                 % job.cancelled;
 
-            if (! job.cancelled) {
+            if (job.cancelled) {
+                // Cancelled while waiting in the queue, the cancel event was already emitted
+            } else if (take_cancelled(job.id)) {
+                // Cancelled in the window between being popped here and being marked in cancel()
+                emit_cancel(job.id);
+            } else {
                 perform_job(std::move(job));
+                // Purge a cancel request that arrived too late to take effect
+                take_cancelled(current_id);
             }
 
-            remove_source();
-            job_id++;
+            remove_source(source_to_remove);
+            source_to_remove.clear();
         }
     } catch (const std::exception &e) {
-        emit_error(e.what());
+        emit_error(current_id, e.what());
     }
 
     // Cleanup leftover files, if any
-    remove_source();
-    auto jobs = channel_jobs.lock_rw();
+    remove_source(source_to_remove);
+    auto jobs = worker->channel_jobs.lock_rw();
     for (const PrintHostJob &job : *jobs) {
         remove_source(job.upload_data.source_path);
     }
 }
 
-void PrintHostJobQueue::priv::progress_fn(Http::Progress progress, bool &cancel)
+bool PrintHostJobQueue::priv::is_cancelled(size_t job_id)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return cancelled_ids.find(job_id) != cancelled_ids.end();
+}
+
+bool PrintHostJobQueue::priv::take_cancelled(size_t job_id)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return cancelled_ids.erase(job_id) > 0;
+}
+
+void PrintHostJobQueue::priv::progress_fn(size_t job_id, int &prev_progress, Http::Progress progress, bool &cancel)
 {
     if (cancel) {
         // When cancel is true from the start, Http indicates request has been cancelled
@@ -213,68 +260,33 @@ void PrintHostJobQueue::priv::progress_fn(Http::Progress progress, bool &cancel)
         return;
     }
 
-    if (channel_cancels.size_hint() > 0) {
-        // Lock both queues
-        auto cancels = channel_cancels.lock_rw();
-        auto jobs = channel_jobs.lock_rw();
-
-        for (size_t cancel_id : *cancels) {
-            if (cancel_id == job_id) {
-                cancel = true;
-            } else if (cancel_id > job_id) {
-                const size_t idx = cancel_id - job_id - 1;
-                if (idx < jobs->size()) {
-                    jobs->at(idx).cancelled = true;
-                    BOOST_LOG_TRIVIAL(debug) << boost::format("PrintHostJobQueue: Job id %1% cancelled") % cancel_id;
-                    emit_cancel(cancel_id);
-                }
-            }
-        }
-
-        cancels->clear();
+    if (is_cancelled(job_id)) {
+        // The id is deliberately kept in the set so that error_fn() can tell the aborted
+        // transfer apart from a genuine error; it is purged once the job is finished.
+        cancel = true;
+        return;
     }
 
-    if (! cancel) {
-        int gui_progress = progress.ultotal > 0 ? 100*progress.ulnow / progress.ultotal : 0;
-        if (gui_progress != prev_progress) {
-            emit_progress(gui_progress);
-            prev_progress = gui_progress;
-        }
+    int gui_progress = progress.ultotal > 0 ? 100*progress.ulnow / progress.ultotal : 0;
+    if (gui_progress != prev_progress) {
+        emit_progress(job_id, gui_progress);
+        prev_progress = gui_progress;
     }
 }
 
-void PrintHostJobQueue::priv::error_fn(wxString error)
+void PrintHostJobQueue::priv::error_fn(size_t job_id, wxString error)
 {
     // check if transfer was not canceled before error occured - than do not show the error
-    bool do_emit_err = true;
-    if (channel_cancels.size_hint() > 0) {
-        // Lock both queues
-        auto cancels = channel_cancels.lock_rw();
-        auto jobs = channel_jobs.lock_rw();
-
-        for (size_t cancel_id : *cancels) {
-            if (cancel_id == job_id) {
-                do_emit_err = false;
-                emit_cancel(job_id);
-            }
-            else if (cancel_id > job_id) {
-                const size_t idx = cancel_id - job_id - 1;
-                if (idx < jobs->size()) {
-                    jobs->at(idx).cancelled = true;
-                    BOOST_LOG_TRIVIAL(debug) << boost::format("PrintHostJobQueue: Job id %1% cancelled") % cancel_id;
-                    emit_cancel(cancel_id);
-                }
-            }
-        }
-        cancels->clear();
+    if (is_cancelled(job_id)) {
+        emit_cancel(job_id);
+    } else {
+        emit_error(job_id, std::move(error));
     }
-    if (do_emit_err)
-        emit_error(std::move(error));
 }
 
-void PrintHostJobQueue::priv::info_fn(wxString tag, wxString status)
+void PrintHostJobQueue::priv::info_fn(size_t job_id, wxString tag, wxString status)
 {
-    emit_info(tag, status);
+    emit_info(job_id, tag, status);
 }
 
 void PrintHostJobQueue::priv::remove_source(const fs::path &path)
@@ -288,37 +300,54 @@ void PrintHostJobQueue::priv::remove_source(const fs::path &path)
     }
 }
 
-void PrintHostJobQueue::priv::remove_source()
-{
-    remove_source(source_to_remove);
-    source_to_remove.clear();
-}
-
 void PrintHostJobQueue::priv::perform_job(PrintHostJob the_job)
 {
-    emit_progress(0);   // Indicate the upload is starting
+    const size_t job_id = the_job.id;
+    int prev_progress = -1;
+
+    emit_progress(job_id, 0);   // Indicate the upload is starting
 
     bool success = the_job.printhost->upload(std::move(the_job.upload_data),
-        [this](Http::Progress progress, bool &cancel)   { this->progress_fn(std::move(progress), cancel); },
-        [this](wxString error)                          { this->error_fn(std::move(error)); },
-        [this](wxString tag, wxString host)             { this->info_fn(std::move(tag), std::move(host)); }
+        [this, job_id, &prev_progress](Http::Progress progress, bool &cancel) { this->progress_fn(job_id, prev_progress, std::move(progress), cancel); },
+        [this, job_id](wxString error)                                        { this->error_fn(job_id, std::move(error)); },
+        [this, job_id](wxString tag, wxString host)                           { this->info_fn(job_id, std::move(tag), std::move(host)); }
     );
 
     if (success) {
-        emit_progress(100);
+        emit_progress(job_id, 100);
     }
 }
 
 void PrintHostJobQueue::enqueue(PrintHostJob job)
 {
-    p->start_bg_thread();
+    job.id = p->next_job_id++;
+    priv::Worker &worker = p->get_worker(job.printhost->get_host());
     p->queue_dialog->append_job(job);
-    p->channel_jobs.push(std::move(job));
+    worker.channel_jobs.push(std::move(job));
 }
 
 void PrintHostJobQueue::cancel(size_t id)
 {
-    p->channel_cancels.push(id);
+    std::lock_guard<std::mutex> lock(p->mutex);
+
+    // If the job is still waiting in one of the worker queues, mark it cancelled right away
+    // so that the queue dialog updates without waiting for the job to reach its worker.
+    for (auto &worker : p->workers) {
+        auto jobs = worker.second->channel_jobs.lock_rw();
+        for (PrintHostJob &job : *jobs) {
+            if (job.id == id) {
+                if (! job.cancelled) {
+                    job.cancelled = true;
+                    BOOST_LOG_TRIVIAL(debug) << boost::format("PrintHostJobQueue: Job id %1% cancelled") % id;
+                    p->emit_cancel(id);
+                }
+                return;
+            }
+        }
+    }
+
+    // Otherwise the job is currently being uploaded; let its progress callback abort it.
+    p->cancelled_ids.insert(id);
 }
 
 }
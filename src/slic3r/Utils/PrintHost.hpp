@@ -79,6 +79,9 @@ struct PrintHostJob
 {
     PrintHostUpload upload_data;
     std::unique_ptr<PrintHost> printhost;
+    // Queue-wide id, assigned by PrintHostJobQueue::enqueue(). Matches the row
+    // of this job in the queue dialog and the id passed to PrintHostJobQueue::cancel().
+    size_t id = 0;
     bool cancelled = false;
 
     PrintHostJob() {}
@@ -86,6 +89,7 @@ struct PrintHostJob
     PrintHostJob(PrintHostJob &&other)
         : upload_data(std::move(other.upload_data))
         , printhost(std::move(other.printhost))
+        , id(other.id)
         , cancelled(other.cancelled)
     {}
 
@@ -98,6 +102,7 @@ struct PrintHostJob
     {
         upload_data = std::move(other.upload_data);
         printhost = std::move(other.printhost);
+        id = other.id;
         cancelled = other.cancelled;
         return *this;
     }
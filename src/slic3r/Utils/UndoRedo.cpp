@@ -21,6 +21,8 @@
 #include <libslic3r/ObjectID.hpp>
 #include <libslic3r/Utils.hpp>
 
+#include "minilzo_extension.hpp"
+
 #include "slic3r/GUI/3DScene.hpp"
 #include <boost/foreach.hpp>
 
@@ -343,25 +345,67 @@ private:
 		// Reference counter of this data chunk. We may have used shared_ptr, but the shared_ptr is thread safe
 		// with the associated cost of CPU cache invalidation on refcount change.
 		size_t		refcnt;
+		// Number of bytes stored at data[]. If lower than uncompressed_size, the blob is LZO compressed.
 		size_t		size;
+		// Size of the original serialized blob. Equal to size if the blob is stored uncompressed.
+		size_t		uncompressed_size;
+		// First bytes of the original (uncompressed) blob, kept aside for the timestamp shortcut below.
+		char 		head[8];
 		char 		data[1];
 
+		bool 		compressed() const { return this->size != this->uncompressed_size; }
+
 		// The serialized data matches the data stored here.
-		bool 		matches(const std::string& rhs) { return this->size == rhs.size() && memcmp(this->data, rhs.data(), this->size) == 0; }
+		bool 		matches(const std::string& rhs) {
+			if (this->uncompressed_size != rhs.size())
+				return false;
+			if (! this->compressed())
+				return memcmp(this->data, rhs.data(), this->size) == 0;
+			if (memcmp(this->head, rhs.data(), std::min(sizeof(this->head), rhs.size())) != 0)
+				return false;
+			// Sizes and heads match, decompress and compare the full content. LZO decompression is cheap
+			// compared to the cereal serialization producing rhs.
+			std::string unpacked(this->uncompressed_size, 0);
+			uint64_t    unpacked_size = unpacked.size();
+			if (lzo_decompress((unsigned char*)this->data, this->size, (unsigned char*)unpacked.data(), &unpacked_size) != 0 ||
+				unpacked_size != this->uncompressed_size)
+				return false;
+			return memcmp(unpacked.data(), rhs.data(), unpacked_size) == 0;
+		}
 
 		// The timestamp matches the timestamp serialized in the data stored here.
-		bool 		matches_timestamp(uint64_t timestamp) { assert(timestamp > 0);  assert(this->size > 8); return memcmp(this->data, &timestamp, 8) == 0; }
+		bool 		matches_timestamp(uint64_t timestamp) { assert(timestamp > 0);  assert(this->uncompressed_size > 8); return memcmp(this->head, &timestamp, 8) == 0; }
 	};
 
+	// Snapshot blobs below this size are stored raw, the compression overhead is not worth it.
+	static constexpr const size_t compression_threshold = 1024;
+
 	Interval    m_interval;
 	Data	   *m_data;
 
 public:
 	MutableHistoryInterval(const Interval &interval, const std::string &input_data) : m_interval(interval), m_data(nullptr) {
-		m_data = (Data*)new char[offsetof(Data, data) + input_data.size()];
+		// Compress the serialized blob, so that the Undo / Redo stack memory limit accomodates more snapshots
+		// and the LRU eviction kicks in later. Worst case LZO1X expansion is input size / 16 + 67 bytes.
+		const char *stored_data = input_data.data();
+		size_t      stored_size = input_data.size();
+		std::string packed;
+		if (input_data.size() >= compression_threshold) {
+			packed.resize(input_data.size() + input_data.size() / 16 + 67);
+			uint64_t packed_size = packed.size();
+			if (lzo_compress((unsigned char*)input_data.data(), input_data.size(), (unsigned char*)packed.data(), &packed_size) == 0 &&
+				packed_size < input_data.size()) {
+				stored_data = packed.data();
+				stored_size = packed_size;
+			}
+		}
+		m_data = (Data*)new char[offsetof(Data, data) + stored_size];
 		m_data->refcnt = 1;
-		m_data->size = input_data.size();
-		memcpy(m_data->data, input_data.data(), input_data.size());
+		m_data->size = stored_size;
+		m_data->uncompressed_size = input_data.size();
+		memset(m_data->head, 0, sizeof(m_data->head));
+		memcpy(m_data->head, input_data.data(), std::min(sizeof(m_data->head), input_data.size()));
+		memcpy(m_data->data, stored_data, stored_size);
 	}
 
 	MutableHistoryInterval(const Interval &interval, MutableHistoryInterval &other) : m_interval(interval), m_data(other.m_data) {
@@ -392,6 +436,8 @@ public:
 
 	const char* data() const { return m_data->data; }
 	size_t  	size() const { return m_data->size; }
+	size_t  	uncompressed_size() const { return m_data->uncompressed_size; }
+	bool		compressed() const { return m_data->compressed(); }
 	size_t		refcnt() const { return m_data->refcnt; }
 	bool		matches(const std::string& data) { return m_data->matches(data); }
 	bool		matches_timestamp(uint64_t timestamp) { return m_data->matches_timestamp(timestamp); }
@@ -485,7 +531,15 @@ public:
 				--it;
 		}
 		//assert(timestamp >= it->begin() && timestamp < it->end());
-		return std::string(it->data(), it->data() + it->size());
+		if (! it->compressed())
+			return std::string(it->data(), it->data() + it->size());
+		// Materialize the snapshot lazily: the blob is only decompressed when this snapshot is being activated.
+		std::string unpacked(it->uncompressed_size(), 0);
+		uint64_t    unpacked_size = unpacked.size();
+		if (lzo_decompress((unsigned char*)it->data(), it->size(), (unsigned char*)unpacked.data(), &unpacked_size) != 0 ||
+			unpacked_size != it->uncompressed_size())
+			throw Slic3r::RuntimeError("Corrupted Undo / Redo snapshot data.");
+		return unpacked;
 	}
 
 	// Currently all mutable snapshots are mandatory.
@@ -0,0 +1,171 @@
+// Timed benchmarks for the slicing core, emitting one JSON document on stdout so the results
+// can be tracked per commit by external CI. Not a correctness suite; the catch2 tests cover that.
+//
+// Usage: slic3r_bench [--repetitions N] [--filter substring]
+//
+// Each benchmark is run N times (default 5) after one warm-up iteration; the minimum and the
+// median wall-clock times are reported. Google Benchmark is deliberately not used, it is not
+// part of the dependency bundle; the hand-rolled runner below is sufficient for trend tracking.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "libslic3r/libslic3r.h"
+#include "libslic3r/ClipperUtils.hpp"
+#include "libslic3r/ExPolygon.hpp"
+#include "libslic3r/Fill/Fill.hpp"
+#include "libslic3r/Flow.hpp"
+#include "libslic3r/Polygon.hpp"
+#include "libslic3r/Surface.hpp"
+#include "libslic3r/TriangleMesh.hpp"
+#include "libslic3r/TriangleMeshSlicer.hpp"
+
+using namespace Slic3r;
+
+namespace {
+
+struct BenchResult {
+    std::string name;
+    double      min_ms;
+    double      median_ms;
+    size_t      repetitions;
+};
+
+class BenchRunner {
+public:
+    BenchRunner(size_t repetitions, std::string filter)
+        : m_repetitions(repetitions), m_filter(std::move(filter)) {}
+
+    void run(const std::string &name, const std::function<void()> &fn)
+    {
+        if (! m_filter.empty() && name.find(m_filter) == std::string::npos)
+            return;
+        // Warm up caches and lazy initializations outside of the measurement.
+        fn();
+        std::vector<double> samples;
+        samples.reserve(m_repetitions);
+        for (size_t i = 0; i < m_repetitions; ++ i) {
+            auto start = std::chrono::steady_clock::now();
+            fn();
+            auto end   = std::chrono::steady_clock::now();
+            samples.emplace_back(std::chrono::duration<double, std::milli>(end - start).count());
+        }
+        std::sort(samples.begin(), samples.end());
+        m_results.push_back({ name, samples.front(), samples[samples.size() / 2], m_repetitions });
+        std::fprintf(stderr, "%-48s min %10.3f ms   median %10.3f ms\n",
+                     name.c_str(), m_results.back().min_ms, m_results.back().median_ms);
+    }
+
+    void print_json() const
+    {
+        std::printf("{\n  \"benchmarks\": [\n");
+        for (size_t i = 0; i < m_results.size(); ++ i) {
+            const BenchResult &r = m_results[i];
+            std::printf("    {\"name\": \"%s\", \"min_ms\": %.4f, \"median_ms\": %.4f, \"repetitions\": %zu}%s\n",
+                        r.name.c_str(), r.min_ms, r.median_ms, r.repetitions,
+                        i + 1 == m_results.size() ? "" : ",");
+        }
+        std::printf("  ]\n}\n");
+    }
+
+private:
+    size_t                   m_repetitions;
+    std::string              m_filter;
+    std::vector<BenchResult> m_results;
+};
+
+// A comb-shaped polygon with the requested number of teeth, side mm wide. Produces the kind of
+// long, thin features that stress both the Clipper offsetting and the rectilinear scan lines.
+ExPolygon make_comb(size_t teeth, double side)
+{
+    Points pts;
+    pts.reserve(teeth * 4 + 4);
+    const double pitch = side / double(teeth);
+    pts.emplace_back(Point::new_scale(0., 0.));
+    pts.emplace_back(Point::new_scale(side, 0.));
+    for (size_t i = 0; i < teeth; ++ i) {
+        const double x1 = side - double(i) * pitch;
+        const double x0 = x1 - 0.6 * pitch;
+        pts.emplace_back(Point::new_scale(x1, side));
+        pts.emplace_back(Point::new_scale(x1 - 0.3 * pitch, side));
+        pts.emplace_back(Point::new_scale(x1 - 0.3 * pitch, 0.2 * side));
+        pts.emplace_back(Point::new_scale(x0, 0.2 * side));
+        pts.emplace_back(Point::new_scale(x0, side));
+    }
+    pts.emplace_back(Point::new_scale(0., side));
+    return ExPolygon(pts);
+}
+
+void bench_slice_mesh(BenchRunner &runner)
+{
+    // Tessellation density of the sphere drives the facet count: fa is the angular step.
+    for (double fa : { 2. * PI / 90., 2. * PI / 360., 2. * PI / 1440. }) {
+        indexed_triangle_set its = its_make_sphere(25., fa);
+        std::vector<float> zs;
+        for (float z = 0.1f; z < 50.f; z += 0.08f)
+            zs.emplace_back(z);
+        runner.run("slice_mesh/facets=" + std::to_string(its.indices.size()),
+                   [&its, &zs] { slice_mesh_ex(its, zs, MeshSlicingParamsEx {}); });
+    }
+}
+
+void bench_clipper_offset(BenchRunner &runner)
+{
+    for (size_t teeth : { 100, 1000, 10000 }) {
+        ExPolygon comb   = make_comb(teeth, 200.);
+        Polygons  subject = to_polygons(comb);
+        runner.run("clipper_offset/vertices=" + std::to_string(comb.contour.points.size()),
+                   [&subject] { offset(subject, scaled<float>(0.2)); });
+        runner.run("clipper_union/vertices=" + std::to_string(comb.contour.points.size()),
+                   [&subject] { union_ex(subject); });
+    }
+}
+
+void bench_fill_rectilinear(BenchRunner &runner)
+{
+    for (float density : { 0.15f, 0.4f, 1.f }) {
+        std::unique_ptr<Fill> filler(Fill::new_from_type("rectilinear"));
+        filler->angle   = float(- PI / 2.);
+        filler->spacing = 0.4;
+        FillParams fill_params;
+        fill_params.density     = density;
+        fill_params.dont_adjust = true;
+        ExPolygon comb = make_comb(200, 200.);
+        Surface   surface(stBottom, comb);
+        runner.run("fill_rectilinear/density=" + std::to_string(density),
+                   [&filler, &surface, &fill_params] { filler->fill_surface(&surface, fill_params); });
+    }
+}
+
+} // namespace
+
+// PerimeterGenerator::process() is not benchmarked here: it needs a fully applied Print with
+// Layer/LayerRegion plumbing, which would turn this micro harness into an integration test.
+// Use the fff_print suite fixtures for that level.
+int main(int argc, char **argv)
+{
+    size_t      repetitions = 5;
+    std::string filter;
+    for (int i = 1; i < argc; ++ i) {
+        if (std::strcmp(argv[i], "--repetitions") == 0 && i + 1 < argc)
+            repetitions = size_t(std::atoi(argv[++ i]));
+        else if (std::strcmp(argv[i], "--filter") == 0 && i + 1 < argc)
+            filter = argv[++ i];
+        else {
+            std::fprintf(stderr, "usage: %s [--repetitions N] [--filter substring]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    BenchRunner runner(repetitions, filter);
+    bench_slice_mesh(runner);
+    bench_clipper_offset(runner);
+    bench_fill_rectilinear(runner);
+    runner.print_json();
+    return 0;
+}
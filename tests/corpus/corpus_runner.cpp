@@ -0,0 +1,258 @@
+// Corpus regression runner: slices a directory of (model, config) pairs through the full
+// FFF pipeline, records wall-clock timings of the load / apply / process / export steps and
+// a fingerprint of the emitted G-code, and optionally diffs the fingerprints against a
+// committed goldens file. Complements the catch2 suites, which assert on small synthetic
+// scenes: this tool scales to an arbitrary corpus of real projects and catches both output
+// drift and performance regressions. Not run by ctest; the corpus is provided by the user.
+//
+// Usage: corpus_runner <corpus_dir> [options]
+//   --goldens <file>   compare fingerprints against <file>, exit nonzero on any mismatch
+//   --update <file>    write the fingerprints of this run to <file>
+//   --filter <substr>  only run cases whose name contains <substr>
+//   --shard <i>/<n>    run every n-th case starting at i (0-based)
+//
+// A case is a model file (3mf, stl, obj, amf) with a config of the same stem next to it
+// (lamp.3mf + lamp.json or lamp.ini), applied on top of the full default print config.
+// Models are expected to be print-ready projects; instances are not rearranged. The slicing
+// core parallelizes internally via TBB, so cases run one at a time here; to use several
+// processes, have the harness spawn one runner per shard (--shard 0/4 .. 3/4).
+//
+// The fingerprint is a 64-bit FNV-1a over the G-code with comment-only lines skipped, as
+// comments carry timestamps and version strings that differ run to run.
+//
+// Results are printed as one JSON document on stdout, progress on stderr.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <boost/filesystem.hpp>
+#include <boost/nowide/fstream.hpp>
+
+#include "libslic3r/libslic3r.h"
+#include "libslic3r/Config.hpp"
+#include "libslic3r/Model.hpp"
+#include "libslic3r/Print.hpp"
+#include "libslic3r/PrintConfig.hpp"
+
+using namespace Slic3r;
+
+namespace {
+
+struct CaseResult {
+    std::string name;
+    double      load_ms    = 0.;
+    double      apply_ms   = 0.;
+    double      process_ms = 0.;
+    double      export_ms  = 0.;
+    std::string fingerprint;
+    std::string error;
+};
+
+double elapsed_ms(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+// FNV-1a over the G-code, comment-only lines skipped.
+std::string fingerprint_gcode_file(const std::string &path)
+{
+    boost::nowide::ifstream file(path, boost::nowide::ifstream::binary);
+    uint64_t    hash = 0xcbf29ce484222325ull;
+    std::string line;
+    while (std::getline(file, line)) {
+        size_t content = line.find_first_not_of(" \t");
+        if (content == std::string::npos || line[content] == ';')
+            continue;
+        for (char c : line)
+            hash = (hash ^ uint64_t(uint8_t(c))) * 0x100000001b3ull;
+        hash = (hash ^ uint64_t('\n')) * 0x100000001b3ull;
+    }
+    char buf[17];
+    std::snprintf(buf, sizeof(buf), "%016llx", (unsigned long long)hash);
+    return buf;
+}
+
+CaseResult run_case(const std::string &name, const std::string &model_path, const std::string &config_path)
+{
+    CaseResult result;
+    result.name = name;
+    try {
+        auto start = std::chrono::steady_clock::now();
+        DynamicPrintConfig config = DynamicPrintConfig::full_print_config();
+        config.load(config_path, ForwardCompatibilitySubstitutionRule::EnableSilent);
+        Model model = Model::read_from_file(model_path, &config);
+        result.load_ms = elapsed_ms(start);
+
+        start = std::chrono::steady_clock::now();
+        Print print;
+        for (ModelObject *mo : model.objects) {
+            mo->ensure_on_bed();
+            print.auto_assign_extruders(mo);
+        }
+        print.apply(model, config);
+        print.validate();
+        print.set_status_silent();
+        result.apply_ms = elapsed_ms(start);
+
+        start = std::chrono::steady_clock::now();
+        print.process();
+        result.process_ms = elapsed_ms(start);
+
+        start = std::chrono::steady_clock::now();
+        boost::filesystem::path temp = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path();
+        print.export_gcode(temp.string(), nullptr, nullptr);
+        result.export_ms = elapsed_ms(start);
+
+        result.fingerprint = fingerprint_gcode_file(temp.string());
+        boost::system::error_code ec;
+        boost::filesystem::remove(temp, ec);
+    } catch (const std::exception &ex) {
+        result.error = ex.what();
+    }
+    return result;
+}
+
+std::map<std::string, std::string> read_goldens(const std::string &path)
+{
+    std::map<std::string, std::string> goldens;
+    boost::nowide::ifstream file(path);
+    std::string fingerprint, name;
+    while (file >> fingerprint && std::getline(file, name)) {
+        size_t content = name.find_first_not_of(" \t");
+        if (content != std::string::npos)
+            goldens[name.substr(content)] = fingerprint;
+    }
+    return goldens;
+}
+
+} // namespace
+
+int main(int argc, char *argv[])
+{
+    std::string corpus_dir;
+    std::string goldens_path;
+    std::string update_path;
+    std::string filter;
+    size_t      shard_index = 0;
+    size_t      shard_count = 1;
+
+    for (int i = 1; i < argc; ++ i) {
+        if (std::strcmp(argv[i], "--goldens") == 0 && i + 1 < argc)
+            goldens_path = argv[++ i];
+        else if (std::strcmp(argv[i], "--update") == 0 && i + 1 < argc)
+            update_path = argv[++ i];
+        else if (std::strcmp(argv[i], "--filter") == 0 && i + 1 < argc)
+            filter = argv[++ i];
+        else if (std::strcmp(argv[i], "--shard") == 0 && i + 1 < argc) {
+            unsigned long long idx = 0, cnt = 1;
+            if (std::sscanf(argv[++ i], "%llu/%llu", &idx, &cnt) != 2 || cnt == 0 || idx >= cnt) {
+                std::fprintf(stderr, "invalid --shard, expected <i>/<n> with i < n\n");
+                return 2;
+            }
+            shard_index = size_t(idx);
+            shard_count = size_t(cnt);
+        } else if (corpus_dir.empty())
+            corpus_dir = argv[i];
+        else {
+            std::fprintf(stderr, "unknown argument: %s\n", argv[i]);
+            return 2;
+        }
+    }
+    if (corpus_dir.empty()) {
+        std::fprintf(stderr, "usage: corpus_runner <corpus_dir> [--goldens <file>] [--update <file>] [--filter <substr>] [--shard <i>/<n>]\n");
+        return 2;
+    }
+
+    // Collect the cases, sorted by name so that sharding is stable across runs.
+    struct Case { std::string name, model_path, config_path; };
+    std::vector<Case> cases;
+    for (const auto &entry : boost::filesystem::directory_iterator(corpus_dir)) {
+        if (! boost::filesystem::is_regular_file(entry.status()))
+            continue;
+        const boost::filesystem::path &path = entry.path();
+        std::string ext = path.extension().string();
+        std::transform(ext.begin(), ext.end(), ext.begin(), [](unsigned char c) { return std::tolower(c); });
+        if (ext != ".3mf" && ext != ".stl" && ext != ".obj" && ext != ".amf")
+            continue;
+        std::string config_path;
+        for (const char *config_ext : { ".json", ".ini" }) {
+            boost::filesystem::path candidate = path;
+            candidate.replace_extension(config_ext);
+            if (boost::filesystem::exists(candidate)) {
+                config_path = candidate.string();
+                break;
+            }
+        }
+        if (config_path.empty()) {
+            std::fprintf(stderr, "skipping %s: no .json / .ini config with the same stem\n", path.filename().string().c_str());
+            continue;
+        }
+        cases.push_back({ path.stem().string(), path.string(), config_path });
+    }
+    std::sort(cases.begin(), cases.end(), [](const Case &l, const Case &r) { return l.name < r.name; });
+
+    std::vector<CaseResult> results;
+    for (size_t i = 0; i < cases.size(); ++ i) {
+        if (i % shard_count != shard_index)
+            continue;
+        if (! filter.empty() && cases[i].name.find(filter) == std::string::npos)
+            continue;
+        std::fprintf(stderr, "slicing %s ...\n", cases[i].name.c_str());
+        results.emplace_back(run_case(cases[i].name, cases[i].model_path, cases[i].config_path));
+        const CaseResult &r = results.back();
+        if (r.error.empty())
+            std::fprintf(stderr, "%-32s load %8.1f ms  apply %8.1f ms  process %10.1f ms  export %10.1f ms  %s\n",
+                         r.name.c_str(), r.load_ms, r.apply_ms, r.process_ms, r.export_ms, r.fingerprint.c_str());
+        else
+            std::fprintf(stderr, "%-32s FAILED: %s\n", r.name.c_str(), r.error.c_str());
+    }
+
+    std::printf("{\n  \"cases\": [\n");
+    for (size_t i = 0; i < results.size(); ++ i) {
+        const CaseResult &r = results[i];
+        if (r.error.empty())
+            std::printf("    {\"name\": \"%s\", \"load_ms\": %.1f, \"apply_ms\": %.1f, \"process_ms\": %.1f, \"export_ms\": %.1f, \"fingerprint\": \"%s\"}%s\n",
+                        r.name.c_str(), r.load_ms, r.apply_ms, r.process_ms, r.export_ms, r.fingerprint.c_str(),
+                        i + 1 == results.size() ? "" : ",");
+        else
+            std::printf("    {\"name\": \"%s\", \"error\": \"%s\"}%s\n",
+                        r.name.c_str(), r.error.c_str(), i + 1 == results.size() ? "" : ",");
+    }
+    std::printf("  ]\n}\n");
+
+    int exit_code = 0;
+    for (const CaseResult &r : results)
+        if (! r.error.empty())
+            exit_code = 1;
+
+    if (! update_path.empty()) {
+        boost::nowide::ofstream file(update_path);
+        for (const CaseResult &r : results)
+            if (r.error.empty())
+                file << r.fingerprint << " " << r.name << "\n";
+        std::fprintf(stderr, "wrote %zu fingerprints to %s\n", results.size(), update_path.c_str());
+    }
+
+    if (! goldens_path.empty()) {
+        std::map<std::string, std::string> goldens = read_goldens(goldens_path);
+        for (const CaseResult &r : results) {
+            if (! r.error.empty())
+                continue;
+            auto it = goldens.find(r.name);
+            if (it == goldens.end()) {
+                std::fprintf(stderr, "NO GOLDEN  %s (%s)\n", r.name.c_str(), r.fingerprint.c_str());
+                exit_code = 1;
+            } else if (it->second != r.fingerprint) {
+                std::fprintf(stderr, "MISMATCH   %s: golden %s, got %s\n", r.name.c_str(), it->second.c_str(), r.fingerprint.c_str());
+                exit_code = 1;
+            }
+        }
+    }
+
+    return exit_code;
+}
@@ -0,0 +1,99 @@
+#include <catch2/catch.hpp>
+
+#include "libslic3r/ClipperUtils.hpp"
+#include "libslic3r/Clipper2Utils.hpp"
+#include "libslic3r/ExPolygon.hpp"
+
+using namespace Slic3r;
+
+// Conformance of the Clipper2 backed booleans (Clipper2Utils) against the legacy
+// clipper.cpp entry points of ClipperUtils. The engines are free to start their output
+// contours at different vertices, thus the results are compared by area after a
+// normalizing union instead of by point lists.
+static double polygons_area(const Polygons &polygons)
+{
+    double area = 0.;
+    for (const ExPolygon &expolygon : union_ex(polygons))
+        area += expolygon.area();
+    return area;
+}
+
+SCENARIO("Clipper2 booleans match the legacy engine", "[Clipper2Utils]") {
+    // CCW oriented contour
+    Slic3r::Polygon square         { { 200, 100 }, { 200, 200 }, { 100, 200 }, { 100, 100 } };
+    // CW oriented contour
+    Slic3r::Polygon hole_in_square { { 160, 140 }, { 140, 140 }, { 140, 160 }, { 160, 160 } };
+    // CCW oriented contour partially overlapping the square
+    Slic3r::Polygon overlapping    { { 250, 150 }, { 250, 250 }, { 150, 250 }, { 150, 150 } };
+
+    GIVEN("square with hole and an overlapping square") {
+        Polygons subject { square, hole_in_square };
+        Polygons clip    { overlapping };
+        WHEN("union_2") {
+            Polygons result = union_2(subject);
+            THEN("result matches union_") {
+                REQUIRE(result.size() == union_(subject).size());
+                REQUIRE(polygons_area(result) == Approx(polygons_area(union_(subject))));
+            }
+        }
+        WHEN("diff_2") {
+            Polygons result = diff_2(subject, clip);
+            THEN("result matches diff") {
+                REQUIRE(polygons_area(result) == Approx(polygons_area(diff(subject, clip))));
+            }
+        }
+        WHEN("intersection_2") {
+            Polygons result = intersection_2(subject, clip);
+            THEN("result matches intersection") {
+                REQUIRE(polygons_area(result) == Approx(polygons_area(intersection(subject, clip))));
+            }
+        }
+        WHEN("diff_2 with multiple clips") {
+            Polygons clip2 { { { 120, 90 }, { 130, 90 }, { 130, 210 }, { 120, 210 } } };
+            Polygons clips = clip;
+            append(clips, clip2);
+            Polygons result = diff_2(subject, clips);
+            THEN("result matches the fused multi-operand diff") {
+                REQUIRE(polygons_area(result) == Approx(polygons_area(diff(subject, { &clip, &clip2 }))));
+            }
+        }
+    }
+
+    GIVEN("empty operands") {
+        WHEN("diff_2 with empty clip") {
+            Polygons result = diff_2({ square }, {});
+            THEN("subject is returned unchanged") {
+                REQUIRE(polygons_area(result) == Approx(polygons_area({ square })));
+            }
+        }
+        WHEN("intersection_2 with empty subject") {
+            Polygons result = intersection_2({}, { square });
+            THEN("result is empty") {
+                REQUIRE(result.empty());
+            }
+        }
+    }
+}
+
+SCENARIO("Clipper2 offsetting matches the legacy engine", "[Clipper2Utils]") {
+    // CCW oriented contour
+    Slic3r::Polygon square         { { 20000, 10000 }, { 20000, 20000 }, { 10000, 20000 }, { 10000, 10000 } };
+    // CW oriented contour
+    Slic3r::Polygon hole_in_square { { 16000, 14000 }, { 14000, 14000 }, { 14000, 16000 }, { 16000, 16000 } };
+
+    GIVEN("square with hole") {
+        Polygons subject { square, hole_in_square };
+        WHEN("expanded by offset_2") {
+            Polygons result = offset_2(subject, 500.);
+            THEN("result matches offset with the default miter join") {
+                REQUIRE(polygons_area(result) == Approx(polygons_area(offset(subject, 500.f))));
+            }
+        }
+        WHEN("shrunk by offset_2") {
+            Polygons result = offset_2(subject, -500.);
+            THEN("result matches offset with the default miter join") {
+                REQUIRE(polygons_area(result) == Approx(polygons_area(offset(subject, -500.f))));
+            }
+        }
+    }
+}
@@ -136,6 +136,84 @@ TEST_CASE("Mutable priority queue - basic tests", "[MutableSkipHeapPriorityQueue
     }
 }
 
+TEST_CASE("Mutable priority queue - 4-ary heap", "[MutablePriorityQueue]") {
+    auto make_dary_test_priority_queue = []() {
+        return make_dary_mutable_priority_queue<ValueIndexPair, 4, false>(
+            [](ValueIndexPair &v, size_t idx){ v.idx = idx; },
+            [](ValueIndexPair &l, ValueIndexPair &r){ return l.value < r.value; });
+    };
+    SECTION("randomly inserted elements are popped sorted") {
+        auto q = make_dary_test_priority_queue();
+        std::random_device rd;
+        std::mt19937 gen(rd());
+        std::uniform_int_distribution<> dist(1, 100000);
+        int n[36000];
+        for (auto& i : n) {
+            i = dist(gen);
+            q.push({ i });
+        }
+
+        REQUIRE(!q.empty());
+        REQUIRE(q.size() == 36000);
+        std::sort(std::begin(n), std::end(n));
+        for (auto i : n) {
+            REQUIRE(q.top().value == i);
+            q.pop();
+        }
+        REQUIRE(q.empty());
+    }
+    SECTION("bulk heapify gives the same order as a sequence of pushes") {
+        auto q = make_dary_test_priority_queue();
+        std::random_device rd;
+        std::mt19937 gen(rd());
+        std::uniform_int_distribution<> dist(1, 100000);
+        int n[36000];
+        q.reserve(std::size(n));
+        for (auto& i : n) {
+            i = dist(gen);
+            q.push_unsorted({ i });
+        }
+        q.heapify();
+
+        REQUIRE(q.size() == 36000);
+        std::sort(std::begin(n), std::end(n));
+        for (auto i : n) {
+            REQUIRE(q.top().value == i);
+            q.pop();
+        }
+        REQUIRE(q.empty());
+    }
+    SECTION("bulk heapify keeps the element indices valid") {
+        struct MyValue {
+            size_t id;
+            float  val;
+        };
+        size_t              count = 5000;
+        std::vector<size_t> idxs(count, {0});
+        auto q = make_dary_mutable_priority_queue<MyValue, 4, false>(
+            [&](MyValue &v, size_t idx) { idxs[v.id] = idx; },
+            [](MyValue &l, MyValue &r) { return l.val < r.val; });
+        q.reserve(count);
+        for (size_t id = 0; id < count; ++ id)
+            q.push_unsorted({ id, float(rand() % 53) / 10.f });
+        q.heapify();
+        for (size_t id = 0; id < count; ++ id)
+            REQUIRE(q[idxs[id]].id == id);
+        // Reschedule a few elements through the stored indices.
+        for (size_t i = 0; i < 100; ++ i) {
+            size_t id = rand() % count;
+            q[idxs[id]].val = float(rand() % 53) / 10.f;
+            q.update(idxs[id]);
+        }
+        float last = -1.f;
+        while (! q.empty()) {
+            REQUIRE(q.top().val >= last);
+            last = q.top().val;
+            q.pop();
+        }
+    }
+}
+
 TEST_CASE("Mutable priority queue - reshedule first", "[MutableSkipHeapPriorityQueue]") {
     struct MyValue {
         int    value;